@@ -28,7 +28,7 @@ namespace urchin {
                     triangleMeshPoints.emplace_back(navPolygon->getPoints()[triangle->getIndex(1)]);
                     triangleMeshPoints.emplace_back(navPolygon->getPoints()[triangle->getIndex(2)]);
 
-                    for (const auto& link : triangle->getLinks()) {
+                    for (const auto& link : navMesh.getLinks(*triangle)) {
                         if (link->getLinkType() == JUMP) {
                             LineSegment3D<float> endEdge = link->getTargetTriangle()->computeEdge(link->getLinkConstraint()->getTargetEdgeIndex());
                             LineSegment3D<float> constrainedStartEdge = link->getLinkConstraint()->computeSourceJumpEdge(triangle->computeEdge(link->getSourceEdgeIndex()));
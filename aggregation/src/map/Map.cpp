@@ -198,8 +198,12 @@ namespace urchin {
             aiEnvironment->checkNoExceptionRaised();
         }
 
-        for (const auto& objectEntity : objectEntities) {
-            objectEntity->refresh();
+        if (physicsWorld) {
+            const BodiesSnapshot& bodiesSnapshot = physicsWorld->getBodyContainer().getLatestSnapshot();
+            float interpolationFactor = physicsWorld->computeInterpolationFactor();
+            for (const auto& objectEntity : objectEntities) {
+                objectEntity->refresh(bodiesSnapshot, interpolationFactor);
+            }
         }
 
         for (const auto& terrainEntity : terrainEntities) {
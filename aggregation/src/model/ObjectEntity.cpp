@@ -11,7 +11,8 @@ namespace urchin {
             soundEnvironment(nullptr),
             aiEnvironment(nullptr),
             rigidBody(nullptr),
-            aiObject(nullptr) {
+            aiObject(nullptr),
+            rigidBodyWasActive(false) {
 
     }
 
@@ -254,9 +255,18 @@ namespace urchin {
         updateTransform(Transform(model->getTransform().getPosition(), model->getTransform().getOrientation(), newScale));
     }
 
-    void ObjectEntity::refresh() const {
-        if (rigidBody && rigidBody->isActive()) {
-            PhysicsTransform physicsTransform = rigidBody->getTransform();
+    /**
+     * @param bodiesSnapshot Last published snapshot of the physics bodies
+     * @param interpolationFactor Interpolation factor between the previous and the current transforms of the bodies
+     */
+    void ObjectEntity::refresh(const BodiesSnapshot& bodiesSnapshot, float interpolationFactor) const {
+        if (!rigidBody) {
+            return;
+        }
+        const BodySnapshot* bodySnapshot = bodiesSnapshot.findBody(*rigidBody);
+        if (bodySnapshot && (bodySnapshot->isActive || rigidBodyWasActive)) {
+            rigidBodyWasActive = bodySnapshot->isActive;
+            PhysicsTransform physicsTransform = bodySnapshot->interpolateTransform(interpolationFactor); //no interpolation for deactivated body: display final transform
             model->setTransform(Transform(physicsTransform.getPosition(), physicsTransform.getOrientation(), model->getTransform().getScale()));
             if (aiObject) {
                 aiObject->updateTransform(physicsTransform.getPosition(), physicsTransform.getOrientation());
@@ -43,7 +43,7 @@ namespace urchin {
             void updateOrientation(const Quaternion<float>&);
             void updateScale(const Vector3<float>&);
 
-            void refresh() const;
+            void refresh(const BodiesSnapshot&, float) const;
 
         private:
             void setup(Renderer3d*, PhysicsWorld*, SoundEnvironment*, AIEnvironment*);
@@ -66,6 +66,7 @@ namespace urchin {
             std::shared_ptr<Light> light;
             std::shared_ptr<SoundComponent> soundComponent;
             std::shared_ptr<AIObject> aiObject;
+            mutable bool rigidBodyWasActive;
     };
 
 }
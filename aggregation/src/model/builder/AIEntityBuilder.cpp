@@ -30,7 +30,15 @@ namespace urchin {
 
         if (shape.getShapeType() == CollisionShape3D::ShapeType::HEIGHTFIELD_SHAPE) {
             const auto& scaledHeightfieldShape = static_cast<const CollisionHeightfieldShape&>(shape);
-            return std::make_shared<AITerrain>(std::move(name), transform, false, scaledHeightfieldShape.getVertices(), scaledHeightfieldShape.getXLength(), scaledHeightfieldShape.getZLength());
+            std::vector<float> localHeights;
+            localHeights.reserve((std::size_t)scaledHeightfieldShape.getXLength() * scaledHeightfieldShape.getZLength());
+            for (unsigned int z = 0; z < scaledHeightfieldShape.getZLength(); ++z) {
+                for (unsigned int x = 0; x < scaledHeightfieldShape.getXLength(); ++x) {
+                    localHeights.push_back(scaledHeightfieldShape.getHeight(x, z));
+                }
+            }
+            return std::make_shared<AITerrain>(std::move(name), transform, false, std::move(localHeights), scaledHeightfieldShape.getXLength(), scaledHeightfieldShape.getZLength(),
+                                               scaledHeightfieldShape.getGridOrigin(), scaledHeightfieldShape.getCellSize());
         } else {
             throw std::invalid_argument("Unknown terrain shape type: " + std::string(typeid(shape).name()));
         }
@@ -2,7 +2,6 @@
 #include <UrchinCommon.h>
 
 #include "AIEnvironment.h"
-#include "path/pathfinding/PathfindingAStar.h"
 
 namespace urchin {
 
@@ -14,7 +13,11 @@ namespace urchin {
             aiSimulationStopper(false),
             timeStep(0),
             paused(true),
-            navMeshGenerator(NavMeshGenerator()) {
+            navMeshGenerator(NavMeshGenerator()),
+            pathRequestScheduler(ConfigService::instance().getFloatValue("pathfinding.replanTolerance"),
+                                 ConfigService::instance().getFloatValue("pathfinding.updateTimeBudget"),
+                                 ConfigService::instance().getUnsignedIntValue("pathfinding.maxCachedPaths"),
+                                 ConfigService::instance().getUnsignedIntValue("pathfinding.priorityAgingUpdates")) {
         SignalHandler::instance().initialize();
     }
 
@@ -152,12 +155,8 @@ namespace urchin {
 
         //AI execution
         if (!paused) {
-            std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
-
-            PathfindingAStar pathfindingAStar(navMesh);
-            for (const auto& pathRequest : copiedPathRequests) {
-                pathRequest->setPath(pathfindingAStar.findPath(pathRequest->getStartPoint(), pathRequest->getEndPoint()));
-            }
+            std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generateInBackground(aiWorld);
+            pathRequestScheduler.update(navMesh, copiedPathRequests);
         }
     }
 
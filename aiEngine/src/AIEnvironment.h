@@ -8,6 +8,7 @@
 #include "input/AIWorld.h"
 #include "input/AIEntity.h"
 #include "path/PathRequest.h"
+#include "path/PathRequestScheduler.h"
 #include "path/navmesh/NavMeshGenerator.h"
 
 namespace urchin {
@@ -51,6 +52,7 @@ namespace urchin {
             AIWorld aiWorld;
             std::vector<std::shared_ptr<PathRequest>> pathRequests;
             std::vector<std::shared_ptr<PathRequest>> copiedPathRequests;
+            PathRequestScheduler pathRequestScheduler;
     };
 
 }
@@ -12,12 +12,14 @@
 #include "path/navmesh/model/output/NavMesh.h"
 #include "path/navmesh/model/output/NavPolygon.h"
 #include "path/navmesh/model/output/NavPolygonEdge.h"
+#include "path/navmesh/model/output/NavTriangleLinks.h"
 #include "path/navmesh/model/output/NavTriangle.h"
 #include "path/navmesh/model/output/NavLink.h"
 #include "path/pathfinding/FunnelAlgorithm.h"
 #include "path/pathfinding/PathPortal.h"
 #include "path/pathfinding/PathfindingAStar.h"
 #include "path/PathRequest.h"
+#include "path/PathRequestScheduler.h"
 #include "path/PathPoint.h"
 
 #include "character/AICharacter.h"
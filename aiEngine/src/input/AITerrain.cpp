@@ -1,21 +1,32 @@
 #include <utility>
+#include <cassert>
 
 #include "input/AITerrain.h"
 
 namespace urchin {
-    AITerrain::AITerrain(std::string name, const Transform<float>& transform, bool bIsObstacleCandidate,
-                         std::vector<Point3<float>> localVertices, unsigned int xLength, unsigned int zLength) :
-            AIEntity(std::move(name), transform, bIsObstacleCandidate),
-            localVertices(std::move(localVertices)), xLength(xLength), zLength(zLength) {
 
+    /**
+     * @param localHeights Heights of the grid vertices ordered by rows of 'xLength' vertices
+     * @param gridOrigin Position on the XZ plane of the first vertex of the grid
+     * @param cellSize Distance between two vertices of the grid on the X and Z axis
+     */
+    AITerrain::AITerrain(std::string name, const Transform<float>& transform, bool bIsObstacleCandidate, std::vector<float> localHeights,
+                         unsigned int xLength, unsigned int zLength, const Point2<float>& gridOrigin, const Vector2<float>& cellSize) :
+            AIEntity(std::move(name), transform, bIsObstacleCandidate),
+            localHeights(std::move(localHeights)), xLength(xLength), zLength(zLength), gridOrigin(gridOrigin), cellSize(cellSize) {
+        assert(this->localHeights.size() == (std::size_t)xLength * zLength);
     }
 
     AIEntity::AIEntityType AITerrain::getType() const {
         return TERRAIN;
     }
 
-    const std::vector<Point3<float>>& AITerrain::getLocalVertices() const {
-        return localVertices;
+    float AITerrain::getLocalHeight(unsigned int x, unsigned int z) const {
+        return localHeights[x + xLength * z];
+    }
+
+    Point3<float> AITerrain::getLocalVertex(unsigned int x, unsigned int z) const {
+        return Point3<float>(gridOrigin.X + (float)x * cellSize.X, getLocalHeight(x, z), gridOrigin.Y + (float)z * cellSize.Y);
     }
 
     unsigned int AITerrain::getXLength() const {
@@ -7,20 +7,26 @@
 
 namespace urchin {
 
+    /**
+    * Terrain defined by the heights of a regular grid in local space
+    */
     class AITerrain final : public AIEntity {
         public:
-            AITerrain(std::string, const Transform<float>&, bool, std::vector<Point3<float>>, unsigned int, unsigned int);
+            AITerrain(std::string, const Transform<float>&, bool, std::vector<float>, unsigned int, unsigned int, const Point2<float>&, const Vector2<float>&);
 
             AIEntityType getType() const override;
 
-            const std::vector<Point3<float>>& getLocalVertices() const;
+            float getLocalHeight(unsigned int, unsigned int) const;
+            Point3<float> getLocalVertex(unsigned int, unsigned int) const;
             unsigned int getXLength() const;
             unsigned int getZLength() const;
 
         private:
-            std::vector<Point3<float>> localVertices;
+            std::vector<float> localHeights;
             unsigned int xLength;
             unsigned int zLength;
+            Point2<float> gridOrigin;
+            Vector2<float> cellSize;
     };
 
 }
@@ -4,18 +4,41 @@ namespace urchin {
     PathRequest::PathRequest(const Point3<float>& startPoint, const Point3<float>& endPoint) :
             startPoint(startPoint),
             endPoint(endPoint),
+            priority(0),
             bIsPathReady(false) {
 
     }
 
-    const Point3<float>& PathRequest::getStartPoint() const {
+    /**
+     * Update the start and end points of the request. The path is re-planned only when a point moved more than the re-plan tolerance.
+     */
+    void PathRequest::updatePoints(const Point3<float>& startPoint, const Point3<float>& endPoint) {
+        std::scoped_lock lock(mutex);
+        this->startPoint = startPoint;
+        this->endPoint = endPoint;
+    }
+
+    Point3<float> PathRequest::getStartPoint() const {
+        std::scoped_lock lock(mutex);
         return startPoint;
     }
 
-    const Point3<float>& PathRequest::getEndPoint() const {
+    Point3<float> PathRequest::getEndPoint() const {
+        std::scoped_lock lock(mutex);
         return endPoint;
     }
 
+    /**
+     * @param priority Requests with the highest priority are planned first when the time budget of an AI update does not allow to plan all the requests
+     */
+    void PathRequest::setPriority(int priority) {
+        this->priority.store(priority, std::memory_order_relaxed);
+    }
+
+    int PathRequest::getPriority() const {
+        return priority.load(std::memory_order_relaxed);
+    }
+
     void PathRequest::setPath(const std::vector<PathPoint>& path) {
         {
             std::scoped_lock lock(mutex);
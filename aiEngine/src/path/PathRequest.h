@@ -12,18 +12,23 @@ namespace urchin {
         public:
             PathRequest(const Point3<float>&, const Point3<float>&);
 
-            const Point3<float>& getStartPoint() const;
-            const Point3<float>& getEndPoint() const;
+            void updatePoints(const Point3<float>&, const Point3<float>&);
+            Point3<float> getStartPoint() const;
+            Point3<float> getEndPoint() const;
+
+            void setPriority(int);
+            int getPriority() const;
 
             void setPath(const std::vector<PathPoint>&);
             std::vector<PathPoint> getPath() const;
             bool isPathReady() const;
 
         private:
+            mutable std::mutex mutex;
             Point3<float> startPoint;
             Point3<float> endPoint;
+            std::atomic_int priority;
 
-            mutable std::mutex mutex;
             std::atomic_bool bIsPathReady;
             std::vector<PathPoint> path;
     };
@@ -0,0 +1,137 @@
+#include <chrono>
+#include <algorithm>
+
+#include "path/PathRequestScheduler.h"
+
+namespace urchin {
+
+    /**
+     * @param replanTolerance Distance a request point must move to re-plan the path
+     * @param timeBudgetInMs Maximum time spent to plan paths by update. At least one path is planned by update.
+     * @param maxCachedPaths Maximum number of paths in cache
+     * @param priorityAgingUpdates Number of updates a request waits to gain one priority level (0 to disable)
+     */
+    PathRequestScheduler::PathRequestScheduler(float replanTolerance, float timeBudgetInMs, unsigned int maxCachedPaths, unsigned int priorityAgingUpdates) :
+            replanTolerance(replanTolerance),
+            timeBudgetInMs(timeBudgetInMs),
+            maxCachedPaths(maxCachedPaths),
+            priorityAgingUpdates(priorityAgingUpdates),
+            updateCount(0),
+            cacheNavMeshUpdateId(0) {
+
+    }
+
+    /**
+     * Plan the paths of the requests needing a new path, by effective priority (priority raised with the waiting time) and then by waiting time, until the
+     * time budget is exhausted
+     * @return Number of paths computed with the pathfinding algorithm (cached paths excluded)
+     */
+    unsigned int PathRequestScheduler::update(const std::shared_ptr<NavMesh>& navMesh, const std::vector<std::shared_ptr<PathRequest>>& pathRequests) {
+        ScopeProfiler sp(Profiler::ai(), "pathReqSchedule");
+        auto updateStartTime = std::chrono::steady_clock::now();
+        updateCount++;
+
+        if (cacheNavMeshUpdateId != navMesh->getUpdateId()) {
+            cachedPaths.clear();
+            cacheNavMeshUpdateId = navMesh->getUpdateId();
+        }
+
+        pendingRequests.clear();
+        for (const auto& pathRequest : pathRequests) {
+            PlannedRequest& plannedRequest = plannedRequests.try_emplace(pathRequest, PlannedRequest{false, Point3<float>(), Point3<float>(), 0, updateCount, 0}).first->second;
+            plannedRequest.lastSeenUpdate = updateCount;
+
+            Point3<float> startPoint = pathRequest->getStartPoint();
+            Point3<float> endPoint = pathRequest->getEndPoint();
+            if (needPlanning(plannedRequest, startPoint, endPoint, navMesh->getUpdateId())) {
+                pendingRequests.push_back({pathRequest.get(), &plannedRequest, computeEffectivePriority(*pathRequest, plannedRequest), startPoint, endPoint});
+            } else {
+                plannedRequest.waitingSinceUpdate = updateCount;
+            }
+        }
+        std::erase_if(plannedRequests, [this](const auto& plannedRequest) { return plannedRequest.second.lastSeenUpdate != updateCount; }); //removed requests
+
+        std::ranges::sort(pendingRequests, [](const PendingRequest& request1, const PendingRequest& request2) {
+            if (request1.priority != request2.priority) {
+                return request1.priority > request2.priority;
+            }
+            return request1.plannedRequest->waitingSinceUpdate < request2.plannedRequest->waitingSinceUpdate;
+        });
+
+        PathfindingAStar pathfindingAStar(navMesh);
+        unsigned int computedPathsCount = 0;
+        for (std::size_t i = 0; i < pendingRequests.size(); ++i) {
+            if (i > 0 && std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStartTime).count() >= timeBudgetInMs) {
+                break; //remaining requests are planned in the next updates
+            }
+
+            const PendingRequest& pendingRequest = pendingRequests[i];
+            computedPathsCount += planPath(navMesh, pathfindingAStar, pendingRequest) ? 1u : 0u;
+
+            PlannedRequest& plannedRequest = *pendingRequest.plannedRequest;
+            plannedRequest.isPlanned = true;
+            plannedRequest.startPoint = pendingRequest.startPoint;
+            plannedRequest.endPoint = pendingRequest.endPoint;
+            plannedRequest.navMeshUpdateId = navMesh->getUpdateId();
+            plannedRequest.waitingSinceUpdate = updateCount;
+        }
+
+        return computedPathsCount;
+    }
+
+    /**
+     * @return Priority of the request raised by one level each time the request waited the aging number of updates: a request cannot wait forever
+     */
+    int PathRequestScheduler::computeEffectivePriority(const PathRequest& pathRequest, const PlannedRequest& plannedRequest) const {
+        if (priorityAgingUpdates == 0) {
+            return pathRequest.getPriority();
+        }
+        uint64_t agingLevels = (updateCount - plannedRequest.waitingSinceUpdate) / priorityAgingUpdates;
+        return pathRequest.getPriority() + (int)agingLevels;
+    }
+
+    bool PathRequestScheduler::needPlanning(const PlannedRequest& plannedRequest, const Point3<float>& startPoint, const Point3<float>& endPoint, unsigned int navMeshUpdateId) const {
+        return !plannedRequest.isPlanned
+                || plannedRequest.navMeshUpdateId != navMeshUpdateId
+                || !isInTolerance(plannedRequest.startPoint, startPoint)
+                || !isInTolerance(plannedRequest.endPoint, endPoint);
+    }
+
+    /**
+     * @return True when the path has been computed with the pathfinding algorithm, false when it comes from the cache
+     */
+    bool PathRequestScheduler::planPath(const std::shared_ptr<NavMesh>& navMesh, const PathfindingAStar& pathfindingAStar, const PendingRequest& pendingRequest) {
+        std::shared_ptr<NavTriangle> startTriangle = navMesh->findTriangle(pendingRequest.startPoint);
+        std::shared_ptr<NavTriangle> endTriangle = navMesh->findTriangle(pendingRequest.endPoint);
+        if (!startTriangle || !endTriangle) {
+            pendingRequest.pathRequest->setPath({}); //no path exists
+            return false;
+        }
+
+        uint64_t cacheKey = ((uint64_t)startTriangle->getNavMeshIndex() << 32u) | endTriangle->getNavMeshIndex();
+        auto itCachedPath = cachedPaths.find(cacheKey);
+        if (itCachedPath != cachedPaths.end() && isInTolerance(itCachedPath->second.startPoint, pendingRequest.startPoint)
+                && isInTolerance(itCachedPath->second.endPoint, pendingRequest.endPoint)) {
+            std::vector<PathPoint> path = itCachedPath->second.path;
+            if (!path.empty()) { //cached path corners are kept: only the extremities follow the request points
+                path.front() = PathPoint(pendingRequest.startPoint, path.front().isJumpPoint());
+                path.back() = PathPoint(pendingRequest.endPoint, path.back().isJumpPoint());
+            }
+            pendingRequest.pathRequest->setPath(path);
+            return false;
+        }
+
+        std::vector<PathPoint> path = pathfindingAStar.findPath(pendingRequest.startPoint, pendingRequest.endPoint);
+        if (cachedPaths.size() >= maxCachedPaths) {
+            cachedPaths.clear();
+        }
+        cachedPaths.insert_or_assign(cacheKey, CachedPath{pendingRequest.startPoint, pendingRequest.endPoint, path});
+        pendingRequest.pathRequest->setPath(path);
+        return true;
+    }
+
+    bool PathRequestScheduler::isInTolerance(const Point3<float>& point1, const Point3<float>& point2) const {
+        return point1.squareDistance(point2) <= replanTolerance * replanTolerance;
+    }
+
+}
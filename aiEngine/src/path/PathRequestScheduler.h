@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <UrchinCommon.h>
+
+#include "path/PathRequest.h"
+#include "path/PathPoint.h"
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/pathfinding/PathfindingAStar.h"
+
+namespace urchin {
+
+    /**
+     * Plan the path requests across the AI updates: a request is re-planned only when its points moved or when the navigation mesh changed. Requests are
+     * planned by priority, raised while they wait, within a time budget by update and the paths are cached by start triangle, end triangle and navigation
+     * mesh version.
+     */
+    class PathRequestScheduler {
+        public:
+            PathRequestScheduler(float, float, unsigned int, unsigned int);
+
+            unsigned int update(const std::shared_ptr<NavMesh>&, const std::vector<std::shared_ptr<PathRequest>>&);
+
+        private:
+            struct PlannedRequest {
+                bool isPlanned;
+                Point3<float> startPoint;
+                Point3<float> endPoint;
+                unsigned int navMeshUpdateId;
+                uint64_t waitingSinceUpdate;
+                uint64_t lastSeenUpdate;
+            };
+
+            struct PendingRequest {
+                PathRequest* pathRequest;
+                PlannedRequest* plannedRequest;
+                int priority;
+                Point3<float> startPoint;
+                Point3<float> endPoint;
+            };
+
+            struct CachedPath {
+                Point3<float> startPoint;
+                Point3<float> endPoint;
+                std::vector<PathPoint> path;
+            };
+
+            bool needPlanning(const PlannedRequest&, const Point3<float>&, const Point3<float>&, unsigned int) const;
+            int computeEffectivePriority(const PathRequest&, const PlannedRequest&) const;
+            bool planPath(const std::shared_ptr<NavMesh>&, const PathfindingAStar&, const PendingRequest&);
+            bool isInTolerance(const Point3<float>&, const Point3<float>&) const;
+
+            const float replanTolerance;
+            const float timeBudgetInMs;
+            const unsigned int maxCachedPaths;
+            const unsigned int priorityAgingUpdates;
+
+            uint64_t updateCount;
+            std::unordered_map<std::shared_ptr<PathRequest>, PlannedRequest> plannedRequests;
+            std::vector<PendingRequest> pendingRequests;
+
+            unsigned int cacheNavMeshUpdateId;
+            std::unordered_map<uint64_t, CachedPath> cachedPaths;
+    };
+
+}
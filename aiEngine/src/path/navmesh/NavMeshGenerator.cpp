@@ -1,4 +1,5 @@
 #include <string>
+#include <cmath>
 
 #include "path/navmesh/NavMeshGenerator.h"
 
@@ -8,12 +9,28 @@ namespace urchin {
     constexpr auto DEBUG_EXPORT_NAV_MESH = False();
 
     NavMeshGenerator::NavMeshGenerator() :
+            voxelSize(ConfigService::instance().getFloatValue("navMesh.voxelSize")),
+            voxelHeight(ConfigService::instance().getFloatValue("navMesh.voxelHeight")),
+            tileSize(ConfigService::instance().getUnsignedIntValue("navMesh.tileSize")),
+            maxHeightError(ConfigService::instance().getFloatValue("navMesh.maxHeightError")),
+            gridOrigin(Point3(0.0f, 0.0f, 0.0f)), //grid anchored on the world origin: the tiles don't move when the world bounds change
+            workerPool(ConfigService::instance().getUnsignedIntValue("navMesh.workersCount")),
             navMeshAgent(std::make_unique<NavMeshAgent>()),
             navMesh(std::make_shared<NavMesh>()),
-            needFullRefresh(false) {
+            needFullRefresh(true),
+            agentMaxSlope(0.0f),
+            maxLinkHeightDifference(0.0f),
+            trianglesIndexEnd(0),
+            generationInProgress(false) {
 
     }
 
+    NavMeshGenerator::~NavMeshGenerator() {
+        if (generationThread) {
+            generationThread->join();
+        }
+    }
+
     void NavMeshGenerator::setNavMeshAgent(const NavMeshAgent& navMeshAgent) {
         std::scoped_lock lock(navMeshMutex);
 
@@ -32,29 +49,426 @@ namespace urchin {
     }
 
     /**
-     * See '_doc' for an algorithm overview
+     * Generate the tiles of the navigation mesh impacted by the entities added, removed or moved since the last generation
      */
-    std::shared_ptr<NavMesh> NavMeshGenerator::generate(AIWorld& /*aiWorld*/) {
+    std::shared_ptr<NavMesh> NavMeshGenerator::generate(AIWorld& aiWorld) {
         ScopeProfiler sp(Profiler::ai(), "navMeshGenerate");
 
-        //TO DO: update 'allNavPolygons' / 'allNavObjects' (model to review ?) from 'aiWorld'
-        updateNavMesh();
-
-        if (DEBUG_EXPORT_NAV_MESH) {
-            navMesh->svgMeshExport(SystemInfo::homeDirectory() + "navMesh/navMesh" + std::to_string(navMesh->getUpdateId()) + ".svg");
+        waitBackgroundGeneration();
+        std::optional<WorldChanges> worldChanges = retrieveWorldChanges(aiWorld);
+        if (worldChanges.has_value()) {
+            updateNavMesh(*worldChanges);
         }
 
+        std::scoped_lock lock(navMeshMutex);
         return navMesh;
     }
 
-    void NavMeshGenerator::updateNavMesh() {
-        allNavPolygons.clear();
-        allNavObjects.clear();
+    /**
+     * Start the generation of the tiles impacted by the AI world changes in a background thread when no generation is in progress. The generated tiles are
+     * swapped in a new navigation mesh at the end of the generation: a navigation mesh returned by this method is never modified.
+     * @return Last generated navigation mesh
+     */
+    std::shared_ptr<NavMesh> NavMeshGenerator::generateInBackground(AIWorld& aiWorld) {
+        if (!generationInProgress.load(std::memory_order_acquire)) {
+            waitBackgroundGeneration();
 
-        //TO DO: fill 'allNavPolygons' from 'allNavObjects' (model to review ?)
+            std::optional<WorldChanges> worldChanges = retrieveWorldChanges(aiWorld);
+            if (worldChanges.has_value()) {
+                generationInProgress.store(true, std::memory_order_release);
+                generationThread = std::make_unique<std::jthread>([this, worldChanges = std::move(*worldChanges)]() {
+                    try {
+                        updateNavMesh(worldChanges);
+                    } catch (const std::exception&) {
+                        Logger::instance().logError("Error during the navigation mesh generation: exception reported to the AI thread");
+                        generationExceptionPtr = std::current_exception();
+                    }
+                    generationInProgress.store(false, std::memory_order_release);
+                });
+            }
+        }
 
         std::scoped_lock lock(navMeshMutex);
-        navMesh->copyAllPolygons(allNavPolygons);
+        return navMesh;
+    }
+
+    /**
+     * Wait the end of the background generation and rethrow the exception raised by the generation
+     */
+    void NavMeshGenerator::waitBackgroundGeneration() {
+        if (generationThread) {
+            generationThread->join();
+            generationThread.reset(nullptr);
+        }
+
+        if (generationExceptionPtr) {
+            std::exception_ptr exceptionPtr = generationExceptionPtr;
+            generationExceptionPtr = nullptr;
+            std::rethrow_exception(exceptionPtr);
+        }
+    }
+
+    /**
+     * @return Entities added, removed or moved since the last call or an empty optional when the AI world is unchanged
+     */
+    std::optional<NavMeshGenerator::WorldChanges> NavMeshGenerator::retrieveWorldChanges(AIWorld& aiWorld) {
+        WorldChanges worldChanges;
+        if (needFullRefresh.exchange(false, std::memory_order_acq_rel)) {
+            std::scoped_lock lock(navMeshMutex);
+            worldChanges.fullRefreshAgent = std::make_unique<NavMeshAgent>(*navMeshAgent);
+        }
+
+        worldChanges.removedEntities = aiWorld.getEntitiesToRemoveAndReset();
+        for (const auto& aiEntity : aiWorld.getEntities()) {
+            if (aiEntity->isToRebuild() || worldChanges.fullRefreshAgent) {
+                aiEntity->markRebuilt(); //mark before reading the entity transform to not miss a transform update done during the generation
+                worldChanges.updatedEntities.push_back(aiEntity);
+            }
+        }
+
+        if (!worldChanges.fullRefreshAgent && worldChanges.updatedEntities.empty() && worldChanges.removedEntities.empty()) {
+            return std::nullopt;
+        }
+        return worldChanges;
+    }
+
+    void NavMeshGenerator::updateNavMesh(const WorldChanges& worldChanges) {
+        if (worldChanges.fullRefreshAgent) {
+            const NavMeshAgent& agent = *worldChanges.fullRefreshAgent;
+            tileBuilder = std::make_unique<VoxelTileBuilder>(agent, voxelSize, voxelHeight, maxHeightError);
+            agentMaxSlope = agent.getMaxSlope();
+            maxLinkHeightDifference = std::min(voxelSize * std::tan(agent.getMaxSlope()), agent.getAgentHeight()) + voxelHeight + maxHeightError;
+            entitiesGeometry.clear();
+            tiles.clear();
+            freeTriangleIndices.clear();
+            trianglesIndexEnd = 0;
+        }
+
+        std::set<TileCoordinate> dirtyTiles = updateEntitiesGeometry(worldChanges);
+        buildTiles(dirtyTiles);
+
+        //polygons of the tiles are shared with the previous navigation meshes: only the rebuilt tiles and the border links of their adjacent tiles are new
+        std::vector<std::shared_ptr<NavPolygon>> allNavPolygons;
+        std::vector<std::shared_ptr<const NavTriangleLinks>> allBorderTrianglesLinks;
+        for (const auto& [tileCoordinate, tile] : tiles) {
+            allNavPolygons.insert(allNavPolygons.end(), tile.navPolygons.begin(), tile.navPolygons.end());
+            allBorderTrianglesLinks.insert(allBorderTrianglesLinks.end(), tile.borderTrianglesLinks.begin(), tile.borderTrianglesLinks.end());
+        }
+        auto newNavMesh = std::make_shared<NavMesh>();
+        newNavMesh->shareAllPolygons(std::move(allNavPolygons), std::move(allBorderTrianglesLinks), trianglesIndexEnd);
+        {
+            std::scoped_lock lock(navMeshMutex);
+            navMesh = newNavMesh;
+        }
+
+        if (DEBUG_EXPORT_NAV_MESH) {
+            newNavMesh->svgMeshExport(SystemInfo::homeDirectory() + "navMesh/navMesh" + std::to_string(newNavMesh->getUpdateId()) + ".svg");
+        }
+    }
+
+    /**
+     * Rebuild the geometry of the updated entities
+     * @return Tiles overlapping the previous or the new bounding box of the updated and removed entities
+     */
+    std::set<NavMeshGenerator::TileCoordinate> NavMeshGenerator::updateEntitiesGeometry(const WorldChanges& worldChanges) {
+        std::set<TileCoordinate> dirtyTiles;
+
+        for (const auto& removedEntity : worldChanges.removedEntities) {
+            auto itFind = entitiesGeometry.find(removedEntity);
+            if (itFind != entitiesGeometry.end()) {
+                addTilesInArea(itFind->second->getMin(), itFind->second->getMax(), dirtyTiles);
+                entitiesGeometry.erase(itFind);
+            }
+        }
+
+        for (const auto& updatedEntity : worldChanges.updatedEntities) {
+            auto itFind = entitiesGeometry.find(updatedEntity);
+            if (itFind != entitiesGeometry.end()) {
+                addTilesInArea(itFind->second->getMin(), itFind->second->getMax(), dirtyTiles);
+                entitiesGeometry.erase(itFind);
+            }
+
+            auto entityGeometry = std::make_unique<VoxelInputGeometry>(agentMaxSlope);
+            entityGeometry->addEntity(*updatedEntity);
+            if (!entityGeometry->isEmpty()) {
+                addTilesInArea(entityGeometry->getMin(), entityGeometry->getMax(), dirtyTiles);
+                entitiesGeometry.try_emplace(updatedEntity, std::move(entityGeometry));
+            }
+        }
+
+        return dirtyTiles;
+    }
+
+    /**
+     * @param dirtyTiles [out] Tiles impacted by a geometry change in the area (tile border included)
+     */
+    void NavMeshGenerator::addTilesInArea(const Point3<float>& areaMin, const Point3<float>& areaMax, std::set<TileCoordinate>& dirtyTiles) const {
+        auto toTileCoordinate = [&](float value, float origin, float borderOffset) {
+            return (int)std::floor(((value - origin) / voxelSize + borderOffset) / (float)tileSize);
+        };
+
+        auto borderSize = (float)tileBuilder->getBorderSize();
+        int minTileX = toTileCoordinate(areaMin.X, gridOrigin.X, -borderSize);
+        int maxTileX = toTileCoordinate(areaMax.X, gridOrigin.X, borderSize);
+        int minTileZ = toTileCoordinate(areaMin.Z, gridOrigin.Z, -borderSize);
+        int maxTileZ = toTileCoordinate(areaMax.Z, gridOrigin.Z, borderSize);
+        for (int tileZ = minTileZ; tileZ <= maxTileZ; ++tileZ) {
+            for (int tileX = minTileX; tileX <= maxTileX; ++tileX) {
+                dirtyTiles.emplace(tileX, tileZ);
+            }
+        }
+    }
+
+    /**
+     * Build the navigation polygons of the dirty tiles in parallel and stitch them with the polygons of the adjacent tiles
+     */
+    void NavMeshGenerator::buildTiles(const std::set<TileCoordinate>& dirtyTiles) {
+        std::vector<TileCoordinate> dirtyTileCoordinates(dirtyTiles.begin(), dirtyTiles.end());
+        std::vector<NavTile> builtTiles(dirtyTileCoordinates.size());
+        {
+            ScopeProfiler sp(Profiler::ai(), "buildTiles");
+            workerPool.parallelFor(dirtyTileCoordinates.size(), 1, [&](unsigned int, std::size_t beginTileIndex, std::size_t endTileIndex) {
+                for (std::size_t tileIndex = beginTileIndex; tileIndex < endTileIndex; ++tileIndex) {
+                    const TileCoordinate& tileCoordinate = dirtyTileCoordinates[tileIndex];
+                    std::vector<const VoxelTriangle*> tileTriangles = retrieveTileTriangles(tileCoordinate);
+                    if (!tileTriangles.empty()) {
+                        Point2 tilePosition(tileCoordinate.first, tileCoordinate.second);
+                        std::vector<std::pair<std::size_t, std::size_t>> adjacentRegions;
+                        builtTiles[tileIndex].navPolygons = tileBuilder->buildTile(tileTriangles, gridOrigin, tilePosition, tileSize, adjacentRegions);
+                        linkTileRegions(builtTiles[tileIndex].navPolygons, adjacentRegions);
+                        builtTiles[tileIndex].borderEdges = collectTileBorderEdges(builtTiles[tileIndex].navPolygons, tileCoordinate);
+                    }
+                }
+            });
+        }
+
+        ScopeProfiler sp(Profiler::ai(), "stitchTiles");
+        std::set<TileCoordinate> tilesToStitch;
+        for (std::size_t tileIndex = 0; tileIndex < dirtyTileCoordinates.size(); ++tileIndex) {
+            const TileCoordinate& tileCoordinate = dirtyTileCoordinates[tileIndex];
+            auto itFind = tiles.find(tileCoordinate);
+            if (itFind != tiles.end()) {
+                releaseTriangleIndices(itFind->second);
+                tiles.erase(itFind);
+            }
+            if (!builtTiles[tileIndex].navPolygons.empty()) {
+                assignTriangleIndices(builtTiles[tileIndex]);
+                tiles.try_emplace(tileCoordinate, std::move(builtTiles[tileIndex]));
+            }
+
+            tilesToStitch.insert({tileCoordinate, TileCoordinate(tileCoordinate.first - 1, tileCoordinate.second), TileCoordinate(tileCoordinate.first + 1, tileCoordinate.second),
+                                  TileCoordinate(tileCoordinate.first, tileCoordinate.second - 1), TileCoordinate(tileCoordinate.first, tileCoordinate.second + 1)});
+        }
+        for (const TileCoordinate& tileCoordinate : tilesToStitch) {
+            stitchTile(tileCoordinate);
+        }
+    }
+
+    /**
+     * @return Geometry triangles overlapping the tile (border included)
+     */
+    std::vector<const VoxelTriangle*> NavMeshGenerator::retrieveTileTriangles(const TileCoordinate& tileCoordinate) const {
+        auto borderSize = (int)tileBuilder->getBorderSize();
+        float tileMinX = gridOrigin.X + (float)(tileCoordinate.first * (int)tileSize - borderSize) * voxelSize;
+        float tileMaxX = gridOrigin.X + (float)((tileCoordinate.first + 1) * (int)tileSize + borderSize) * voxelSize;
+        float tileMinZ = gridOrigin.Z + (float)(tileCoordinate.second * (int)tileSize - borderSize) * voxelSize;
+        float tileMaxZ = gridOrigin.Z + (float)((tileCoordinate.second + 1) * (int)tileSize + borderSize) * voxelSize;
+
+        std::vector<const VoxelTriangle*> tileTriangles;
+        for (const auto& [aiEntity, entityGeometry] : entitiesGeometry) {
+            if (entityGeometry->getMax().X < tileMinX || entityGeometry->getMin().X > tileMaxX || entityGeometry->getMax().Z < tileMinZ || entityGeometry->getMin().Z > tileMaxZ) {
+                continue;
+            }
+            for (const VoxelTriangle& triangle : entityGeometry->getTriangles()) {
+                const std::array<Point3<float>, 3>& points = triangle.points;
+                if (std::max({points[0].X, points[1].X, points[2].X}) >= tileMinX && std::min({points[0].X, points[1].X, points[2].X}) <= tileMaxX
+                        && std::max({points[0].Z, points[1].Z, points[2].Z}) >= tileMinZ && std::min({points[0].Z, points[1].Z, points[2].Z}) <= tileMaxZ) {
+                    tileTriangles.push_back(&triangle);
+                }
+            }
+        }
+        return tileTriangles;
+    }
+
+    /**
+     * Give to the triangles of a new tile the indices released by the removed tiles. Released indices can be reused because the triangles of a navigation mesh
+     * cannot be both in a removed tile and in a new tile.
+     */
+    void NavMeshGenerator::assignTriangleIndices(const NavTile& tile) {
+        for (const auto& navPolygon : tile.navPolygons) {
+            for (const auto& navTriangle : navPolygon->getTriangles()) {
+                if (freeTriangleIndices.empty()) {
+                    navTriangle->setNavMeshIndex(trianglesIndexEnd++);
+                } else {
+                    navTriangle->setNavMeshIndex(freeTriangleIndices.back());
+                    freeTriangleIndices.pop_back();
+                }
+            }
+        }
+    }
+
+    void NavMeshGenerator::releaseTriangleIndices(const NavTile& tile) {
+        for (const auto& navPolygon : tile.navPolygons) {
+            for (const auto& navTriangle : navPolygon->getTriangles()) {
+                freeTriangleIndices.push_back(navTriangle->getNavMeshIndex());
+            }
+        }
+    }
+
+    /**
+     * Rebuild the links of the tile border triangles: links of the triangles completed with the links to the polygons of the adjacent tiles.
+     * The triangles are not modified because they are shared with the previous navigation meshes.
+     */
+    void NavMeshGenerator::stitchTile(const TileCoordinate& tileCoordinate) {
+        auto itFind = tiles.find(tileCoordinate);
+        if (itFind == tiles.end()) {
+            return;
+        }
+        NavTile& tile = itFind->second;
+
+        std::array<std::pair<TileCoordinate, TileSide>, 4> adjacentTiles = { //indexed by TileSide of the tile
+                std::make_pair(TileCoordinate(tileCoordinate.first - 1, tileCoordinate.second), MAX_X),
+                std::make_pair(TileCoordinate(tileCoordinate.first + 1, tileCoordinate.second), MIN_X),
+                std::make_pair(TileCoordinate(tileCoordinate.first, tileCoordinate.second - 1), MAX_Z),
+                std::make_pair(TileCoordinate(tileCoordinate.first, tileCoordinate.second + 1), MIN_Z)};
+        std::map<std::shared_ptr<NavTriangle>, std::vector<std::shared_ptr<NavLink>>> adjacentTilesLinks;
+        for (std::size_t side = 0; side < 4; ++side) {
+            const auto& [adjacentTileCoordinate, adjacentTileSide] = adjacentTiles[side];
+            if (const NavTile* adjacentTile = findTile(adjacentTileCoordinate.first, adjacentTileCoordinate.second)) {
+                linkEdges(tile.borderEdges[side], adjacentTile->borderEdges[adjacentTileSide], side == MIN_X || side == MAX_X, adjacentTilesLinks);
+            }
+        }
+
+        tile.borderTrianglesLinks.clear();
+        for (auto& [triangle, links] : adjacentTilesLinks) {
+            auto borderTriangleLinks = std::make_shared<NavTriangleLinks>();
+            borderTriangleLinks->triangle = triangle;
+            borderTriangleLinks->links = triangle->getLinks();
+            borderTriangleLinks->links.insert(borderTriangleLinks->links.end(), links.begin(), links.end());
+            tile.borderTrianglesLinks.push_back(std::move(borderTriangleLinks));
+        }
+    }
+
+    const NavMeshGenerator::NavTile* NavMeshGenerator::findTile(int tileX, int tileZ) const {
+        auto itFind = tiles.find(TileCoordinate(tileX, tileZ));
+        return itFind == tiles.end() ? nullptr : &itFind->second;
+    }
+
+    /**
+     * @return External edges of the tile polygons located on the tile sides, indexed by TileSide
+     */
+    std::array<std::vector<NavPolygonEdge>, 4> NavMeshGenerator::collectTileBorderEdges(const std::vector<std::shared_ptr<NavPolygon>>& navPolygons,
+                                                                                       const TileCoordinate& tileCoordinate) const {
+        float tileLength = (float)tileSize * voxelSize;
+        std::array<float, 4> sidesValue = {
+                gridOrigin.X + (float)(tileCoordinate.first * (int)tileSize) * voxelSize,
+                gridOrigin.X + (float)((tileCoordinate.first + 1) * (int)tileSize) * voxelSize,
+                gridOrigin.Z + (float)(tileCoordinate.second * (int)tileSize) * voxelSize,
+                gridOrigin.Z + (float)((tileCoordinate.second + 1) * (int)tileSize) * voxelSize};
+        float sideTolerance = tileLength * 0.0001f;
+
+        std::array<std::vector<NavPolygonEdge>, 4> borderEdges;
+        for (const auto& navPolygon : navPolygons) {
+            for (const NavPolygonEdge& externalEdge : navPolygon->retrieveExternalEdges()) {
+                LineSegment3D<float> edge = externalEdge.triangle->computeEdge(externalEdge.edgeIndex);
+                for (std::size_t side = 0; side < 4; ++side) {
+                    bool xSide = side == MIN_X || side == MAX_X;
+                    if (std::abs(axisValue(edge.getA(), xSide) - sidesValue[side]) < sideTolerance && std::abs(axisValue(edge.getB(), xSide) - sidesValue[side]) < sideTolerance) {
+                        borderEdges[side].push_back(externalEdge);
+                        break;
+                    }
+                }
+            }
+        }
+        return borderEdges;
+    }
+
+    /**
+     * Link the polygons of the adjacent regions of a tile: connected spans belong to different regions when a region cannot contain all of them (see VoxelWalkableField::buildRegions)
+     * @param adjacentRegions Indices of the polygons of the tile regions having connected spans
+     */
+    void NavMeshGenerator::linkTileRegions(const std::vector<std::shared_ptr<NavPolygon>>& navPolygons, const std::vector<std::pair<std::size_t, std::size_t>>& adjacentRegions) const {
+        float axisTolerance = voxelSize * 0.01f;
+        std::vector<std::array<std::vector<NavPolygonEdge>, 2>> polygonsAxisEdges(navPolygons.size()); //external edges perpendicular to the X axis, then to the Z axis
+        auto collectAxisEdges = [&](std::size_t polygonIndex) -> const std::array<std::vector<NavPolygonEdge>, 2>& {
+            std::array<std::vector<NavPolygonEdge>, 2>& axisEdges = polygonsAxisEdges[polygonIndex];
+            if (axisEdges[0].empty() && axisEdges[1].empty()) {
+                for (const NavPolygonEdge& externalEdge : navPolygons[polygonIndex]->retrieveExternalEdges()) {
+                    LineSegment3D<float> edge = externalEdge.triangle->computeEdge(externalEdge.edgeIndex);
+                    if (std::abs(edge.getA().X - edge.getB().X) < axisTolerance) {
+                        axisEdges[0].push_back(externalEdge);
+                    } else if (std::abs(edge.getA().Z - edge.getB().Z) < axisTolerance) {
+                        axisEdges[1].push_back(externalEdge);
+                    }
+                }
+            }
+            return axisEdges;
+        };
+
+        std::map<std::shared_ptr<NavTriangle>, std::vector<std::shared_ptr<NavLink>>> regionsLinks;
+        for (const auto& [polygonIndex1, polygonIndex2] : adjacentRegions) {
+            const std::array<std::vector<NavPolygonEdge>, 2>& axisEdges1 = collectAxisEdges(polygonIndex1);
+            const std::array<std::vector<NavPolygonEdge>, 2>& axisEdges2 = collectAxisEdges(polygonIndex2);
+            for (std::size_t axis = 0; axis < 2; ++axis) {
+                linkEdges(axisEdges1[axis], axisEdges2[axis], axis == 0, regionsLinks);
+                linkEdges(axisEdges2[axis], axisEdges1[axis], axis == 0, regionsLinks);
+            }
+        }
+        for (const auto& [triangle, links] : regionsLinks) {
+            for (const auto& link : links) {
+                triangle->addLink(link);
+            }
+        }
+    }
+
+    /**
+     * Create join polygons links from the source edges to the overlapping target edges located on the same line
+     * @param xSide True when the edges are perpendicular to the X axis
+     * @param edgesLinks [out] Links created by source triangle
+     */
+    void NavMeshGenerator::linkEdges(const std::vector<NavPolygonEdge>& sourceEdges, const std::vector<NavPolygonEdge>& targetEdges, bool xSide,
+                                     std::map<std::shared_ptr<NavTriangle>, std::vector<std::shared_ptr<NavLink>>>& edgesLinks) const {
+        float lineTolerance = voxelSize * 0.01f;
+        float minOverlapLength = voxelSize * 0.01f;
+        for (const NavPolygonEdge& sourceEdge : sourceEdges) {
+            LineSegment3D<float> edge1 = sourceEdge.triangle->computeEdge(sourceEdge.edgeIndex);
+            float edge1A = axisValue(edge1.getA(), !xSide);
+            float edge1B = axisValue(edge1.getB(), !xSide);
+
+            for (const NavPolygonEdge& targetEdge : targetEdges) {
+                LineSegment3D<float> edge2 = targetEdge.triangle->computeEdge(targetEdge.edgeIndex);
+                if (std::abs(axisValue(edge1.getA(), xSide) - axisValue(edge2.getA(), xSide)) > lineTolerance) {
+                    continue; //parallel edges not located on the same line
+                }
+                float edge2A = axisValue(edge2.getA(), !xSide);
+                float edge2B = axisValue(edge2.getB(), !xSide);
+
+                float overlapStart = std::max(std::min(edge1A, edge1B), std::min(edge2A, edge2B));
+                float overlapEnd = std::min(std::max(edge1A, edge1B), std::max(edge2A, edge2B));
+                if (overlapEnd - overlapStart < minOverlapLength) {
+                    continue;
+                }
+
+                float overlapMiddle = (overlapStart + overlapEnd) / 2.0f;
+                float edge1MiddleRatio = (overlapMiddle - edge1A) / (edge1B - edge1A);
+                float edge2MiddleRatio = (overlapMiddle - edge2A) / (edge2B - edge2A);
+                float edge1MiddleY = edge1.getA().Y + (edge1.getB().Y - edge1.getA().Y) * edge1MiddleRatio;
+                float edge2MiddleY = edge2.getA().Y + (edge2.getB().Y - edge2.getA().Y) * edge2MiddleRatio;
+                if (std::abs(edge1MiddleY - edge2MiddleY) > maxLinkHeightDifference) {
+                    continue;
+                }
+
+                //link constraint range: 1.0 for the edge start point and 0.0 for the edge end point
+                float edge1StartRatio = (overlapStart - edge1A) / (edge1B - edge1A);
+                float edge1EndRatio = (overlapEnd - edge1A) / (edge1B - edge1A);
+                edgesLinks[sourceEdge.triangle].push_back(NavLink::newJoinPolygonsLink(sourceEdge.edgeIndex, targetEdge.triangle, std::make_unique<NavLinkConstraint>(
+                        1.0f - std::min(edge1StartRatio, edge1EndRatio), 1.0f - std::max(edge1StartRatio, edge1EndRatio), targetEdge.edgeIndex)));
+            }
+        }
+    }
+
+    float NavMeshGenerator::axisValue(const Point3<float>& point, bool xAxis) {
+        return xAxis ? point.X : point.Z;
     }
 
 }
@@ -1,38 +1,101 @@
 #pragma once
 
+#include <array>
+#include <map>
+#include <set>
 #include <memory>
 #include <vector>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <optional>
+#include <unordered_map>
+#include <exception>
 
 #include "input/AIWorld.h"
-#include "path/navmesh/model/NavObject.h"
 #include "path/navmesh/model/output/NavMeshAgent.h"
 #include "path/navmesh/model/output/NavMesh.h"
 #include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/voxel/VoxelInputGeometry.h"
+#include "path/navmesh/voxel/VoxelTileBuilder.h"
 
 namespace urchin {
 
     class NavMeshGenerator {
         public:
             NavMeshGenerator();
+            ~NavMeshGenerator();
 
             void setNavMeshAgent(const NavMeshAgent&);
             const NavMeshAgent& getNavMeshAgent() const;
 
             std::shared_ptr<NavMesh> generate(AIWorld&);
+            std::shared_ptr<NavMesh> generateInBackground(AIWorld&);
             NavMesh copyLastGeneratedNavMesh() const;
 
         private:
-            void updateNavMesh();
+            using TileCoordinate = std::pair<int, int>;
+
+            enum TileSide {
+                MIN_X = 0,
+                MAX_X,
+                MIN_Z,
+                MAX_Z
+            };
+
+            struct NavTile {
+                std::vector<std::shared_ptr<NavPolygon>> navPolygons; //shared with the generated navigation meshes: not modified once the tile is built
+                std::array<std::vector<NavPolygonEdge>, 4> borderEdges;
+                std::vector<std::shared_ptr<const NavTriangleLinks>> borderTrianglesLinks;
+            };
+
+            struct WorldChanges {
+                std::unique_ptr<NavMeshAgent> fullRefreshAgent;
+                std::vector<std::shared_ptr<AIEntity>> updatedEntities;
+                std::vector<std::shared_ptr<AIEntity>> removedEntities;
+            };
+
+            std::optional<WorldChanges> retrieveWorldChanges(AIWorld&);
+            void waitBackgroundGeneration();
+            void updateNavMesh(const WorldChanges&);
+            std::set<TileCoordinate> updateEntitiesGeometry(const WorldChanges&);
+            void addTilesInArea(const Point3<float>&, const Point3<float>&, std::set<TileCoordinate>&) const;
+
+            void buildTiles(const std::set<TileCoordinate>&);
+            std::vector<const VoxelTriangle*> retrieveTileTriangles(const TileCoordinate&) const;
+            void assignTriangleIndices(const NavTile&);
+            void releaseTriangleIndices(const NavTile&);
+            void stitchTile(const TileCoordinate&);
+            const NavTile* findTile(int, int) const;
+
+            std::array<std::vector<NavPolygonEdge>, 4> collectTileBorderEdges(const std::vector<std::shared_ptr<NavPolygon>>&, const TileCoordinate&) const;
+            void linkTileRegions(const std::vector<std::shared_ptr<NavPolygon>>&, const std::vector<std::pair<std::size_t, std::size_t>>&) const;
+            void linkEdges(const std::vector<NavPolygonEdge>&, const std::vector<NavPolygonEdge>&, bool, std::map<std::shared_ptr<NavTriangle>, std::vector<std::shared_ptr<NavLink>>>&) const;
+            static float axisValue(const Point3<float>&, bool);
+
+            const float voxelSize;
+            const float voxelHeight;
+            const unsigned int tileSize;
+            const float maxHeightError;
+            const Point3<float> gridOrigin;
+            WorkerPool workerPool;
 
             mutable std::mutex navMeshMutex;
             std::unique_ptr<NavMeshAgent> navMeshAgent;
             std::shared_ptr<NavMesh> navMesh;
             std::atomic_bool needFullRefresh;
 
-            std::vector<std::shared_ptr<NavObject>> allNavObjects;
-            std::vector<std::shared_ptr<NavPolygon>> allNavPolygons;
+            std::unique_ptr<VoxelTileBuilder> tileBuilder;
+            float agentMaxSlope;
+            float maxLinkHeightDifference;
+            std::unordered_map<std::shared_ptr<AIEntity>, std::unique_ptr<VoxelInputGeometry>> entitiesGeometry;
+            std::map<TileCoordinate, NavTile> tiles;
+            std::vector<uint32_t> freeTriangleIndices;
+            uint32_t trianglesIndexEnd;
+
+            std::unique_ptr<std::jthread> generationThread;
+            std::atomic_bool generationInProgress;
+            std::exception_ptr generationExceptionPtr;
     };
 
 }
@@ -4,8 +4,10 @@ namespace urchin {
 
     /**
      * @param copiedNavPolygons [out] Return copied navigation polygons
+     * @param triangleLinks Links to copy for an original triangle
      */
-    void NavModelCopy::copyNavPolygons(const std::vector<std::shared_ptr<NavPolygon>>& originalNavPolygons, std::vector<std::shared_ptr<NavPolygon>>& copiedNavPolygons) {
+    void NavModelCopy::copyNavPolygons(const std::vector<std::shared_ptr<NavPolygon>>& originalNavPolygons, std::vector<std::shared_ptr<NavPolygon>>& copiedNavPolygons,
+                                       const std::function<const std::vector<std::shared_ptr<NavLink>>&(const NavTriangle&)>& triangleLinks) {
         std::map<const NavPolygon*, std::map<const NavTriangle*, std::pair<std::size_t, std::size_t>>> originalPositionsMap;
 
         copiedNavPolygons.reserve(originalNavPolygons.size());
@@ -33,7 +35,7 @@ namespace urchin {
             const auto& originalPolygon = originalNavPolygons[originalPolygonIndex];
             for (std::size_t originalTriangleIndex = 0; originalTriangleIndex < originalPolygon->getTriangles().size(); ++originalTriangleIndex) {
                 const auto& originalTriangle = originalPolygon->getTriangles()[originalTriangleIndex];
-                for (const auto& originalLink : originalTriangle->getLinks()) {
+                for (const auto& originalLink : triangleLinks(*originalTriangle)) {
                     const auto& linkTargetPolygonPositions = originalPositionsMap.find(originalLink->getTargetTriangle()->getNavPolygon().get());
                     assert(linkTargetPolygonPositions != originalPositionsMap.end());
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <functional>
 
 #include "path/navmesh/model/output//NavPolygon.h"
 
@@ -8,7 +9,8 @@ namespace urchin {
 
     class NavModelCopy {
         public:
-            static void copyNavPolygons(const std::vector<std::shared_ptr<NavPolygon>>&, std::vector<std::shared_ptr<NavPolygon>>&);
+            static void copyNavPolygons(const std::vector<std::shared_ptr<NavPolygon>>&, std::vector<std::shared_ptr<NavPolygon>>&,
+                                        const std::function<const std::vector<std::shared_ptr<NavLink>>&(const NavTriangle&)>&);
     };
 
 }
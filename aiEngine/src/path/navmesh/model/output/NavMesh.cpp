@@ -6,16 +6,19 @@
 namespace urchin {
 
     //static
-    unsigned int NavMesh::nextUpdateId = 0;
+    std::atomic<unsigned int> NavMesh::nextUpdateId = 0;
 
     NavMesh::NavMesh() :
-            updateId(0) {
+            updateId(0),
+            trianglesCount(0) {
 
     }
 
     NavMesh::NavMesh(const NavMesh& navMesh) :
-            updateId(navMesh.getUpdateId()) {
-        NavModelCopy::copyNavPolygons(navMesh.getPolygons(), polygons);
+            updateId(navMesh.getUpdateId()),
+            trianglesCount(0) {
+        NavModelCopy::copyNavPolygons(navMesh.getPolygons(), polygons, [&navMesh](const NavTriangle& triangle) -> const auto& { return navMesh.getLinks(triangle); });
+        indexTriangles();
     }
 
     unsigned int NavMesh::getUpdateId() const {
@@ -26,13 +29,50 @@ namespace urchin {
         changeUpdateId();
 
         polygons.clear();
-        NavModelCopy::copyNavPolygons(allPolygons, polygons);
+        sharedTrianglesLinks.clear();
+        NavModelCopy::copyNavPolygons(allPolygons, polygons, [](const NavTriangle& triangle) -> const auto& { return triangle.getLinks(); });
+        indexTriangles();
+    }
+
+    /**
+     * Use the polygons without copying them: the polygons can be shared with other navigation meshes and must not be modified anymore
+     * @param trianglesLinks Links replacing the links of some triangles for this navigation mesh (e.g. links to polygons not shared with other navigation meshes)
+     * @param trianglesCount Number of triangles indices: triangles are already indexed from 0 to this number (excluded) with NavTriangle::getNavMeshIndex()
+     */
+    void NavMesh::shareAllPolygons(std::vector<std::shared_ptr<NavPolygon>> allPolygons, std::vector<std::shared_ptr<const NavTriangleLinks>> trianglesLinks,
+                                   uint32_t trianglesCount) {
+        changeUpdateId();
+
+        this->polygons = std::move(allPolygons);
+        this->sharedTrianglesLinks = std::move(trianglesLinks);
+        this->trianglesCount = trianglesCount;
+        indexTrianglesLinks();
+        triangleGrid.build(polygons);
     }
 
     const std::vector<std::shared_ptr<NavPolygon>>& NavMesh::getPolygons() const {
         return polygons;
     }
 
+    /**
+     * @return Number of triangles: triangles are indexed from 0 to this number (excluded) with NavTriangle::getNavMeshIndex()
+     */
+    uint32_t NavMesh::getTrianglesCount() const {
+        return trianglesCount;
+    }
+
+    const std::vector<std::shared_ptr<NavLink>>& NavMesh::getLinks(const NavTriangle& triangle) const {
+        const std::vector<std::shared_ptr<NavLink>>* links = trianglesLinks[triangle.getNavMeshIndex()];
+        return links ? *links : triangle.getLinks();
+    }
+
+    /**
+     * @return Triangle containing the point on the XZ plane and having its center just below the point. Null pointer when no triangle is found.
+     */
+    std::shared_ptr<NavTriangle> NavMesh::findTriangle(const Point3<float>& point) const {
+        return triangleGrid.findTriangle(point);
+    }
+
     void NavMesh::svgMeshExport(std::string filename) const {
         SVGExporter svgExporter(std::move(filename));
 
@@ -55,7 +95,7 @@ namespace urchin {
 
         for (const auto& polygon : polygons) {
             for (const auto& triangle : polygon->getTriangles()) {
-                for (const auto& link : triangle->getLinks()) {
+                for (const auto& link : getLinks(*triangle)) {
                     Point3<float> lineP1 = triangle->getCenterPoint();
                     Point3<float> lineP2 = link->getTargetTriangle()->getCenterPoint();
                     LineSegment2D line(Point2(lineP1.X, -lineP1.Z), Point2(lineP2.X, -lineP2.Z));
@@ -72,7 +112,27 @@ namespace urchin {
     }
 
     unsigned int NavMesh::changeUpdateId() {
-        updateId = ++nextUpdateId;
+        updateId = nextUpdateId.fetch_add(1, std::memory_order_relaxed) + 1;
         return updateId;
     }
+
+    void NavMesh::indexTriangles() {
+        trianglesCount = 0;
+        for (const auto& polygon : polygons) {
+            for (const auto& triangle : polygon->getTriangles()) {
+                triangle->setNavMeshIndex(trianglesCount++);
+            }
+        }
+
+        indexTrianglesLinks();
+        triangleGrid.build(polygons);
+    }
+
+    void NavMesh::indexTrianglesLinks() {
+        trianglesLinks.assign(trianglesCount, nullptr);
+        for (const auto& triangleLinks : sharedTrianglesLinks) {
+            trianglesLinks[triangleLinks->triangle->getNavMeshIndex()] = &triangleLinks->links;
+        }
+    }
+
 }
@@ -2,8 +2,11 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/model/output/NavTriangleLinks.h"
+#include "path/navmesh/model/output/NavTriangleGrid.h"
 
 namespace urchin {
 
@@ -20,17 +23,27 @@ namespace urchin {
             unsigned int getUpdateId() const;
 
             void copyAllPolygons(const std::vector<std::shared_ptr<NavPolygon>>&);
+            void shareAllPolygons(std::vector<std::shared_ptr<NavPolygon>>, std::vector<std::shared_ptr<const NavTriangleLinks>>, uint32_t);
             const std::vector<std::shared_ptr<NavPolygon>>& getPolygons() const;
+            uint32_t getTrianglesCount() const;
+            const std::vector<std::shared_ptr<NavLink>>& getLinks(const NavTriangle&) const;
+            std::shared_ptr<NavTriangle> findTriangle(const Point3<float>&) const;
 
             void svgMeshExport(std::string) const;
 
         private:
             unsigned int changeUpdateId();
+            void indexTriangles();
+            void indexTrianglesLinks();
 
-            static unsigned int nextUpdateId;
+            static std::atomic<unsigned int> nextUpdateId;
             unsigned int updateId;
 
             std::vector<std::shared_ptr<NavPolygon>> polygons;
+            uint32_t trianglesCount;
+            std::vector<std::shared_ptr<const NavTriangleLinks>> sharedTrianglesLinks;
+            std::vector<const std::vector<std::shared_ptr<NavLink>>*> trianglesLinks; //by triangle index: null when the triangle links are used
+            NavTriangleGrid triangleGrid;
     };
 
 }
@@ -9,6 +9,7 @@ namespace urchin {
      * Indices of points in CCW order when looked from top
      */
     NavTriangle::NavTriangle(std::size_t index1, std::size_t index2, std::size_t index3) :
+            navMeshIndex(0),
             indices() {
         assert(index1 != index2 && index1 != index3 && index2 != index3);
 
@@ -22,6 +23,7 @@ namespace urchin {
     }
 
     NavTriangle::NavTriangle(const NavTriangle& navTriangle) :
+            navMeshIndex(navTriangle.getNavMeshIndex()),
             indices(),
             centerPoint(navTriangle.getCenterPoint()) {
         this->indices[0] = navTriangle.getIndex(0);
@@ -36,6 +38,14 @@ namespace urchin {
         this->centerPoint = (navPolygon->getPoints()[indices[0]] + navPolygon->getPoints()[indices[1]] + navPolygon->getPoints()[indices[2]]) / 3.0f;
     }
 
+    void NavTriangle::setNavMeshIndex(uint32_t navMeshIndex) {
+        this->navMeshIndex = navMeshIndex;
+    }
+
+    uint32_t NavTriangle::getNavMeshIndex() const {
+        return navMeshIndex;
+    }
+
     std::shared_ptr<NavPolygon> NavTriangle::getNavPolygon() const {
         assert(!navPolygon.expired());
         return navPolygon.lock();
@@ -85,7 +95,7 @@ namespace urchin {
         });
     }
 
-    std::vector<std::shared_ptr<NavLink>> NavTriangle::getLinks() const {
+    const std::vector<std::shared_ptr<NavLink>>& NavTriangle::getLinks() const {
         return links;
     }
 
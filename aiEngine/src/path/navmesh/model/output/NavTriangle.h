@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 #include <UrchinCommon.h>
 
 #include "path/navmesh/model/output/NavLink.h"
@@ -18,6 +19,8 @@ namespace urchin {
             ~NavTriangle() = default;
 
             void attachNavPolygon(const std::shared_ptr<NavPolygon>&);
+            void setNavMeshIndex(uint32_t);
+            uint32_t getNavMeshIndex() const;
 
             std::shared_ptr<NavPolygon> getNavPolygon() const;
             const Point3<float>& getCenterPoint() const;
@@ -30,7 +33,7 @@ namespace urchin {
             void addJumpLink(std::size_t, const std::shared_ptr<NavTriangle>&, std::unique_ptr<NavLinkConstraint>);
             void addLink(const std::shared_ptr<NavLink>&);
             void removeLinksTo(const NavPolygon&);
-            std::vector<std::shared_ptr<NavLink>> getLinks() const;
+            const std::vector<std::shared_ptr<NavLink>>& getLinks() const;
 
             bool hasEdgeLinks(std::size_t) const;
             bool isExternalEdge(std::size_t) const;
@@ -41,6 +44,7 @@ namespace urchin {
 
             std::weak_ptr<NavPolygon> navPolygon; //use weak_ptr to avoid cyclic references (=memory leak) between triangle and polygon
 
+            uint32_t navMeshIndex; //dense index of the triangle in the navigation mesh
             std::array<std::size_t, 3> indices;
             std::vector<std::shared_ptr<NavLink>> links;
 
@@ -0,0 +1,130 @@
+#include <cmath>
+
+#include "path/navmesh/model/output/NavTriangleGrid.h"
+
+namespace urchin {
+
+    NavTriangleGrid::NavTriangleGrid() :
+            invCellSize(1.0f),
+            cellsCountX(0),
+            cellsCountZ(0) {
+
+    }
+
+    void NavTriangleGrid::build(const std::vector<std::shared_ptr<NavPolygon>>& polygons) {
+        triangles.clear();
+        cellsOffset.clear();
+        cellsTriangles.clear();
+        cellsCountX = 0;
+        cellsCountZ = 0;
+
+        gridMin = Point2(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        gridMax = Point2(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+        for (const auto& polygon : polygons) {
+            for (const auto& triangle : polygon->getTriangles()) {
+                std::array<Point2<float>, 3> points = {
+                        polygon->getPoint(triangle->getIndex(0)).toPoint2XZ(),
+                        polygon->getPoint(triangle->getIndex(1)).toPoint2XZ(),
+                        polygon->getPoint(triangle->getIndex(2)).toPoint2XZ()};
+                for (const Point2<float>& point : points) {
+                    gridMin = Point2(std::min(gridMin.X, point.X), std::min(gridMin.Y, point.Y));
+                    gridMax = Point2(std::max(gridMax.X, point.X), std::max(gridMax.Y, point.Y));
+                }
+                triangles.push_back({points, triangle->getCenterPoint().Y, triangle});
+            }
+        }
+        if (triangles.empty()) {
+            return;
+        }
+
+        //cell size giving about TRIANGLES_BY_CELL triangles by cell on a uniformly covered area
+        float width = gridMax.X - gridMin.X;
+        float depth = gridMax.Y - gridMin.Y;
+        float trianglesByCell = (float)TRIANGLES_BY_CELL / (float)triangles.size();
+        float cellSize = std::max({std::sqrt(width * depth * trianglesByCell), std::max(width, depth) * trianglesByCell, 0.01f});
+        invCellSize = 1.0f / cellSize;
+        cellsCountX = std::max(1u, MathFunction::ceilToUInt(width * invCellSize));
+        cellsCountZ = std::max(1u, MathFunction::ceilToUInt(depth * invCellSize));
+
+        //count the triangles by cell, compute the cells offset and fill the cells
+        cellsOffset.assign((std::size_t)cellsCountX * cellsCountZ + 1, 0);
+        for (int pass = 0; pass < 2; ++pass) {
+            for (uint32_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex) {
+                const std::array<Point2<float>, 3>& points = triangles[triangleIndex].points;
+                unsigned int minCellX = toCellX(std::min({points[0].X, points[1].X, points[2].X}));
+                unsigned int maxCellX = toCellX(std::max({points[0].X, points[1].X, points[2].X}));
+                unsigned int minCellZ = toCellZ(std::min({points[0].Y, points[1].Y, points[2].Y}));
+                unsigned int maxCellZ = toCellZ(std::max({points[0].Y, points[1].Y, points[2].Y}));
+                for (unsigned int cellZ = minCellZ; cellZ <= maxCellZ; ++cellZ) {
+                    for (unsigned int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+                        std::size_t cellIndex = cellX + (std::size_t)cellZ * cellsCountX;
+                        if (pass == 0) {
+                            cellsOffset[cellIndex + 1]++;
+                        } else {
+                            cellsTriangles[cellsOffset[cellIndex]++] = triangleIndex;
+                        }
+                    }
+                }
+            }
+
+            if (pass == 0) {
+                for (std::size_t cellIndex = 1; cellIndex < cellsOffset.size(); ++cellIndex) {
+                    cellsOffset[cellIndex] += cellsOffset[cellIndex - 1];
+                }
+                cellsTriangles.resize(cellsOffset.back());
+            }
+        }
+        for (std::size_t cellIndex = cellsOffset.size() - 1; cellIndex > 0; --cellIndex) { //filling pass shifted the offsets of one cell
+            cellsOffset[cellIndex] = cellsOffset[cellIndex - 1];
+        }
+        cellsOffset[0] = 0;
+    }
+
+    /**
+     * @return Triangle containing the point on the XZ plane and having its center just below the point. Null pointer when no triangle is found.
+     */
+    std::shared_ptr<NavTriangle> NavTriangleGrid::findTriangle(const Point3<float>& point) const {
+        if (triangles.empty() || point.X < gridMin.X || point.X > gridMax.X || point.Z < gridMin.Y || point.Z > gridMax.Y) {
+            return nullptr;
+        }
+
+        Point2 flattenPoint(point.X, point.Z);
+        std::size_t cellIndex = toCellX(point.X) + (std::size_t)toCellZ(point.Z) * cellsCountX;
+        float bestVerticalDistance = std::numeric_limits<float>::max();
+        const IndexedTriangle* result = nullptr;
+        for (uint32_t i = cellsOffset[cellIndex]; i < cellsOffset[cellIndex + 1]; ++i) {
+            const IndexedTriangle& indexedTriangle = triangles[cellsTriangles[i]];
+            float verticalDistance = point.Y - indexedTriangle.centerY;
+            if (verticalDistance >= 0.0f && verticalDistance < bestVerticalDistance && isPointInsideTriangle(flattenPoint, indexedTriangle.points)) {
+                bestVerticalDistance = verticalDistance;
+                result = &indexedTriangle;
+            }
+        }
+        return result ? result->triangle : nullptr;
+    }
+
+    unsigned int NavTriangleGrid::toCellX(float x) const {
+        return std::min((unsigned int)std::max(0.0f, (x - gridMin.X) * invCellSize), cellsCountX - 1);
+    }
+
+    unsigned int NavTriangleGrid::toCellZ(float z) const {
+        return std::min((unsigned int)std::max(0.0f, (z - gridMin.Y) * invCellSize), cellsCountZ - 1);
+    }
+
+    bool NavTriangleGrid::isPointInsideTriangle(const Point2<float>& point, const std::array<Point2<float>, 3>& trianglePoints) {
+        float crossProduct1 = crossProduct(point, trianglePoints[0], trianglePoints[1]);
+        float crossProduct2 = crossProduct(point, trianglePoints[1], trianglePoints[2]);
+        float crossProduct3 = crossProduct(point, trianglePoints[2], trianglePoints[0]);
+
+        //check cross products sign: a null cross product (point on an edge line) must not hide a different sign of the two others
+        bool hasNegativeCrossProduct = crossProduct1 < 0.0f || crossProduct2 < 0.0f || crossProduct3 < 0.0f;
+        bool hasPositiveCrossProduct = crossProduct1 > 0.0f || crossProduct2 > 0.0f || crossProduct3 > 0.0f;
+        return !(hasNegativeCrossProduct && hasPositiveCrossProduct);
+    }
+
+    float NavTriangleGrid::crossProduct(const Point2<float>& p1, const Point2<float>& p2, const Point2<float>& p3) {
+        //Same as: p3.vector(p1).crossProduct(p3.vector(p2))
+        return (p1.X - p3.X) * (p2.Y - p3.Y) - (p2.X - p3.X) * (p1.Y - p3.Y);
+    }
+
+}
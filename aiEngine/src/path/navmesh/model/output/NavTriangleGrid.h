@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <UrchinCommon.h>
+
+#include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/model/output/NavTriangle.h"
+
+namespace urchin {
+
+    /**
+     * Uniform grid on the XZ plane referencing the navigation triangles overlapping each cell. Cells content is stored in a single array (cells offsets
+     * + triangles indices) to locate a point with a few memory accesses.
+     */
+    class NavTriangleGrid {
+        public:
+            NavTriangleGrid();
+
+            void build(const std::vector<std::shared_ptr<NavPolygon>>&);
+
+            std::shared_ptr<NavTriangle> findTriangle(const Point3<float>&) const;
+
+        private:
+            struct IndexedTriangle {
+                std::array<Point2<float>, 3> points;
+                float centerY;
+                std::shared_ptr<NavTriangle> triangle;
+            };
+
+            unsigned int toCellX(float) const;
+            unsigned int toCellZ(float) const;
+            static bool isPointInsideTriangle(const Point2<float>&, const std::array<Point2<float>, 3>&);
+            static float crossProduct(const Point2<float>&, const Point2<float>&, const Point2<float>&);
+
+            static constexpr unsigned int TRIANGLES_BY_CELL = 2;
+
+            std::vector<IndexedTriangle> triangles;
+            Point2<float> gridMin;
+            Point2<float> gridMax;
+            float invCellSize;
+            unsigned int cellsCountX;
+            unsigned int cellsCountZ;
+            std::vector<uint32_t> cellsOffset;
+            std::vector<uint32_t> cellsTriangles;
+    };
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "path/navmesh/model/output/NavTriangle.h"
+
+#include <memory>
+#include <vector>
+
+namespace urchin {
+
+    /**
+     * Links of a triangle shared between several navigation meshes, completed with the links specific to a navigation mesh
+     */
+    struct NavTriangleLinks {
+        std::shared_ptr<NavTriangle> triangle;
+        std::vector<std::shared_ptr<NavLink>> links;
+    };
+
+}
@@ -0,0 +1,250 @@
+#include <array>
+#include <cmath>
+
+#include "path/navmesh/voxel/VoxelHeightfield.h"
+
+namespace urchin {
+
+    namespace {
+        constexpr std::size_t MAX_CLIPPED_POINTS = 12;
+        using ClippedPolygon = std::array<Point3<float>, MAX_CLIPPED_POINTS>;
+
+        float axisValue(const Point3<float>& point, unsigned int axis) {
+            return axis == 0 ? point.X : point.Z;
+        }
+
+        /**
+         * Split a convex polygon with the plane 'axis = axisOffset'
+         * @param belowPolygon [out] Part of the polygon having an axis value lower than the offset
+         * @param abovePolygon [out] Part of the polygon having an axis value greater than the offset
+         */
+        void dividePolygon(const ClippedPolygon& polygon, std::size_t pointsCount, ClippedPolygon& belowPolygon, std::size_t& belowPointsCount,
+                           ClippedPolygon& abovePolygon, std::size_t& abovePointsCount, float axisOffset, unsigned int axis) {
+            std::array<float, MAX_CLIPPED_POINTS> distances{};
+            for (std::size_t i = 0; i < pointsCount; ++i) {
+                distances[i] = axisOffset - axisValue(polygon[i], axis);
+            }
+
+            belowPointsCount = 0;
+            abovePointsCount = 0;
+            for (std::size_t i = 0, j = pointsCount - 1; i < pointsCount; j = i, ++i) {
+                bool iBelow = distances[i] >= 0.0f;
+                bool jBelow = distances[j] >= 0.0f;
+                if (iBelow != jBelow) {
+                    float ratio = distances[j] / (distances[j] - distances[i]);
+                    Point3<float> intersection = polygon[j] + (polygon[i] - polygon[j]) * ratio;
+                    belowPolygon[belowPointsCount++] = intersection;
+                    abovePolygon[abovePointsCount++] = intersection;
+                    if (distances[i] > 0.0f) {
+                        belowPolygon[belowPointsCount++] = polygon[i];
+                    } else if (distances[i] < 0.0f) {
+                        abovePolygon[abovePointsCount++] = polygon[i];
+                    }
+                } else {
+                    if (distances[i] >= 0.0f) {
+                        belowPolygon[belowPointsCount++] = polygon[i];
+                        if (distances[i] != 0.0f) {
+                            continue;
+                        }
+                    }
+                    abovePolygon[abovePointsCount++] = polygon[i];
+                }
+            }
+        }
+    }
+
+    /**
+     * @param origin Minimum point of the heightfield
+     * @param width Number of columns on X axis
+     * @param depth Number of columns on Z axis
+     * @param voxelSize Size of a column on X and Z axis
+     * @param voxelHeight Height of a voxel
+     * @param mergeThreshold Maximum difference (in voxels) between two span tops to merge their walkable flags
+     */
+    VoxelHeightfield::VoxelHeightfield(const Point3<float>& origin, unsigned int width, unsigned int depth, float voxelSize, float voxelHeight, int mergeThreshold) :
+            origin(origin),
+            width(width),
+            depth(depth),
+            voxelSize(voxelSize),
+            voxelHeight(voxelHeight),
+            mergeThreshold(mergeThreshold),
+            columnsFirstSpan((std::size_t)width * depth, NO_SPAN),
+            freeSpan(NO_SPAN) {
+        spans.reserve((std::size_t)width * depth); //estimated memory size
+    }
+
+    /**
+     * Add the spans covered by the triangle in the columns. A span covers a column as soon as the triangle overlaps the column (conservative rasterization).
+     */
+    void VoxelHeightfield::rasterizeTriangle(const VoxelTriangle& triangle) {
+        const std::array<Point3<float>, 3>& points = triangle.points;
+        float triangleMinX = std::min({points[0].X, points[1].X, points[2].X});
+        float triangleMaxX = std::max({points[0].X, points[1].X, points[2].X});
+        float triangleMinZ = std::min({points[0].Z, points[1].Z, points[2].Z});
+        float triangleMaxZ = std::max({points[0].Z, points[1].Z, points[2].Z});
+        float heightfieldMaxX = origin.X + (float)width * voxelSize;
+        float heightfieldMaxZ = origin.Z + (float)depth * voxelSize;
+        if (triangleMaxX < origin.X || triangleMinX > heightfieldMaxX || triangleMaxZ < origin.Z || triangleMinZ > heightfieldMaxZ) {
+            return;
+        }
+
+        Vector3<float> normal = points[0].vector(points[1]).crossProduct(points[0].vector(points[2]));
+        bool hasSurfacePlane = std::abs(normal.Y) > std::numeric_limits<float>::epsilon();
+
+        int minZ = std::clamp((int)std::floor((triangleMinZ - origin.Z) / voxelSize), 0, (int)depth - 1);
+        int maxZ = std::clamp((int)std::floor((triangleMaxZ - origin.Z) / voxelSize), 0, (int)depth - 1);
+
+        ClippedPolygon remainingPolygon;
+        ClippedPolygon rowPolygon;
+        ClippedPolygon columnPolygon;
+        ClippedPolygon nextRemainingPolygon;
+        std::copy(points.begin(), points.end(), remainingPolygon.begin());
+        std::size_t remainingPointsCount = 3;
+        if (triangleMinZ < origin.Z) { //remove the part of the triangle located outside the heightfield
+            std::size_t outsidePointsCount;
+            dividePolygon(remainingPolygon, remainingPointsCount, rowPolygon, outsidePointsCount, nextRemainingPolygon, remainingPointsCount, origin.Z, 2);
+            std::swap(remainingPolygon, nextRemainingPolygon);
+        }
+
+        for (int z = minZ; z <= maxZ && remainingPointsCount >= 3; ++z) {
+            float rowMaxZ = origin.Z + (float)(z + 1) * voxelSize;
+            std::size_t rowPointsCount;
+            std::size_t nextRemainingPointsCount;
+            dividePolygon(remainingPolygon, remainingPointsCount, rowPolygon, rowPointsCount, nextRemainingPolygon, nextRemainingPointsCount, rowMaxZ, 2);
+            std::swap(remainingPolygon, nextRemainingPolygon);
+            remainingPointsCount = nextRemainingPointsCount;
+            if (rowPointsCount < 3) {
+                continue;
+            }
+
+            float rowMinX = rowPolygon[0].X;
+            float rowMaxX = rowPolygon[0].X;
+            for (std::size_t i = 1; i < rowPointsCount; ++i) {
+                rowMinX = std::min(rowMinX, rowPolygon[i].X);
+                rowMaxX = std::max(rowMaxX, rowPolygon[i].X);
+            }
+            if (rowMinX < origin.X) { //remove the part of the row located outside the heightfield
+                std::size_t outsidePointsCount;
+                std::size_t insidePointsCount;
+                dividePolygon(rowPolygon, rowPointsCount, columnPolygon, outsidePointsCount, nextRemainingPolygon, insidePointsCount, origin.X, 0);
+                std::swap(rowPolygon, nextRemainingPolygon);
+                rowPointsCount = insidePointsCount;
+            }
+            int minX = std::clamp((int)std::floor((rowMinX - origin.X) / voxelSize), 0, (int)width - 1);
+            int maxX = std::clamp((int)std::floor((rowMaxX - origin.X) / voxelSize), 0, (int)width - 1);
+
+            for (int x = minX; x <= maxX && rowPointsCount >= 3; ++x) {
+                float columnMaxX = origin.X + (float)(x + 1) * voxelSize;
+                std::size_t columnPointsCount;
+                std::size_t nextRowPointsCount;
+                dividePolygon(rowPolygon, rowPointsCount, columnPolygon, columnPointsCount, nextRemainingPolygon, nextRowPointsCount, columnMaxX, 0);
+                std::swap(rowPolygon, nextRemainingPolygon);
+                rowPointsCount = nextRowPointsCount;
+                if (columnPointsCount < 3) {
+                    continue;
+                }
+
+                float minY = columnPolygon[0].Y;
+                float maxY = columnPolygon[0].Y;
+                for (std::size_t i = 1; i < columnPointsCount; ++i) {
+                    minY = std::min(minY, columnPolygon[i].Y);
+                    maxY = std::max(maxY, columnPolygon[i].Y);
+                }
+
+                float surfaceY = maxY;
+                if (hasSurfacePlane) {
+                    float columnCenterX = columnMaxX - voxelSize * 0.5f;
+                    float rowCenterZ = rowMaxZ - voxelSize * 0.5f;
+                    float planeY = points[0].Y - (normal.X * (columnCenterX - points[0].X) + normal.Z * (rowCenterZ - points[0].Z)) / normal.Y;
+                    surfaceY = std::clamp(planeY, minY, maxY);
+                }
+
+                int spanMinY = (int)std::floor((minY - origin.Y) / voxelHeight);
+                int spanMaxY = std::max((int)std::ceil((maxY - origin.Y) / voxelHeight), spanMinY + 1);
+                addSpan((unsigned int)x, (unsigned int)z, spanMinY, spanMaxY, surfaceY, triangle.walkable);
+            }
+        }
+    }
+
+    unsigned int VoxelHeightfield::getWidth() const {
+        return width;
+    }
+
+    unsigned int VoxelHeightfield::getDepth() const {
+        return depth;
+    }
+
+    /**
+     * @return First (lowest) span of the column or NO_SPAN when the column is empty
+     */
+    uint32_t VoxelHeightfield::getFirstSpan(unsigned int x, unsigned int z) const {
+        return columnsFirstSpan[x + (std::size_t)z * width];
+    }
+
+    const VoxelSpan& VoxelHeightfield::getSpan(uint32_t spanIndex) const {
+        return spans[spanIndex];
+    }
+
+    /**
+     * Insert a span in the sorted spans of the column and merge it with the overlapping spans
+     */
+    void VoxelHeightfield::addSpan(unsigned int x, unsigned int z, int minY, int maxY, float surfaceY, bool walkable) {
+        std::size_t columnIndex = x + (std::size_t)z * width;
+        uint32_t previousSpanIndex = NO_SPAN;
+        uint32_t currentSpanIndex = columnsFirstSpan[columnIndex];
+
+        while (currentSpanIndex != NO_SPAN) {
+            const VoxelSpan& currentSpan = spans[currentSpanIndex];
+            if (currentSpan.minY > maxY) {
+                break;
+            } else if (currentSpan.maxY < minY) {
+                previousSpanIndex = currentSpanIndex;
+                currentSpanIndex = currentSpan.next;
+                continue;
+            }
+
+            if (std::abs(currentSpan.maxY - maxY) <= mergeThreshold) {
+                walkable = walkable || currentSpan.walkable;
+                surfaceY = std::max(surfaceY, currentSpan.surfaceY);
+            } else if (currentSpan.maxY > maxY) {
+                walkable = currentSpan.walkable;
+                surfaceY = currentSpan.surfaceY;
+            }
+            minY = std::min(minY, currentSpan.minY);
+            maxY = std::max(maxY, currentSpan.maxY);
+
+            uint32_t nextSpanIndex = currentSpan.next;
+            releaseSpan(currentSpanIndex);
+            if (previousSpanIndex == NO_SPAN) {
+                columnsFirstSpan[columnIndex] = nextSpanIndex;
+            } else {
+                spans[previousSpanIndex].next = nextSpanIndex;
+            }
+            currentSpanIndex = nextSpanIndex;
+        }
+
+        uint32_t newSpanIndex = allocateSpan();
+        spans[newSpanIndex] = {minY, maxY, surfaceY, walkable, currentSpanIndex};
+        if (previousSpanIndex == NO_SPAN) {
+            columnsFirstSpan[columnIndex] = newSpanIndex;
+        } else {
+            spans[previousSpanIndex].next = newSpanIndex;
+        }
+    }
+
+    uint32_t VoxelHeightfield::allocateSpan() {
+        if (freeSpan != NO_SPAN) {
+            uint32_t spanIndex = freeSpan;
+            freeSpan = spans[spanIndex].next;
+            return spanIndex;
+        }
+        spans.emplace_back();
+        return (uint32_t)(spans.size() - 1);
+    }
+
+    void VoxelHeightfield::releaseSpan(uint32_t spanIndex) {
+        spans[spanIndex].next = freeSpan;
+        freeSpan = spanIndex;
+    }
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <UrchinCommon.h>
+
+#include "path/navmesh/voxel/VoxelInputGeometry.h"
+
+namespace urchin {
+
+    struct VoxelSpan {
+        int minY; //in voxels
+        int maxY; //in voxels
+        float surfaceY; //height of the top surface at the center of the column
+        bool walkable;
+        uint32_t next;
+    };
+
+    /**
+     * Solid spans of a grid of columns: each column contains the sorted and non-overlapping spans of the rasterized triangles
+     */
+    class VoxelHeightfield {
+        public:
+            static constexpr uint32_t NO_SPAN = std::numeric_limits<uint32_t>::max();
+
+            VoxelHeightfield(const Point3<float>&, unsigned int, unsigned int, float, float, int);
+
+            void rasterizeTriangle(const VoxelTriangle&);
+
+            unsigned int getWidth() const;
+            unsigned int getDepth() const;
+            uint32_t getFirstSpan(unsigned int, unsigned int) const;
+            const VoxelSpan& getSpan(uint32_t) const;
+
+        private:
+            void addSpan(unsigned int, unsigned int, int, int, float, bool);
+            uint32_t allocateSpan();
+            void releaseSpan(uint32_t);
+
+            Point3<float> origin;
+            unsigned int width;
+            unsigned int depth;
+            float voxelSize;
+            float voxelHeight;
+            int mergeThreshold;
+
+            std::vector<uint32_t> columnsFirstSpan;
+            std::vector<VoxelSpan> spans;
+            uint32_t freeSpan;
+    };
+
+}
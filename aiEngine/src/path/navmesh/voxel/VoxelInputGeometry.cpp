@@ -0,0 +1,140 @@
+#include <cmath>
+
+#include "path/navmesh/voxel/VoxelInputGeometry.h"
+
+namespace urchin {
+
+    /**
+     * @param maxSlopeInRadian Maximum slope of a triangle to be considered as walkable
+     */
+    VoxelInputGeometry::VoxelInputGeometry(float maxSlopeInRadian) :
+            walkableNormalY(std::cos(maxSlopeInRadian)),
+            min(Point3(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max())),
+            max(Point3(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max())) {
+
+    }
+
+    void VoxelInputGeometry::addEntity(const AIEntity& aiEntity) {
+        if (aiEntity.getType() == AIEntity::OBJECT) {
+            addObject(static_cast<const AIObject&>(aiEntity));
+        } else if (aiEntity.getType() == AIEntity::TERRAIN) {
+            addTerrain(static_cast<const AITerrain&>(aiEntity));
+        } else {
+            throw std::invalid_argument("Unknown AI entity type: " + std::to_string(aiEntity.getType()));
+        }
+    }
+
+    bool VoxelInputGeometry::isEmpty() const {
+        return triangles.empty();
+    }
+
+    const std::vector<VoxelTriangle>& VoxelInputGeometry::getTriangles() const {
+        return triangles;
+    }
+
+    const Point3<float>& VoxelInputGeometry::getMin() const {
+        return min;
+    }
+
+    const Point3<float>& VoxelInputGeometry::getMax() const {
+        return max;
+    }
+
+    void VoxelInputGeometry::addObject(const AIObject& aiObject) {
+        Transform<float> objectTransform = aiObject.getTransform();
+        for (const auto& aiShape : aiObject.getShapes()) {
+            Transform<float> shapeTransform = aiShape->hasLocalTransform() ? objectTransform * aiShape->getLocalTransform() : objectTransform;
+            std::unique_ptr<ConvexObject3D<float>> convexObject = aiShape->getShape().toConvexObject(shapeTransform);
+            addConvexObject(*convexObject);
+        }
+    }
+
+    void VoxelInputGeometry::addTerrain(const AITerrain& aiTerrain) {
+        Transform<float> terrainTransform = aiTerrain.getTransform();
+        auto toWorldVertex = [&](unsigned int x, unsigned int z) {
+            return terrainTransform.getOrientation().rotatePoint(aiTerrain.getLocalVertex(x, z)) + terrainTransform.getPosition();
+        };
+
+        for (unsigned int z = 0; z + 1 < aiTerrain.getZLength(); ++z) {
+            for (unsigned int x = 0; x + 1 < aiTerrain.getXLength(); ++x) {
+                Point3<float> point00 = toWorldVertex(x, z);
+                Point3<float> point10 = toWorldVertex(x + 1, z);
+                Point3<float> point01 = toWorldVertex(x, z + 1);
+                Point3<float> point11 = toWorldVertex(x + 1, z + 1);
+                addTriangle(point00, point01, point10, true);
+                addTriangle(point10, point01, point11, true);
+            }
+        }
+    }
+
+    /**
+     * Add the triangles of the convex hull of the object. Boxes and convex hulls are exact while the curved objects are approximated with their support points.
+     */
+    void VoxelInputGeometry::addConvexObject(const ConvexObject3D<float>& convexObject) {
+        std::unique_ptr<ConvexHull3D<float>> builtConvexHull;
+        if (convexObject.getObjectType() == ConvexObjectType::OBBOX) {
+            builtConvexHull = std::make_unique<ConvexHull3D<float>>(static_cast<const OBBox<float>&>(convexObject).getPoints());
+        } else if (convexObject.getObjectType() != ConvexObjectType::CONVEX_HULL) {
+            std::vector<Point3<float>> supportPoints;
+            supportPoints.reserve(getSupportDirections().size());
+            for (const Vector3<float>& supportDirection : getSupportDirections()) {
+                Point3<float> supportPoint = convexObject.getSupportPoint(supportDirection);
+                if (std::ranges::none_of(supportPoints, [&supportPoint](const Point3<float>& p) { return p.squareDistance(supportPoint) < 0.0001f; })) {
+                    supportPoints.push_back(supportPoint);
+                }
+            }
+            builtConvexHull = std::make_unique<ConvexHull3D<float>>(supportPoints);
+        }
+        const auto* convexHull = builtConvexHull ? builtConvexHull.get() : static_cast<const ConvexHull3D<float>*>(&convexObject);
+
+        const std::map<std::size_t, ConvexHullPoint<float>>& hullPoints = convexHull->getConvexHullPoints();
+        for (const auto& [triangleIndex, indexedTriangle] : convexHull->getIndexedTriangles()) {
+            addTriangle(hullPoints.at(indexedTriangle.getIndex(0)).point, hullPoints.at(indexedTriangle.getIndex(1)).point, hullPoints.at(indexedTriangle.getIndex(2)).point, false);
+        }
+    }
+
+    /**
+     * @param isTopSurface True when the triangle is a surface seen from the top whatever its winding (e.g. terrain)
+     */
+    void VoxelInputGeometry::addTriangle(const Point3<float>& point1, const Point3<float>& point2, const Point3<float>& point3, bool isTopSurface) {
+        Vector3<float> normal = point1.vector(point2).crossProduct(point1.vector(point3));
+        float normalLength = normal.length();
+        if (normalLength <= std::numeric_limits<float>::epsilon()) {
+            return; //degenerate triangle
+        }
+        float normalY = normal.Y / normalLength;
+        if (isTopSurface) {
+            normalY = std::abs(normalY);
+        }
+
+        triangles.push_back({{point1, point2, point3}, normalY >= walkableNormalY});
+        for (const auto& point : {point1, point2, point3}) {
+            min = Point3(std::min(min.X, point.X), std::min(min.Y, point.Y), std::min(min.Z, point.Z));
+            max = Point3(std::max(max.X, point.X), std::max(max.Y, point.Y), std::max(max.Z, point.Z));
+        }
+    }
+
+    /**
+     * @return Directions (latitude/longitude sampling) used to approximate the curved objects by their support points
+     */
+    const std::vector<Vector3<float>>& VoxelInputGeometry::getSupportDirections() {
+        static const std::vector<Vector3<float>> supportDirections = [] {
+            constexpr unsigned int LATITUDES_COUNT = 7;
+            constexpr unsigned int LONGITUDES_COUNT = 16;
+            std::vector<Vector3<float>> directions;
+            directions.reserve(LATITUDES_COUNT * LONGITUDES_COUNT + 2);
+            directions.emplace_back(0.0f, 1.0f, 0.0f);
+            directions.emplace_back(0.0f, -1.0f, 0.0f);
+            for (unsigned int latitude = 1; latitude <= LATITUDES_COUNT; ++latitude) {
+                float polarAngle = MathValue::PI_FLOAT * (float)latitude / (float)(LATITUDES_COUNT + 1);
+                for (unsigned int longitude = 0; longitude < LONGITUDES_COUNT; ++longitude) {
+                    float azimuthAngle = 2.0f * MathValue::PI_FLOAT * (float)longitude / (float)LONGITUDES_COUNT;
+                    directions.emplace_back(std::sin(polarAngle) * std::cos(azimuthAngle), std::cos(polarAngle), std::sin(polarAngle) * std::sin(azimuthAngle));
+                }
+            }
+            return directions;
+        }();
+        return supportDirections;
+    }
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "input/AIEntity.h"
+#include "input/AIObject.h"
+#include "input/AITerrain.h"
+
+namespace urchin {
+
+    struct VoxelTriangle {
+        std::array<Point3<float>, 3> points;
+        bool walkable;
+    };
+
+    /**
+     * Triangles of the AI world entities used to build the voxel heightfields
+     */
+    class VoxelInputGeometry {
+        public:
+            explicit VoxelInputGeometry(float);
+
+            void addEntity(const AIEntity&);
+
+            bool isEmpty() const;
+            const std::vector<VoxelTriangle>& getTriangles() const;
+            const Point3<float>& getMin() const;
+            const Point3<float>& getMax() const;
+
+        private:
+            void addObject(const AIObject&);
+            void addTerrain(const AITerrain&);
+            void addConvexObject(const ConvexObject3D<float>&);
+            void addTriangle(const Point3<float>&, const Point3<float>&, const Point3<float>&, bool);
+
+            static const std::vector<Vector3<float>>& getSupportDirections();
+
+            float walkableNormalY;
+            std::vector<VoxelTriangle> triangles;
+            Point3<float> min;
+            Point3<float> max;
+    };
+
+}
@@ -0,0 +1,287 @@
+#include <cmath>
+#include <set>
+#include <unordered_map>
+
+#include "path/navmesh/voxel/VoxelTileBuilder.h"
+#include "path/navmesh/voxel/VoxelHeightfield.h"
+
+namespace urchin {
+
+    /**
+     * @param voxelSize Size of a voxel on X and Z axis
+     * @param voxelHeight Height of a voxel
+     * @param maxHeightError Maximum distance between the surface and the navigation polygons
+     */
+    VoxelTileBuilder::VoxelTileBuilder(const NavMeshAgent& navMeshAgent, float voxelSize, float voxelHeight, float maxHeightError) :
+            voxelSize(voxelSize),
+            voxelHeight(voxelHeight),
+            maxHeightError(maxHeightError),
+            agentHeight((int)std::ceil(navMeshAgent.getAgentHeight() / voxelHeight)),
+            agentClimb((int)std::ceil(std::min(voxelSize * std::tan(navMeshAgent.getMaxSlope()), navMeshAgent.getAgentHeight()) / voxelHeight) + 1),
+            erosionDistance((unsigned int)std::max(0.0f, std::ceil(navMeshAgent.getAgentRadius() / voxelSize - 0.5f))),
+            borderSize(erosionDistance + 1) {
+
+    }
+
+    /**
+     * @return Number of columns added around a tile to take into account the geometry of the neighbour tiles during the erosion
+     */
+    unsigned int VoxelTileBuilder::getBorderSize() const {
+        return borderSize;
+    }
+
+    /**
+     * @param triangles Geometry triangles overlapping the tile (border included)
+     * @param gridOrigin Origin of the tiles grid
+     * @param tileCoordinate Coordinate of the tile in the tiles grid
+     * @param tileSize Number of columns of the tile on X and Z axis
+     * @param adjacentRegions [out] Indices of the polygons of the tile regions having connected spans
+     */
+    std::vector<std::shared_ptr<NavPolygon>> VoxelTileBuilder::buildTile(const std::vector<const VoxelTriangle*>& triangles, const Point3<float>& gridOrigin,
+                                                                        const Point2<int>& tileCoordinate, unsigned int tileSize,
+                                                                        std::vector<std::pair<std::size_t, std::size_t>>& adjacentRegions) const {
+        Point2 cellOffset(tileCoordinate.X * (int)tileSize - (int)borderSize, tileCoordinate.Y * (int)tileSize - (int)borderSize);
+        Point3 heightfieldOrigin(gridOrigin.X + (float)cellOffset.X * voxelSize, gridOrigin.Y, gridOrigin.Z + (float)cellOffset.Y * voxelSize);
+        unsigned int heightfieldSize = tileSize + 2 * borderSize;
+
+        VoxelHeightfield heightfield(heightfieldOrigin, heightfieldSize, heightfieldSize, voxelSize, voxelHeight, agentClimb);
+        for (const VoxelTriangle* triangle : triangles) {
+            heightfield.rasterizeTriangle(*triangle);
+        }
+
+        VoxelWalkableField walkableField(heightfield, agentHeight, agentClimb);
+        walkableField.erode(erosionDistance);
+        uint32_t regionsCount = walkableField.buildRegions(borderSize, borderSize, borderSize + tileSize, borderSize + tileSize);
+
+        std::vector<std::vector<RegionCell>> regionsCells(regionsCount);
+        std::set<std::pair<std::size_t, std::size_t>> adjacentRegionsSet;
+        for (unsigned int z = borderSize; z < borderSize + tileSize; ++z) {
+            for (unsigned int x = borderSize; x < borderSize + tileSize; ++x) {
+                auto [firstSpan, spansCount] = walkableField.getColumnSpans(x, z);
+                for (uint32_t spanIndex = firstSpan; spanIndex < firstSpan + spansCount; ++spanIndex) {
+                    const WalkableSpan& span = walkableField.getSpan(spanIndex);
+                    regionsCells[span.regionId].push_back({x, z, spanIndex});
+
+                    for (uint32_t neighbourIndex : span.neighbours) {
+                        if (neighbourIndex == VoxelWalkableField::NO_NEIGHBOUR) {
+                            continue;
+                        }
+                        uint32_t neighbourRegionId = walkableField.getSpan(neighbourIndex).regionId;
+                        if (neighbourRegionId != VoxelWalkableField::NO_REGION && neighbourRegionId > span.regionId) { //spans of the border have no region
+                            adjacentRegionsSet.emplace(span.regionId, neighbourRegionId);
+                        }
+                    }
+                }
+            }
+        }
+        adjacentRegions.assign(adjacentRegionsSet.begin(), adjacentRegionsSet.end());
+
+        std::vector<std::shared_ptr<NavPolygon>> navPolygons;
+        navPolygons.reserve(regionsCount);
+        for (std::size_t regionId = 0; regionId < regionsCount; ++regionId) {
+            std::string polygonName = "tile" + std::to_string(tileCoordinate.X) + "_" + std::to_string(tileCoordinate.Y) + "_region" + std::to_string(regionId);
+            navPolygons.push_back(buildRegionPolygon(walkableField, regionsCells[regionId], gridOrigin, cellOffset, std::move(polygonName)));
+        }
+        return navPolygons;
+    }
+
+    /**
+     * Decompose the region in rectangles (greedy merge of the cells while the rectangle follows the surface) and triangulate each rectangle with the corners of
+     * the adjacent rectangles to avoid T-junctions between triangles.
+     */
+    std::shared_ptr<NavPolygon> VoxelTileBuilder::buildRegionPolygon(const VoxelWalkableField& walkableField, const std::vector<RegionCell>& regionCells,
+                                                                    const Point3<float>& gridOrigin, const Point2<int>& cellOffset, std::string polygonName) const {
+        unsigned int minX = std::numeric_limits<unsigned int>::max();
+        unsigned int minZ = std::numeric_limits<unsigned int>::max();
+        unsigned int maxX = 0;
+        unsigned int maxZ = 0;
+        for (const RegionCell& regionCell : regionCells) {
+            minX = std::min(minX, regionCell.x);
+            minZ = std::min(minZ, regionCell.z);
+            maxX = std::max(maxX, regionCell.x);
+            maxZ = std::max(maxZ, regionCell.z);
+        }
+        unsigned int width = maxX - minX + 1;
+        unsigned int depth = maxZ - minZ + 1;
+
+        std::vector<uint32_t> cellSpans((std::size_t)width * depth, VoxelWalkableField::NO_NEIGHBOUR);
+        for (const RegionCell& regionCell : regionCells) {
+            cellSpans[(regionCell.x - minX) + (std::size_t)(regionCell.z - minZ) * width] = regionCell.spanIndex;
+        }
+
+        //decompose the region in rectangles
+        std::vector<bool> assignedCells(cellSpans.size(), false);
+        auto isFreeCell = [&](unsigned int x, unsigned int z) {
+            std::size_t cellIndex = x + (std::size_t)z * width;
+            return cellSpans[cellIndex] != VoxelWalkableField::NO_NEIGHBOUR && !assignedCells[cellIndex];
+        };
+        std::vector<CellRectangle> rectangles;
+        std::vector<bool> usedCorners((std::size_t)(width + 1) * (depth + 1), false);
+        for (unsigned int z = 0; z < depth; ++z) {
+            for (unsigned int x = 0; x < width; ++x) {
+                if (!isFreeCell(x, z)) {
+                    continue;
+                }
+
+                CellRectangle rectangle{x, z, 1, 1};
+                while (rectangle.x + rectangle.width < width && isFreeCell(rectangle.x + rectangle.width, z)
+                        && followSurface(walkableField, cellSpans, width, {x, z, rectangle.width + 1, 1})) {
+                    rectangle.width++;
+                }
+                while (rectangle.z + rectangle.depth < depth) {
+                    bool isFreeRow = true;
+                    for (unsigned int rowX = x; rowX < x + rectangle.width && isFreeRow; ++rowX) {
+                        isFreeRow = isFreeCell(rowX, rectangle.z + rectangle.depth);
+                    }
+                    if (!isFreeRow || !followSurface(walkableField, cellSpans, width, {x, z, rectangle.width, rectangle.depth + 1})) {
+                        break;
+                    }
+                    rectangle.depth++;
+                }
+
+                for (unsigned int rectangleZ = z; rectangleZ < z + rectangle.depth; ++rectangleZ) {
+                    for (unsigned int rectangleX = x; rectangleX < x + rectangle.width; ++rectangleX) {
+                        assignedCells[rectangleX + (std::size_t)rectangleZ * width] = true;
+                    }
+                }
+                usedCorners[x + (std::size_t)z * (width + 1)] = true;
+                usedCorners[x + rectangle.width + (std::size_t)z * (width + 1)] = true;
+                usedCorners[x + (std::size_t)(z + rectangle.depth) * (width + 1)] = true;
+                usedCorners[x + rectangle.width + (std::size_t)(z + rectangle.depth) * (width + 1)] = true;
+                rectangles.push_back(rectangle);
+            }
+        }
+
+        //create the points on the rectangles corners: height is the average of the adjacent cells surface
+        std::vector<Point3<float>> points;
+        std::vector<uint32_t> cornerPoints(usedCorners.size(), VoxelWalkableField::NO_NEIGHBOUR);
+        auto retrieveCornerPoint = [&](unsigned int cornerX, unsigned int cornerZ) {
+            std::size_t cornerIndex = cornerX + (std::size_t)cornerZ * (width + 1);
+            if (cornerPoints[cornerIndex] == VoxelWalkableField::NO_NEIGHBOUR) {
+                float sumHeight = 0.0f;
+                unsigned int cellsCount = 0;
+                for (unsigned int cellZ = std::max(cornerZ, 1u) - 1; cellZ <= std::min(cornerZ, depth - 1); ++cellZ) {
+                    for (unsigned int cellX = std::max(cornerX, 1u) - 1; cellX <= std::min(cornerX, width - 1); ++cellX) {
+                        uint32_t spanIndex = cellSpans[cellX + (std::size_t)cellZ * width];
+                        if (spanIndex != VoxelWalkableField::NO_NEIGHBOUR) {
+                            sumHeight += walkableField.getSpan(spanIndex).surfaceY;
+                            cellsCount++;
+                        }
+                    }
+                }
+                float pointX = gridOrigin.X + (float)(cellOffset.X + (int)(minX + cornerX)) * voxelSize;
+                float pointZ = gridOrigin.Z + (float)(cellOffset.Y + (int)(minZ + cornerZ)) * voxelSize;
+                cornerPoints[cornerIndex] = (uint32_t)points.size();
+                points.emplace_back(pointX, sumHeight / (float)cellsCount, pointZ);
+            }
+            return cornerPoints[cornerIndex];
+        };
+
+        //triangulate the rectangles: points are in CCW order when looked from top
+        std::vector<std::shared_ptr<NavTriangle>> triangles;
+        std::vector<uint32_t> boundaryPoints;
+        for (const CellRectangle& rectangle : rectangles) {
+            unsigned int x0 = rectangle.x;
+            unsigned int z0 = rectangle.z;
+            unsigned int x1 = rectangle.x + rectangle.width;
+            unsigned int z1 = rectangle.z + rectangle.depth;
+
+            boundaryPoints.clear();
+            for (unsigned int cornerZ = z0; cornerZ < z1; ++cornerZ) {
+                if (cornerZ == z0 || usedCorners[x0 + (std::size_t)cornerZ * (width + 1)]) {
+                    boundaryPoints.push_back(retrieveCornerPoint(x0, cornerZ));
+                }
+            }
+            for (unsigned int cornerX = x0; cornerX < x1; ++cornerX) {
+                if (cornerX == x0 || usedCorners[cornerX + (std::size_t)z1 * (width + 1)]) {
+                    boundaryPoints.push_back(retrieveCornerPoint(cornerX, z1));
+                }
+            }
+            for (unsigned int cornerZ = z1; cornerZ > z0; --cornerZ) {
+                if (cornerZ == z1 || usedCorners[x1 + (std::size_t)cornerZ * (width + 1)]) {
+                    boundaryPoints.push_back(retrieveCornerPoint(x1, cornerZ));
+                }
+            }
+            for (unsigned int cornerX = x1; cornerX > x0; --cornerX) {
+                if (cornerX == x1 || usedCorners[cornerX + (std::size_t)z0 * (width + 1)]) {
+                    boundaryPoints.push_back(retrieveCornerPoint(cornerX, z0));
+                }
+            }
+
+            if (boundaryPoints.size() == 4) {
+                triangles.push_back(std::make_shared<NavTriangle>(boundaryPoints[0], boundaryPoints[1], boundaryPoints[2]));
+                triangles.push_back(std::make_shared<NavTriangle>(boundaryPoints[0], boundaryPoints[2], boundaryPoints[3]));
+            } else {
+                Point3<float> centerPoint = (points[boundaryPoints[0]] + points[retrieveCornerPoint(x0, z1)] + points[retrieveCornerPoint(x1, z1)] + points[retrieveCornerPoint(x1, z0)]) / 4.0f;
+                auto centerPointIndex = (uint32_t)points.size();
+                points.push_back(centerPoint);
+                for (std::size_t i = 0; i < boundaryPoints.size(); ++i) {
+                    triangles.push_back(std::make_shared<NavTriangle>(centerPointIndex, boundaryPoints[i], boundaryPoints[(i + 1) % boundaryPoints.size()]));
+                }
+            }
+        }
+
+        auto navPolygon = std::make_shared<NavPolygon>(std::move(polygonName), std::move(points), nullptr);
+        navPolygon->addTriangles(triangles, navPolygon);
+        linkTriangles(triangles);
+        return navPolygon;
+    }
+
+    /**
+     * @return True when the surface of all cells of the rectangle is close to the bilinear interpolation of the rectangle corner cells surface
+     */
+    bool VoxelTileBuilder::followSurface(const VoxelWalkableField& walkableField, const std::vector<uint32_t>& cellSpans, unsigned int width, const CellRectangle& rectangle) const {
+        auto surfaceY = [&](unsigned int x, unsigned int z) {
+            return walkableField.getSpan(cellSpans[x + (std::size_t)z * width]).surfaceY;
+        };
+        unsigned int lastX = rectangle.x + rectangle.width - 1;
+        unsigned int lastZ = rectangle.z + rectangle.depth - 1;
+        float surfaceY00 = surfaceY(rectangle.x, rectangle.z);
+        float surfaceY10 = surfaceY(lastX, rectangle.z);
+        float surfaceY01 = surfaceY(rectangle.x, lastZ);
+        float surfaceY11 = surfaceY(lastX, lastZ);
+
+        for (unsigned int z = rectangle.z; z <= lastZ; ++z) {
+            float ratioZ = rectangle.depth == 1 ? 0.0f : (float)(z - rectangle.z) / (float)(rectangle.depth - 1);
+            for (unsigned int x = rectangle.x; x <= lastX; ++x) {
+                float ratioX = rectangle.width == 1 ? 0.0f : (float)(x - rectangle.x) / (float)(rectangle.width - 1);
+                float interpolatedY = (surfaceY00 * (1.0f - ratioX) + surfaceY10 * ratioX) * (1.0f - ratioZ) + (surfaceY01 * (1.0f - ratioX) + surfaceY11 * ratioX) * ratioZ;
+                if (std::abs(surfaceY(x, z) - interpolatedY) > maxHeightError) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Create the standard links between the triangles sharing an edge
+     */
+    void VoxelTileBuilder::linkTriangles(const std::vector<std::shared_ptr<NavTriangle>>& triangles) const {
+        auto edgeKey = [](std::size_t startPointIndex, std::size_t endPointIndex) {
+            return ((uint64_t)startPointIndex << 32u) | (uint64_t)endPointIndex;
+        };
+
+        std::unordered_map<uint64_t, std::pair<std::size_t, std::size_t>> edges; //value: triangle index and edge index
+        edges.reserve(triangles.size() * 3);
+        for (std::size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex) {
+            for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+                std::size_t startPointIndex = triangles[triangleIndex]->getIndex(edgeIndex);
+                std::size_t endPointIndex = triangles[triangleIndex]->getIndex((edgeIndex + 1) % 3);
+                edges.try_emplace(edgeKey(startPointIndex, endPointIndex), std::make_pair(triangleIndex, edgeIndex));
+            }
+        }
+
+        for (std::size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex) {
+            for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+                std::size_t startPointIndex = triangles[triangleIndex]->getIndex(edgeIndex);
+                std::size_t endPointIndex = triangles[triangleIndex]->getIndex((edgeIndex + 1) % 3);
+                auto itReverseEdge = edges.find(edgeKey(endPointIndex, startPointIndex));
+                if (itReverseEdge != edges.end()) {
+                    triangles[triangleIndex]->addStandardLink(edgeIndex, triangles[itReverseEdge->second.first]);
+                }
+            }
+        }
+    }
+
+}
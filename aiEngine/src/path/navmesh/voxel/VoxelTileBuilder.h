@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <UrchinCommon.h>
+
+#include "path/navmesh/model/output/NavMeshAgent.h"
+#include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/voxel/VoxelInputGeometry.h"
+#include "path/navmesh/voxel/VoxelWalkableField.h"
+
+namespace urchin {
+
+    /**
+     * Build the navigation polygons of a tile: rasterization of the input geometry in a voxel heightfield, extraction of the walkable regions and decomposition
+     * of each region in rectangles merged while they follow the surface height.
+     */
+    class VoxelTileBuilder {
+        public:
+            VoxelTileBuilder(const NavMeshAgent&, float, float, float);
+
+            unsigned int getBorderSize() const;
+
+            std::vector<std::shared_ptr<NavPolygon>> buildTile(const std::vector<const VoxelTriangle*>&, const Point3<float>&, const Point2<int>&, unsigned int,
+                                                               std::vector<std::pair<std::size_t, std::size_t>>&) const;
+
+        private:
+            struct RegionCell {
+                unsigned int x;
+                unsigned int z;
+                uint32_t spanIndex;
+            };
+
+            struct CellRectangle {
+                unsigned int x;
+                unsigned int z;
+                unsigned int width;
+                unsigned int depth;
+            };
+
+            std::shared_ptr<NavPolygon> buildRegionPolygon(const VoxelWalkableField&, const std::vector<RegionCell>&, const Point3<float>&, const Point2<int>&, std::string) const;
+            bool followSurface(const VoxelWalkableField&, const std::vector<uint32_t>&, unsigned int, const CellRectangle&) const;
+            void linkTriangles(const std::vector<std::shared_ptr<NavTriangle>>&) const;
+
+            float voxelSize;
+            float voxelHeight;
+            float maxHeightError;
+            int agentHeight;
+            int agentClimb;
+            unsigned int erosionDistance;
+            unsigned int borderSize;
+    };
+
+}
@@ -0,0 +1,221 @@
+#include <deque>
+
+#include "path/navmesh/voxel/VoxelWalkableField.h"
+
+namespace urchin {
+
+    /**
+     * @param agentHeight Height of the agent in voxels
+     * @param agentClimb Maximum height (in voxels) the agent can climb between two neighbour columns
+     */
+    VoxelWalkableField::VoxelWalkableField(const VoxelHeightfield& heightfield, int agentHeight, int agentClimb) :
+            width(heightfield.getWidth()),
+            depth(heightfield.getDepth()),
+            columns((std::size_t)width * depth) {
+        std::vector<int> ceilings;
+        for (unsigned int z = 0; z < depth; ++z) {
+            for (unsigned int x = 0; x < width; ++x) {
+                std::size_t columnIndex = x + (std::size_t)z * width;
+                columns[columnIndex].first = (uint32_t)spans.size();
+
+                for (uint32_t spanIndex = heightfield.getFirstSpan(x, z); spanIndex != VoxelHeightfield::NO_SPAN; spanIndex = heightfield.getSpan(spanIndex).next) {
+                    const VoxelSpan& span = heightfield.getSpan(spanIndex);
+                    int ceiling = span.next == VoxelHeightfield::NO_SPAN ? std::numeric_limits<int>::max() / 2 : heightfield.getSpan(span.next).minY;
+                    if (span.walkable && ceiling - span.maxY >= agentHeight) {
+                        spans.push_back({span.maxY, span.surfaceY, {NO_NEIGHBOUR, NO_NEIGHBOUR, NO_NEIGHBOUR, NO_NEIGHBOUR}, NO_REGION});
+                        spansColumn.push_back((uint32_t)columnIndex);
+                        ceilings.push_back(ceiling);
+                    }
+                }
+
+                columns[columnIndex].second = (uint32_t)spans.size() - columns[columnIndex].first;
+            }
+        }
+
+        connectNeighbours(ceilings, agentHeight, agentClimb);
+    }
+
+    /**
+     * Remove the walkable spans too close of an obstacle or of a border for the agent
+     * @param erosionDistance Minimum distance (in voxels) between a kept span and the border of the walkable area
+     */
+    void VoxelWalkableField::erode(unsigned int erosionDistance) {
+        if (erosionDistance == 0) {
+            return;
+        }
+
+        //distances to the border of the walkable area
+        std::vector<unsigned int> distances(spans.size(), std::numeric_limits<unsigned int>::max());
+        std::deque<uint32_t> spansToProcess;
+        for (uint32_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex) {
+            if (std::ranges::find(spans[spanIndex].neighbours, NO_NEIGHBOUR) != spans[spanIndex].neighbours.end()) {
+                distances[spanIndex] = 0;
+                spansToProcess.push_back(spanIndex);
+            }
+        }
+        while (!spansToProcess.empty()) {
+            uint32_t spanIndex = spansToProcess.front();
+            spansToProcess.pop_front();
+            if (distances[spanIndex] + 1 >= erosionDistance) {
+                continue;
+            }
+            for (uint32_t neighbourIndex : spans[spanIndex].neighbours) {
+                if (neighbourIndex != NO_NEIGHBOUR && distances[neighbourIndex] > distances[spanIndex] + 1) {
+                    distances[neighbourIndex] = distances[spanIndex] + 1;
+                    spansToProcess.push_back(neighbourIndex);
+                }
+            }
+        }
+
+        //remove the eroded spans and remap the neighbours indices
+        std::vector<uint32_t> newSpanIndices(spans.size(), NO_NEIGHBOUR);
+        uint32_t keptSpansCount = 0;
+        for (std::size_t columnIndex = 0; columnIndex < columns.size(); ++columnIndex) {
+            uint32_t firstKeptSpan = keptSpansCount;
+            for (uint32_t spanIndex = columns[columnIndex].first; spanIndex < columns[columnIndex].first + columns[columnIndex].second; ++spanIndex) {
+                if (distances[spanIndex] >= erosionDistance) {
+                    newSpanIndices[spanIndex] = keptSpansCount;
+                    spans[keptSpansCount] = spans[spanIndex];
+                    spansColumn[keptSpansCount] = spansColumn[spanIndex];
+                    keptSpansCount++;
+                }
+            }
+            columns[columnIndex] = std::make_pair(firstKeptSpan, keptSpansCount - firstKeptSpan);
+        }
+        spans.resize(keptSpansCount);
+        spansColumn.resize(keptSpansCount);
+        for (WalkableSpan& span : spans) {
+            for (uint32_t& neighbourIndex : span.neighbours) {
+                if (neighbourIndex != NO_NEIGHBOUR) {
+                    neighbourIndex = newSpanIndices[neighbourIndex];
+                }
+            }
+        }
+    }
+
+    /**
+     * Group the connected spans of an area in regions. A region contains at most one span by column and its spans located in adjacent columns are connected.
+     * @return Number of regions
+     */
+    uint32_t VoxelWalkableField::buildRegions(unsigned int minX, unsigned int minZ, unsigned int maxX, unsigned int maxZ) {
+        uint32_t regionsCount = 0;
+        std::vector<uint32_t> regionSpans;
+
+        for (unsigned int z = minZ; z < maxZ; ++z) {
+            for (unsigned int x = minX; x < maxX; ++x) {
+                auto [firstSpan, spansCount] = getColumnSpans(x, z);
+                for (uint32_t seedSpanIndex = firstSpan; seedSpanIndex < firstSpan + spansCount; ++seedSpanIndex) {
+                    if (spans[seedSpanIndex].regionId != NO_REGION) {
+                        continue;
+                    }
+
+                    uint32_t regionId = regionsCount++;
+                    spans[seedSpanIndex].regionId = regionId;
+                    regionSpans.clear();
+                    regionSpans.push_back(seedSpanIndex);
+                    for (std::size_t i = 0; i < regionSpans.size(); ++i) {
+                        uint32_t spanIndex = regionSpans[i];
+                        unsigned int spanX = spansColumn[spanIndex] % width;
+                        unsigned int spanZ = spansColumn[spanIndex] / width;
+                        for (std::size_t direction = 0; direction < 4; ++direction) {
+                            uint32_t neighbourIndex = spans[spanIndex].neighbours[direction];
+                            if (neighbourIndex == NO_NEIGHBOUR || spans[neighbourIndex].regionId != NO_REGION) {
+                                continue;
+                            }
+                            auto neighbourX = (unsigned int)((int)spanX + DIRECTION_X[direction]);
+                            auto neighbourZ = (unsigned int)((int)spanZ + DIRECTION_Z[direction]);
+                            if (neighbourX < minX || neighbourX >= maxX || neighbourZ < minZ || neighbourZ >= maxZ || !canJoinRegion(neighbourIndex, regionId)) {
+                                continue;
+                            }
+                            spans[neighbourIndex].regionId = regionId;
+                            regionSpans.push_back(neighbourIndex);
+                        }
+                    }
+                }
+            }
+        }
+
+        return regionsCount;
+    }
+
+    unsigned int VoxelWalkableField::getWidth() const {
+        return width;
+    }
+
+    unsigned int VoxelWalkableField::getDepth() const {
+        return depth;
+    }
+
+    /**
+     * @return First span index and spans count of the column
+     */
+    std::pair<uint32_t, uint32_t> VoxelWalkableField::getColumnSpans(unsigned int x, unsigned int z) const {
+        return columns[x + (std::size_t)z * width];
+    }
+
+    const WalkableSpan& VoxelWalkableField::getSpan(uint32_t spanIndex) const {
+        return spans[spanIndex];
+    }
+
+    void VoxelWalkableField::connectNeighbours(const std::vector<int>& ceilings, int agentHeight, int agentClimb) {
+        for (uint32_t spanIndex = 0; spanIndex < spans.size(); ++spanIndex) {
+            WalkableSpan& span = spans[spanIndex];
+            int x = (int)(spansColumn[spanIndex] % width);
+            int z = (int)(spansColumn[spanIndex] / width);
+
+            for (std::size_t direction = 0; direction < 4; ++direction) {
+                int neighbourX = x + DIRECTION_X[direction];
+                int neighbourZ = z + DIRECTION_Z[direction];
+                if (neighbourX < 0 || neighbourX >= (int)width || neighbourZ < 0 || neighbourZ >= (int)depth) {
+                    continue;
+                }
+
+                auto [firstSpan, spansCount] = getColumnSpans((unsigned int)neighbourX, (unsigned int)neighbourZ);
+                for (uint32_t neighbourIndex = firstSpan; neighbourIndex < firstSpan + spansCount; ++neighbourIndex) {
+                    const WalkableSpan& neighbourSpan = spans[neighbourIndex];
+                    int clearance = std::min(ceilings[spanIndex], ceilings[neighbourIndex]) - std::max(span.y, neighbourSpan.y);
+                    if (std::abs(neighbourSpan.y - span.y) <= agentClimb && clearance >= agentHeight) {
+                        span.neighbours[direction] = neighbourIndex;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @return True when the span column has no span in the region and when the span is connected to the spans of the region located in the adjacent columns
+     */
+    bool VoxelWalkableField::canJoinRegion(uint32_t spanIndex, uint32_t regionId) const {
+        if (columnHasRegion(spansColumn[spanIndex], regionId)) {
+            return false;
+        }
+
+        unsigned int spanX = spansColumn[spanIndex] % width;
+        unsigned int spanZ = spansColumn[spanIndex] / width;
+        for (std::size_t direction = 0; direction < 4; ++direction) {
+            auto adjacentX = (unsigned int)((int)spanX + DIRECTION_X[direction]);
+            auto adjacentZ = (unsigned int)((int)spanZ + DIRECTION_Z[direction]);
+            if (adjacentX >= width || adjacentZ >= depth) {
+                continue;
+            }
+            auto [firstSpan, spansCount] = getColumnSpans(adjacentX, adjacentZ);
+            for (uint32_t adjacentSpanIndex = firstSpan; adjacentSpanIndex < firstSpan + spansCount; ++adjacentSpanIndex) {
+                if (spans[adjacentSpanIndex].regionId == regionId && spans[spanIndex].neighbours[direction] != adjacentSpanIndex) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool VoxelWalkableField::columnHasRegion(std::size_t columnIndex, uint32_t regionId) const {
+        for (uint32_t spanIndex = columns[columnIndex].first; spanIndex < columns[columnIndex].first + columns[columnIndex].second; ++spanIndex) {
+            if (spans[spanIndex].regionId == regionId) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include "path/navmesh/voxel/VoxelHeightfield.h"
+
+namespace urchin {
+
+    struct WalkableSpan {
+        int y; //in voxels
+        float surfaceY;
+        std::array<uint32_t, 4> neighbours; //walkable span index or NO_NEIGHBOUR for directions: -X, +Z, +X, -Z
+        uint32_t regionId;
+    };
+
+    /**
+     * Walkable spans of a heightfield: top of solid spans having enough clearance for the agent, connected to their neighbour spans reachable by the agent
+     */
+    class VoxelWalkableField {
+        public:
+            static constexpr uint32_t NO_NEIGHBOUR = std::numeric_limits<uint32_t>::max();
+            static constexpr uint32_t NO_REGION = std::numeric_limits<uint32_t>::max();
+
+            VoxelWalkableField(const VoxelHeightfield&, int, int);
+
+            void erode(unsigned int);
+            uint32_t buildRegions(unsigned int, unsigned int, unsigned int, unsigned int);
+
+            unsigned int getWidth() const;
+            unsigned int getDepth() const;
+            std::pair<uint32_t, uint32_t> getColumnSpans(unsigned int, unsigned int) const;
+            const WalkableSpan& getSpan(uint32_t) const;
+
+        private:
+            static constexpr std::array<int, 4> DIRECTION_X = {-1, 0, 1, 0};
+            static constexpr std::array<int, 4> DIRECTION_Z = {0, 1, 0, -1};
+
+            void connectNeighbours(const std::vector<int>&, int, int);
+            bool canJoinRegion(uint32_t, uint32_t) const;
+            bool columnHasRegion(std::size_t, uint32_t) const;
+
+            unsigned int width;
+            unsigned int depth;
+            std::vector<std::pair<uint32_t, uint32_t>> columns; //first: first span index, second: spans count
+            std::vector<WalkableSpan> spans;
+            std::vector<uint32_t> spansColumn;
+    };
+
+}
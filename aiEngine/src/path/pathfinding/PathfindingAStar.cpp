@@ -6,9 +6,10 @@
 
 namespace urchin {
 
-    bool PathNodeCompare::operator()(const std::shared_ptr<PathNode>& node1, const std::shared_ptr<PathNode>& node2) const {
-        return node1->getFScore() < node2->getFScore();
-    }
+    //static
+    thread_local std::vector<PathfindingAStar::SearchNode> PathfindingAStar::searchNodes;
+    thread_local std::vector<uint32_t> PathfindingAStar::openNodesHeap;
+    thread_local uint32_t PathfindingAStar::searchGeneration = 0;
 
     PathfindingAStar::PathfindingAStar(std::shared_ptr<NavMesh> navMesh) :
             jumpAdditionalCost(ConfigService::instance().getFloatValue("pathfinding.jumpAdditionalCost")),
@@ -19,140 +20,189 @@ namespace urchin {
     std::vector<PathPoint> PathfindingAStar::findPath(const Point3<float>& startPoint, const Point3<float>& endPoint) const {
         ScopeProfiler sp(Profiler::ai(), "findPath");
 
-        std::shared_ptr<NavTriangle> startTriangle = findTriangle(startPoint);
-        std::shared_ptr<NavTriangle> endTriangle = findTriangle(endPoint);
+        std::shared_ptr<NavTriangle> startTriangle = navMesh->findTriangle(startPoint);
+        std::shared_ptr<NavTriangle> endTriangle = navMesh->findTriangle(endPoint);
         if (!startTriangle || !endTriangle) {
             return {}; //no path exists
         }
 
-        float startEndHScore = computeHScore(*startTriangle, endPoint);
-
-        std::set<const NavTriangle*> closedList;
-        std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> openList;
-        openList.insert(std::make_shared<PathNode>(startTriangle, 0.0, startEndHScore));
-
-        std::shared_ptr<PathNode> endNodePath = nullptr;
-        while (!openList.empty()) {
-            auto currentNodeIt = openList.begin(); //node with smallest fScore
-            std::shared_ptr<PathNode> currentNode = *currentNodeIt;
-
-            closedList.insert(&currentNode->getNavTriangle());
-            openList.erase(currentNodeIt);
-
-            const auto& currTriangle = currentNode->getNavTriangle();
-            for (const auto& link : currTriangle.getLinks()) {
-                auto neighborTriangle = link->getTargetTriangle();
+        startSearch();
+        uint32_t endNodeIndex = endTriangle->getNavMeshIndex();
+        SearchNode& startNode = visitNode(startTriangle->getNavMeshIndex(), *startTriangle);
+        startNode.entryPoint = startPoint;
+        startNode.gScore = 0.0f;
+        startNode.fScore = computeHScore(*startTriangle, endPoint);
+        pushOpenNode(startTriangle->getNavMeshIndex());
+
+        while (!openNodesHeap.empty()) {
+            uint32_t currentNodeIndex = popOpenNode(); //node with smallest F score
+            if (currentNodeIndex == endNodeIndex) {
+                std::vector<std::unique_ptr<PathPortal>> pathPortals = determinePath(buildPathNodes(endNodeIndex, startTriangle), startPoint, endPoint);
+                return pathPortalsToPathPoints(pathPortals, true);
+            }
 
-                if (closedList.contains(neighborTriangle.get())) { //already processed
+            const SearchNode& currentNode = searchNodes[currentNodeIndex];
+            const std::vector<std::shared_ptr<NavLink>>& links = navMesh->getLinks(*currentNode.triangle);
+            for (std::size_t linkIndex = 0; linkIndex < links.size(); ++linkIndex) {
+                const NavTriangle& neighborTriangle = *links[linkIndex]->getTargetTriangle();
+                uint32_t neighborNodeIndex = neighborTriangle.getNavMeshIndex();
+                bool isNewNode = searchNodes[neighborNodeIndex].generation != searchGeneration;
+                if (!isNewNode && searchNodes[neighborNodeIndex].heapPosition == CLOSED_NODE) { //already processed
                     continue;
                 }
 
-                std::shared_ptr<PathNode> neighborNodePath = retrievePathNodeFrom(openList, *neighborTriangle);
-                if (!neighborNodePath) {
-                    float gScore = computeGScore(currentNode, link, startPoint);
-                    float hScore = computeHScore(*neighborTriangle, endPoint);
-                    neighborNodePath = std::make_shared<PathNode>(neighborTriangle, gScore, hScore);
-                    neighborNodePath->setPreviousNode(currentNode, link);
-
-                    if (!endNodePath || neighborNodePath->getFScore() < endNodePath->getFScore()) {
-                        openList.insert(neighborNodePath);
-                    }
-
-                    if (neighborTriangle.get() == endTriangle.get()) { //end triangle reached but continue on path nodes having a smaller F score
-                        endNodePath = neighborNodePath;
-                    }
-                } else {
-                    float gScore = computeGScore(currentNode, link, startPoint);
-                    if (neighborNodePath->getGScore() > gScore) { //better path found to reach neighborNodePath: override previous values
-                        neighborNodePath->setGScore(gScore);
-                        neighborNodePath->setPreviousNode(currentNode, link);
+                Point3<float> neighborEntryPoint;
+                float gScore = currentNode.gScore + computeLinkCost(currentNode, *links[linkIndex], neighborEntryPoint);
+                if (isNewNode || gScore < searchNodes[neighborNodeIndex].gScore) {
+                    SearchNode& neighborNode = isNewNode ? visitNode(neighborNodeIndex, neighborTriangle) : searchNodes[neighborNodeIndex];
+                    float hScore = isNewNode ? computeHScore(neighborTriangle, endPoint) : neighborNode.fScore - neighborNode.gScore;
+                    neighborNode.entryPoint = neighborEntryPoint;
+                    neighborNode.gScore = gScore;
+                    neighborNode.fScore = gScore + hScore;
+                    neighborNode.previousNode = currentNodeIndex;
+                    neighborNode.previousNodeLinkIndex = (uint32_t)linkIndex;
+
+                    if (isNewNode) {
+                        pushOpenNode(neighborNodeIndex);
+                    } else { //better path found to reach the neighbor node: decrease its key
+                        moveUpOpenNode(neighborNode.heapPosition);
                     }
                 }
             }
         }
 
-        if (endNodePath) {
-            std::vector<std::unique_ptr<PathPortal>> pathPortals = determinePath(endNodePath, startPoint, endPoint);
-            return pathPortalsToPathPoints(pathPortals, true);
-        }
-
         return {}; //no path exists
     }
 
-    std::shared_ptr<NavTriangle> PathfindingAStar::findTriangle(const Point3<float>& point) const {
-        float bestVerticalDistance = std::numeric_limits<float>::max();
-        std::shared_ptr<NavTriangle> result = nullptr;
-
-        Point2 flattenPoint(point.X, point.Z);
-        for (const auto& polygon : navMesh->getPolygons()) {
-            for (const auto& triangle : polygon->getTriangles()) {
-                if (isPointInsideTriangle(flattenPoint, *polygon, *triangle)) {
-                    float verticalDistance = point.Y - triangle->getCenterPoint().Y;
-                    if (verticalDistance >= 0.0 && verticalDistance < bestVerticalDistance) {
-                        bestVerticalDistance = verticalDistance;
-                        result = triangle;
-                    }
-                }
+    /**
+     * Start a new search by incrementing the generation instead of clearing the nodes of the previous searches
+     */
+    void PathfindingAStar::startSearch() const {
+        if (searchNodes.size() < navMesh->getTrianglesCount()) {
+            searchNodes.resize(navMesh->getTrianglesCount(), SearchNode{});
+        }
+        openNodesHeap.clear();
+
+        if (++searchGeneration == 0) { //generation overflow: reset the generation of all nodes
+            for (SearchNode& searchNode : searchNodes) {
+                searchNode.generation = 0;
             }
+            searchGeneration = 1;
         }
-        return result;
     }
 
-    bool PathfindingAStar::isPointInsideTriangle(const Point2<float>& point, const NavPolygon& polygon, const NavTriangle& triangle) const {
-        Point2<float> p0 = polygon.getPoint(triangle.getIndex(0)).toPoint2XZ();
-        Point2<float> p1 = polygon.getPoint(triangle.getIndex(1)).toPoint2XZ();
-        Point2<float> p2 = polygon.getPoint(triangle.getIndex(2)).toPoint2XZ();
+    PathfindingAStar::SearchNode& PathfindingAStar::visitNode(uint32_t nodeIndex, const NavTriangle& triangle) const {
+        SearchNode& searchNode = searchNodes[nodeIndex];
+        searchNode.triangle = &triangle;
+        searchNode.generation = searchGeneration;
+        searchNode.previousNode = NULL_NODE;
+        searchNode.previousNodeLinkIndex = 0;
+        return searchNode;
+    }
 
-        float crossProduct1 = crossProduct(point, p0, p1);
-        float crossProduct2 = crossProduct(point, p1, p2);
-        if (crossProduct1 * crossProduct2 < 0.0f) { //cross products have different sign
-            return false;
+    /**
+     * Compute the cost to go from the entry point of the node to the portal of the link
+     * @param entryPoint [out] Point where the path enters in the link target triangle
+     */
+    float PathfindingAStar::computeLinkCost(const SearchNode& searchNode, const NavLink& link, Point3<float>& entryPoint) const {
+        LineSegment3D<float> sourceEdge = searchNode.triangle->computeEdge(link.getSourceEdgeIndex());
+        if (link.getLinkType() == STANDARD) {
+            entryPoint = sourceEdge.closestPoint(searchNode.entryPoint);
+            return searchNode.entryPoint.distance(entryPoint);
+        } else if (link.getLinkType() == JOIN_POLYGONS) {
+            entryPoint = link.getLinkConstraint()->computeSourceJumpEdge(sourceEdge).closestPoint(searchNode.entryPoint);
+            return searchNode.entryPoint.distance(entryPoint);
+        } else if (link.getLinkType() == JUMP) {
+            Point3<float> jumpStartPoint = link.getLinkConstraint()->computeSourceJumpEdge(sourceEdge).closestPoint(searchNode.entryPoint);
+            entryPoint = link.getTargetTriangle()->computeEdge(link.getLinkConstraint()->getTargetEdgeIndex()).closestPoint(jumpStartPoint);
+            return searchNode.entryPoint.distance(jumpStartPoint) + jumpStartPoint.distance(entryPoint) + jumpAdditionalCost;
         }
 
-        float crossProduct3 = crossProduct(point, p2, p0);
-        return crossProduct2 * crossProduct3 >= 0.0f; //check cross products sign
+        throw std::runtime_error("Unknown link type: " + std::to_string(link.getLinkType()));
     }
 
-    float PathfindingAStar::crossProduct(const Point2<float>& p1, const Point2<float>& p2, const Point2<float>& p3) const {
-        //Same as: p3.vector(p1).crossProduct(p3.vector(p2))
-        return (p1.X - p3.X) * (p2.Y - p3.Y) - (p2.X - p3.X) * (p1.Y - p3.Y);
+    /**
+     * Compute approximate score from 'current' to 'endPoint'
+     */
+    float PathfindingAStar::computeHScore(const NavTriangle& current, const Point3<float>& endPoint) const {
+        Point3<float> currentPoint = current.getCenterPoint();
+        return std::abs(currentPoint.X - endPoint.X) + std::abs(currentPoint.Y - endPoint.Y) + std::abs(currentPoint.Z - endPoint.Z);
     }
 
-    std::shared_ptr<PathNode> PathfindingAStar::retrievePathNodeFrom(const std::multiset<std::shared_ptr<PathNode>, PathNodeCompare>& pathNodes, const NavTriangle& navTriangle) const {
-        for (const auto& pathNode : pathNodes) {
-            if (&pathNode->getNavTriangle() == &navTriangle) {
-                return pathNode;
-            }
+    /**
+     * @return Path node of the end node linked to its previous path nodes up to the start node
+     */
+    std::shared_ptr<PathNode> PathfindingAStar::buildPathNodes(uint32_t endNodeIndex, const std::shared_ptr<NavTriangle>& startTriangle) const {
+        std::vector<uint32_t> pathNodeIndices;
+        for (uint32_t nodeIndex = endNodeIndex; nodeIndex != NULL_NODE; nodeIndex = searchNodes[nodeIndex].previousNode) {
+            pathNodeIndices.push_back(nodeIndex);
         }
-        return std::shared_ptr<PathNode>();
+
+        const SearchNode& startNode = searchNodes[pathNodeIndices.back()];
+        auto pathNode = std::make_shared<PathNode>(startTriangle, startNode.gScore, startNode.fScore - startNode.gScore);
+        for (auto it = std::next(pathNodeIndices.rbegin()); it != pathNodeIndices.rend(); ++it) {
+            const SearchNode& searchNode = searchNodes[*it];
+            const std::shared_ptr<NavLink>& link = navMesh->getLinks(*searchNodes[searchNode.previousNode].triangle)[searchNode.previousNodeLinkIndex];
+            auto nextPathNode = std::make_shared<PathNode>(link->getTargetTriangle(), searchNode.gScore, searchNode.fScore - searchNode.gScore);
+            nextPathNode->setPreviousNode(pathNode, link);
+            pathNode = nextPathNode;
+        }
+        return pathNode;
+    }
+
+    void PathfindingAStar::pushOpenNode(uint32_t nodeIndex) const {
+        searchNodes[nodeIndex].heapPosition = (uint32_t)openNodesHeap.size();
+        openNodesHeap.push_back(nodeIndex);
+        moveUpOpenNode(searchNodes[nodeIndex].heapPosition);
     }
 
     /**
-     * Compute score from 'startPoint to 'link'
+     * @return Open node having the smallest F score. The node is marked as closed.
      */
-    float PathfindingAStar::computeGScore(const std::shared_ptr<PathNode>& currentNode, const std::shared_ptr<NavLink>& link, const Point3<float>& startPoint) const {
-        auto neighborNodePath = std::make_shared<PathNode>(link->getTargetTriangle(), 0.0f, 0.0f);
-        neighborNodePath->setPreviousNode(currentNode, link);
-        std::vector<std::unique_ptr<PathPortal>> pathPortals = determinePath(neighborNodePath, startPoint, link->getTargetTriangle()->getCenterPoint());
-        std::vector<PathPoint> path = pathPortalsToPathPoints(pathPortals, false);
-
-        float pathCost = 0.0f;
-        for (int i = 0; i < (long)path.size() - 1; i++) {
-            pathCost += path[(std::size_t)i].getPoint().distance(path[(std::size_t)i + 1].getPoint());
-            if (path[(std::size_t)i].isJumpPoint()) {
-                pathCost += jumpAdditionalCost;
+    uint32_t PathfindingAStar::popOpenNode() const {
+        uint32_t nodeIndex = openNodesHeap[0];
+        swapOpenNodes(0, (uint32_t)openNodesHeap.size() - 1);
+        openNodesHeap.pop_back();
+        if (!openNodesHeap.empty()) {
+            moveDownOpenNode(0);
+        }
+
+        searchNodes[nodeIndex].heapPosition = CLOSED_NODE;
+        return nodeIndex;
+    }
+
+    void PathfindingAStar::moveUpOpenNode(uint32_t heapPosition) const {
+        while (heapPosition > 0) {
+            uint32_t parentPosition = (heapPosition - 1) / 2;
+            if (searchNodes[openNodesHeap[parentPosition]].fScore <= searchNodes[openNodesHeap[heapPosition]].fScore) {
+                break;
             }
+            swapOpenNodes(heapPosition, parentPosition);
+            heapPosition = parentPosition;
         }
+    }
 
-        return pathCost;
+    void PathfindingAStar::moveDownOpenNode(uint32_t heapPosition) const {
+        auto heapSize = (uint32_t)openNodesHeap.size();
+        while (true) {
+            uint32_t smallestPosition = heapPosition;
+            for (uint32_t childPosition = 2 * heapPosition + 1; childPosition <= 2 * heapPosition + 2 && childPosition < heapSize; ++childPosition) {
+                if (searchNodes[openNodesHeap[childPosition]].fScore < searchNodes[openNodesHeap[smallestPosition]].fScore) {
+                    smallestPosition = childPosition;
+                }
+            }
+            if (smallestPosition == heapPosition) {
+                break;
+            }
+            swapOpenNodes(heapPosition, smallestPosition);
+            heapPosition = smallestPosition;
+        }
     }
 
-    /**
-     * Compute approximate score from 'current' to 'endPoint'
-     */
-    float PathfindingAStar::computeHScore(const NavTriangle& current, const Point3<float>& endPoint) const {
-        Point3<float> currentPoint = current.getCenterPoint();
-        return std::abs(currentPoint.X - endPoint.X) + std::abs(currentPoint.Y - endPoint.Y) + std::abs(currentPoint.Z - endPoint.Z);
+    void PathfindingAStar::swapOpenNodes(uint32_t heapPosition1, uint32_t heapPosition2) const {
+        std::swap(openNodesHeap[heapPosition1], openNodesHeap[heapPosition2]);
+        searchNodes[openNodesHeap[heapPosition1]].heapPosition = heapPosition1;
+        searchNodes[openNodesHeap[heapPosition2]].heapPosition = heapPosition2;
     }
 
     std::vector<std::unique_ptr<PathPortal>> PathfindingAStar::determinePath(const std::shared_ptr<PathNode>& endNode, const Point3<float>& startPoint,
@@ -2,6 +2,8 @@
 
 #include <vector>
 #include <memory>
+#include <limits>
+#include <cstdint>
 #include <UrchinCommon.h>
 
 #include "path/navmesh/model/output/NavMesh.h"
@@ -12,10 +14,6 @@
 
 namespace urchin {
 
-    struct PathNodeCompare {
-        bool operator()(const std::shared_ptr<PathNode>&, const std::shared_ptr<PathNode>&) const;
-    };
-
     class PathfindingAStar {
         public:
             explicit PathfindingAStar(std::shared_ptr<NavMesh>);
@@ -23,13 +21,28 @@ namespace urchin {
             std::vector<PathPoint> findPath(const Point3<float>&, const Point3<float>&) const;
 
         private:
-            std::shared_ptr<NavTriangle> findTriangle(const Point3<float>&) const;
-            bool isPointInsideTriangle(const Point2<float>&, const NavPolygon&, const NavTriangle&) const;
-            float crossProduct(const Point2<float>&, const Point2<float>&, const Point2<float>&) const;
+            struct SearchNode {
+                const NavTriangle* triangle;
+                Point3<float> entryPoint; //point where the path enters in the triangle
+                float gScore;
+                float fScore;
+                uint32_t generation;
+                uint32_t previousNode;
+                uint32_t previousNodeLinkIndex;
+                uint32_t heapPosition;
+            };
 
-            std::shared_ptr<PathNode> retrievePathNodeFrom(const std::multiset<std::shared_ptr<PathNode>, PathNodeCompare>&, const NavTriangle&) const;
-            float computeGScore(const std::shared_ptr<PathNode>&, const std::shared_ptr<NavLink>&, const Point3<float>&) const;
+            void startSearch() const;
+            SearchNode& visitNode(uint32_t, const NavTriangle&) const;
+            float computeLinkCost(const SearchNode&, const NavLink&, Point3<float>&) const;
             float computeHScore(const NavTriangle&, const Point3<float>&) const;
+            std::shared_ptr<PathNode> buildPathNodes(uint32_t, const std::shared_ptr<NavTriangle>&) const;
+
+            void pushOpenNode(uint32_t) const;
+            uint32_t popOpenNode() const;
+            void moveUpOpenNode(uint32_t) const;
+            void moveDownOpenNode(uint32_t) const;
+            void swapOpenNodes(uint32_t, uint32_t) const;
 
             std::vector<std::unique_ptr<PathPortal>> determinePath(const std::shared_ptr<PathNode>&, const Point3<float>&, const Point3<float>&) const;
             LineSegment3D<float> rearrangePortal(const LineSegment3D<float>&, const std::vector<std::unique_ptr<PathPortal>>&) const;
@@ -39,8 +52,16 @@ namespace urchin {
             void addMissingTransitionPoints(const std::vector<std::unique_ptr<PathPortal>>&) const;
             Point3<float> computeTransitionPoint(const PathPortal&, const Point3<float>&) const;
 
+            static constexpr uint32_t NULL_NODE = std::numeric_limits<uint32_t>::max();
+            static constexpr uint32_t CLOSED_NODE = std::numeric_limits<uint32_t>::max();
+
             const float jumpAdditionalCost;
             std::shared_ptr<NavMesh> navMesh;
+
+            //reused between the path searches of a thread: nodes are valid only when their generation is the current search generation
+            static thread_local std::vector<SearchNode> searchNodes;
+            static thread_local std::vector<uint32_t> openNodesHeap;
+            static thread_local uint32_t searchGeneration;
     };
 
 }
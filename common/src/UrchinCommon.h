@@ -55,6 +55,7 @@
 #include "math/geometry/3d/Line3D.h"
 #include "math/geometry/3d/LineSegment3D.h"
 #include "math/geometry/3d/Ray.h"
+#include "math/geometry/3d/RayPacket.h"
 #include "math/geometry/3d/Plane.h"
 #include "math/geometry/3d/Rectangle3D.h"
 #include "math/geometry/3d/IndexedTriangle3D.h"
@@ -90,6 +91,9 @@
 #include "partitioning/aabbtree/AABBTree.h"
 #include "partitioning/aabbtree/AABBNode.h"
 #include "partitioning/aabbtree/AABBNodeData.h"
+#include "partitioning/aabbtree/AABBTreeSahPartitioner.h"
+#include "partitioning/aabbtree/AABBTreeSnapshot.h"
+#include "partitioning/aabbtree/IndexedAABBTree.h"
 #include "partitioning/octree/Octreeable.h"
 #include "partitioning/octree/OctreeManager.h"
 #include "partitioning/octree/Octree.h"
@@ -106,12 +110,15 @@
 #include "profiler/Profiler.h"
 #include "profiler/ScopeProfiler.h"
 #include "profiler/PerfMetrics.h"
+#include "profiler/LatencyHistogram.h"
 
 #include "system/SignalHandler.h"
 #include "system/SystemInfo.h"
 #include "system/thread/LockById.h"
 #include "system/thread/ScopeLockById.h"
 #include "system/thread/SleepUtil.h"
+#include "system/thread/WorkerPool.h"
+#include "system/thread/TripleBuffer.h"
 #include "system/control/Control.h"
 
 #include "util/DateTimeUtil.h"
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <sstream>
+#include <limits>
 
 #include "collision/GJKResult.h"
 #include "math/algebra/point/Point3.h"
@@ -19,6 +20,7 @@ namespace urchin {
     template<class T> class GJKAlgorithm {
         public:
             template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> processGJK(const CONVEX_OBJ1&, const CONVEX_OBJ2&) const;
+            template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> processGJK(const CONVEX_OBJ1&, const CONVEX_OBJ2&, const Vector3<T>&, T) const;
 
         private:
             template<class CONVEX_OBJ1, class CONVEX_OBJ2> void logMaximumIterationReach(const CONVEX_OBJ1&, const CONVEX_OBJ2&) const;
@@ -1,9 +1,29 @@
+template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> GJKAlgorithm<T>::processGJK(const CONVEX_OBJ1& convexObject1, const CONVEX_OBJ2& convexObject2) const {
+    return processGJK(convexObject1, convexObject2, Vector3<T>(0.0, 0.0, 0.0), std::numeric_limits<T>::max());
+}
+
 /**
-* @param includeMargin Indicate whether algorithm operates on objects with margin
+* @param separatingAxis Normalized axis expected to separate the objects (e.g. axis from closest point of object 2 to closest point of object 1 found at the
+* previous frame). It is only used to early-out: the algorithm always starts from the same direction to keep the closest points stable from one frame to another.
+* @param earlyOutDistance When the objects are separated by more than this distance along the separating axis, a no collide result is returned without
+* computing the exact closest points: the separating distance and closest points of the result are only an approximation higher than this distance.
 */
-template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> GJKAlgorithm<T>::processGJK(const CONVEX_OBJ1& convexObject1, const CONVEX_OBJ2& convexObject2) const {
+template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> GJKAlgorithm<T>::processGJK(const CONVEX_OBJ1& convexObject1, const CONVEX_OBJ2& convexObject2,
+        const Vector3<T>& separatingAxis, T earlyOutDistance) const {
     ScopeProfiler sp(Profiler::physics(), "processGJK");
 
+    Simplex<T> simplex;
+
+    if (earlyOutDistance < std::numeric_limits<T>::max()) {
+        Point3<T> axisSupportPointA = convexObject1.getSupportPoint(-separatingAxis).template cast<T>();
+        Point3<T> axisSupportPointB = convexObject2.getSupportPoint(separatingAxis).template cast<T>();
+        Point3<T> axisPoint = axisSupportPointA - axisSupportPointB;
+        if (axisPoint.toVector().dotProduct(separatingAxis) > earlyOutDistance) { //all points of Minkowski difference are beyond the early-out distance along the axis
+            simplex.addPoint(axisSupportPointA, axisSupportPointB);
+            return GJKResult<T>::newNoCollideResult(axisPoint.toVector().length(), simplex, 0);
+        }
+    }
+
     //get point which belongs to the outline of the shape (Minkowski difference)
     Vector3<T> initialDirection = Vector3<T>(1.0, 0.0, 0.0);
     Point3<T> initialSupportPointA = convexObject1.getSupportPoint(initialDirection).template cast<T>();
@@ -12,7 +32,6 @@ template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> GJ
 
     Vector3<T> direction = (-initialPoint).toVector();
 
-    Simplex<T> simplex;
     simplex.addPoint(initialSupportPointA, initialSupportPointB);
 
     for (unsigned int iterationNumber = 0; iterationNumber < MAX_ITERATION; ++iterationNumber) {
@@ -27,10 +46,10 @@ template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> GJ
         //check termination conditions: new point is not more extreme that existing ones OR new point already exist in simplex
         if ((closestPointSquareDistance-closestPointDotNewPoint) <= TERMINATION_TOLERANCE || simplex.isPointInSimplex(newPoint)) {
             if (closestPointDotNewPoint <= 0.0) { //collision detected
-                return GJKResult<T>::newCollideResult(simplex);
+                return GJKResult<T>::newCollideResult(simplex, iterationNumber + 1);
             }
 
-            return GJKResult<T>::newNoCollideResult(std::sqrt(closestPointSquareDistance), simplex);
+            return GJKResult<T>::newNoCollideResult(std::sqrt(closestPointSquareDistance), simplex, iterationNumber + 1);
         }
 
         simplex.addPoint(supportPointA, supportPointB);
@@ -40,7 +59,7 @@ template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> GJKResult<T> GJ
 
     logMaximumIterationReach(convexObject1, convexObject2);
 
-    return GJKResult<T>::newInvalidResult();
+    return GJKResult<T>::newInvalidResult(MAX_ITERATION);
 }
 
 template<class T> template<class CONVEX_OBJ1, class CONVEX_OBJ2> void GJKAlgorithm<T>::logMaximumIterationReach(const CONVEX_OBJ1& convexObject1, const CONVEX_OBJ2& convexObject2) const {
@@ -10,10 +10,11 @@
 
 namespace urchin {
 
-    template<class T> GJKResult<T>::GJKResult(bool validResult, T separatingDistance, const Simplex<T>& simplex) :
+    template<class T> GJKResult<T>::GJKResult(bool validResult, T separatingDistance, const Simplex<T>& simplex, unsigned int iterationsCount) :
             validResult(validResult),
             separatingDistance(separatingDistance),
-            simplex(simplex) {
+            simplex(simplex),
+            iterationsCount(iterationsCount) {
         if (isValidResult() && !isCollide()) {
             simplex.computeClosestPoints(closestPointA, closestPointB);
 
@@ -26,16 +27,16 @@ namespace urchin {
         }
     }
 
-    template<class T> GJKResult<T> GJKResult<T>::newInvalidResult() {
-        return GJKResult<T>(false, -std::numeric_limits<T>::max(), Simplex<T>());
+    template<class T> GJKResult<T> GJKResult<T>::newInvalidResult(unsigned int iterationsCount) {
+        return GJKResult<T>(false, -std::numeric_limits<T>::max(), Simplex<T>(), iterationsCount);
     }
 
-    template<class T> GJKResult<T> GJKResult<T>::newCollideResult(const Simplex<T>& simplex) {
-        return GJKResult<T>(true, -std::numeric_limits<T>::max(), simplex);
+    template<class T> GJKResult<T> GJKResult<T>::newCollideResult(const Simplex<T>& simplex, unsigned int iterationsCount) {
+        return GJKResult<T>(true, -std::numeric_limits<T>::max(), simplex, iterationsCount);
     }
 
-    template<class T> GJKResult<T> GJKResult<T>::newNoCollideResult(T separatingDistance, const Simplex<T>& simplex) {
-        return GJKResult<T>(true, separatingDistance, simplex);
+    template<class T> GJKResult<T> GJKResult<T>::newNoCollideResult(T separatingDistance, const Simplex<T>& simplex, unsigned int iterationsCount) {
+        return GJKResult<T>(true, separatingDistance, simplex, iterationsCount);
     }
 
     template<class T> bool GJKResult<T>::isValidResult() const {
@@ -86,6 +87,13 @@ namespace urchin {
         return simplex;
     }
 
+    /**
+     * @return Number of iterations executed by the GJK algorithm (0 when the result is found without iterating)
+     */
+    template<class T> unsigned int GJKResult<T>::getIterationsCount() const {
+        return iterationsCount;
+    }
+
     template<class T> void GJKResult<T>::logInputData(std::string_view errorMessage, const Simplex<T>& simplex) {
         std::stringstream logStream;
         logStream.precision(std::numeric_limits<T>::max_digits10);
@@ -7,9 +7,9 @@ namespace urchin {
 
     template<class T> class GJKResult {
         public:
-            static GJKResult<T> newInvalidResult();
-            static GJKResult<T> newCollideResult(const Simplex<T>&);
-            static GJKResult<T> newNoCollideResult(T, const Simplex<T>&);
+            static GJKResult<T> newInvalidResult(unsigned int);
+            static GJKResult<T> newCollideResult(const Simplex<T>&, unsigned int);
+            static GJKResult<T> newNoCollideResult(T, const Simplex<T>&, unsigned int);
 
             bool isValidResult() const;
 
@@ -19,9 +19,10 @@ namespace urchin {
             const Point3<T>& getClosestPointB() const;
 
             const Simplex<T>& getSimplex() const;
+            unsigned int getIterationsCount() const;
 
         private:
-            GJKResult(bool, T, const Simplex<T>&);
+            GJKResult(bool, T, const Simplex<T>&, unsigned int);
 
             void logInputData(std::string_view, const Simplex<T>&);
 
@@ -32,6 +33,7 @@ namespace urchin {
             Point3<T> closestPointB;
 
             Simplex<T> simplex;
+            unsigned int iterationsCount;
     };
 
 }
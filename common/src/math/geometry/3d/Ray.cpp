@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include "math/geometry/3d/Ray.h"
 
 namespace urchin {
@@ -21,13 +23,23 @@ namespace urchin {
     }
 
     template<class T> void Ray<T>::initializeAdditionalData() {
-        inverseDirection = Vector3<T>(1.0, 1.0, 1.0) / this->direction;
+        inverseDirection = Vector3<T>(computeInverse(this->direction.X), computeInverse(this->direction.Y), computeInverse(this->direction.Z));
 
         directionSigns[0] = this->direction.X < 0.0 ? 1 : 0;
         directionSigns[1] = this->direction.Y < 0.0 ? 1 : 0;
         directionSigns[2] = this->direction.Z < 0.0 ? 1 : 0;
     }
 
+    /**
+     * @return Inverse of the direction component clamped to a finite value: infinite and NaN values are not supported with the fast math compilation flag
+     */
+    template<class T> T Ray<T>::computeInverse(T directionComponent) {
+        if (std::abs(directionComponent) < MIN_DIRECTION_COMPONENT) {
+            return directionComponent < (T)0.0 ? (T)-1.0 / MIN_DIRECTION_COMPONENT : (T)1.0 / MIN_DIRECTION_COMPONENT;
+        }
+        return (T)1.0 / directionComponent;
+    }
+
     template<class T> const Point3<T> &Ray<T>::getOrigin() const {
         return origin;
     }
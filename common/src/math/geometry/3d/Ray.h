@@ -27,6 +27,9 @@ namespace urchin {
 
         private:
             void initializeAdditionalData();
+            static T computeInverse(T);
+
+            static constexpr T MIN_DIRECTION_COMPONENT = (T)1.0e-20;
 
             Point3<T> origin;
             Vector3<T> direction; //normalized
@@ -0,0 +1,112 @@
+#include <cassert>
+#include <algorithm>
+#include <bit>
+
+#include "math/geometry/3d/RayPacket.h"
+
+namespace urchin {
+
+    RayPacket::RayPacket() :
+            raysCount(0),
+            originsX(),
+            originsY(),
+            originsZ(),
+            inverseDirectionsX(),
+            inverseDirectionsY(),
+            inverseDirectionsZ(),
+            lengths(),
+            hits() {
+
+    }
+
+    void RayPacket::setup(std::span<const Ray<float>> rays) {
+        assert(rays.size() <= MAX_RAYS);
+        raysCount = rays.size();
+
+        for (std::size_t i = 0; i < raysCount; ++i) {
+            originsX[i] = rays[i].getOrigin().X;
+            originsY[i] = rays[i].getOrigin().Y;
+            originsZ[i] = rays[i].getOrigin().Z;
+            inverseDirectionsX[i] = rays[i].getInverseDirection().X;
+            inverseDirectionsY[i] = rays[i].getInverseDirection().Y;
+            inverseDirectionsZ[i] = rays[i].getInverseDirection().Z;
+            lengths[i] = rays[i].getLength();
+        }
+        for (std::size_t i = raysCount; i < MAX_RAYS; ++i) { //unused rays: tested but discarded by the rays mask
+            originsX[i] = originsY[i] = originsZ[i] = 0.0f;
+            inverseDirectionsX[i] = inverseDirectionsY[i] = inverseDirectionsZ[i] = 1.0f;
+            lengths[i] = 0.0f;
+        }
+    }
+
+    std::size_t RayPacket::getRaysCount() const {
+        return raysCount;
+    }
+
+    /**
+     * @return Mask where the bit 'i' is set for each ray 'i' of the packet
+     */
+    uint64_t RayPacket::getAllRaysMask() const {
+        return raysCount == MAX_RAYS ? ~0ull : (1ull << raysCount) - 1ull;
+    }
+
+    /**
+     * Slab test of all rays against the AABBox. Provide the same result as AABBox::collideWithRay for each ray.
+     * @param raysMask Mask of the rays to test (bit 'i' for ray 'i')
+     * @return Mask of the rays colliding with the AABBox
+     */
+    uint64_t RayPacket::collideWithAABBox(const AABBox<float>& aabbox, uint64_t raysMask) const {
+        const Point3<float>& boxMin = aabbox.getMin();
+        const Point3<float>& boxMax = aabbox.getMax();
+
+        if (std::popcount(raysMask) <= (int)SPARSE_RAYS_THRESHOLD) { //few rays remaining (incoherent rays): test them one by one
+            uint64_t collideRaysMask = 0;
+            for (uint64_t remainingRaysMask = raysMask; remainingRaysMask != 0; remainingRaysMask &= remainingRaysMask - 1) {
+                auto i = (std::size_t)std::countr_zero(remainingRaysMask);
+                if (collideWithAABBox(boxMin, boxMax, i)) {
+                    collideRaysMask |= 1ull << i;
+                }
+            }
+            return collideRaysMask;
+        }
+
+        for (std::size_t i = 0; i < MAX_RAYS; ++i) {
+            float lengthToMinXPlane = (boxMin.X - originsX[i]) * inverseDirectionsX[i];
+            float lengthToMaxXPlane = (boxMax.X - originsX[i]) * inverseDirectionsX[i];
+            float lengthToMinYPlane = (boxMin.Y - originsY[i]) * inverseDirectionsY[i];
+            float lengthToMaxYPlane = (boxMax.Y - originsY[i]) * inverseDirectionsY[i];
+            float lengthToMinZPlane = (boxMin.Z - originsZ[i]) * inverseDirectionsZ[i];
+            float lengthToMaxZPlane = (boxMax.Z - originsZ[i]) * inverseDirectionsZ[i];
+
+            float lengthToEntry = std::max(std::max(std::min(lengthToMinXPlane, lengthToMaxXPlane), std::min(lengthToMinYPlane, lengthToMaxYPlane)),
+                                           std::min(lengthToMinZPlane, lengthToMaxZPlane));
+            float lengthToExit = std::min(std::min(std::max(lengthToMinXPlane, lengthToMaxXPlane), std::max(lengthToMinYPlane, lengthToMaxYPlane)),
+                                          std::max(lengthToMinZPlane, lengthToMaxZPlane));
+
+            hits[i] = (uint8_t)((lengthToEntry <= lengthToExit) & (lengthToEntry < lengths[i]) & (lengthToExit > 0.0f));
+        }
+
+        uint64_t collideRaysMask = 0;
+        for (std::size_t i = 0; i < MAX_RAYS; ++i) {
+            collideRaysMask |= (uint64_t)hits[i] << i;
+        }
+        return collideRaysMask & raysMask;
+    }
+
+    bool RayPacket::collideWithAABBox(const Point3<float>& boxMin, const Point3<float>& boxMax, std::size_t i) const {
+        float lengthToMinXPlane = (boxMin.X - originsX[i]) * inverseDirectionsX[i];
+        float lengthToMaxXPlane = (boxMax.X - originsX[i]) * inverseDirectionsX[i];
+        float lengthToMinYPlane = (boxMin.Y - originsY[i]) * inverseDirectionsY[i];
+        float lengthToMaxYPlane = (boxMax.Y - originsY[i]) * inverseDirectionsY[i];
+        float lengthToMinZPlane = (boxMin.Z - originsZ[i]) * inverseDirectionsZ[i];
+        float lengthToMaxZPlane = (boxMax.Z - originsZ[i]) * inverseDirectionsZ[i];
+
+        float lengthToEntry = std::max(std::max(std::min(lengthToMinXPlane, lengthToMaxXPlane), std::min(lengthToMinYPlane, lengthToMaxYPlane)),
+                                       std::min(lengthToMinZPlane, lengthToMaxZPlane));
+        float lengthToExit = std::min(std::min(std::max(lengthToMinXPlane, lengthToMaxXPlane), std::max(lengthToMinYPlane, lengthToMaxYPlane)),
+                                      std::max(lengthToMinZPlane, lengthToMaxZPlane));
+
+        return lengthToEntry <= lengthToExit && lengthToEntry < lengths[i] && lengthToExit > 0.0f;
+    }
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <span>
+#include <array>
+#include <cstdint>
+
+#include "math/geometry/3d/Ray.h"
+#include "math/geometry/3d/object/AABBox.h"
+
+namespace urchin {
+
+    /**
+     * Packet of rays stored in structure of arrays (SoA) layout. The packet is tested against an AABBox in one pass: the slab test
+     * loop has no branch and no dependency between rays so that the compiler vectorizes it with the SIMD instructions of the target.
+     */
+    class RayPacket {
+        public:
+            static constexpr std::size_t MAX_RAYS = 64;
+
+            RayPacket();
+
+            void setup(std::span<const Ray<float>>);
+            std::size_t getRaysCount() const;
+            uint64_t getAllRaysMask() const;
+
+            uint64_t collideWithAABBox(const AABBox<float>&, uint64_t) const;
+
+        private:
+            bool collideWithAABBox(const Point3<float>&, const Point3<float>&, std::size_t) const;
+
+            static constexpr std::size_t SPARSE_RAYS_THRESHOLD = 8;
+
+            std::size_t raysCount;
+
+            alignas(32) std::array<float, MAX_RAYS> originsX;
+            alignas(32) std::array<float, MAX_RAYS> originsY;
+            alignas(32) std::array<float, MAX_RAYS> originsZ;
+            alignas(32) std::array<float, MAX_RAYS> inverseDirectionsX;
+            alignas(32) std::array<float, MAX_RAYS> inverseDirectionsY;
+            alignas(32) std::array<float, MAX_RAYS> inverseDirectionsZ;
+            alignas(32) std::array<float, MAX_RAYS> lengths;
+            alignas(32) mutable std::array<uint8_t, MAX_RAYS> hits;
+    };
+
+}
@@ -1,10 +1,10 @@
 #include <limits>
 #include <stdexcept>
 #include <cassert>
+#include <algorithm>
 
 #include "math/geometry/3d/Simplex.h"
 #include "math/geometry/3d/LineSegment3D.h"
-#include "math/geometry/3d/object/Tetrahedron.h"
 #include "math/geometry/3d/object/Triangle3D.h"
 
 namespace urchin {
@@ -103,6 +103,8 @@ namespace urchin {
 
     /**
      * Update the simplex: remove useless point, find closest point to origin and barycentrics.
+     * The last point added to the simplex has been found in the direction of the origin: the voronoi regions which don't include this point cannot contain the
+     * origin and are not tested (2D: A | 3D: A, B, AB | 4D: ABC and his sub-regions).
      */
     template<class T> void Simplex<T>::updateSimplex() {
         if (getSize() == 1) { //simplex is a point
@@ -111,13 +113,14 @@ namespace urchin {
             setBarycentric(0, 1.0);
         } else if (getSize() == 2) { //simplex is a line (1D)
 
-            const Point3<T>& pointA = getPoint(0);
-            const Point3<T>& pointB = getPoint(1); //pointB is the last point added to the simplex
-
             std::array<T, 2> barycentrics = {0.0, 0.0};
-            closestPointToOrigin = LineSegment3D<T>(pointA, pointB).closestPoint(Point3<T>(0.0, 0.0, 0.0), barycentrics);
+            closestPointToOrigin = closestPointToOriginOnSegment(getPoint(0), getPoint(1), barycentrics);
             setBarycentric(0, barycentrics[0]);
             setBarycentric(1, barycentrics[1]);
+
+            if (barycentrics[0] == 0.0) { //remove pointA
+                removePoint(0);
+            }
         } else if (getSize() == 3) { //simplex is a triangle (2D)
 
             const Point3<T>& pointA = getPoint(0);
@@ -130,7 +133,7 @@ namespace urchin {
             const Vector3<T> normalAbc = cb.crossProduct(ca);
 
             std::array<T, 3> barycentrics = {0.0, 0.0, 0.0};
-            closestPointToOrigin = Triangle3D<T>(pointA, pointB, pointC).closestPoint(Point3<T>(0.0, 0.0, 0.0), barycentrics);
+            closestPointToOrigin = closestPointToOriginOnTriangle(pointA, pointB, pointC, barycentrics);
             setBarycentric(0, barycentrics[0]);
             setBarycentric(1, barycentrics[1]);
             setBarycentric(2, barycentrics[2]);
@@ -142,7 +145,7 @@ namespace urchin {
                 removePoint(0);
             }
 
-            if (normalAbc.dotProduct(co) <= 0.0) { //voronoi region -ABC => ABC
+            if (getSize() == 3 && normalAbc.dotProduct(co) <= 0.0) { //voronoi region -ABC => ABC
                 std::swap(simplexPoints[0], simplexPoints[1]); //swap pointA and pointB
             }
         } else if (getSize() == 4) { //simplex is a tetrahedron (3D)
@@ -152,28 +155,189 @@ namespace urchin {
             const Point3<T>& pointC = getPoint(2);
             const Point3<T>& pointD = getPoint(3); //pointD is the last point added to the simplex
 
+            //test faces including pointD: ACD, ADB and BDC
             std::array<T, 4> barycentrics = {0.0, 0.0, 0.0, 0.0};
-            constexpr unsigned short voronoiRegionMask = 14u; //test all voronoi regions except the one which doesn't include the new point added (pointD)
-            closestPointToOrigin = Tetrahedron<T>(pointA, pointB, pointC, pointD).closestPoint(Point3<T>(0.0, 0.0, 0.0), barycentrics, voronoiRegionMask);
-            setBarycentric(0, barycentrics[0]);
-            setBarycentric(1, barycentrics[1]);
-            setBarycentric(2, barycentrics[2]);
-            setBarycentric(3, barycentrics[3]);
-
-            if (barycentrics[2] == 0.0) { //remove pointC
-                removePoint(2);
+            std::array<T, 3> triangleBarycentrics = {0.0, 0.0, 0.0};
+            T bestSquareDist = std::numeric_limits<T>::max();
+            bool originInsideTetrahedron = true;
+
+            if (isOriginOutsideOrInPlane(pointA, pointC, pointD, pointB)) {
+                originInsideTetrahedron = false;
+                Point3<T> closestPoint = closestPointToOriginOnTriangle(pointA, pointC, pointD, triangleBarycentrics);
+                T squareDist = closestPoint.toVector().squareLength();
+                if (squareDist < bestSquareDist) {
+                    bestSquareDist = squareDist;
+                    closestPointToOrigin = closestPoint;
+                    barycentrics = {triangleBarycentrics[0], 0.0, triangleBarycentrics[1], triangleBarycentrics[2]};
+                }
             }
-            if (barycentrics[1] == 0.0) { //remove pointB
-                removePoint(1);
+            if (isOriginOutsideOrInPlane(pointB, pointA, pointD, pointC)) {
+                originInsideTetrahedron = false;
+                Point3<T> closestPoint = closestPointToOriginOnTriangle(pointB, pointA, pointD, triangleBarycentrics);
+                T squareDist = closestPoint.toVector().squareLength();
+                if (squareDist < bestSquareDist) {
+                    bestSquareDist = squareDist;
+                    closestPointToOrigin = closestPoint;
+                    barycentrics = {triangleBarycentrics[1], triangleBarycentrics[0], 0.0, triangleBarycentrics[2]};
+                }
             }
-            if (barycentrics[0] == 0.0) { //remove pointA
-                removePoint(0);
+            if (isOriginOutsideOrInPlane(pointC, pointB, pointD, pointA)) {
+                originInsideTetrahedron = false;
+                Point3<T> closestPoint = closestPointToOriginOnTriangle(pointC, pointB, pointD, triangleBarycentrics);
+                T squareDist = closestPoint.toVector().squareLength();
+                if (squareDist < bestSquareDist) {
+                    closestPointToOrigin = closestPoint;
+                    barycentrics = {0.0, triangleBarycentrics[1], triangleBarycentrics[0], triangleBarycentrics[2]};
+                }
+            }
+
+            if (originInsideTetrahedron) {
+                closestPointToOrigin = Point3<T>(0.0, 0.0, 0.0); //barycentrics are not computed: simplex contains the origin
+            } else {
+                setBarycentric(0, barycentrics[0]);
+                setBarycentric(1, barycentrics[1]);
+                setBarycentric(2, barycentrics[2]);
+                setBarycentric(3, barycentrics[3]);
+
+                if (barycentrics[2] == 0.0) { //remove pointC
+                    removePoint(2);
+                }
+                if (barycentrics[1] == 0.0) { //remove pointB
+                    removePoint(1);
+                }
+                if (barycentrics[0] == 0.0) { //remove pointA
+                    removePoint(0);
+                }
             }
         } else {
             throw std::invalid_argument("Size of simplex unsupported: " + std::to_string(getSize()) + ".");
         }
     }
 
+    /**
+     * @param pointB Last point added to the simplex. Voronoi region of point A is not tested.
+     * @param barycentrics [out] Barycentrics of the closest point
+     * @return Point on segment AB closest to the origin
+     */
+    template<class T> Point3<T> Simplex<T>::closestPointToOriginOnSegment(const Point3<T>& pointA, const Point3<T>& pointB, std::array<T, 2>& barycentrics) {
+        Vector3<T> ab = pointA.vector(pointB);
+        T abSquareLength = ab.squareLength();
+        if (abSquareLength == (T)0.0) { //point B identical to point A: keep the last point added
+            barycentrics[0] = 0.0;
+            barycentrics[1] = 1.0;
+            return pointB;
+        }
+
+        T t = -pointA.toVector().dotProduct(ab) / abSquareLength;
+        if (t >= (T)1.0) { //voronoi region of point B
+            barycentrics[0] = 0.0;
+            barycentrics[1] = 1.0;
+            return pointB;
+        }
+
+        t = std::max(t, (T)0.0); //voronoi region of point A excluded: clamp value due to float imprecision
+        barycentrics[0] = (T)1.0 - t;
+        barycentrics[1] = t;
+        return pointA.translate(t * ab);
+    }
+
+    /**
+     * @param pointC Last point added to the simplex. Voronoi regions of point A, point B and edge AB are not tested unless the face region result is invalid.
+     * @param barycentrics [out] Barycentrics of the closest point
+     * @return Point on triangle ABC closest to the origin
+     */
+    template<class T> Point3<T> Simplex<T>::closestPointToOriginOnTriangle(const Point3<T>& pointA, const Point3<T>& pointB, const Point3<T>& pointC, std::array<T, 3>& barycentrics) {
+        Vector3<T> ab = pointA.vector(pointB);
+        Vector3<T> ac = pointA.vector(pointC);
+        Vector3<T> ao = -pointA.toVector();
+        Vector3<T> bo = -pointB.toVector();
+        Vector3<T> co = -pointC.toVector();
+        T abDotAo = ab.dotProduct(ao);
+        T acDotAo = ac.dotProduct(ao);
+        T abDotBo = ab.dotProduct(bo);
+        T acDotBo = ac.dotProduct(bo);
+        T abDotCo = ab.dotProduct(co);
+        T acDotCo = ac.dotProduct(co);
+
+        //check if origin is in voronoi region of point C
+        if (acDotCo >= (T)0.0 && abDotCo <= acDotCo) {
+            barycentrics = {0.0, 0.0, 1.0};
+            return pointC;
+        }
+
+        //check if origin is in voronoi region of edge AC
+        T vb = abDotCo * acDotAo - abDotAo * acDotCo;
+        if (vb <= (T)0.0 && acDotAo >= (T)0.0 && acDotCo <= (T)0.0) {
+            T w = acDotAo / (acDotAo - acDotCo);
+            barycentrics = {(T)1.0 - w, 0.0, w};
+            return pointA.translate(w * ac);
+        }
+
+        //check if origin is in voronoi region of edge BC
+        T va = abDotBo * acDotCo - abDotCo * acDotBo;
+        if (va <= (T)0.0 && (acDotBo - abDotBo) >= (T)0.0 && (abDotCo - acDotCo) >= (T)0.0) {
+            T w = (acDotBo - abDotBo) / ((acDotBo - abDotBo) + (abDotCo - acDotCo));
+            barycentrics = {0.0, (T)1.0 - w, w};
+            return pointB + w * (pointC - pointB);
+        }
+
+        //origin is inside face region
+        T vc = abDotAo * acDotBo - abDotBo * acDotAo;
+        T vSum = va + vb + vc;
+        if (vSum > (T)0.0) {
+            T v = vb / vSum;
+            T w = vc / vSum;
+            if (v >= (T)0.0 && w >= (T)0.0 && v + w <= (T)1.0) {
+                barycentrics = {(T)1.0 - v - w, v, w};
+                return pointA.translate(ab * v + ac * w);
+            }
+        }
+
+        //origin in a not tested voronoi region (float imprecision) or degenerate triangle
+        return closestPointToOriginOnTriangleAllRegions(pointA, pointB, pointC, barycentrics);
+    }
+
+    /**
+     * @param barycentrics [out] Barycentrics of the closest point
+     * @return Point on triangle ABC closest to the origin. All the voronoi regions are tested and the degenerate triangles (aligned points) are supported.
+     */
+    template<class T> Point3<T> Simplex<T>::closestPointToOriginOnTriangleAllRegions(const Point3<T>& pointA, const Point3<T>& pointB, const Point3<T>& pointC, std::array<T, 3>& barycentrics) {
+        const Point3<T> origin(0.0, 0.0, 0.0);
+        if (pointA.vector(pointB).crossProduct(pointA.vector(pointC)).squareLength() > (T)0.0) {
+            return Triangle3D<T>(pointA, pointB, pointC).closestPoint(origin, barycentrics);
+        }
+
+        //degenerate triangle: closest point on the edges
+        std::array<T, 2> segmentBarycentrics = {0.0, 0.0};
+        Point3<T> closestPoint = LineSegment3D<T>(pointA, pointB).closestPoint(origin, segmentBarycentrics);
+        barycentrics = {segmentBarycentrics[0], segmentBarycentrics[1], 0.0};
+        T bestSquareDist = closestPoint.toVector().squareLength();
+
+        Point3<T> closestPointAc = LineSegment3D<T>(pointA, pointC).closestPoint(origin, segmentBarycentrics);
+        if (closestPointAc.toVector().squareLength() < bestSquareDist) {
+            closestPoint = closestPointAc;
+            barycentrics = {segmentBarycentrics[0], 0.0, segmentBarycentrics[1]};
+            bestSquareDist = closestPointAc.toVector().squareLength();
+        }
+
+        Point3<T> closestPointBc = LineSegment3D<T>(pointB, pointC).closestPoint(origin, segmentBarycentrics);
+        if (closestPointBc.toVector().squareLength() < bestSquareDist) {
+            closestPoint = closestPointBc;
+            barycentrics = {0.0, segmentBarycentrics[0], segmentBarycentrics[1]};
+        }
+        return closestPoint;
+    }
+
+    /**
+     * @return True if the origin is outside the plane ABC or on the plane. The outside is the side opposite to the point.
+     */
+    template<class T> bool Simplex<T>::isOriginOutsideOrInPlane(const Point3<T>& planePointA, const Point3<T>& planePointB, const Point3<T>& planePointC, const Point3<T>& oppositePoint) {
+        Vector3<T> normal = planePointA.vector(planePointB).crossProduct(planePointA.vector(planePointC));
+        T signOrigin = -planePointA.toVector().dotProduct(normal);
+        T signOppositePoint = planePointA.vector(oppositePoint).dotProduct(normal);
+        return (signOrigin * signOppositePoint) <= (T)0.0;
+    }
+
     template<class T> void Simplex<T>::removePoint(std::size_t index) {
         assert(simplexPointsSize > 0);
 
@@ -31,6 +31,10 @@ namespace urchin {
 
         private:
             void updateSimplex();
+            static Point3<T> closestPointToOriginOnSegment(const Point3<T>&, const Point3<T>&, std::array<T, 2>&);
+            static Point3<T> closestPointToOriginOnTriangle(const Point3<T>&, const Point3<T>&, const Point3<T>&, std::array<T, 3>&);
+            static Point3<T> closestPointToOriginOnTriangleAllRegions(const Point3<T>&, const Point3<T>&, const Point3<T>&, std::array<T, 3>&);
+            static bool isOriginOutsideOrInPlane(const Point3<T>&, const Point3<T>&, const Point3<T>&, const Point3<T>&);
             void removePoint(std::size_t);
             void setBarycentric(std::size_t, T);
 
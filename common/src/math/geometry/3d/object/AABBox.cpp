@@ -144,6 +144,11 @@ namespace urchin {
         return boxShape.getVolume();
     }
 
+    template<class T> T AABBox<T>::getSurfaceArea() const {
+        const Vector3<T>& halfSizes = getHalfSizes();
+        return (halfSizes.X * halfSizes.Y + halfSizes.Y * halfSizes.Z + halfSizes.Z * halfSizes.X) * (T)8.0;
+    }
+
     template<class T> AABBox<T> AABBox<T>::moveAABBox(const Transform<T>& transform) const {
         return transform.getTransformMatrix() * *this;
     }
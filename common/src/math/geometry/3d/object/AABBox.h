@@ -38,6 +38,7 @@ namespace urchin {
             Point3<T> getSupportPoint(const Vector3<T>&) const override;
             std::array<Point3<T>, 8> getPoints() const;
             T getVolume() const;
+            T getSurfaceArea() const;
 
             [[nodiscard]] AABBox<T> moveAABBox(const Transform<T>&) const;
             Matrix4<T> toProjectionMatrix() const;
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <cassert>
+#include <algorithm>
 
 #include "partitioning/aabbtree/AABBNodeData.h"
 #include "math/geometry/3d/object/AABBox.h"
@@ -25,6 +26,7 @@ namespace urchin {
             AABBNode<OBJ>* getRightChild() const;
 
             const AABBox<float>& getAABBox() const;
+            unsigned int getHeight() const;
 
         protected:
             void updateAABBox(float);
@@ -44,6 +46,7 @@ namespace urchin {
         private:
             std::unique_ptr<AABBNodeData<OBJ>> nodeData;
             AABBox<float> aabbox;
+            unsigned int height;
 
             AABBNode<OBJ>* parentNode;
             std::array<std::shared_ptr<AABBNode<OBJ>>, 2> children;
@@ -1,5 +1,6 @@
 template<class OBJ> AABBNode<OBJ>::AABBNode(std::unique_ptr<AABBNodeData<OBJ>> nodeData) :
         nodeData(std::move(nodeData)),
+        height(0),
         parentNode(nullptr) {
 
 }
@@ -70,13 +71,25 @@ template<class OBJ> const AABBox<float> &AABBNode<OBJ>::getAABBox() const {
     return aabbox;
 }
 
+/**
+ * Returns 0 for leaf and the height of the highest child plus one for branch
+ */
+template<class OBJ> unsigned int AABBNode<OBJ>::getHeight() const {
+    return height;
+}
+
+/**
+ * Update the AABBox and the height of the node. The children of a branch node must be up-to-date.
+ */
 template<class OBJ> void AABBNode<OBJ>::updateAABBox(float fatMargin) {
     if (isLeaf()) {
         Point3 fatMargin3(fatMargin, fatMargin, fatMargin);
         AABBox<float> objectBox = getNodeData().retrieveObjectAABBox();
 
         aabbox = AABBox(objectBox.getMin()-fatMargin3, objectBox.getMax()+fatMargin3);
+        height = 0;
     } else {
         aabbox = children[0]->getAABBox().merge(children[1]->getAABBox());
+        height = 1 + std::max(children[0]->getHeight(), children[1]->getHeight());
     }
 }
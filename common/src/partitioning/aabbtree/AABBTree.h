@@ -1,8 +1,13 @@
 #pragma once
 
+#include <bit>
+#include <span>
+
 #include "partitioning/aabbtree/AABBNode.h"
 #include "partitioning/aabbtree/AABBNodeData.h"
+#include "partitioning/aabbtree/AABBTreeSahPartitioner.h"
 #include "math/geometry/3d/Ray.h"
+#include "math/geometry/3d/RayPacket.h"
 
 namespace urchin {
 
@@ -16,7 +21,9 @@ namespace urchin {
             void updateFatMargin(float);
 
             AABBNode<OBJ>* getRootNode() const;
+            bool containsObject(void*) const;
             AABBNodeData<OBJ>& getNodeData(void*) const;
+            const AABBox<float>& getFatAABBox(void*) const;
             void getAllNodeObjects(std::vector<OBJ>&) const;
 
             void addObject(std::unique_ptr<AABBNodeData<OBJ>>);
@@ -29,8 +36,13 @@ namespace urchin {
             void updateObjects();
             virtual void preUpdateObjectCallback(AABBNode<OBJ>&);
 
+            void rebuild();
+            unsigned int getHeight() const;
+            float computeTotalSurfaceArea() const;
+
             void aabboxQuery(const AABBox<float>&, std::vector<OBJ>&) const;
             void rayQuery(const Ray<float>&, std::vector<OBJ>&) const;
+            void rayQueries(std::span<const Ray<float>>, std::vector<std::vector<OBJ>>&) const;
             void enlargedRayQuery(const Ray<float>&, float, const void*, std::vector<OBJ>&) const;
 
         protected:
@@ -39,12 +51,21 @@ namespace urchin {
 
         private:
             std::vector<std::unique_ptr<AABBNodeData<OBJ>>> extractAllNodeData();
-            void insertNode(std::shared_ptr<AABBNode<OBJ>>, std::shared_ptr<AABBNode<OBJ>>);
+            void insertNode(std::shared_ptr<AABBNode<OBJ>>);
             void replaceNode(const AABBNode<OBJ>&, std::shared_ptr<AABBNode<OBJ>>);
             void removeLeafNode(AABBNode<OBJ>&);
 
+            std::shared_ptr<AABBNode<OBJ>> getNodeSmartPtr(const AABBNode<OBJ>&) const;
+            void refitAndBalance(AABBNode<OBJ>*);
+            std::shared_ptr<AABBNode<OBJ>> balanceNode(const std::shared_ptr<AABBNode<OBJ>>&);
+            std::shared_ptr<AABBNode<OBJ>> rotateNode(const std::shared_ptr<AABBNode<OBJ>>&, bool);
+
+            std::shared_ptr<AABBNode<OBJ>> buildSubTree(std::span<std::shared_ptr<AABBNode<OBJ>>>) const;
+
             float fatMargin;
             std::shared_ptr<AABBNode<OBJ>> rootNode;
+            mutable std::vector<std::pair<AABBNode<OBJ>*, uint64_t>> browseMaskedNodes;
+            mutable RayPacket rayPacket;
     };
 
     #include "AABBTree.inl"
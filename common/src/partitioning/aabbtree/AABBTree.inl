@@ -18,10 +18,21 @@ template <class OBJ> AABBNode<OBJ>* AABBTree<OBJ>::getRootNode() const {
     return rootNode.get();
 }
 
+template <class OBJ> bool AABBTree<OBJ>::containsObject(void* objectPtr) const {
+    return objectsNode.contains(objectPtr);
+}
+
 template <class OBJ> AABBNodeData<OBJ>& AABBTree<OBJ>::getNodeData(void* objectPtr) const {
     return objectsNode.at(objectPtr)->getNodeData();
 }
 
+/**
+ * @return Fat AABBox of the leaf node containing the object
+ */
+template <class OBJ> const AABBox<float>& AABBTree<OBJ>::getFatAABBox(void* objectPtr) const {
+    return objectsNode.at(objectPtr)->getAABBox();
+}
+
 /**
  *
  * @param nodeObjects [out] Returns all node objects in the tree
@@ -71,7 +82,7 @@ template <class OBJ> void AABBTree<OBJ>::addObject(std::unique_ptr<AABBNodeData<
 
     if (rootNode) [[likely]] {
         nodeToInsert->updateAABBox(fatMargin);
-        insertNode(nodeToInsert, rootNode);
+        insertNode(nodeToInsert);
     } else {
         rootNode = nodeToInsert;
         rootNode->updateAABBox(fatMargin);
@@ -86,28 +97,24 @@ template<class OBJ> void AABBTree<OBJ>::postAddObjectCallback(AABBNode<OBJ>&) {
     //can be overridden
 }
 
-template<class OBJ> void AABBTree<OBJ>::insertNode(std::shared_ptr<AABBNode<OBJ>> nodeToInsert, std::shared_ptr<AABBNode<OBJ>> currentNode) {
-    if (currentNode->isLeaf()) {
-        auto newParent = std::make_shared<AABBNode<OBJ>>(nullptr);
-        replaceNode(*currentNode, newParent);
-        newParent->setLeftChild(std::move(nodeToInsert));
-        newParent->setRightChild(currentNode);
-        newParent->updateAABBox(fatMargin);
-    } else {
+template<class OBJ> void AABBTree<OBJ>::insertNode(std::shared_ptr<AABBNode<OBJ>> nodeToInsert) {
+    std::shared_ptr<AABBNode<OBJ>> currentNode = rootNode;
+    while (!currentNode->isLeaf()) {
         const AABBox<float>& leftAABBox = currentNode->getLeftChild()->getAABBox();
         float volumeDiffLeft = leftAABBox.merge(nodeToInsert->getAABBox()).getVolume() - leftAABBox.getVolume();
 
         const AABBox<float>& rightAABBox = currentNode->getRightChild()->getAABBox();
         float volumeDiffRight = rightAABBox.merge(nodeToInsert->getAABBox()).getVolume() - rightAABBox.getVolume();
 
-        if (volumeDiffLeft < volumeDiffRight) {
-            insertNode(std::move(nodeToInsert), currentNode->getLeftChildSmartPtr());
-        } else {
-            insertNode(std::move(nodeToInsert), currentNode->getRightChildSmartPtr());
-        }
-
-        currentNode->updateAABBox(fatMargin);
+        currentNode = volumeDiffLeft < volumeDiffRight ? currentNode->getLeftChildSmartPtr() : currentNode->getRightChildSmartPtr();
     }
+
+    auto newParent = std::make_shared<AABBNode<OBJ>>(nullptr);
+    replaceNode(*currentNode, newParent);
+    newParent->setLeftChild(std::move(nodeToInsert));
+    newParent->setRightChild(currentNode);
+
+    refitAndBalance(newParent.get());
 }
 
 template<class OBJ> void AABBTree<OBJ>::replaceNode(const AABBNode<OBJ>& nodeToReplace, std::shared_ptr<AABBNode<OBJ>> newNode) {
@@ -149,14 +156,77 @@ template<class OBJ> void AABBTree<OBJ>::removeLeafNode(AABBNode<OBJ>& nodeToRemo
     assert(nodeToRemove.isLeaf());
     if (nodeToRemove.getParent()) {
         std::shared_ptr<AABBNode<OBJ>> sibling = nodeToRemove.getSibling();
+        AABBNode<OBJ>* grandParentNode = nodeToRemove.getParent()->getParent();
         replaceNode(*nodeToRemove.getParent(), sibling);
         //at this stage: parentNode and nodeToRemove are not anymore in the tree
+
+        refitAndBalance(grandParentNode);
     } else {
         assert(&nodeToRemove == rootNode.get());
         rootNode = nullptr;
     }
 }
 
+template<class OBJ> std::shared_ptr<AABBNode<OBJ>> AABBTree<OBJ>::getNodeSmartPtr(const AABBNode<OBJ>& node) const {
+    if (node.getParent()) {
+        return node.getParent()->getLeftChild() == &node ? node.getParent()->getLeftChildSmartPtr() : node.getParent()->getRightChildSmartPtr();
+    }
+    return rootNode;
+}
+
+/**
+ * Refit the AABBox of the branch node and of all its ancestors. A rotation is applied on each unbalanced node (AVL-style).
+ */
+template<class OBJ> void AABBTree<OBJ>::refitAndBalance(AABBNode<OBJ>* branchNode) {
+    while (branchNode) {
+        std::shared_ptr<AABBNode<OBJ>> balancedNode = balanceNode(getNodeSmartPtr(*branchNode));
+        balancedNode->updateAABBox(fatMargin);
+        branchNode = balancedNode->getParent();
+    }
+}
+
+/**
+ * @return Node in the place of the provided node after balancing
+ */
+template<class OBJ> std::shared_ptr<AABBNode<OBJ>> AABBTree<OBJ>::balanceNode(const std::shared_ptr<AABBNode<OBJ>>& node) {
+    assert(!node->isLeaf());
+    int balance = (int)node->getRightChild()->getHeight() - (int)node->getLeftChild()->getHeight();
+    if (balance > 1) {
+        return rotateNode(node, true);
+    } else if (balance < -1) {
+        return rotateNode(node, false);
+    }
+    return node;
+}
+
+/**
+ * Promote the highest child of the node in the place of the node. The node becomes a child of the promoted node and
+ * takes the lowest grandchild of the promoted node in replacement.
+ * @param rightRotation True when the right child of the node is promoted
+ * @return Promoted node
+ */
+template<class OBJ> std::shared_ptr<AABBNode<OBJ>> AABBTree<OBJ>::rotateNode(const std::shared_ptr<AABBNode<OBJ>>& node, bool rightRotation) {
+    std::shared_ptr<AABBNode<OBJ>> promotedNode = rightRotation ? node->getRightChildSmartPtr() : node->getLeftChildSmartPtr();
+    std::shared_ptr<AABBNode<OBJ>> highestGrandChild = promotedNode->getLeftChildSmartPtr();
+    std::shared_ptr<AABBNode<OBJ>> lowestGrandChild = promotedNode->getRightChildSmartPtr();
+    if (highestGrandChild->getHeight() < lowestGrandChild->getHeight()) {
+        std::swap(highestGrandChild, lowestGrandChild);
+    }
+
+    replaceNode(*node, promotedNode);
+    promotedNode->setLeftChild(node);
+    promotedNode->setRightChild(std::move(highestGrandChild));
+    if (rightRotation) {
+        node->setRightChild(std::move(lowestGrandChild));
+    } else {
+        node->setLeftChild(std::move(lowestGrandChild));
+    }
+
+    node->updateAABBox(fatMargin);
+    promotedNode->updateAABBox(fatMargin);
+    return promotedNode;
+}
+
 template<class OBJ> void AABBTree<OBJ>::updateObjects() {
     for (objects_node_it<OBJ> it = objectsNode.begin(); it != objectsNode.end();) {
         const std::shared_ptr<AABBNode<OBJ>>& leaf = it->second;
@@ -183,6 +253,72 @@ template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNode<OBJ>&)
     //can be overridden
 }
 
+/**
+ * Rebuild the tree from scratch (top-down) by using the surface area heuristic (SAH). The leaf nodes and their fat AABBox are kept.
+ * A rebuild is useful after a bulk insertion or when the tree quality is degraded (see getHeight() and computeTotalSurfaceArea()).
+ */
+template<class OBJ> void AABBTree<OBJ>::rebuild() {
+    if (objectsNode.empty()) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<AABBNode<OBJ>>> leafNodes;
+    leafNodes.reserve(objectsNode.size());
+    for (const auto& [objectPtr, leafNode] : objectsNode) {
+        leafNodes.push_back(leafNode);
+    }
+
+    rootNode = buildSubTree(leafNodes);
+    rootNode->setParent(nullptr);
+}
+
+template<class OBJ> std::shared_ptr<AABBNode<OBJ>> AABBTree<OBJ>::buildSubTree(std::span<std::shared_ptr<AABBNode<OBJ>>> leafNodes) const {
+    if (leafNodes.size() == 1) {
+        return leafNodes[0];
+    }
+
+    std::size_t splitIndex = AABBTreeSahPartitioner::partition(leafNodes, [](const std::shared_ptr<AABBNode<OBJ>>& leafNode) -> const AABBox<float>& {
+        return leafNode->getAABBox();
+    });
+
+    auto branchNode = std::make_shared<AABBNode<OBJ>>(nullptr);
+    branchNode->setLeftChild(buildSubTree(leafNodes.subspan(0, splitIndex)));
+    branchNode->setRightChild(buildSubTree(leafNodes.subspan(splitIndex)));
+    branchNode->updateAABBox(fatMargin);
+    return branchNode;
+}
+
+/**
+ * @return Height of the tree (0 for an empty tree or a tree with one object). The height is logarithmic in the number of objects for a balanced tree.
+ */
+template<class OBJ> unsigned int AABBTree<OBJ>::getHeight() const {
+    return rootNode ? rootNode->getHeight() : 0;
+}
+
+/**
+ * @return Sum of the surface area of all branch nodes. A lower value indicates a better tree for the queries.
+ */
+template<class OBJ> float AABBTree<OBJ>::computeTotalSurfaceArea() const {
+    float totalSurfaceArea = 0.0f;
+
+    browseNodes.clear();
+    if (rootNode) [[likely]] {
+        browseNodes.push_back(rootNode.get());
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const AABBNode<OBJ>* currentNode = browseNodes[i];
+
+        if (!currentNode->isLeaf()) {
+            totalSurfaceArea += currentNode->getAABBox().getSurfaceArea();
+            browseNodes.push_back(currentNode->getRightChild());
+            browseNodes.push_back(currentNode->getLeftChild());
+        }
+    }
+
+    return totalSurfaceArea;
+}
+
 /**
  * @param objectsAABBoxHit [out] Objects AABBox hit by the aabbox
  */
@@ -229,6 +365,42 @@ template<class OBJ> void AABBTree<OBJ>::rayQuery(const Ray<float>& ray, std::vec
     }
 }
 
+/**
+ * Process the ray queries by packet of rays: the tree is traversed once per packet and each node is tested against all the rays of the packet
+ * which collide with the parent node.
+ * @param objectsAABBoxHitRays [out] Objects AABBox hit by each ray. The vector is resized to the number of rays.
+ */
+template<class OBJ> void AABBTree<OBJ>::rayQueries(std::span<const Ray<float>> rays, std::vector<std::vector<OBJ>>& objectsAABBoxHitRays) const {
+    objectsAABBoxHitRays.resize(rays.size());
+    if (!rootNode) [[unlikely]] {
+        return;
+    }
+
+    for (std::size_t packetStartIndex = 0; packetStartIndex < rays.size(); packetStartIndex += RayPacket::MAX_RAYS) {
+        rayPacket.setup(rays.subspan(packetStartIndex, std::min(RayPacket::MAX_RAYS, rays.size() - packetStartIndex)));
+
+        browseMaskedNodes.clear();
+        browseMaskedNodes.emplace_back(rootNode.get(), rayPacket.getAllRaysMask());
+        while (!browseMaskedNodes.empty()) { //tree traversal: pre-order (iterative)
+            auto [currentNode, raysMask] = browseMaskedNodes.back();
+            browseMaskedNodes.pop_back();
+
+            uint64_t collideRaysMask = rayPacket.collideWithAABBox(currentNode->getAABBox(), raysMask);
+            if (collideRaysMask != 0) {
+                if (currentNode->isLeaf()) {
+                    for (; collideRaysMask != 0; collideRaysMask &= collideRaysMask - 1) {
+                        auto rayIndex = (std::size_t)std::countr_zero(collideRaysMask);
+                        objectsAABBoxHitRays[packetStartIndex + rayIndex].push_back(currentNode->getNodeData().getNodeObject());
+                    }
+                } else {
+                    browseMaskedNodes.emplace_back(currentNode->getRightChild(), collideRaysMask);
+                    browseMaskedNodes.emplace_back(currentNode->getLeftChild(), collideRaysMask);
+                }
+            }
+        }
+    }
+}
+
 /**
  * Enlarge each node box of a specified size and process a classical ray test. This method provide similar result to a OBB test but with better performance.
  * @param enlargeNodeBoxHalfSize Specify the size of the enlargement. A size of 0.5 will enlarge the node box from 1.0 (0.5 on left and 0.5 on right).
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <span>
+#include <array>
+#include <limits>
+#include <algorithm>
+
+#include "math/geometry/3d/object/AABBox.h"
+
+namespace urchin {
+
+    /**
+    * Partition the leaves of an AABBox tree according to the surface area heuristic (SAH). Used to build the tree top-down.
+    */
+    class AABBTreeSahPartitioner {
+        public:
+            template<class LEAF, class AABBOX_GETTER> static std::size_t partition(std::span<LEAF>, AABBOX_GETTER);
+
+        private:
+            static constexpr std::size_t BINS_COUNT = 12;
+    };
+
+    #include "AABBTreeSahPartitioner.inl"
+
+}
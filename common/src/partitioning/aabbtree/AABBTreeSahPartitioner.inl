@@ -0,0 +1,79 @@
+/**
+ * Partition the leaves along the axis of the largest centroids extent. The partition minimizing the surface area heuristic
+ * is selected among a fixed number of bins. A median split is used when no partition is possible.
+ * @param leaves [out] Leaves partitioned
+ * @param leafAABBox Function returning the AABBox of a leaf
+ * @return Index of the first leaf of the right partition
+ */
+template<class LEAF, class AABBOX_GETTER> std::size_t AABBTreeSahPartitioner::partition(std::span<LEAF> leaves, AABBOX_GETTER leafAABBox) {
+    Point3 minCentroid(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Point3 maxCentroid(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    for (const LEAF& leaf : leaves) {
+        Point3<float> centroid = leafAABBox(leaf).getCenterOfMass();
+        minCentroid = Point3(std::min(minCentroid.X, centroid.X), std::min(minCentroid.Y, centroid.Y), std::min(minCentroid.Z, centroid.Z));
+        maxCentroid = Point3(std::max(maxCentroid.X, centroid.X), std::max(maxCentroid.Y, centroid.Y), std::max(maxCentroid.Z, centroid.Z));
+    }
+
+    Vector3<float> centroidsExtent = minCentroid.vector(maxCentroid);
+    std::size_t axis = 0;
+    if (centroidsExtent.Y > centroidsExtent[axis]) {
+        axis = 1;
+    }
+    if (centroidsExtent.Z > centroidsExtent[axis]) {
+        axis = 2;
+    }
+
+    std::size_t medianIndex = leaves.size() / 2;
+    if (centroidsExtent[axis] <= std::numeric_limits<float>::epsilon()) { //all centroids at same position
+        return medianIndex;
+    }
+
+    auto computeBinIndex = [&](const LEAF& leaf) {
+        float centroidRatio = (leafAABBox(leaf).getCenterOfMass()[axis] - minCentroid[axis]) / centroidsExtent[axis];
+        return std::min((std::size_t)(centroidRatio * (float)BINS_COUNT), BINS_COUNT - 1);
+    };
+
+    std::array<AABBox<float>, BINS_COUNT> binsAABBox;
+    std::array<std::size_t, BINS_COUNT> binsCount = {};
+    binsAABBox.fill(AABBox<float>::initMergeableAABBox());
+    for (const LEAF& leaf : leaves) {
+        std::size_t binIndex = computeBinIndex(leaf);
+        binsAABBox[binIndex] = binsAABBox[binIndex].merge(leafAABBox(leaf));
+        binsCount[binIndex]++;
+    }
+
+    std::array<float, BINS_COUNT> rightCosts = {};
+    AABBox<float> rightAABBox = AABBox<float>::initMergeableAABBox();
+    std::size_t rightCount = 0;
+    for (std::size_t binIndex = BINS_COUNT - 1; binIndex > 0; --binIndex) {
+        rightAABBox = rightAABBox.merge(binsAABBox[binIndex]);
+        rightCount += binsCount[binIndex];
+        rightCosts[binIndex] = rightCount == 0 ? 0.0f : rightAABBox.getSurfaceArea() * (float)rightCount;
+    }
+
+    float bestCost = std::numeric_limits<float>::max();
+    std::size_t bestSplitBin = 0;
+    AABBox<float> leftAABBox = AABBox<float>::initMergeableAABBox();
+    std::size_t leftCount = 0;
+    for (std::size_t splitBin = 1; splitBin < BINS_COUNT; ++splitBin) {
+        leftAABBox = leftAABBox.merge(binsAABBox[splitBin - 1]);
+        leftCount += binsCount[splitBin - 1];
+        if (leftCount != 0 && leftCount != leaves.size()) {
+            float cost = leftAABBox.getSurfaceArea() * (float)leftCount + rightCosts[splitBin];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestSplitBin = splitBin;
+            }
+        }
+    }
+
+    if (bestSplitBin == 0) {
+        std::ranges::nth_element(leaves, leaves.begin() + (long)medianIndex, [&](const LEAF& leaf1, const LEAF& leaf2) {
+            return leafAABBox(leaf1).getCenterOfMass()[axis] < leafAABBox(leaf2).getCenterOfMass()[axis];
+        });
+        return medianIndex;
+    }
+
+    auto rightPartition = std::ranges::partition(leaves, [&](const LEAF& leaf) { return computeBinIndex(leaf) < bestSplitBin; });
+    return (std::size_t)std::distance(leaves.begin(), rightPartition.begin());
+}
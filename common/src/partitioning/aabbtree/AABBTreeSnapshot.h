@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+#include "math/geometry/3d/object/AABBox.h"
+#include "math/geometry/3d/Ray.h"
+
+namespace urchin {
+
+    template<class OBJ> class IndexedAABBTree;
+
+    /**
+    * Copy of an IndexedAABBTree which is not modified by the queries: queries can be executed from several threads.
+    * The snapshot objects can differ from the tree objects (e.g. object enriched with data of the snapshot time).
+    */
+    template<class OBJ> class AABBTreeSnapshot {
+        public:
+            template<class> friend class IndexedAABBTree;
+
+            AABBTreeSnapshot();
+
+            void clear();
+
+            void aabboxQuery(const AABBox<float>&, std::vector<const OBJ*>&) const;
+            void rayQuery(const Ray<float>&, std::vector<const OBJ*>&) const;
+
+        private:
+            static constexpr uint32_t NULL_NODE = std::numeric_limits<uint32_t>::max();
+
+            struct Node {
+                AABBox<float> aabbox; //object AABBox for leaf and bounding box for branch
+                std::array<uint32_t, 2> children;
+                OBJ object; //only defined for leaf
+            };
+
+            std::vector<Node> nodes;
+            uint32_t rootNodeIndex;
+            static thread_local std::vector<uint32_t> browseNodes;
+    };
+
+    #include "AABBTreeSnapshot.inl"
+
+}
@@ -0,0 +1,60 @@
+template<class OBJ> thread_local std::vector<uint32_t> AABBTreeSnapshot<OBJ>::browseNodes;
+
+template<class OBJ> AABBTreeSnapshot<OBJ>::AABBTreeSnapshot() :
+        rootNodeIndex(NULL_NODE) {
+
+}
+
+/**
+ * Remove all the nodes and their objects. Memory is kept for the next copy.
+ */
+template<class OBJ> void AABBTreeSnapshot<OBJ>::clear() {
+    nodes.clear();
+    rootNodeIndex = NULL_NODE;
+}
+
+/**
+ * @param objectsAABBoxHit [out] Objects AABBox hit. The pointers stay valid as long as the snapshot is not modified.
+ */
+template<class OBJ> void AABBTreeSnapshot<OBJ>::aabboxQuery(const AABBox<float>& aabbox, std::vector<const OBJ*>& objectsAABBoxHit) const {
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        if (currentNode.aabbox.collideWithAABBox(aabbox)) {
+            if (currentNode.children[0] == NULL_NODE) {
+                objectsAABBoxHit.push_back(&currentNode.object);
+            } else {
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
+            }
+        }
+    }
+}
+
+/**
+ * @param objectsAABBoxHitRay [out] Objects AABBox hit by the ray. The pointers stay valid as long as the snapshot is not modified.
+ */
+template<class OBJ> void AABBTreeSnapshot<OBJ>::rayQuery(const Ray<float>& ray, std::vector<const OBJ*>& objectsAABBoxHitRay) const {
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        if (currentNode.aabbox.collideWithRay(ray)) {
+            if (currentNode.children[0] == NULL_NODE) {
+                objectsAABBoxHitRay.push_back(&currentNode.object);
+            } else {
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
+            }
+        }
+    }
+}
@@ -0,0 +1,493 @@
+template<class OBJ> bool IndexedAABBTree<OBJ>::Node::isLeaf() const {
+    return children[0] == NULL_NODE;
+}
+
+template<class OBJ> IndexedAABBTree<OBJ>::IndexedAABBTree(float fatMargin) :
+        fatMargin(fatMargin),
+        rootNodeIndex(NULL_NODE),
+        freeNodeIndex(NULL_NODE) {
+
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::updateFatMargin(float fatMargin) {
+    this->fatMargin = fatMargin;
+
+    for (uint32_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+        if (nodes[nodeIndex].nodeData) { //leaf node
+            updateNodeAABBox(nodeIndex);
+        }
+    }
+    rebuild();
+}
+
+template<class OBJ> bool IndexedAABBTree<OBJ>::containsObject(void* objectPtr) const {
+    return objectsNode.contains(objectPtr);
+}
+
+template<class OBJ> AABBNodeData<OBJ>& IndexedAABBTree<OBJ>::getNodeData(void* objectPtr) const {
+    return *nodes[objectsNode.at(objectPtr)].nodeData;
+}
+
+/**
+ * @return Fat AABBox of the leaf node containing the object. The reference is invalidated by the next object insertion.
+ */
+template<class OBJ> const AABBox<float>& IndexedAABBTree<OBJ>::getFatAABBox(void* objectPtr) const {
+    return nodes[objectsNode.at(objectPtr)].aabbox;
+}
+
+/**
+ * @param nodeObjects [out] Returns all node objects in the tree
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::getAllNodeObjects(std::vector<OBJ>& nodeObjects) const {
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        if (currentNode.isLeaf()) {
+            nodeObjects.push_back(currentNode.nodeData->getNodeObject());
+        } else {
+            browseNodes.push_back(currentNode.children[1]);
+            browseNodes.push_back(currentNode.children[0]);
+        }
+    }
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::addObject(std::unique_ptr<AABBNodeData<OBJ>> nodeData) {
+    void* objectPtr = nodeData->getNodeObject().get();
+
+    uint32_t leafNodeIndex = allocateNode();
+    nodes[leafNodeIndex].nodeData = std::move(nodeData);
+    updateNodeAABBox(leafNodeIndex);
+    insertLeafNode(leafNodeIndex);
+
+    objectsNode[objectPtr] = leafNodeIndex;
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::removeObject(const AABBNodeData<OBJ>& nodeData) {
+    removeObject(nodeData.getNodeObject());
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::removeObject(const OBJ& object) {
+    auto itFind = objectsNode.find(object.get());
+    if (itFind != objectsNode.end()) {
+        uint32_t leafNodeIndex = itFind->second;
+        objectsNode.erase(itFind);
+
+        removeLeafNode(leafNodeIndex);
+        freeNode(leafNodeIndex);
+    }
+}
+
+/**
+ * Re-insert the leaf nodes of the moving objects when the object is not anymore included in the fat AABBox of the leaf node.
+ * Contrary to AABBTree, the leaf nodes are re-inserted without re-allocation. Leaf nodes are browsed in the nodes array order (not in the
+ * objects map order which depends on the objects address): the resulting tree is identical from one execution to another.
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::updateObjects() {
+    for (uint32_t leafNodeIndex = 0; leafNodeIndex < nodes.size(); ++leafNodeIndex) {
+        const Node& leafNode = nodes[leafNodeIndex];
+        if (leafNode.nodeData && leafNode.nodeData->isObjectMoving()) [[unlikely]] {
+            if (!leafNode.aabbox.include(leafNode.nodeData->retrieveObjectAABBox())) {
+                removeLeafNode(leafNodeIndex);
+                updateNodeAABBox(leafNodeIndex);
+                insertLeafNode(leafNodeIndex);
+            }
+        }
+    }
+}
+
+/**
+ * Rebuild the tree from scratch (top-down) by using the surface area heuristic (SAH). The leaf nodes and their fat AABBox are kept.
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::rebuild() {
+    if (rootNodeIndex == NULL_NODE) {
+        return;
+    }
+
+    std::vector<uint32_t> leafNodeIndices;
+    leafNodeIndices.reserve(objectsNode.size());
+
+    browseNodes.clear();
+    browseNodes.push_back(rootNodeIndex);
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        uint32_t currentNodeIndex = browseNodes[i];
+
+        if (nodes[currentNodeIndex].isLeaf()) {
+            leafNodeIndices.push_back(currentNodeIndex);
+        } else {
+            browseNodes.push_back(nodes[currentNodeIndex].children[1]);
+            browseNodes.push_back(nodes[currentNodeIndex].children[0]);
+            freeNode(currentNodeIndex);
+        }
+    }
+
+    rootNodeIndex = buildSubTree(leafNodeIndices);
+    nodes[rootNodeIndex].parent = NULL_NODE;
+}
+
+/**
+ * @return Height of the tree (0 for an empty tree or a tree with one object)
+ */
+template<class OBJ> unsigned int IndexedAABBTree<OBJ>::getHeight() const {
+    return rootNodeIndex == NULL_NODE ? 0 : nodes[rootNodeIndex].height;
+}
+
+/**
+ * @return Sum of the surface area of all branch nodes. A lower value indicates a better tree for the queries.
+ */
+template<class OBJ> float IndexedAABBTree<OBJ>::computeTotalSurfaceArea() const {
+    float totalSurfaceArea = 0.0f;
+
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        if (!currentNode.isLeaf()) {
+            totalSurfaceArea += currentNode.aabbox.getSurfaceArea();
+            browseNodes.push_back(currentNode.children[1]);
+            browseNodes.push_back(currentNode.children[0]);
+        }
+    }
+
+    return totalSurfaceArea;
+}
+
+/**
+ * @param objectsAABBoxHit [out] Objects AABBox hit by the aabbox
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::aabboxQuery(const AABBox<float>& aabbox, std::vector<OBJ>& objectsAABBoxHit) const {
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        if (currentNode.aabbox.collideWithAABBox(aabbox)) {
+            if (currentNode.isLeaf()) {
+                objectsAABBoxHit.push_back(currentNode.nodeData->getNodeObject());
+            } else {
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
+            }
+        }
+    }
+}
+
+/**
+ * @param objectsAABBoxHitRay [out] Objects AABBox hit by the ray
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::rayQuery(const Ray<float>& ray, std::vector<OBJ>& objectsAABBoxHitRay) const {
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        if (currentNode.aabbox.collideWithRay(ray)) {
+            if (currentNode.isLeaf()) {
+                objectsAABBoxHitRay.push_back(currentNode.nodeData->getNodeObject());
+            } else {
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
+            }
+        }
+    }
+}
+
+/**
+ * Process the ray queries by packet of rays: the tree is traversed once per packet and each node is tested against all the rays of the packet
+ * which collide with the parent node.
+ * @param objectsAABBoxHitRays [out] Objects AABBox hit by each ray. The vector is resized to the number of rays.
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::rayQueries(std::span<const Ray<float>> rays, std::vector<std::vector<OBJ>>& objectsAABBoxHitRays) const {
+    objectsAABBoxHitRays.resize(rays.size());
+    if (rootNodeIndex == NULL_NODE) [[unlikely]] {
+        return;
+    }
+
+    for (std::size_t packetStartIndex = 0; packetStartIndex < rays.size(); packetStartIndex += RayPacket::MAX_RAYS) {
+        rayPacket.setup(rays.subspan(packetStartIndex, std::min(RayPacket::MAX_RAYS, rays.size() - packetStartIndex)));
+
+        browseMaskedNodes.clear();
+        browseMaskedNodes.emplace_back(rootNodeIndex, rayPacket.getAllRaysMask());
+        while (!browseMaskedNodes.empty()) { //tree traversal: pre-order (iterative)
+            auto [currentNodeIndex, raysMask] = browseMaskedNodes.back();
+            browseMaskedNodes.pop_back();
+            const Node& currentNode = nodes[currentNodeIndex];
+
+            uint64_t collideRaysMask = rayPacket.collideWithAABBox(currentNode.aabbox, raysMask);
+            if (collideRaysMask != 0) {
+                if (currentNode.isLeaf()) {
+                    for (; collideRaysMask != 0; collideRaysMask &= collideRaysMask - 1) {
+                        auto rayIndex = (std::size_t)std::countr_zero(collideRaysMask);
+                        objectsAABBoxHitRays[packetStartIndex + rayIndex].push_back(currentNode.nodeData->getNodeObject());
+                    }
+                } else {
+                    browseMaskedNodes.emplace_back(currentNode.children[1], collideRaysMask);
+                    browseMaskedNodes.emplace_back(currentNode.children[0], collideRaysMask);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Enlarge each node box of a specified size and process a classical ray test (see AABBTree::enlargedRayQuery).
+ * @param objectPtrToExclude Object to exclude from result
+ * @param objectsAABBoxHitEnlargedRay [out] Objects AABBox hit by the enlarged ray
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::enlargedRayQuery(const Ray<float>& ray, float enlargeNodeBoxHalfSize, const void* objectPtrToExclude,
+        std::vector<OBJ>& objectsAABBoxHitEnlargedRay) const {
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+
+        AABBox<float> extendedNodeAABBox = currentNode.aabbox.enlarge(enlargeNodeBoxHalfSize, enlargeNodeBoxHalfSize);
+        if (extendedNodeAABBox.collideWithRay(ray)) {
+            if (currentNode.isLeaf()) {
+                const OBJ& object = currentNode.nodeData->getNodeObject();
+                if (object.get() != objectPtrToExclude) {
+                    objectsAABBoxHitEnlargedRay.push_back(object);
+                }
+            } else {
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
+            }
+        }
+    }
+}
+
+/**
+ * @return Index of a new node. References on the nodes are invalidated by this method.
+ */
+template<class OBJ> uint32_t IndexedAABBTree<OBJ>::allocateNode() {
+    uint32_t nodeIndex;
+    if (freeNodeIndex != NULL_NODE) {
+        nodeIndex = freeNodeIndex;
+        freeNodeIndex = nodes[nodeIndex].parent;
+    } else {
+        assert(nodes.size() < NULL_NODE);
+        nodeIndex = (uint32_t)nodes.size();
+        nodes.emplace_back();
+    }
+
+    Node& node = nodes[nodeIndex];
+    node.children = {NULL_NODE, NULL_NODE};
+    node.parent = NULL_NODE;
+    node.height = 0;
+    return nodeIndex;
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::freeNode(uint32_t nodeIndex) {
+    nodes[nodeIndex].nodeData.reset();
+    nodes[nodeIndex].parent = freeNodeIndex;
+    freeNodeIndex = nodeIndex;
+}
+
+/**
+ * Update the AABBox and the height of the node. The children of a branch node must be up-to-date.
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::updateNodeAABBox(uint32_t nodeIndex) {
+    Node& node = nodes[nodeIndex];
+    if (node.isLeaf()) {
+        Point3 fatMargin3(fatMargin, fatMargin, fatMargin);
+        AABBox<float> objectBox = node.nodeData->retrieveObjectAABBox();
+
+        node.aabbox = AABBox(objectBox.getMin() - fatMargin3, objectBox.getMax() + fatMargin3);
+        node.height = 0;
+    } else {
+        const Node& leftChild = nodes[node.children[0]];
+        const Node& rightChild = nodes[node.children[1]];
+
+        node.aabbox = leftChild.aabbox.merge(rightChild.aabbox);
+        node.height = 1 + std::max(leftChild.height, rightChild.height);
+    }
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::insertLeafNode(uint32_t leafNodeIndex) {
+    if (rootNodeIndex == NULL_NODE) [[unlikely]] {
+        rootNodeIndex = leafNodeIndex;
+        nodes[leafNodeIndex].parent = NULL_NODE;
+        return;
+    }
+
+    const AABBox<float>& leafAABBox = nodes[leafNodeIndex].aabbox;
+    uint32_t currentNodeIndex = rootNodeIndex;
+    while (!nodes[currentNodeIndex].isLeaf()) {
+        const Node& currentNode = nodes[currentNodeIndex];
+
+        const AABBox<float>& leftAABBox = nodes[currentNode.children[0]].aabbox;
+        float volumeDiffLeft = leftAABBox.merge(leafAABBox).getVolume() - leftAABBox.getVolume();
+
+        const AABBox<float>& rightAABBox = nodes[currentNode.children[1]].aabbox;
+        float volumeDiffRight = rightAABBox.merge(leafAABBox).getVolume() - rightAABBox.getVolume();
+
+        currentNodeIndex = volumeDiffLeft < volumeDiffRight ? currentNode.children[0] : currentNode.children[1];
+    }
+
+    uint32_t newParentIndex = allocateNode();
+    replaceNode(currentNodeIndex, newParentIndex);
+    setChild(newParentIndex, 0, leafNodeIndex);
+    setChild(newParentIndex, 1, currentNodeIndex);
+
+    refitAndBalance(newParentIndex);
+}
+
+/**
+ * Detach the leaf node from the tree. The leaf node is not freed.
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::removeLeafNode(uint32_t leafNodeIndex) {
+    assert(nodes[leafNodeIndex].isLeaf());
+    if (leafNodeIndex == rootNodeIndex) {
+        rootNodeIndex = NULL_NODE;
+        return;
+    }
+
+    uint32_t parentIndex = nodes[leafNodeIndex].parent;
+    uint32_t grandParentIndex = nodes[parentIndex].parent;
+    uint32_t siblingIndex = nodes[parentIndex].children[0] == leafNodeIndex ? nodes[parentIndex].children[1] : nodes[parentIndex].children[0];
+
+    replaceNode(parentIndex, siblingIndex);
+    freeNode(parentIndex);
+    nodes[leafNodeIndex].parent = NULL_NODE;
+
+    refitAndBalance(grandParentIndex);
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::replaceNode(uint32_t nodeToReplaceIndex, uint32_t newNodeIndex) {
+    uint32_t parentIndex = nodes[nodeToReplaceIndex].parent;
+    if (parentIndex != NULL_NODE) {
+        setChild(parentIndex, nodes[parentIndex].children[0] == nodeToReplaceIndex ? 0 : 1, newNodeIndex);
+    } else {
+        rootNodeIndex = newNodeIndex;
+        nodes[newNodeIndex].parent = NULL_NODE;
+    }
+}
+
+template<class OBJ> void IndexedAABBTree<OBJ>::setChild(uint32_t parentIndex, std::size_t childPosition, uint32_t childIndex) {
+    nodes[parentIndex].children[childPosition] = childIndex;
+    nodes[childIndex].parent = parentIndex;
+}
+
+/**
+ * Refit the AABBox of the branch node and of all its ancestors. A rotation is applied on each unbalanced node (AVL-style).
+ */
+template<class OBJ> void IndexedAABBTree<OBJ>::refitAndBalance(uint32_t branchNodeIndex) {
+    while (branchNodeIndex != NULL_NODE) {
+        uint32_t balancedNodeIndex = balanceNode(branchNodeIndex);
+        updateNodeAABBox(balancedNodeIndex);
+        branchNodeIndex = nodes[balancedNodeIndex].parent;
+    }
+}
+
+/**
+ * @return Index of the node in the place of the provided node after balancing
+ */
+template<class OBJ> uint32_t IndexedAABBTree<OBJ>::balanceNode(uint32_t nodeIndex) {
+    const Node& node = nodes[nodeIndex];
+    int balance = (int)nodes[node.children[1]].height - (int)nodes[node.children[0]].height;
+    if (balance > 1) {
+        return rotateNode(nodeIndex, 1);
+    } else if (balance < -1) {
+        return rotateNode(nodeIndex, 0);
+    }
+    return nodeIndex;
+}
+
+/**
+ * Promote the highest child of the node in the place of the node (see AABBTree::rotateNode).
+ * @param promotedChildPosition Position of the child to promote: 0 for left child and 1 for right child
+ * @return Index of the promoted node
+ */
+template<class OBJ> uint32_t IndexedAABBTree<OBJ>::rotateNode(uint32_t nodeIndex, std::size_t promotedChildPosition) {
+    uint32_t promotedNodeIndex = nodes[nodeIndex].children[promotedChildPosition];
+    uint32_t highestGrandChildIndex = nodes[promotedNodeIndex].children[0];
+    uint32_t lowestGrandChildIndex = nodes[promotedNodeIndex].children[1];
+    if (nodes[highestGrandChildIndex].height < nodes[lowestGrandChildIndex].height) {
+        std::swap(highestGrandChildIndex, lowestGrandChildIndex);
+    }
+
+    replaceNode(nodeIndex, promotedNodeIndex);
+    setChild(promotedNodeIndex, 0, nodeIndex);
+    setChild(promotedNodeIndex, 1, highestGrandChildIndex);
+    setChild(nodeIndex, promotedChildPosition, lowestGrandChildIndex);
+
+    updateNodeAABBox(nodeIndex);
+    updateNodeAABBox(promotedNodeIndex);
+    return promotedNodeIndex;
+}
+
+template<class OBJ> uint32_t IndexedAABBTree<OBJ>::buildSubTree(std::span<uint32_t> leafNodeIndices) {
+    if (leafNodeIndices.size() == 1) {
+        return leafNodeIndices[0];
+    }
+
+    std::size_t splitIndex = AABBTreeSahPartitioner::partition(leafNodeIndices, [this](uint32_t leafNodeIndex) -> const AABBox<float>& {
+        return nodes[leafNodeIndex].aabbox;
+    });
+
+    uint32_t leftChildIndex = buildSubTree(leafNodeIndices.subspan(0, splitIndex));
+    uint32_t rightChildIndex = buildSubTree(leafNodeIndices.subspan(splitIndex));
+
+    uint32_t branchNodeIndex = allocateNode();
+    setChild(branchNodeIndex, 0, leftChildIndex);
+    setChild(branchNodeIndex, 1, rightChildIndex);
+    updateNodeAABBox(branchNodeIndex);
+    return branchNodeIndex;
+}
+
+/**
+ * Copy the tree into an immutable snapshot. The leaf nodes of the snapshot use the current AABBox of the objects instead of the fat AABBox and the
+ * branch nodes are refitted: the snapshot stays exact even when the objects moved since the last update of the tree. The nodes of the snapshot are
+ * reused to avoid memory allocations.
+ * @param objectConverter Function converting a tree object into a snapshot object
+ */
+template<class OBJ> template<class SNAPSHOT_OBJ, class OBJ_CONVERTER> void IndexedAABBTree<OBJ>::copyTo(AABBTreeSnapshot<SNAPSHOT_OBJ>& snapshot, OBJ_CONVERTER objectConverter) const {
+    snapshot.nodes.resize(nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        if (!nodes[i].nodeData) {
+            snapshot.nodes[i].object = SNAPSHOT_OBJ(); //branch or free node: do not keep a reference on a removed object
+        }
+    }
+    snapshot.rootNodeIndex = rootNodeIndex;
+
+    browseNodes.clear();
+    if (rootNodeIndex != NULL_NODE) [[likely]] {
+        browseNodes.push_back(rootNodeIndex);
+    }
+    for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
+        const Node& currentNode = nodes[browseNodes[i]];
+        if (!currentNode.isLeaf()) {
+            browseNodes.push_back(currentNode.children[0]);
+            browseNodes.push_back(currentNode.children[1]);
+        }
+    }
+
+    for (auto it = browseNodes.rbegin(); it != browseNodes.rend(); ++it) { //reverse pre-order: children are copied before their parent
+        const Node& currentNode = nodes[*it];
+        auto& snapshotNode = snapshot.nodes[*it];
+        snapshotNode.children = currentNode.children;
+        if (currentNode.isLeaf()) {
+            snapshotNode.aabbox = currentNode.nodeData->retrieveObjectAABBox();
+            snapshotNode.object = objectConverter(currentNode.nodeData->getNodeObject());
+        } else {
+            snapshotNode.aabbox = snapshot.nodes[currentNode.children[0]].aabbox.merge(snapshot.nodes[currentNode.children[1]].aabbox);
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "profiler/LatencyHistogram.h"
+#include "util/TypeConverter.h"
+
+namespace urchin {
+
+    //static
+    thread_local std::vector<float> LatencyHistogram::sortedLatenciesMs;
+
+    /**
+     * @param windowSize Number of last latencies counted in the histogram
+     */
+    LatencyHistogram::LatencyHistogram(std::size_t windowSize) :
+            latenciesMs(windowSize, 0.0f),
+            nextLatencyIndex(0),
+            latenciesCount(0),
+            counts({}) {
+        if (windowSize == 0) {
+            throw std::invalid_argument("Latency histogram window size must be greater than zero");
+        }
+    }
+
+    /**
+     * Register a latency and evict the oldest latency of the window when the window is full
+     */
+    void LatencyHistogram::registerLatency(float latencyInSec) {
+        if (latenciesCount == latenciesMs.size()) {
+            counts[findBucketIndex(latenciesMs[nextLatencyIndex])]--;
+        } else {
+            latenciesCount++;
+        }
+
+        float latencyInMs = latencyInSec * 1000.0f;
+        latenciesMs[nextLatencyIndex] = latencyInMs;
+        counts[findBucketIndex(latencyInMs)]++;
+        nextLatencyIndex = (nextLatencyIndex + 1) % latenciesMs.size();
+    }
+
+    std::size_t LatencyHistogram::getLatenciesCount() const {
+        return latenciesCount;
+    }
+
+    std::size_t LatencyHistogram::getBucketsCount() const {
+        return counts.size();
+    }
+
+    /**
+     * @return Maximum latency (ms) of the bucket. The last bucket has no maximum: the float maximum value is returned.
+     */
+    float LatencyHistogram::getBucketMaxMs(std::size_t bucketIndex) const {
+        assert(bucketIndex < counts.size());
+        return (bucketIndex == NUM_THRESHOLDS) ? std::numeric_limits<float>::max() : MS_THRESHOLDS[bucketIndex];
+    }
+
+    unsigned int LatencyHistogram::getBucketCount(std::size_t bucketIndex) const {
+        assert(bucketIndex < counts.size());
+        return counts[bucketIndex];
+    }
+
+    /**
+     * @param percentile Percentile between 0.0 and 1.0 (e.g. 0.95 for the 95th percentile)
+     * @return Latency (ms) of the percentile computed on the window or 0.0 when no latency is registered
+     */
+    float LatencyHistogram::computePercentileMs(float percentile) const {
+        if (latenciesCount == 0) {
+            return 0.0f;
+        }
+
+        sortedLatenciesMs.assign(latenciesMs.begin(), latenciesMs.begin() + (long)latenciesCount);
+        auto percentileIndex = (std::size_t)std::ceil(std::clamp(percentile, 0.0f, 1.0f) * (float)latenciesCount);
+        percentileIndex = std::clamp(percentileIndex, (std::size_t)1, latenciesCount) - 1;
+        std::ranges::nth_element(sortedLatenciesMs, sortedLatenciesMs.begin() + (long)percentileIndex);
+        return sortedLatenciesMs[percentileIndex];
+    }
+
+    /**
+     * @return Maximum latency (ms) of the window or 0.0 when no latency is registered
+     */
+    float LatencyHistogram::getMaxMs() const {
+        if (latenciesCount == 0) {
+            return 0.0f;
+        }
+        return *std::max_element(latenciesMs.begin(), latenciesMs.begin() + (long)latenciesCount);
+    }
+
+    std::string LatencyHistogram::toString() const {
+        std::string result;
+
+        float minMs = 0.0f;
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            float maxMs = getBucketMaxMs(i);
+            std::string maxMsString = (maxMs == std::numeric_limits<float>::max()) ? "∞" : TypeConverter::toString(maxMs, 2);
+            result += "[" + TypeConverter::toString(minMs, 2) + "-" + maxMsString + "ms]: " + std::to_string(counts[i]);
+            if (i != counts.size() - 1) {
+                result += ", ";
+            }
+            minMs = maxMs;
+        }
+        return result;
+    }
+
+    std::size_t LatencyHistogram::findBucketIndex(float latencyInMs) const {
+        auto itFind = std::ranges::lower_bound(MS_THRESHOLDS, latencyInMs);
+        return (std::size_t)std::distance(MS_THRESHOLDS.begin(), itFind);
+    }
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+
+namespace urchin {
+
+    /**
+    * Histogram of the latencies registered in a rolling window: only the last registered latencies are counted.
+    */
+    class LatencyHistogram {
+        public:
+            explicit LatencyHistogram(std::size_t);
+
+            void registerLatency(float);
+
+            std::size_t getLatenciesCount() const;
+            std::size_t getBucketsCount() const;
+            float getBucketMaxMs(std::size_t) const;
+            unsigned int getBucketCount(std::size_t) const;
+
+            float computePercentileMs(float) const;
+            float getMaxMs() const;
+
+            std::string toString() const;
+
+        private:
+            std::size_t findBucketIndex(float) const;
+
+            static constexpr std::size_t NUM_THRESHOLDS = 10;
+            static constexpr std::array<float, NUM_THRESHOLDS> MS_THRESHOLDS = {0.1f, 0.25f, 0.5f, 1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 33.0f, 100.0f};
+
+            std::vector<float> latenciesMs; //ring buffer of the rolling window
+            std::size_t nextLatencyIndex;
+            std::size_t latenciesCount;
+            std::array<unsigned int, NUM_THRESHOLDS + 1> counts;
+
+            static thread_local std::vector<float> sortedLatenciesMs;
+    };
+
+}
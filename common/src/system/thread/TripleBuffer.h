@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace urchin {
+
+    /**
+     * Triple buffer allowing a single writer thread to publish data to a single reader thread without lock and without waiting.
+     * The writer fills the write buffer and publishes it. The reader retrieves the last published buffer which is never modified while it is read.
+     */
+    template<class T> class TripleBuffer {
+        public:
+            TripleBuffer();
+
+            T& getWriteBuffer();
+            void publishWriteBuffer();
+
+            const T& getLatestReadBuffer();
+
+        private:
+            static constexpr unsigned int INDEX_MASK = 0x3u;
+            static constexpr unsigned int NEW_DATA_FLAG = 0x4u;
+
+            std::array<T, 3> buffers;
+            unsigned int writeIndex; //owned by writer thread
+            std::atomic<unsigned int> sharedIndex; //buffer exchanged between writer and reader with flag indicating not read data
+            unsigned int readIndex; //owned by reader thread
+    };
+
+    #include "TripleBuffer.inl"
+
+}
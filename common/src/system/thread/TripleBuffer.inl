@@ -0,0 +1,30 @@
+template<class T> TripleBuffer<T>::TripleBuffer() :
+        writeIndex(0),
+        sharedIndex(1),
+        readIndex(2) {
+
+}
+
+/**
+ * @return Buffer to fill by the writer thread. The buffer content is the one of an old published buffer: it must be entirely refreshed.
+ */
+template<class T> T& TripleBuffer<T>::getWriteBuffer() {
+    return buffers[writeIndex];
+}
+
+/**
+ * Publish the write buffer for the reader thread and give a new write buffer to the writer thread
+ */
+template<class T> void TripleBuffer<T>::publishWriteBuffer() {
+    writeIndex = sharedIndex.exchange(writeIndex | NEW_DATA_FLAG, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+/**
+ * @return Last buffer published by the writer thread. The buffer stays valid and unchanged until the next call of this method.
+ */
+template<class T> const T& TripleBuffer<T>::getLatestReadBuffer() {
+    if ((sharedIndex.load(std::memory_order_relaxed) & NEW_DATA_FLAG) != 0) {
+        readIndex = sharedIndex.exchange(readIndex, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+    return buffers[readIndex];
+}
@@ -0,0 +1,118 @@
+#include <algorithm>
+
+#include "system/thread/WorkerPool.h"
+
+namespace urchin {
+
+    /**
+     * @param workersCount Number of workers including the calling thread. A value of 0 uses the number of hardware threads.
+     */
+    WorkerPool::WorkerPool(unsigned int workersCount) :
+            workersCount(workersCount == 0 ? std::max(1u, std::thread::hardware_concurrency()) : workersCount),
+            job(nullptr),
+            jobItemsCount(0),
+            jobWorkersCount(0),
+            jobGeneration(0),
+            jobRemainingWorkers(0),
+            workersException(this->workersCount),
+            stopWorkers(false) {
+        threads.reserve(this->workersCount - 1);
+        for (unsigned int workerIndex = 1; workerIndex < this->workersCount; ++workerIndex) {
+            threads.emplace_back(&WorkerPool::workerLoop, this, workerIndex);
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::scoped_lock lock(jobMutex);
+            stopWorkers = true;
+        }
+        jobCondition.notify_all();
+        threads.clear(); //join threads
+    }
+
+    unsigned int WorkerPool::getWorkersCount() const {
+        return workersCount;
+    }
+
+    /**
+     * Split the items in contiguous ranges and process each range in a different worker. This method returns once all ranges are processed.
+     * Method must not be called concurrently by several threads. Exceptions thrown by the job are rethrown in the calling thread.
+     * @param itemsCount Number of items to process
+     * @param minItemsByWorker Minimum number of items by worker to avoid waking up workers for small jobs
+     * @param job Job processing a range of items: job(workerIndex, beginItemIndex, endItemIndex)
+     */
+    void WorkerPool::parallelFor(std::size_t itemsCount, std::size_t minItemsByWorker, const Job& job) {
+        std::size_t usefulWorkersCount = itemsCount / std::max((std::size_t)1, minItemsByWorker);
+        auto usedWorkersCount = (unsigned int)std::clamp(usefulWorkersCount, (std::size_t)1, (std::size_t)workersCount);
+        if (usedWorkersCount == 1) {
+            if (itemsCount != 0) {
+                job(0, 0, itemsCount);
+            }
+            return;
+        }
+
+        {
+            std::scoped_lock lock(jobMutex);
+            this->job = &job;
+            jobItemsCount = itemsCount;
+            jobWorkersCount = usedWorkersCount;
+            jobRemainingWorkers = usedWorkersCount - 1;
+            jobGeneration++;
+        }
+        jobCondition.notify_all();
+
+        try {
+            executeRange(0);
+        } catch (...) {
+            workersException[0] = std::current_exception();
+        }
+
+        std::unique_lock lock(jobMutex);
+        jobCompletedCondition.wait(lock, [this] { return jobRemainingWorkers == 0; });
+        this->job = nullptr;
+        for (std::exception_ptr& workerException : workersException) {
+            if (workerException) {
+                std::exception_ptr exceptionToRethrow = workerException;
+                std::ranges::fill(workersException, nullptr);
+                std::rethrow_exception(exceptionToRethrow);
+            }
+        }
+    }
+
+    void WorkerPool::workerLoop(unsigned int workerIndex) {
+        unsigned int lastJobGeneration = 0;
+        std::unique_lock lock(jobMutex);
+        while (true) {
+            jobCondition.wait(lock, [&] { return stopWorkers || jobGeneration != lastJobGeneration; });
+            if (stopWorkers) {
+                return;
+            }
+            lastJobGeneration = jobGeneration;
+            if (workerIndex >= jobWorkersCount) {
+                continue;
+            }
+
+            lock.unlock();
+            try {
+                executeRange(workerIndex);
+            } catch (...) {
+                workersException[workerIndex] = std::current_exception();
+            }
+            lock.lock();
+
+            if (--jobRemainingWorkers == 0) {
+                jobCompletedCondition.notify_one();
+            }
+        }
+    }
+
+    void WorkerPool::executeRange(unsigned int workerIndex) const {
+        std::size_t beginItemIndex = workerIndex * jobItemsCount / jobWorkersCount;
+        std::size_t endItemIndex = (workerIndex + 1) * jobItemsCount / jobWorkersCount;
+        if (beginItemIndex != endItemIndex) {
+            (*job)(workerIndex, beginItemIndex, endItemIndex);
+        }
+    }
+
+}
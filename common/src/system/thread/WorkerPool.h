@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace urchin {
+
+    /**
+     * Fixed pool of worker threads processing a job split in contiguous ranges of items.
+     * The range 'i' is always processed by the worker 'i' and the calling thread is the worker 0.
+     */
+    class WorkerPool {
+        public:
+            using Job = std::function<void(unsigned int, std::size_t, std::size_t)>;
+
+            explicit WorkerPool(unsigned int);
+            ~WorkerPool();
+
+            unsigned int getWorkersCount() const;
+
+            void parallelFor(std::size_t, std::size_t, const Job&);
+
+        private:
+            void workerLoop(unsigned int);
+            void executeRange(unsigned int) const;
+
+            unsigned int workersCount;
+            std::vector<std::jthread> threads;
+
+            std::mutex jobMutex;
+            std::condition_variable jobCondition;
+            std::condition_variable jobCompletedCondition;
+            const Job* job;
+            std::size_t jobItemsCount;
+            unsigned int jobWorkersCount;
+            unsigned int jobGeneration;
+            unsigned int jobRemainingWorkers;
+            std::vector<std::exception_ptr> workersException;
+            bool stopWorkers;
+    };
+
+}
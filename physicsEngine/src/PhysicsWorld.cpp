@@ -1,6 +1,8 @@
 #include <exception>
 #include <chrono>
 #include <algorithm>
+#include <cmath>
+#include <utility>
 #include <PhysicsWorld.h>
 
 #include "raytest/RayTester.h"
@@ -15,7 +17,10 @@ namespace urchin {
             physicsSimulationStopper(false),
             gravity(Vector3(0.0f, -9.81f, 0.0f)),
             expectedTimeStepInSec(0.0f),
+            maxSubStepsCount(ConfigService::instance().getUnsignedIntValue("physicsWorld.maxSubStepsCount")),
+            lastStepEndTime(0),
             paused(true),
+            journalStartRequested(false),
             bodyContainer(BodyContainer()),
             collisionWorld(CollisionWorld(getBodyContainer())) {
         SignalHandler::instance().initialize();
@@ -48,12 +53,57 @@ namespace urchin {
         bodyContainer.removeBody(body);
     }
 
+    /**
+     * Add a joint between two bodies of the world. The joint is removed when one of its bodies is removed from the world.
+     */
+    void PhysicsWorld::addJoint(std::shared_ptr<Joint> joint) {
+        if (joint) {
+            collisionWorld.getJointContainer().addJoint(std::move(joint));
+        }
+    }
+
+    void PhysicsWorld::removeJoint(const Joint& joint) {
+        collisionWorld.getJointContainer().removeJoint(joint);
+    }
+
     void PhysicsWorld::triggerRayTest(std::shared_ptr<RayTester> rayTester, const Ray<float>& ray) {
         std::scoped_lock lock(mutex);
         rayTester->updateRay(ray);
         rayTesters.push_back(std::move(rayTester));
     }
 
+    /**
+     * Immediate ray cast executed on the caller thread against the last physics step. Method can be called from any thread.
+     * @return Nearest body hit by the ray
+     */
+    std::optional<ContinuousCollisionResult<float>> PhysicsWorld::rayCast(const Ray<float>& ray) const {
+        return collisionWorld.getSceneQuery().rayCast(ray);
+    }
+
+    /**
+     * Immediate sweep test of a convex shape executed on the caller thread against the last physics step. Method can be called from any thread.
+     * @return Nearest body hit by the shape moving from a transform to another one
+     */
+    std::optional<ContinuousCollisionResult<float>> PhysicsWorld::sweepTest(const CollisionShape3D& shape, const PhysicsTransform& from, const PhysicsTransform& to) const {
+        return collisionWorld.getSceneQuery().sweepTest(shape, from, to);
+    }
+
+    /**
+     * Immediate overlap test executed on the caller thread against the last physics step. Method can be called from any thread.
+     * @param bodiesAABBoxHit [out] Bodies having their AABBox overlapping the provided AABBox
+     */
+    void PhysicsWorld::aabboxOverlapTest(const AABBox<float>& aabbox, std::vector<std::shared_ptr<AbstractBody>>& bodiesAABBoxHit) const {
+        collisionWorld.getSceneQuery().aabboxOverlapTest(aabbox, bodiesAABBoxHit);
+    }
+
+    /**
+     * Immediate overlap test of a convex shape executed on the caller thread against the last physics step. Method can be called from any thread.
+     * @param bodiesOverlapping [out] Bodies overlapping the provided shape
+     */
+    void PhysicsWorld::shapeOverlapTest(const CollisionShape3D& shape, const PhysicsTransform& transform, std::vector<std::shared_ptr<AbstractBody>>& bodiesOverlapping) const {
+        collisionWorld.getSceneQuery().shapeOverlapTest(shape, transform, bodiesOverlapping);
+    }
+
     /**
      * @param gravity Gravity expressed in units/s^2
      */
@@ -70,6 +120,25 @@ namespace urchin {
         return gravity;
     }
 
+    /**
+     * Start to record the physics inputs in a journal from the next physics step. See CollisionWorld::startJournal.
+     */
+    void PhysicsWorld::startJournal() {
+        std::scoped_lock lock(mutex);
+        journalStartRequested = true;
+        journalStopFilename = std::nullopt;
+    }
+
+    /**
+     * Stop the journal recording at the next physics step and save it in a file. The file can be replayed with PhysicsReplayer.
+     * @param journalFilename Journal file to create
+     */
+    void PhysicsWorld::stopJournal(std::string journalFilename) {
+        std::scoped_lock lock(mutex);
+        journalStartRequested = false;
+        journalStopFilename = std::move(journalFilename);
+    }
+
     /**
      * Set up the physics simulation in new thread
      * @param expectedTimeStepInSec Frequency updates expressed in second
@@ -123,6 +192,20 @@ namespace urchin {
         return stepExecutionTimeInSec.load(std::memory_order_relaxed);
     }
 
+    /**
+     * Interpolation factor to apply between the previous and the current transforms of the bodies (see BodySnapshot::interpolateTransform).
+     * Rendering the interpolated transforms avoids judder when the rendering frequency differs from the physics frequency. Method can be called from any thread.
+     * @return Factor between 0.0 and 1.0 computed from the time elapsed since the end of the last physics step
+     */
+    float PhysicsWorld::computeInterpolationFactor() const {
+        if (expectedTimeStepInSec <= 0.0f) {
+            return 1.0f;
+        }
+        std::chrono::steady_clock::duration elapsedTime(std::chrono::steady_clock::now().time_since_epoch().count() - lastStepEndTime.load(std::memory_order_relaxed));
+        float elapsedTimeInSec = std::chrono::duration<float>(elapsedTime).count();
+        return std::clamp(elapsedTimeInSec / expectedTimeStepInSec, 0.0f, 1.0f);
+    }
+
     const PerfMetrics& PhysicsWorld::getPerfMetrics() const {
         if (physicsSimulationThread) {
             throw std::runtime_error("Physics thread must be stopped to access to the performance metrics (thread safety)");
@@ -130,48 +213,51 @@ namespace urchin {
         return perfMetrics;
     }
 
+    /**
+     * @return Counters and phases latencies of the last physics steps. Contrary to the performance metrics, the physics metrics can be read while the physics
+     * thread is running.
+     */
+    const PhysicsMetrics& PhysicsWorld::getPhysicsMetrics() const {
+        return collisionWorld.getMetrics();
+    }
+
+    /**
+     * Execute the physics steps with a fixed time step. The real elapsed time is accumulated and consumed by steps of expected time step: when the physics is late, several
+     * sub-steps are executed to catch up the real time.
+     */
     void PhysicsWorld::startPhysicsUpdate() {
         try {
             Logger::instance().logInfo("Physics thread started with time step of " + std::to_string(expectedTimeStepInSec) + " sec");
 
-            float remainingTime = 0.0f;
-            float maxAdditionalTimeStep = expectedTimeStepInSec * 0.5f;
-            auto executionStartTime = std::chrono::high_resolution_clock::now();
+            float accumulatedTimeInSec = expectedTimeStepInSec;
+            auto previousTime = std::chrono::steady_clock::now();
 
             while (continueExecution()) {
-                float additionalTimeStep = std::abs(remainingTime);
-                if (additionalTimeStep > maxAdditionalTimeStep) {
-                    //Cannot process physics update with 'additionalTimeStep'. Value is too big and can lead to physics errors.
-                    //Use 'maxAdditionalTimeStep' which lead to slow-down of the physics.
-                    additionalTimeStep = maxAdditionalTimeStep;
+                unsigned int subStepsCount = 0;
+                while (accumulatedTimeInSec >= expectedTimeStepInSec && subStepsCount < maxSubStepsCount && continueExecution()) {
+                    auto stepStartTime = std::chrono::steady_clock::now();
+                    processPhysicsUpdate(expectedTimeStepInSec);
+                    auto stepEndTime = std::chrono::steady_clock::now();
+                    lastStepEndTime.store(stepEndTime.time_since_epoch().count(), std::memory_order_relaxed);
+
+                    float stepExecTimeInSec = std::chrono::duration<float>(stepEndTime - stepStartTime).count();
+                    stepExecutionTimeInSec.store(stepExecTimeInSec, std::memory_order_relaxed);
+                    perfMetrics.registerDt(stepExecTimeInSec);
+
+                    accumulatedTimeInSec -= expectedTimeStepInSec;
+                    subStepsCount++;
                 }
-
-                float dt = expectedTimeStepInSec + additionalTimeStep;
-
-                processPhysicsUpdate(dt);
-
-                auto executionEndTime = std::chrono::high_resolution_clock::now();
-                auto deltaTimeInUs = std::chrono::duration_cast<std::chrono::microseconds>(executionEndTime - executionStartTime).count();
-                auto realDeltaTimeInUs = deltaTimeInUs;
-                if (deltaTimeInUs < 250) { //small delta time on Windows is imprecise: wait two milliseconds more to get a more precise value
-                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
-                    executionEndTime = std::chrono::high_resolution_clock::now();
-                    deltaTimeInUs = std::chrono::duration_cast<std::chrono::microseconds>(executionEndTime - executionStartTime).count();
+                if (accumulatedTimeInSec >= expectedTimeStepInSec) {
+                    //Cannot catch up the real time with the maximum number of sub-steps: the remaining time is dropped which lead to slow-down of the physics.
+                    accumulatedTimeInSec = std::fmod(accumulatedTimeInSec, expectedTimeStepInSec);
                 }
 
-                float realExecTimeInSec = (float)((double)realDeltaTimeInUs / 1000000.0);
-                stepExecutionTimeInSec.store(realExecTimeInSec, std::memory_order_relaxed);
-                perfMetrics.registerDt(realExecTimeInSec);
-
-                float execTimeInSec = (float)((double)deltaTimeInUs / 1000000.0);
-                remainingTime = dt - execTimeInSec;
-                if (remainingTime >= 0.0f) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds((int)(remainingTime * 1000.0f)));
-                    remainingTime = 0.0f;
-                    executionStartTime = std::chrono::high_resolution_clock::now();
-                } else {
-                    executionStartTime = executionEndTime;
-                }
+                float waitingTimeInSec = expectedTimeStepInSec - accumulatedTimeInSec;
+                std::this_thread::sleep_for(std::chrono::microseconds((long)(waitingTimeInSec * 1000000.0f)));
+
+                auto currentTime = std::chrono::steady_clock::now();
+                accumulatedTimeInSec += std::chrono::duration<float>(currentTime - previousTime).count();
+                previousTime = currentTime;
             }
 
             Profiler::physics().log(); //log for physics thread
@@ -194,11 +280,15 @@ namespace urchin {
         //copy for local thread
         bool paused;
         Vector3<float> gravity;
+        bool startJournal;
+        std::optional<std::string> stopJournalFilename;
         threadLocalRayTesters.clear();
 
         {
             std::scoped_lock lock(mutex);
             paused = this->paused;
+            startJournal = std::exchange(journalStartRequested, false);
+            stopJournalFilename = std::exchange(journalStopFilename, std::nullopt);
             if (!paused) {
                 gravity = this->gravity;
                 for (const std::shared_ptr<RayTester>& rayTester : rayTesters) {
@@ -208,6 +298,8 @@ namespace urchin {
             }
         }
 
+        executeJournalRequest(startJournal, stopJournalFilename);
+
         //physics execution
         if (!paused) {
             collisionWorld.process(dt, gravity);
@@ -219,8 +311,28 @@ namespace urchin {
     void PhysicsWorld::executeRayTesters(const std::vector<std::shared_ptr<RayTester>>& rayTesters) {
         ScopeProfiler sp(Profiler::physics(), "exeRayTest");
 
+        rays.clear();
         for (const std::shared_ptr<RayTester>& rayTester : rayTesters) {
-            rayTester->execute(getCollisionWorld());
+            rays.push_back(rayTester->getRay());
+        }
+        getCollisionWorld().getBroadPhase().rayTests(rays, bodiesAABBoxHitRays);
+        getCollisionWorld().getMetrics().addLastStepRayTests((unsigned int)rayTesters.size());
+
+        for (std::size_t i = 0; i < rayTesters.size(); ++i) {
+            rayTesters[i]->execute(getCollisionWorld(), bodiesAABBoxHitRays[i]);
+            bodiesAABBoxHitRays[i].clear();
+        }
+    }
+
+    void PhysicsWorld::executeJournalRequest(bool startJournal, const std::optional<std::string>& stopJournalFilename) {
+        if (startJournal) {
+            collisionWorld.startJournal();
+        } else if (stopJournalFilename.has_value()) {
+            std::unique_ptr<PhysicsJournal> journal = collisionWorld.stopJournal();
+            if (journal) {
+                journal->saveToFile(*stopJournalFilename);
+                Logger::instance().logInfo("Physics journal of " + std::to_string(journal->getStepsCount()) + " steps saved in " + *stopJournalFilename);
+            }
         }
     }
 
@@ -5,10 +5,14 @@
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <chrono>
+#include <optional>
+#include <string>
 #include <UrchinCommon.h>
 
 #include "body/model/AbstractBody.h"
 #include "body/BodyContainer.h"
+#include "joint/model/Joint.h"
 #include "collision/CollisionWorld.h"
 #include "raytest/RayTester.h"
 #include "visualizer/CollisionVisualizer.h"
@@ -25,12 +29,21 @@ namespace urchin {
 
             void addBody(std::shared_ptr<AbstractBody>);
             void removeBody(const AbstractBody&);
+            void addJoint(std::shared_ptr<Joint>);
+            void removeJoint(const Joint&);
 
             void triggerRayTest(std::shared_ptr<RayTester>, const Ray<float>&);
+            std::optional<ContinuousCollisionResult<float>> rayCast(const Ray<float>&) const;
+            std::optional<ContinuousCollisionResult<float>> sweepTest(const CollisionShape3D&, const PhysicsTransform&, const PhysicsTransform&) const;
+            void aabboxOverlapTest(const AABBox<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const;
+            void shapeOverlapTest(const CollisionShape3D&, const PhysicsTransform&, std::vector<std::shared_ptr<AbstractBody>>&) const;
 
             void setGravity(const Vector3<float>&);
             Vector3<float> getGravity() const;
 
+            void startJournal();
+            void stopJournal(std::string);
+
             void setUp(float);
             void pause();
             void unpause();
@@ -38,7 +51,9 @@ namespace urchin {
             void interruptThread(bool);
             void checkNoExceptionRaised();
             float getStepExecutionTimeInSec() const;
+            float computeInterpolationFactor() const;
             const PerfMetrics& getPerfMetrics() const;
+            const PhysicsMetrics& getPhysicsMetrics() const;
 
             void createCollisionVisualizer();
             const CollisionVisualizer& getCollisionVisualizer() const;
@@ -49,6 +64,7 @@ namespace urchin {
             void processPhysicsUpdate(float);
 
             void executeRayTesters(const std::vector<std::shared_ptr<RayTester>>&);
+            void executeJournalRequest(bool, const std::optional<std::string>&);
 
             std::unique_ptr<std::jthread> physicsSimulationThread;
             std::atomic_bool physicsSimulationStopper;
@@ -57,8 +73,12 @@ namespace urchin {
             mutable std::mutex mutex;
             Vector3<float> gravity;
             float expectedTimeStepInSec;
+            const unsigned int maxSubStepsCount;
             std::atomic<float> stepExecutionTimeInSec;
+            std::atomic<std::chrono::steady_clock::rep> lastStepEndTime;
             bool paused;
+            bool journalStartRequested;
+            std::optional<std::string> journalStopFilename;
             PerfMetrics perfMetrics;
 
             BodyContainer bodyContainer;
@@ -66,6 +86,8 @@ namespace urchin {
 
             std::vector<std::shared_ptr<RayTester>> rayTesters;
             std::vector<std::shared_ptr<RayTester>> threadLocalRayTesters;
+            std::vector<Ray<float>> rays;
+            std::vector<std::vector<std::shared_ptr<AbstractBody>>> bodiesAABBoxHitRays;
 
             std::unique_ptr<CollisionVisualizer> collisionVisualizer;
     };
@@ -5,6 +5,15 @@
 #include "body/model/RigidBody.h"
 #include "body/model/GhostBody.h"
 #include "body/InertiaCalculation.h"
+#include "body/BodySnapshot.h"
+#include "body/BodiesSnapshot.h"
+
+#include "joint/model/Joint.h"
+#include "joint/model/BallSocketJoint.h"
+#include "joint/model/HingeJoint.h"
+#include "joint/model/SliderJoint.h"
+#include "joint/model/FixedJoint.h"
+#include "joint/model/DistanceJoint.h"
 
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionSphereShape.h"
@@ -15,6 +24,7 @@
 #include "shape/CollisionConvexHullShape.h"
 #include "shape/CollisionCompoundShape.h"
 #include "shape/CollisionHeightfieldShape.h"
+#include "shape/CollisionTriangleMeshShape.h"
 
 #include "object/CollisionConvexObject3D.h"
 #include "object/CollisionSphereObject.h"
@@ -39,8 +49,17 @@
 #include "raytest/RayTester.h"
 #include "raytest/RayTestResult.h"
 
+#include "scenequery/SceneQuery.h"
+
+#include "journal/PhysicsJournal.h"
+#include "journal/PhysicsReplayer.h"
+
+#include "metrics/StepCounters.h"
+#include "metrics/PhysicsMetrics.h"
+
 #include "character/CharacterController.h"
 #include "character/CharacterControllerConfig.h"
+#include "character/CharacterControllerSystem.h"
 #include "character/PhysicsCharacter.h"
 
 #include "utils/math/PhysicsTransform.h"
@@ -0,0 +1,24 @@
+#include "body/BodiesSnapshot.h"
+
+namespace urchin {
+
+    std::vector<BodySnapshot>& BodiesSnapshot::getBodies() {
+        return bodies;
+    }
+
+    const std::vector<BodySnapshot>& BodiesSnapshot::getBodies() const {
+        return bodies;
+    }
+
+    /**
+     * @return Snapshot of the body or null if the body was not in the physics world at the snapshot time
+     */
+    const BodySnapshot* BodiesSnapshot::findBody(const AbstractBody& body) const {
+        std::size_t snapshotIndex = body.getSnapshotIndex();
+        if (snapshotIndex < bodies.size() && bodies[snapshotIndex].objectId == body.getObjectId()) {
+            return &bodies[snapshotIndex];
+        }
+        return nullptr;
+    }
+
+}
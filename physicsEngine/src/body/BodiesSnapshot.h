@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "body/BodySnapshot.h"
+#include "body/model/AbstractBody.h"
+
+namespace urchin {
+
+    /**
+    * Snapshot of the bodies state at the end of a physics step. Bodies states are stored contiguously at the snapshot index of the bodies.
+    */
+    class BodiesSnapshot {
+        public:
+            std::vector<BodySnapshot>& getBodies();
+            const std::vector<BodySnapshot>& getBodies() const;
+
+            const BodySnapshot* findBody(const AbstractBody&) const;
+
+        private:
+            std::vector<BodySnapshot> bodies;
+    };
+
+}
@@ -2,14 +2,24 @@
 #include <utility>
 
 #include "body/BodyContainer.h"
+#include "body/model/RigidBody.h"
 
 namespace urchin {
 
     BodyContainer::BodyContainer() :
-            lastUpdatedBody(nullptr) {
+            deterministic(false),
+            lastUpdatedBody(nullptr),
+            lastStateUpdatedBody(nullptr),
+            snapshotBuffers({}) {
 
     }
 
+    BodyContainer::~BodyContainer() {
+        for (const auto& body : bodies) {
+            body->setBodyContainer(nullptr);
+        }
+    }
+
     void BodyContainer::addBody(std::shared_ptr<AbstractBody> body) {
         std::scoped_lock lock(bodiesMutex);
         bodiesToRefresh.emplace_back(BodyRefresh{nullptr, std::move(body)});
@@ -24,10 +34,45 @@ namespace urchin {
         return lastUpdatedBody;
     }
 
+    /**
+     * Notify that the state of a body has been updated (activated, deactivated or manually moved). Method can be called from thread different of the physics thread.
+     * The notification is dispatched to the observers by the physics thread on next bodies refresh.
+     */
+    void BodyContainer::notifyBodyStateUpdated(AbstractBody& body) {
+        std::scoped_lock lock(bodiesStateMutex);
+        stateUpdatedBodies.push_back(&body);
+    }
+
+    AbstractBody& BodyContainer::getLastStateUpdatedBody() const {
+        assert(lastStateUpdatedBody);
+        return *lastStateUpdatedBody;
+    }
+
     const std::vector<std::shared_ptr<AbstractBody>>& BodyContainer::getBodies() const {
         return bodies;
     }
 
+    /**
+     * Return the bodies active at the last bodies refresh. A body deactivated during the physics step stays in this list until the next bodies refresh: the active
+     * state of the bodies must still be checked.
+     * @return Active bodies (order depends on the activation order)
+     */
+    const std::vector<AbstractBody*>& BodyContainer::getActiveBodies() const {
+        return activeBodies;
+    }
+
+    /**
+     * @param deterministic Process the bodies state updates in the bodies snapshot index order instead of the notification order. The notification
+     * order depends on the threads scheduling while the snapshot indexes only depend on the order of the bodies addition/removal.
+     */
+    void BodyContainer::setDeterministic(bool deterministic) {
+        this->deterministic = deterministic;
+    }
+
+    bool BodyContainer::isDeterministic() const {
+        return deterministic;
+    }
+
     /**
      * Refresh bodies list
      */
@@ -39,6 +84,12 @@ namespace urchin {
             if (bodyToRefresh.bodyToAdd) {
                 bodies.emplace_back(bodyToRefresh.bodyToAdd);
                 bodyToRefresh.bodyToAdd->setPhysicsThreadId(std::this_thread::get_id());
+                bodyToRefresh.bodyToAdd->setBodyContainer(this);
+                std::size_t snapshotIndex = allocateSnapshotIndex();
+                bodyToRefresh.bodyToAdd->setSnapshotIndex(snapshotIndex);
+                bodySnapshots[snapshotIndex] = buildBodySnapshot(*bodyToRefresh.bodyToAdd);
+                markBodySnapshotOutdated(snapshotIndex);
+                refreshActiveBody(*bodyToRefresh.bodyToAdd);
 
                 lastUpdatedBody = bodyToRefresh.bodyToAdd;
                 notifyObservers(this, ADD_BODY);
@@ -51,6 +102,17 @@ namespace urchin {
                     std::shared_ptr<AbstractBody> bodyToRemovePtr = *itFind; //keep a smart pointer on body for notify event
                     bodies.erase(itFind);
 
+                    bodyToRemovePtr->setBodyContainer(nullptr);
+                    removeActiveBody(*bodyToRemovePtr);
+                    freeSnapshotIndexes.push_back(bodyToRemovePtr->getSnapshotIndex());
+                    bodySnapshots[bodyToRemovePtr->getSnapshotIndex()].objectId = BodySnapshot::NO_OBJECT_ID;
+                    markBodySnapshotOutdated(bodyToRemovePtr->getSnapshotIndex());
+                    std::erase(stateUpdatedBodiesToPublish, bodyToRemovePtr.get());
+                    {
+                        std::scoped_lock stateLock(bodiesStateMutex);
+                        std::erase(stateUpdatedBodies, bodyToRemovePtr.get());
+                    }
+
                     lastUpdatedBody = bodyToRemovePtr;
                     notifyObservers(this, REMOVE_BODY);
                     lastUpdatedBody = nullptr;
@@ -58,5 +120,168 @@ namespace urchin {
             }
         }
         bodiesToRefresh.clear();
+
+        {
+            std::scoped_lock stateLock(bodiesStateMutex);
+            stateUpdatedBodiesToProcess.swap(stateUpdatedBodies);
+        }
+        if (deterministic) {
+            std::ranges::sort(stateUpdatedBodiesToProcess, [](const AbstractBody* lhs, const AbstractBody* rhs){ return lhs->getSnapshotIndex() < rhs->getSnapshotIndex(); });
+        }
+        for (AbstractBody* stateUpdatedBody : stateUpdatedBodiesToProcess) {
+            refreshActiveBody(*stateUpdatedBody);
+            stateUpdatedBodiesToPublish.push_back(stateUpdatedBody);
+
+            lastStateUpdatedBody = stateUpdatedBody;
+            notifyObservers(this, BODY_STATE_UPDATED);
+            lastStateUpdatedBody = nullptr;
+        }
+        stateUpdatedBodiesToProcess.clear();
     }
+
+    std::size_t BodyContainer::allocateSnapshotIndex() {
+        if (!freeSnapshotIndexes.empty()) {
+            std::size_t snapshotIndex = freeSnapshotIndexes.back();
+            freeSnapshotIndexes.pop_back();
+            return snapshotIndex;
+        }
+        bodySnapshots.emplace_back();
+        bodySnapshotRefreshed.push_back(false);
+        activeBodyIndexes.push_back(NOT_ACTIVE_INDEX);
+        return bodySnapshots.size() - 1;
+    }
+
+    /**
+     * Add or remove the body from the active bodies according to its active state
+     */
+    void BodyContainer::refreshActiveBody(AbstractBody& body) {
+        std::size_t& activeBodyIndex = activeBodyIndexes[body.getSnapshotIndex()];
+        if (body.isActive() && activeBodyIndex == NOT_ACTIVE_INDEX) {
+            activeBodyIndex = activeBodies.size();
+            activeBodies.push_back(&body);
+        } else if (!body.isActive() && activeBodyIndex != NOT_ACTIVE_INDEX) {
+            removeActiveBody(body);
+        }
+    }
+
+    void BodyContainer::removeActiveBody(const AbstractBody& body) {
+        std::size_t& activeBodyIndex = activeBodyIndexes[body.getSnapshotIndex()];
+        if (activeBodyIndex != NOT_ACTIVE_INDEX) {
+            AbstractBody* lastActiveBody = activeBodies.back();
+            activeBodies[activeBodyIndex] = lastActiveBody;
+            activeBodyIndexes[lastActiveBody->getSnapshotIndex()] = activeBodyIndex;
+            activeBodies.pop_back();
+            activeBodyIndex = NOT_ACTIVE_INDEX;
+        }
+    }
+
+    /**
+     * Publish a snapshot of the bodies state. Method must be called by the physics thread at the end of each physics step.
+     * Only the active bodies and the bodies having their state updated (added, removed, manually moved, activated or deactivated) are refreshed:
+     * the sleeping and static bodies keep their last published state.
+     */
+    void BodyContainer::publishSnapshot() {
+        ScopeProfiler sp(Profiler::physics(), "publishSnapshot");
+
+        for (AbstractBody* activeBody : activeBodies) {
+            refreshBodySnapshot(*activeBody);
+        }
+        for (AbstractBody* stateUpdatedBody : stateUpdatedBodiesToPublish) {
+            refreshBodySnapshot(*stateUpdatedBody);
+        }
+        stateUpdatedBodiesToPublish.clear();
+        {
+            std::scoped_lock stateLock(bodiesStateMutex);
+            for (AbstractBody* stateUpdatedBody : stateUpdatedBodies) { //state updated during the physics step (e.g. woken up body)
+                refreshBodySnapshot(*stateUpdatedBody);
+            }
+        }
+        for (std::size_t refreshedSnapshotIndex : refreshedSnapshotIndexes) {
+            bodySnapshotRefreshed[refreshedSnapshotIndex] = false;
+        }
+        refreshedSnapshotIndexes.clear();
+
+        writeBodySnapshots(snapshots.getWriteBuffer());
+        snapshots.publishWriteBuffer();
+    }
+
+    BodySnapshot BodyContainer::buildBodySnapshot(const AbstractBody& body) {
+        BodySnapshot bodySnapshot{.objectId = body.getObjectId(), .isActive = body.isActive(), .previousTransform = body.getTransform(), .transform = body.getTransform(),
+                .linearVelocity = Vector3<float>(), .angularVelocity = Vector3<float>()};
+        if (const RigidBody* rigidBody = RigidBody::upCast(&body)) {
+            bodySnapshot.linearVelocity = rigidBody->getLinearVelocity();
+            bodySnapshot.angularVelocity = rigidBody->getAngularVelocity();
+        }
+        return bodySnapshot;
+    }
+
+    /**
+     * Refresh the state of the body once per published snapshot: the previous transform is the transform of the last published snapshot
+     */
+    void BodyContainer::refreshBodySnapshot(AbstractBody& body) {
+        std::size_t snapshotIndex = body.getSnapshotIndex();
+        if (bodySnapshotRefreshed[snapshotIndex]) {
+            return;
+        }
+        bodySnapshotRefreshed[snapshotIndex] = true;
+        refreshedSnapshotIndexes.push_back(snapshotIndex);
+
+        BodySnapshot& bodySnapshot = bodySnapshots[snapshotIndex];
+        PhysicsTransform publishedTransform = bodySnapshot.transform;
+        bodySnapshot = buildBodySnapshot(body);
+        bool teleported = body.getTeleportedAndReset();
+        if (bodySnapshot.isActive && !teleported) { //inactive or manually moved body: no interpolation
+            bodySnapshot.previousTransform = publishedTransform;
+        }
+        markBodySnapshotOutdated(snapshotIndex);
+    }
+
+    void BodyContainer::markBodySnapshotOutdated(std::size_t snapshotIndex) {
+        for (SnapshotBuffer& snapshotBuffer : snapshotBuffers) {
+            if (snapshotIndex >= snapshotBuffer.outdatedFlags.size()) {
+                snapshotBuffer.outdatedFlags.resize(bodySnapshots.size(), false);
+            }
+            if (!snapshotBuffer.outdatedFlags[snapshotIndex]) {
+                snapshotBuffer.outdatedFlags[snapshotIndex] = true;
+                snapshotBuffer.outdatedIndexes.push_back(snapshotIndex);
+            }
+        }
+    }
+
+    /**
+     * Write the bodies refreshed since the last write in this buffer. The buffer content is the one of an old published snapshot.
+     */
+    void BodyContainer::writeBodySnapshots(BodiesSnapshot& buffer) {
+        auto itBuffer = std::ranges::find(snapshotBuffers, &buffer, &SnapshotBuffer::buffer);
+        bool firstWrite = itBuffer == snapshotBuffers.end();
+        if (firstWrite) {
+            itBuffer = std::ranges::find(snapshotBuffers, nullptr, &SnapshotBuffer::buffer);
+            assert(itBuffer != snapshotBuffers.end());
+            itBuffer->buffer = &buffer;
+        }
+
+        std::vector<BodySnapshot>& bufferBodySnapshots = buffer.getBodies();
+        if (firstWrite) {
+            bufferBodySnapshots = bodySnapshots;
+        } else {
+            bufferBodySnapshots.resize(bodySnapshots.size());
+            for (std::size_t outdatedIndex : itBuffer->outdatedIndexes) {
+                bufferBodySnapshots[outdatedIndex] = bodySnapshots[outdatedIndex];
+            }
+        }
+
+        for (std::size_t outdatedIndex : itBuffer->outdatedIndexes) {
+            itBuffer->outdatedFlags[outdatedIndex] = false;
+        }
+        itBuffer->outdatedIndexes.clear();
+    }
+
+    /**
+     * Return the last published snapshot of the bodies state. The snapshot is read without lock: it must be read by a single thread (e.g. rendering thread).
+     * @return Snapshot which stays valid and unchanged until the next call of this method
+     */
+    const BodiesSnapshot& BodyContainer::getLatestSnapshot() {
+        return snapshots.getLatestReadBuffer();
+    }
+
 }
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <mutex>
+#include <limits>
+#include <array>
 
 #include "body/model/AbstractBody.h"
+#include "body/BodiesSnapshot.h"
 
 namespace urchin {
 
@@ -18,26 +21,70 @@ namespace urchin {
     class BodyContainer final : public Observable {
         public:
             BodyContainer();
+            ~BodyContainer() override;
 
             enum NotificationType {
                 ADD_BODY, //A body has been added to the world
                 REMOVE_BODY, //A body has been removed from the world
+                BODY_STATE_UPDATED, //A body has been activated, deactivated or manually moved
             };
 
             void addBody(std::shared_ptr<AbstractBody>);
             void removeBody(const AbstractBody&);
             const std::shared_ptr<AbstractBody>& getLastUpdatedBody() const;
 
+            void notifyBodyStateUpdated(AbstractBody&);
+            AbstractBody& getLastStateUpdatedBody() const;
+
+            void setDeterministic(bool);
+            bool isDeterministic() const;
             void refreshBodies();
 
             const std::vector<std::shared_ptr<AbstractBody>>& getBodies() const;
+            const std::vector<AbstractBody*>& getActiveBodies() const;
+
+            void publishSnapshot();
+            const BodiesSnapshot& getLatestSnapshot();
 
         private:
+            std::size_t allocateSnapshotIndex();
+            void refreshActiveBody(AbstractBody&);
+            void removeActiveBody(const AbstractBody&);
+
+            static BodySnapshot buildBodySnapshot(const AbstractBody&);
+            void refreshBodySnapshot(AbstractBody&);
+            void markBodySnapshotOutdated(std::size_t);
+            void writeBodySnapshots(BodiesSnapshot&);
+
+            static constexpr std::size_t NOT_ACTIVE_INDEX = std::numeric_limits<std::size_t>::max();
+
             mutable std::mutex bodiesMutex;
             std::vector<std::shared_ptr<AbstractBody>> bodies;
             std::vector<BodyRefresh> bodiesToRefresh;
+            std::vector<AbstractBody*> activeBodies; //compact set of the active bodies: the sleeping bodies are not iterated by the physics steps
+            std::vector<std::size_t> activeBodyIndexes; //index in the active bodies by snapshot index
 
+            std::mutex bodiesStateMutex;
+            std::vector<AbstractBody*> stateUpdatedBodies;
+            std::vector<AbstractBody*> stateUpdatedBodiesToProcess;
+
+            bool deterministic;
             std::shared_ptr<AbstractBody> lastUpdatedBody;
+            AbstractBody* lastStateUpdatedBody;
+
+            struct SnapshotBuffer {
+                const BodiesSnapshot* buffer; //null until the first write in this buffer
+                std::vector<std::size_t> outdatedIndexes; //snapshot indexes refreshed since the last write in this buffer
+                std::vector<bool> outdatedFlags;
+            };
+
+            std::vector<std::size_t> freeSnapshotIndexes;
+            std::vector<AbstractBody*> stateUpdatedBodiesToPublish; //sleeping bodies manually moved or deactivated: not refreshed as active bodies
+            std::vector<BodySnapshot> bodySnapshots; //last published state by snapshot index: only the active and state updated bodies are refreshed
+            std::vector<bool> bodySnapshotRefreshed;
+            std::vector<std::size_t> refreshedSnapshotIndexes;
+            std::array<SnapshotBuffer, 3> snapshotBuffers; //one per buffer of the triple buffer: only the outdated bodies are written in a buffer
+            TripleBuffer<BodiesSnapshot> snapshots;
     };
 
 }
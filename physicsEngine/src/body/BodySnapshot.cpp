@@ -0,0 +1,15 @@
+#include "body/BodySnapshot.h"
+
+namespace urchin {
+
+    /**
+     * @param interpolationFactor Factor between 0.0 (transform of the previous physics step) and 1.0 (transform of the last physics step)
+     */
+    PhysicsTransform BodySnapshot::interpolateTransform(float interpolationFactor) const {
+        const Point3<float>& previousPosition = previousTransform.getPosition();
+        Point3<float> position = previousPosition.translate(previousPosition.vector(transform.getPosition()) * interpolationFactor);
+        Quaternion<float> orientation = previousTransform.getOrientation().slerp(transform.getOrientation(), interpolationFactor);
+        return PhysicsTransform(position, orientation);
+    }
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <limits>
+#include <UrchinCommon.h>
+
+#include "utils/math/PhysicsTransform.h"
+
+namespace urchin {
+
+    /**
+    * State of a body at the end of a physics step
+    */
+    struct BodySnapshot {
+        static constexpr uint_fast32_t NO_OBJECT_ID = std::numeric_limits<uint_fast32_t>::max();
+
+        PhysicsTransform interpolateTransform(float) const;
+
+        uint_fast32_t objectId;
+        bool isActive;
+        PhysicsTransform previousTransform; //transform at the end of the previous physics step
+        PhysicsTransform transform;
+        Vector3<float> linearVelocity;
+        Vector3<float> angularVelocity;
+    };
+
+}
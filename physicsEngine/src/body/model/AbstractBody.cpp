@@ -1,6 +1,7 @@
 #include <utility>
 
 #include "body/model/AbstractBody.h"
+#include "body/BodyContainer.h"
 #include "collision/broadphase/PairContainer.h"
 
 namespace urchin {
@@ -10,8 +11,10 @@ namespace urchin {
     bool AbstractBody::bDisableAllBodies = false;
 
     AbstractBody::AbstractBody(BodyType bodyType, std::string id, const PhysicsTransform& transform, std::unique_ptr<const CollisionShape3D> shape) :
+            bodyContainer(nullptr),
             transform(transform),
             isManuallyMoved(false),
+            isTeleported(false),
             bodyType(bodyType),
             id(std::move(id)),
             shape(std::move(shape)),
@@ -21,14 +24,17 @@ namespace urchin {
             ccdMotionThreshold(0.0f),
             bIsStatic(true),
             bIsActive(false),
-            objectId(nextObjectId++) {
+            objectId(nextObjectId++),
+            snapshotIndex(0) {
         initialize(0.2f, 0.5f, 0.0f);
     }
 
     AbstractBody::AbstractBody(const AbstractBody& abstractBody) :
             IslandElement(abstractBody),
+            bodyContainer(nullptr),
             transform(abstractBody.getTransform()),
             isManuallyMoved(false),
+            isTeleported(false),
             bodyType(abstractBody.bodyType),
             id(abstractBody.getId()),
             shape(abstractBody.getShape().clone()),
@@ -38,7 +44,8 @@ namespace urchin {
             ccdMotionThreshold(0.0f),
             bIsStatic(true),
             bIsActive(false),
-            objectId(nextObjectId++) {
+            objectId(nextObjectId++),
+            snapshotIndex(0) {
         initialize(abstractBody.getRestitution(), abstractBody.getFriction(), abstractBody.getRollingFriction());
         setCcdMotionThreshold(abstractBody.getCcdMotionThreshold()); //override default value
     }
@@ -47,6 +54,27 @@ namespace urchin {
         this->physicsThreadId = physicsThreadId;
     }
 
+    /**
+     * @param bodyContainer Container owning the body or null when the body is not anymore in a container
+     */
+    void AbstractBody::setBodyContainer(BodyContainer* bodyContainer) {
+        this->bodyContainer.store(bodyContainer, std::memory_order_release);
+    }
+
+    const BodyContainer* AbstractBody::getBodyContainer() const {
+        return bodyContainer.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Notify the body container that the body state has been updated (activated, deactivated or manually moved).
+     */
+    void AbstractBody::notifyStateUpdated() {
+        BodyContainer* ownerBodyContainer = bodyContainer.load(std::memory_order_acquire);
+        if (ownerBodyContainer) {
+            ownerBodyContainer->notifyBodyStateUpdated(*this);
+        }
+    }
+
     void AbstractBody::initialize(float restitution, float friction, float rollingFriction) {
         //technical data
         bIsStatic.store(true, std::memory_order_release);
@@ -72,12 +100,23 @@ namespace urchin {
         return transform;
     }
 
+    /**
+     * @return True when the body has been moved from a thread different of the physics thread and the move has not been processed yet by the broad phase
+     */
+    bool AbstractBody::hasPendingManualMove() const {
+        return isManuallyMoved.load();
+    }
+
     bool AbstractBody::getManuallyMovedAndReset() {
         bool expected = true;
         isManuallyMoved.compare_exchange_strong(expected, false);
         return expected;
     }
 
+    bool AbstractBody::getTeleportedAndReset() {
+        return isTeleported.exchange(false);
+    }
+
     const CollisionShape3D& AbstractBody::getShape() const {
         return *shape;
     }
@@ -172,7 +211,9 @@ namespace urchin {
      */
     void AbstractBody::setIsActive(bool bIsActive) {
         assert(!(bIsActive && bIsStatic)); //an active body cannot be static
-        this->bIsActive.store(bIsActive, std::memory_order_release);
+        if (this->bIsActive.exchange(bIsActive, std::memory_order_acq_rel) != bIsActive) {
+            notifyStateUpdated();
+        }
     }
 
     /**
@@ -187,4 +228,15 @@ namespace urchin {
         return objectId;
     }
 
+    /**
+     * @param snapshotIndex Index of the body in the bodies snapshot. Index is defined by the body container when the body is added.
+     */
+    void AbstractBody::setSnapshotIndex(std::size_t snapshotIndex) {
+        this->snapshotIndex.store(snapshotIndex, std::memory_order_relaxed);
+    }
+
+    std::size_t AbstractBody::getSnapshotIndex() const {
+        return snapshotIndex.load(std::memory_order_relaxed);
+    }
+
 }
@@ -17,6 +17,7 @@ namespace urchin {
     };
 
     class PairContainer;
+    class BodyContainer;
 
     class AbstractBody : public IslandElement {
         public:
@@ -30,10 +31,14 @@ namespace urchin {
             ~AbstractBody() override = default;
 
             void setPhysicsThreadId(std::thread::id);
+            void setBodyContainer(BodyContainer*);
+            const BodyContainer* getBodyContainer() const;
 
             virtual void setTransform(const PhysicsTransform&);
             PhysicsTransform getTransform() const;
+            bool hasPendingManualMove() const;
             bool getManuallyMovedAndReset();
+            bool getTeleportedAndReset();
 
             const CollisionShape3D& getShape() const;
 
@@ -59,14 +64,18 @@ namespace urchin {
             bool isActive() const override;
 
             uint_fast32_t getObjectId() const;
+            void setSnapshotIndex(std::size_t);
+            std::size_t getSnapshotIndex() const;
 
         protected:
             void initialize(float, float, float);
 
             void setIsStatic(bool);
+            void notifyStateUpdated();
 
             //technical data
             std::thread::id physicsThreadId;
+            std::atomic<BodyContainer*> bodyContainer;
 
             //mutex for attributes modifiable from external
             mutable std::mutex bodyMutex;
@@ -74,6 +83,7 @@ namespace urchin {
             //body representation data
             PhysicsTransform transform;
             std::atomic_bool isManuallyMoved;
+            std::atomic_bool isTeleported; //manually moved since the last bodies snapshot: transform must not be interpolated
 
         private:
             //body description data
@@ -93,6 +103,7 @@ namespace urchin {
             //technical object id
             static uint_fast32_t nextObjectId;
             uint_fast32_t objectId;
+            std::atomic<std::size_t> snapshotIndex;
     };
 
 }
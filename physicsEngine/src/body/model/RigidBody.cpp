@@ -32,6 +32,13 @@ namespace urchin {
         return nullptr;
     }
 
+    const RigidBody* RigidBody::upCast(const AbstractBody* abstractBody) {
+        if (abstractBody->getBodyType() == BodyType::RIGID) {
+            return static_cast<const RigidBody*>(abstractBody);
+        }
+        return nullptr;
+    }
+
     RigidBody& RigidBody::upCast(AbstractBody& abstractBody) {
         return static_cast<RigidBody&>(abstractBody);
     }
@@ -89,14 +96,32 @@ namespace urchin {
             if (AbstractBody::isActive()) {
                 throw std::runtime_error("Impossible to update the rigid body position/orientation while physics engine manages it");
             }
-            isManuallyMoved = true;
-            refreshBodyActiveState();
+            markAsManuallyMoved();
         }
 
         this->transform = transform;
         refreshWorldInertia();
     }
 
+    /**
+     * Define the body transform as a manual move even when called from the physics thread: the body is activated and its broad phase data refreshed
+     * as if the transform was updated from another thread. Used to replay the manual moves recorded in a physics journal.
+     */
+    void RigidBody::setManualTransform(const PhysicsTransform& transform) {
+        std::scoped_lock lock(bodyMutex);
+        markAsManuallyMoved();
+
+        this->transform = transform;
+        refreshWorldInertia();
+    }
+
+    void RigidBody::markAsManuallyMoved() {
+        isManuallyMoved = true;
+        isTeleported = true;
+        refreshBodyActiveState();
+        notifyStateUpdated();
+    }
+
     /**
      * Define the body velocity. Undetermined behavior if called outside the physics engine thread.
      */
@@ -17,9 +17,11 @@ namespace urchin {
             ~RigidBody() override = default;
 
             static RigidBody* upCast(AbstractBody*);
+            static const RigidBody* upCast(const AbstractBody*);
             static RigidBody& upCast(AbstractBody&);
 
             void setTransform(const PhysicsTransform&) override;
+            void setManualTransform(const PhysicsTransform&);
 
             void setVelocity(const Vector3<float>&, const Vector3<float>&);
             Vector3<float> getLinearVelocity() const;
@@ -51,6 +53,7 @@ namespace urchin {
             void refreshInertia();
             void refreshWorldInertia();
             void refreshBodyActiveState();
+            void markAsManuallyMoved();
 
             //rigid body representation data
             Vector3<float> linearVelocity;
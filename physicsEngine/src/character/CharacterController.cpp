@@ -1,6 +1,7 @@
 #include <vector>
 #include <limits>
 #include <cmath>
+#include <atomic>
 
 #include "PhysicsWorld.h"
 #include "character/CharacterController.h"
@@ -127,6 +128,14 @@ namespace urchin {
      * @param dt Delta of time between two simulation steps
      */
     void CharacterController::update(float dt) {
+        update(dt, physicsWorld.getGravity());
+    }
+
+    /**
+     * @param dt Delta of time between two simulation steps
+     * @param gravity Gravity of the physics world
+     */
+    void CharacterController::update(float dt, const Vector3<float>& gravity) {
         ScopeProfiler sp(Profiler::physics(), "charactCtrlUp");
 
         std::size_t stepLoopCounter = 0;
@@ -137,7 +146,7 @@ namespace urchin {
                 stepDt = std::min(remainingDt, 1.0f / MIN_UPDATE_FREQUENCY);
                 remainingDt -= stepDt;
             } else {
-                static unsigned int numErrorsLogged = 0;
+                static std::atomic_uint numErrorsLogged = 0;
                 if (numErrorsLogged++ < MAX_ERRORS_LOG) {
                     Logger::instance().logWarning("Maximum of iteration reached on character update (dt: " + std::to_string(dt) + ", remaining dt: " + std::to_string(remainingDt) + ")");
                 }
@@ -145,7 +154,7 @@ namespace urchin {
                 remainingDt = 0.0f;
             }
 
-            updateStep(stepDt);
+            updateStep(stepDt, gravity);
 
             stepLoopCounter++;
         } while (remainingDt > 0.001f);
@@ -174,10 +183,10 @@ namespace urchin {
         ccdGhostBody->setIsActive(true);
     }
 
-    void CharacterController::updateStep(float stepDt) {
+    void CharacterController::updateStep(float stepDt, const Vector3<float>& gravity) {
         if (ghostBody->isActive() && ccdGhostBody->isActive()) {
             //update body transform
-            updateBodiesTransform(stepDt);
+            updateBodiesTransform(stepDt, gravity);
 
             //recover from penetration
             recoverFromPenetration(stepDt);
@@ -199,7 +208,7 @@ namespace urchin {
         physicsCharacter->updateTransform(ghostBody->getTransform());
     }
 
-    void CharacterController::updateBodiesTransform(float dt) {
+    void CharacterController::updateBodiesTransform(float dt, const Vector3<float>& gravity) {
         //values
         previousBodyPosition = ghostBody->getTransform().getPosition();
         bool closeToTheGround = timeInTheAir < MAX_TIME_IN_AIR_CONSIDERED_AS_ON_GROUND;
@@ -247,7 +256,7 @@ namespace urchin {
         //gravity velocity
         if (!onGround || numberOfHit > 1) {
             if (gravityEnabled) {
-                verticalSpeed -= (-physicsWorld.getGravity().Y) * dt;
+                verticalSpeed -= (-gravity.Y) * dt;
             }
             if (verticalSpeed < -config.getMaxVerticalSpeed()) {
                 verticalSpeed = -config.getMaxVerticalSpeed();
@@ -10,6 +10,7 @@
 namespace urchin {
 
     class PhysicsWorld;
+    class CharacterControllerSystem;
 
     struct SignificantContactValues {
         unsigned int numberOfHit;
@@ -50,12 +51,15 @@ namespace urchin {
             void update(float);
 
         private:
+            friend class CharacterControllerSystem;
+
+            void update(float, const Vector3<float>&);
             void createBodies();
 
             Quaternion<float> computeYRotation(const Vector3<float>&) const;
 
-            void updateStep(float);
-            void updateBodiesTransform(float);
+            void updateStep(float, const Vector3<float>&);
+            void updateBodiesTransform(float, const Vector3<float>&);
             void recoverFromPenetration(float);
             void resetSignificantContactValues();
             void saveSignificantContactValues(const Vector3<float>&);
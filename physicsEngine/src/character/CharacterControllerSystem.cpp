@@ -0,0 +1,45 @@
+#include <algorithm>
+
+#include "PhysicsWorld.h"
+#include "character/CharacterControllerSystem.h"
+
+namespace urchin {
+
+    CharacterControllerSystem::CharacterControllerSystem(PhysicsWorld& physicsWorld) :
+            physicsWorld(physicsWorld),
+            workerPool(ConfigService::instance().getUnsignedIntValue("characterControllerSystem.workersCount")) {
+
+    }
+
+    void CharacterControllerSystem::addCharacterController(std::shared_ptr<CharacterController> characterController) {
+        if (characterController) {
+            characterControllers.push_back(std::move(characterController));
+        }
+    }
+
+    void CharacterControllerSystem::removeCharacterController(const CharacterController& characterController) {
+        std::erase_if(characterControllers, [&characterController](const auto& registeredCharacterController) {
+            return registeredCharacterController.get() == &characterController;
+        });
+    }
+
+    const std::vector<std::shared_ptr<CharacterController>>& CharacterControllerSystem::getCharacterControllers() const {
+        return characterControllers;
+    }
+
+    /**
+     * Update the registered character controllers. Method must be called from the thread which adds and removes the character controllers.
+     * @param dt Delta of time between two simulation steps
+     */
+    void CharacterControllerSystem::update(float dt) {
+        ScopeProfiler sp(Profiler::physics(), "charactCtrlSys");
+
+        Vector3<float> gravity = physicsWorld.getGravity();
+        workerPool.parallelFor(characterControllers.size(), MIN_CHARACTERS_BY_WORKER, [&](unsigned int, std::size_t beginIndex, std::size_t endIndex) {
+            for (std::size_t i = beginIndex; i < endIndex; ++i) {
+                characterControllers[i]->update(dt, gravity);
+            }
+        });
+    }
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "character/CharacterController.h"
+
+namespace urchin {
+
+    class PhysicsWorld;
+
+    /**
+    * Update all the registered character controllers in one pass. The characters are split between several workers: the penetration recovery and the ground checks
+    * of the characters are executed in parallel. The ghost bodies of the characters cannot see each other in the broad phase: the result is identical to an update
+    * of each character controller one after the other.
+    * The character event callbacks are executed from the worker threads: a callback shared by several characters must be thread safe.
+    */
+    class CharacterControllerSystem {
+        public:
+            explicit CharacterControllerSystem(PhysicsWorld&);
+
+            void addCharacterController(std::shared_ptr<CharacterController>);
+            void removeCharacterController(const CharacterController&);
+            const std::vector<std::shared_ptr<CharacterController>>& getCharacterControllers() const;
+
+            void update(float);
+
+        private:
+            static constexpr std::size_t MIN_CHARACTERS_BY_WORKER = 8;
+
+            PhysicsWorld& physicsWorld;
+            WorkerPool workerPool;
+
+            std::vector<std::shared_ptr<CharacterController>> characterControllers;
+    };
+
+}
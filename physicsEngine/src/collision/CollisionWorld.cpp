@@ -1,4 +1,5 @@
 #include <vector>
+#include <utility>
 
 #include "collision/CollisionWorld.h"
 
@@ -6,13 +7,20 @@ namespace urchin {
 
     CollisionWorld::CollisionWorld(BodyContainer& bodyContainer) :
             bodyContainer(bodyContainer),
+            jointContainer(bodyContainer),
+            workerPool(ConfigService::instance().getUnsignedIntValue("collisionWorld.workersCount")),
             broadPhase(BroadPhase(bodyContainer)),
-            narrowPhase(NarrowPhase(bodyContainer, getBroadPhase())),
+            narrowPhase(NarrowPhase(bodyContainer, getBroadPhase(), workerPool)),
             integrateVelocity(IntegrateVelocity(bodyContainer)),
-            constraintSolver(ConstraintSolver()),
+            constraintSolver(ConstraintSolver(workerPool)),
             bodyActiveStateUpdater(BodyActiveStateUpdater(bodyContainer)),
-            integrateTransform(IntegrateTransform(bodyContainer, getBroadPhase(), getNarrowPhase())) {
+            integrateTransform(IntegrateTransform(bodyContainer, getBroadPhase(), getNarrowPhase())),
+            sceneQuery(narrowPhase, metrics) {
+        setDeterministic(ConfigService::instance().getBoolValue("collisionWorld.deterministic"));
+    }
 
+    JointContainer& CollisionWorld::getJointContainer() {
+        return jointContainer;
     }
 
     BroadPhase& CollisionWorld::getBroadPhase() {
@@ -23,6 +31,48 @@ namespace urchin {
         return narrowPhase;
     }
 
+    const SceneQuery& CollisionWorld::getSceneQuery() const {
+        return sceneQuery;
+    }
+
+    /**
+     * @param deterministic Process the bodies state updates notified by the other threads in a fixed order. With the same inputs (see PhysicsJournal), the
+     * world produces the same bodies state at each step.
+     */
+    void CollisionWorld::setDeterministic(bool deterministic) {
+        bodyContainer.setDeterministic(deterministic);
+    }
+
+    bool CollisionWorld::isDeterministic() const {
+        return bodyContainer.isDeterministic();
+    }
+
+    /**
+     * Start to record the inputs of the next steps in a journal. The recorded journal can be replayed by PhysicsReplayer.
+     * Deterministic mode should be enabled to ensure that the replayed steps produce the recorded bodies state.
+     */
+    void CollisionWorld::startJournal() {
+        journal = std::make_unique<PhysicsJournal>(bodyContainer);
+    }
+
+    /**
+     * @return Journal recorded since the last start or null if no journal has been started
+     */
+    std::unique_ptr<PhysicsJournal> CollisionWorld::stopJournal() {
+        return std::move(journal);
+    }
+
+    /**
+     * @return Metrics of the last steps. Metrics can be read from any thread.
+     */
+    PhysicsMetrics& CollisionWorld::getMetrics() {
+        return metrics;
+    }
+
+    const PhysicsMetrics& CollisionWorld::getMetrics() const {
+        return metrics;
+    }
+
     /**
      * Update bodies by performing collision tests and responses
      * @param dt Delta of time (sec.) between two simulation steps
@@ -30,29 +80,73 @@ namespace urchin {
      */
     void CollisionWorld::process(float dt, const Vector3<float>& gravity) {
         ScopeProfiler sp(Profiler::physics(), "colWorldProc");
+        metrics.beginStep();
 
-        //refresh bodies: add new bodies, remove bodies...
+        if (journal) {
+            journal->beginStep(gravity);
+        }
+
+        //refresh bodies and joints: add new bodies, remove bodies...
         bodyContainer.refreshBodies();
+        jointContainer.refreshJoints();
+        if (journal && !jointContainer.getJoints().empty()) {
+            journal->recordUnsupportedJoints();
+        }
+        metrics.endPhase(PhysicsMetrics::REFRESH_BODIES);
 
         //broad phase: determine pairs of bodies potentially colliding based on their AABBox
         auto& overlappingPairs = broadPhase.computeOverlappingPairs();
+        metrics.endPhase(PhysicsMetrics::BROAD_PHASE);
 
         //integrate bodies velocities: gravity, external forces...
-        integrateVelocity.process(dt, overlappingPairs, gravity);
+        integrateVelocity.process(dt, overlappingPairs, gravity, journal.get());
+        metrics.endPhase(PhysicsMetrics::INTEGRATE_VELOCITY);
 
         //narrow phase: check if a pair of bodies colliding and update collision constraints
         manifoldResults.clear();
         narrowPhase.process(dt, overlappingPairs, manifoldResults);
         notifyObservers(this, COLLISION_RESULT_UPDATED);
+        metrics.endPhase(PhysicsMetrics::NARROW_PHASE);
 
-        //constraints solver: solve collision constraints
-        constraintSolver.process(dt, manifoldResults);
+        //constraints solver: solve collision and joint constraints
+        constraintSolver.process(dt, manifoldResults, jointContainer.getJoints());
+        narrowPhase.storeAccumulatedSolvingData(manifoldResults);
+        metrics.endPhase(PhysicsMetrics::CONSTRAINT_SOLVER);
 
         //update bodies state
-        bodyActiveStateUpdater.update(manifoldResults);
+        bodyActiveStateUpdater.update(manifoldResults, jointContainer.getJoints());
+        metrics.endPhase(PhysicsMetrics::BODY_STATE_UPDATE);
 
         //integrate transformations
         integrateTransform.process(dt);
+        if (journal) {
+            journal->endStep(dt);
+        }
+        metrics.endPhase(PhysicsMetrics::INTEGRATE_TRANSFORM);
+
+        //publish bodies state and broad phase for the other threads
+        bodyContainer.publishSnapshot();
+        sceneQuery.publishSnapshot(broadPhase);
+        metrics.endPhase(PhysicsMetrics::PUBLISH_SNAPSHOT);
+
+        endStepMetrics(overlappingPairs);
+    }
+
+    /**
+     * Record the counters of the step. The active bodies are the bodies active at the start of the step.
+     */
+    void CollisionWorld::endStepMetrics(const std::vector<std::unique_ptr<OverlappingPair>>& overlappingPairs) {
+        StepCounters stepCounters;
+        stepCounters.overlappingPairs = overlappingPairs.size();
+        stepCounters.manifoldResults = manifoldResults.size();
+        stepCounters.constraints = constraintSolver.getConstraintsCount();
+        stepCounters.islands = constraintSolver.getIslandsCount();
+        stepCounters.activeBodies = bodyContainer.getActiveBodies().size();
+        stepCounters.inactiveBodies = bodyContainer.getBodies().size() - stepCounters.activeBodies;
+        narrowPhase.getAlgorithmCounters().fillStepCounters(stepCounters);
+        narrowPhase.getAlgorithmCounters().reset();
+
+        metrics.endStep(stepCounters);
     }
 
     const std::vector<ManifoldResult>& CollisionWorld::getLastUpdatedManifoldResults() const {
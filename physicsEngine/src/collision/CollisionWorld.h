@@ -3,6 +3,7 @@
 #include <UrchinCommon.h>
 
 #include "body/BodyContainer.h"
+#include "joint/JointContainer.h"
 #include "collision/ManifoldResult.h"
 #include "collision/broadphase/BroadPhase.h"
 #include "collision/narrowphase/NarrowPhase.h"
@@ -10,6 +11,9 @@
 #include "collision/constraintsolver/ConstraintSolver.h"
 #include "collision/bodystate/BodyActiveStateUpdater.h"
 #include "collision/integration/IntegrateTransform.h"
+#include "scenequery/SceneQuery.h"
+#include "journal/PhysicsJournal.h"
+#include "metrics/PhysicsMetrics.h"
 
 namespace urchin {
 
@@ -25,15 +29,28 @@ namespace urchin {
                 COLLISION_RESULT_UPDATED
             };
 
+            JointContainer& getJointContainer();
             BroadPhase& getBroadPhase();
             NarrowPhase& getNarrowPhase();
+            const SceneQuery& getSceneQuery() const;
+
+            void setDeterministic(bool);
+            bool isDeterministic() const;
+            void startJournal();
+            std::unique_ptr<PhysicsJournal> stopJournal();
+            PhysicsMetrics& getMetrics();
+            const PhysicsMetrics& getMetrics() const;
 
             void process(float, const Vector3<float>&);
 
             const std::vector<ManifoldResult>& getLastUpdatedManifoldResults() const;
 
         private:
+            void endStepMetrics(const std::vector<std::unique_ptr<OverlappingPair>>&);
+
             BodyContainer& bodyContainer;
+            JointContainer jointContainer;
+            WorkerPool workerPool;
 
             BroadPhase broadPhase;
             NarrowPhase narrowPhase;
@@ -41,6 +58,9 @@ namespace urchin {
             ConstraintSolver constraintSolver;
             BodyActiveStateUpdater bodyActiveStateUpdater;
             IntegrateTransform integrateTransform;
+            PhysicsMetrics metrics;
+            SceneQuery sceneQuery;
+            std::unique_ptr<PhysicsJournal> journal;
 
             std::vector<ManifoldResult> manifoldResults;
     };
@@ -106,4 +106,8 @@ namespace urchin {
     AccumulatedSolvingData& ManifoldContactPoint::getAccumulatedSolvingData() {
         return accumulatedSolvingData;
     }
+
+    const AccumulatedSolvingData& ManifoldContactPoint::getAccumulatedSolvingData() const {
+        return accumulatedSolvingData;
+    }
 }
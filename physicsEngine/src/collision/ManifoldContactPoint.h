@@ -23,6 +23,7 @@ namespace urchin {
             void updateDepth(float);
 
             AccumulatedSolvingData& getAccumulatedSolvingData();
+            const AccumulatedSolvingData& getAccumulatedSolvingData() const;
 
         private:
             Vector3<float> normalFromObject2;
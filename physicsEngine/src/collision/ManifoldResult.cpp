@@ -7,7 +7,8 @@ namespace urchin {
     ManifoldResult::ManifoldResult(AbstractBody& body1, AbstractBody& body2) :
             body1(body1),
             body2(body2),
-            nbContactPoint(0) {
+            nbContactPoint(0),
+            speculative(false) {
 
     }
 
@@ -36,6 +37,17 @@ namespace urchin {
         return CONTACT_BREAKING_THRESHOLD;
     }
 
+    /**
+     * Mark the manifold as generated by the speculative contacts of a fast body
+     */
+    void ManifoldResult::markAsSpeculative() {
+        speculative = true;
+    }
+
+    bool ManifoldResult::isSpeculative() const {
+        return speculative;
+    }
+
     ManifoldContactPoint& ManifoldResult::getManifoldContactPoint(unsigned int index) {
         return contactPoints[index];
     }
@@ -73,9 +85,11 @@ namespace urchin {
 
         //1. if similar point exist in manifold result: replace it
         int nearestPointIndex = getNearestPointIndex(localPointOnObject2);
-        if (nearestPointIndex >= 0) { //replace existing point
+        if (nearestPointIndex >= 0) { //replace existing point and keep its accumulated solving data for warm starting
+            AccumulatedSolvingData accumulatedSolvingData = contactPoints[(std::size_t)nearestPointIndex].getAccumulatedSolvingData();
             contactPoints[(std::size_t)nearestPointIndex] = ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2,
                     localPointOnObject1, localPointOnObject2, depth, isPredictive);
+            contactPoints[(std::size_t)nearestPointIndex].getAccumulatedSolvingData() = accumulatedSolvingData;
             return;
         }
 
@@ -116,6 +130,18 @@ namespace urchin {
         }
     }
 
+    /**
+     * Copy the accumulated solving data of a copy of this manifold result. Contact points of both manifold results must be identical.
+     * @param solvedManifoldResult Copy of this manifold result on which the constraint solver stored the accumulated solving data
+     */
+    void ManifoldResult::copyAccumulatedSolvingData(const ManifoldResult& solvedManifoldResult) {
+        assert(nbContactPoint == solvedManifoldResult.getNumContactPoints());
+
+        for (unsigned int i = 0; i < nbContactPoint; ++i) {
+            contactPoints[i].getAccumulatedSolvingData() = solvedManifoldResult.getManifoldContactPoint(i).getAccumulatedSolvingData();
+        }
+    }
+
     /**
      * @param localPointOnObject2 Local point of object 2 used for comparison
      * @return Nearest point index to point given in parameter. If all points are too far: '-1' is returned.
@@ -22,12 +22,15 @@ namespace urchin {
 
             unsigned int getNumContactPoints() const;
             float getContactBreakingThreshold() const;
+            void markAsSpeculative();
+            bool isSpeculative() const;
             ManifoldContactPoint& getManifoldContactPoint(unsigned int);
             const ManifoldContactPoint& getManifoldContactPoint(unsigned int) const;
 
             void addContactPoint(const Vector3<float>&, const Point3<float>&, float, bool);
             void addContactPoint(const Vector3<float>&, const Point3<float>&, const Point3<float>&, const Point3<float>&, const Point3<float>&, float, bool);
             void refreshContactPoints();
+            void copyAccumulatedSolvingData(const ManifoldResult&);
 
         private:
             int getNearestPointIndex(const Point3<float>&) const;
@@ -44,6 +47,7 @@ namespace urchin {
 
             std::array<ManifoldContactPoint, MAX_PERSISTENT_POINTS> contactPoints;
             unsigned int nbContactPoint;
+            bool speculative;
     };
 
 }
@@ -88,4 +88,15 @@ namespace urchin {
         return collisionAlgorithm.get();
     }
 
+    /**
+     * @param collisionRelativeTransform Transform of body 2 relative to body 1 used to compute the collision algorithm result
+     */
+    void OverlappingPair::setCollisionRelativeTransform(const PhysicsTransform& collisionRelativeTransform) {
+        this->collisionRelativeTransform = collisionRelativeTransform;
+    }
+
+    const std::optional<PhysicsTransform>& OverlappingPair::getCollisionRelativeTransform() const {
+        return collisionRelativeTransform;
+    }
+
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "body/model/AbstractBody.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
@@ -31,6 +32,9 @@ namespace urchin {
             void setCollisionAlgorithm(std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter>);
             CollisionAlgorithm* getCollisionAlgorithm() const;
 
+            void setCollisionRelativeTransform(const PhysicsTransform&);
+            const std::optional<PhysicsTransform>& getCollisionRelativeTransform() const;
+
         private:
             //keep the ownership on the bodies via std::shared_ptr because bodies could be removed from physics thread but still present in the copied overlapping pairs
             std::shared_ptr<AbstractBody> body1;
@@ -38,6 +42,7 @@ namespace urchin {
             uint_fast64_t bodiesId;
 
             std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> collisionAlgorithm;
+            std::optional<PhysicsTransform> collisionRelativeTransform; //relative transform of the bodies at the last collision algorithm execution
     };
 
 }
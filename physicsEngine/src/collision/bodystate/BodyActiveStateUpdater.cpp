@@ -16,10 +16,10 @@ namespace urchin {
      * Refresh body active state. If all bodies of an island can sleep, we set their status to inactive.
      * If one body of the island cannot sleep, we set their status to active.
      */
-    void BodyActiveStateUpdater::update(const std::vector<ManifoldResult>& manifoldResults) {
+    void BodyActiveStateUpdater::update(const std::vector<ManifoldResult>& manifoldResults, const std::vector<std::shared_ptr<Joint>>& joints) {
         ScopeProfiler sp(Profiler::physics(), "refreshBodyStat");
 
-        buildIslands(manifoldResults);
+        buildIslands(manifoldResults, joints);
         const std::vector<IslandElementLink>& islandElementsLink = islandContainer.retrieveSortedIslandElements();
 
         if (DEBUG_PRINT_ISLANDS) {
@@ -60,17 +60,34 @@ namespace urchin {
         }
     }
 
-    void BodyActiveStateUpdater::buildIslands(const std::vector<ManifoldResult>& manifoldResults) {
-        //1. create an island for each body
-        islandElements.clear();
-        for (auto& body : bodyContainer.getBodies()) {
-            if (!body->isStatic()) {
-                islandElements.push_back(body.get());
+    void BodyActiveStateUpdater::buildIslands(const std::vector<ManifoldResult>& manifoldResults, const std::vector<std::shared_ptr<Joint>>& joints) {
+        //1. create an island for each active body and each sleeping body in contact or linked to an active body: the other sleeping bodies keep their state
+        islandContainer.reset();
+        for (AbstractBody* body : bodyContainer.getActiveBodies()) {
+            if (!body->isStatic() && body->isActive()) {
+                islandContainer.addElement(*body);
+            }
+        }
+        for (const auto& manifoldResult : manifoldResults) {
+            if (manifoldResult.getNumContactPoints() > 0) {
+                for (AbstractBody* body : {&manifoldResult.getBody1(), &manifoldResult.getBody2()}) {
+                    if (!body->isStatic()) {
+                        islandContainer.addElement(*body);
+                    }
+                }
+            }
+        }
+        for (const auto& joint : joints) {
+            if (joint->getBody1().isActive() || joint->getBody2().isActive()) {
+                for (AbstractBody* body : {&joint->getBody1(), &joint->getBody2()}) {
+                    if (!body->isStatic()) {
+                        islandContainer.addElement(*body);
+                    }
+                }
             }
         }
-        islandContainer.reset(islandElements);
 
-        //2. merge islands for bodies in contact
+        //2. merge islands for bodies in contact or linked by a joint
         for (const auto& manifoldResult : manifoldResults) {
             if (manifoldResult.getNumContactPoints() > 0) {
                 const AbstractBody& body1 = manifoldResult.getBody1();
@@ -85,6 +102,13 @@ namespace urchin {
                 }
             }
         }
+        for (const auto& joint : joints) { //a joint with a static body is not a static link: the joint does not stop the body (e.g. pendulum released without velocity)
+            const AbstractBody& body1 = joint->getBody1();
+            const AbstractBody& body2 = joint->getBody2();
+            if (!body1.isStatic() && !body2.isStatic() && islandContainer.containsElement(body1)) {
+                islandContainer.mergeIsland(body1, body2);
+            }
+        }
     }
 
     /**
@@ -6,6 +6,7 @@
 #include "collision/ManifoldResult.h"
 #include "body/BodyContainer.h"
 #include "body/model/RigidBody.h"
+#include "joint/model/Joint.h"
 
 namespace urchin {
 
@@ -13,17 +14,16 @@ namespace urchin {
         public:
             explicit BodyActiveStateUpdater(const BodyContainer&);
 
-            void update(const std::vector<ManifoldResult>&);
+            void update(const std::vector<ManifoldResult>&, const std::vector<std::shared_ptr<Joint>>&);
 
         private:
-            void buildIslands(const std::vector<ManifoldResult>&);
+            void buildIslands(const std::vector<ManifoldResult>&, const std::vector<std::shared_ptr<Joint>>&);
             unsigned int computeNumberElements(const std::vector<IslandElementLink>&, unsigned int) const;
             bool isBodyMoving(const RigidBody*) const;
 
             void printIslands(const std::vector<IslandElementLink>&) const;
 
             const BodyContainer& bodyContainer;
-            std::vector<IslandElement*> islandElements;
             IslandContainer islandContainer;
 
             const float squaredLinearSleepingThreshold;
@@ -11,21 +11,47 @@ namespace urchin {
     }
 
     /**
-     * Reset the container of island elements. Create islands of one element for each island elements asked.
+     * Reset the container of island elements. The container is empty: the island elements must be added with 'addElement' method.
      */
-    void IslandContainer::reset(const std::vector<IslandElement*>& islandElements) {
+    void IslandContainer::reset() {
         containerSorted = false;
-
         islandElementsLink.clear();
-        islandElementsLink.resize(islandElements.size());
+    }
 
-        for (std::size_t i = 0; i < islandElements.size(); ++i) {
-            islandElements[i]->setIslandElementId((unsigned int)i);
+    /**
+     * Reset the container of island elements. Create islands of one element for each island elements asked.
+     */
+    void IslandContainer::reset(const std::vector<IslandElement*>& islandElements) {
+        reset();
+        islandElementsLink.reserve(islandElements.size());
+        for (IslandElement* islandElement : islandElements) {
+            addElement(*islandElement);
+        }
+    }
 
-            islandElementsLink[i].element = islandElements[i];
-            islandElementsLink[i].linkedToStaticElement = !islandElements[i]->isActive();
-            islandElementsLink[i].islandIdRef = (unsigned int)i;
+    /**
+     * Create an island of one element for the element. Nothing is done when the element is already in the container.
+     */
+    void IslandContainer::addElement(IslandElement& islandElement) {
+        assert(!containerSorted);
+        if (containsElement(islandElement)) {
+            return;
         }
+
+        auto islandElementId = (unsigned int)islandElementsLink.size();
+        islandElement.setIslandElementId(islandElementId);
+        IslandElementLink& islandElementLink = islandElementsLink.emplace_back();
+        islandElementLink.element = &islandElement;
+        islandElementLink.linkedToStaticElement = !islandElement.isActive();
+        islandElementLink.islandIdRef = islandElementId;
+    }
+
+    /**
+     * @return True when the element has been added since the last reset. The island element ID of an element not in the container could be an ID of a previous reset.
+     */
+    bool IslandContainer::containsElement(const IslandElement& islandElement) const {
+        unsigned int islandElementId = islandElement.getIslandElementId();
+        return islandElementId < islandElementsLink.size() && islandElementsLink[islandElementId].element == &islandElement;
     }
 
     void IslandContainer::mergeIsland(const IslandElement& element1, const IslandElement& element2) {
@@ -46,6 +72,14 @@ namespace urchin {
         islandElementsLink[islandId].linkedToStaticElement = true;
     }
 
+    /**
+     * @return Island ID of the element. Method must be called before sorting the islands.
+     */
+    unsigned int IslandContainer::retrieveIslandId(const IslandElement& element) const {
+        assert(!containerSorted);
+        return findIslandId(element.getIslandElementId());
+    }
+
     /**
      * Sorts the islands by ID and returns them.
      * Once the islands sorted, the container is not usable anymore and need to be reset.
@@ -56,7 +90,10 @@ namespace urchin {
             islandElementsLink[i].islandIdRef = findIslandId((unsigned int)i);
         }
 
-        std::ranges::sort(islandElementsLink, [](const auto& lhs, const auto& rhs){return lhs.islandIdRef < rhs.islandIdRef;});
+        //elements of an island are sorted by element ID: the order does not depend on the sort algorithm implementation
+        std::ranges::sort(islandElementsLink, [](const auto& lhs, const auto& rhs){
+            return lhs.islandIdRef < rhs.islandIdRef || (lhs.islandIdRef == rhs.islandIdRef && lhs.element->getIslandElementId() < rhs.element->getIslandElementId());
+        });
         containerSorted = true;
 
         return islandElementsLink;
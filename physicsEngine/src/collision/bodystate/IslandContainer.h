@@ -15,9 +15,13 @@ namespace urchin {
         public:
             IslandContainer();
 
+            void reset();
             void reset(const std::vector<IslandElement*>&);
+            void addElement(IslandElement&);
+            bool containsElement(const IslandElement&) const;
             void mergeIsland(const IslandElement&, const IslandElement&);
             void linkToStaticElement(const IslandElement&);
+            unsigned int retrieveIslandId(const IslandElement&) const;
 
             const std::vector<IslandElementLink>& retrieveSortedIslandElements();
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "collision/broadphase/BroadPhase.h"
 #include "collision/broadphase/aabbtree/AABBTreeAlgorithm.h"
 
@@ -7,6 +9,7 @@ namespace urchin {
             broadPhaseAlgorithm(AABBTreeAlgorithm()) {
         bodyContainer.addObserver(this, BodyContainer::ADD_BODY);
         bodyContainer.addObserver(this, BodyContainer::REMOVE_BODY);
+        bodyContainer.addObserver(this, BodyContainer::BODY_STATE_UPDATED);
     }
 
     BroadPhase::~BroadPhase() {
@@ -19,6 +22,8 @@ namespace urchin {
                 addBody(bodyContainer->getLastUpdatedBody());
             } else if (notificationType == BodyContainer::REMOVE_BODY) {
                 removeBody(*bodyContainer->getLastUpdatedBody());
+            } else if (notificationType == BodyContainer::BODY_STATE_UPDATED) {
+                broadPhaseAlgorithm.updateBodyState(bodyContainer->getLastStateUpdatedBody());
             }
         }
     }
@@ -80,6 +85,15 @@ namespace urchin {
         broadPhaseAlgorithm.rayTest(ray, bodiesAABBoxHitRay);
     }
 
+    /**
+     * Ray tests processed in batch: more efficient than several calls to rayTest.
+     * @param bodiesAABBoxHitRays [out] Bodies AABBox hit by each ray
+     */
+    void BroadPhase::rayTests(std::span<const Ray<float>> rays, std::vector<std::vector<std::shared_ptr<AbstractBody>>>& bodiesAABBoxHitRays) const {
+        assert(std::ranges::all_of(bodiesAABBoxHitRays, [](const auto& bodiesAABBoxHitRay) { return bodiesAABBoxHitRay.empty(); }));
+        broadPhaseAlgorithm.rayTests(rays, bodiesAABBoxHitRays);
+    }
+
     /**
      * @param bodiesAABBoxHitBody [out] Bodies AABBox hit by a moving body
      */
@@ -88,4 +102,12 @@ namespace urchin {
         broadPhaseAlgorithm.bodyTest(body, from, to, bodiesAABBoxHitBody);
     }
 
+    /**
+     * Copy the broad phase into an immutable snapshot. Method must be called by the physics thread once the bodies are up to date.
+     * @param previousSnapshot Last published snapshot (nullable): its unchanged parts are shared with the new snapshot
+     */
+    void BroadPhase::copyTo(BroadPhaseSnapshot& snapshot, const BroadPhaseSnapshot* previousSnapshot) const {
+        broadPhaseAlgorithm.copyTo(snapshot, previousSnapshot);
+    }
+
 }
@@ -26,8 +26,11 @@ namespace urchin {
             const std::vector<std::unique_ptr<OverlappingPair>>& computeOverlappingPairs();
 
             void rayTest(const Ray<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const;
+            void rayTests(std::span<const Ray<float>>, std::vector<std::vector<std::shared_ptr<AbstractBody>>>&) const;
             void bodyTest(const AbstractBody&, const PhysicsTransform&, const PhysicsTransform&, std::vector<std::shared_ptr<AbstractBody>>&) const;
 
+            void copyTo(BroadPhaseSnapshot&, const BroadPhaseSnapshot*) const;
+
         private:
             void addBody(const std::shared_ptr<AbstractBody>&);
             void removeBody(const AbstractBody&);
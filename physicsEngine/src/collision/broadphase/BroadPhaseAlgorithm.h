@@ -1,10 +1,12 @@
 #pragma once
 
+#include <span>
 #include <vector>
 #include <UrchinCommon.h>
 
 #include "body/model/AbstractBody.h"
 #include "collision/OverlappingPair.h"
+#include "collision/broadphase/BroadPhaseSnapshot.h"
 
 namespace urchin {
 
@@ -14,12 +16,16 @@ namespace urchin {
 
             virtual void addBody(const std::shared_ptr<AbstractBody>&) = 0;
             virtual void removeBody(const AbstractBody&) = 0;
+            virtual void updateBodyState(const AbstractBody&) = 0;
             virtual void updateBodies() = 0;
 
             virtual const std::vector<std::unique_ptr<OverlappingPair>>& getOverlappingPairs() const = 0;
 
             virtual void rayTest(const Ray<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const = 0;
+            virtual void rayTests(std::span<const Ray<float>>, std::vector<std::vector<std::shared_ptr<AbstractBody>>>&) const = 0;
             virtual void bodyTest(const AbstractBody&, const PhysicsTransform&, const PhysicsTransform&, std::vector<std::shared_ptr<AbstractBody>>&) const = 0;
+
+            virtual void copyTo(BroadPhaseSnapshot&, const BroadPhaseSnapshot*) const = 0;
     };
 
 }
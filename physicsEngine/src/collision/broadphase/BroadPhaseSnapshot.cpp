@@ -0,0 +1,84 @@
+#include "collision/broadphase/BroadPhaseSnapshot.h"
+
+namespace urchin {
+
+    BroadPhaseSnapshot::BroadPhaseSnapshot() :
+            staticTree({.tree = nullptr, .version = 0}),
+            dynamicTree({.tree = nullptr, .version = 0}) {
+
+    }
+
+    /**
+     * @param treeVersion Version of the static tree to copy: a version is never reused for a different tree content
+     * @param previousSnapshot Last published snapshot (nullable)
+     * @return Tree to fill with the static tree or nullptr when the tree of the previous snapshot is unchanged and has been shared
+     */
+    AABBTreeSnapshot<SnapshotBody>* BroadPhaseSnapshot::prepareStaticTree(uint64_t treeVersion, const BroadPhaseSnapshot* previousSnapshot) {
+        return prepareTree(staticTree, treeVersion, previousSnapshot ? &previousSnapshot->staticTree : nullptr);
+    }
+
+    /**
+     * @param treeVersion Version of the dynamic tree to copy: a version is never reused for a different tree content
+     * @param previousSnapshot Last published snapshot (nullable)
+     * @return Tree to fill with the dynamic tree or nullptr when the tree of the previous snapshot is unchanged and has been shared
+     */
+    AABBTreeSnapshot<SnapshotBody>* BroadPhaseSnapshot::prepareDynamicTree(uint64_t treeVersion, const BroadPhaseSnapshot* previousSnapshot) {
+        return prepareTree(dynamicTree, treeVersion, previousSnapshot ? &previousSnapshot->dynamicTree : nullptr);
+    }
+
+    AABBTreeSnapshot<SnapshotBody>* BroadPhaseSnapshot::prepareTree(SharedTree& sharedTree, uint64_t treeVersion, const SharedTree* previousTree) {
+        if (previousTree && previousTree->tree && previousTree->version == treeVersion) {
+            sharedTree = *previousTree;
+            return nullptr;
+        }
+
+        if (!sharedTree.tree || sharedTree.tree.use_count() > 1) {
+            sharedTree.tree = std::make_shared<AABBTreeSnapshot<SnapshotBody>>(); //tree referenced by other snapshots: cannot be overwritten
+        }
+        sharedTree.version = treeVersion;
+        return sharedTree.tree.get();
+    }
+
+    /**
+     * Release the bodies references. The memory of the trees owned by this snapshot only is kept for the next copy.
+     * Method must be called by the physics thread once the snapshot is not used by the queries anymore.
+     */
+    void BroadPhaseSnapshot::clear() {
+        clearTree(staticTree);
+        clearTree(dynamicTree);
+    }
+
+    void BroadPhaseSnapshot::clearTree(SharedTree& sharedTree) {
+        if (sharedTree.tree && sharedTree.tree.use_count() > 1) {
+            sharedTree.tree.reset();
+        } else if (sharedTree.tree) {
+            sharedTree.tree->clear();
+        }
+        sharedTree.version = 0;
+    }
+
+    /**
+     * @param bodiesAABBoxHit [out] Bodies having their AABBox at the snapshot time hit
+     */
+    void BroadPhaseSnapshot::aabboxQuery(const AABBox<float>& aabbox, std::vector<const SnapshotBody*>& bodiesAABBoxHit) const {
+        if (staticTree.tree) {
+            staticTree.tree->aabboxQuery(aabbox, bodiesAABBoxHit);
+        }
+        if (dynamicTree.tree) {
+            dynamicTree.tree->aabboxQuery(aabbox, bodiesAABBoxHit);
+        }
+    }
+
+    /**
+     * @param bodiesAABBoxHitRay [out] Bodies having their AABBox at the snapshot time hit by the ray
+     */
+    void BroadPhaseSnapshot::rayQuery(const Ray<float>& ray, std::vector<const SnapshotBody*>& bodiesAABBoxHitRay) const {
+        if (staticTree.tree) {
+            staticTree.tree->rayQuery(ray, bodiesAABBoxHitRay);
+        }
+        if (dynamicTree.tree) {
+            dynamicTree.tree->rayQuery(ray, bodiesAABBoxHitRay);
+        }
+    }
+
+}
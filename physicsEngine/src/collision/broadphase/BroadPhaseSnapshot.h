@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <UrchinCommon.h>
+
+#include "body/model/AbstractBody.h"
+#include "utils/math/PhysicsTransform.h"
+
+namespace urchin {
+
+    struct SnapshotBody {
+        std::shared_ptr<AbstractBody> body;
+        PhysicsTransform transform; //transform of the body at the snapshot time
+    };
+
+    /**
+    * Immutable copy of the broad phase at the end of a physics step. Queries can be executed from any thread without blocking the physics thread.
+    * A tree unchanged since the previous snapshot is shared with it instead of being copied again.
+    */
+    class BroadPhaseSnapshot {
+        public:
+            BroadPhaseSnapshot();
+
+            AABBTreeSnapshot<SnapshotBody>* prepareStaticTree(uint64_t, const BroadPhaseSnapshot*);
+            AABBTreeSnapshot<SnapshotBody>* prepareDynamicTree(uint64_t, const BroadPhaseSnapshot*);
+            void clear();
+
+            void aabboxQuery(const AABBox<float>&, std::vector<const SnapshotBody*>&) const;
+            void rayQuery(const Ray<float>&, std::vector<const SnapshotBody*>&) const;
+
+        private:
+            struct SharedTree {
+                std::shared_ptr<AABBTreeSnapshot<SnapshotBody>> tree; //shared by the successive snapshots while the tree version does not change
+                uint64_t version;
+            };
+
+            static AABBTreeSnapshot<SnapshotBody>* prepareTree(SharedTree&, uint64_t, const SharedTree*);
+            static void clearTree(SharedTree&);
+
+            SharedTree staticTree;
+            SharedTree dynamicTree;
+    };
+
+}
@@ -7,38 +7,35 @@ namespace urchin {
     void VectorPairContainer::addOverlappingPair(std::shared_ptr<AbstractBody> body1, std::shared_ptr<AbstractBody> body2) {
         uint_fast64_t bodiesId = OverlappingPair::computeBodiesId(*body1, *body2);
 
-        bool found = false;
-        for (const auto& overlappingPair : overlappingPairs) {
-            if (overlappingPair->getBodiesId() == bodiesId) {
-                found = true;
-                break;
-            }
-        }
-
-        if (!found) { //pair doesn't exist: we create it
+        auto [itPairIndex, inserted] = pairsIndex.try_emplace(bodiesId, overlappingPairs.size());
+        if (inserted) { //pair doesn't exist: we create it
+            bodiesPairsId[body1.get()].push_back(bodiesId);
+            bodiesPairsId[body2.get()].push_back(bodiesId);
             overlappingPairs.push_back(std::make_unique<OverlappingPair>(std::move(body1), std::move(body2), bodiesId));
         }
     }
 
     void VectorPairContainer::removeOverlappingPair(AbstractBody& body1, AbstractBody& body2) {
         uint_fast64_t bodiesId = OverlappingPair::computeBodiesId(body1, body2);
-        for (auto it = overlappingPairs.begin(); it != overlappingPairs.end(); ++it) {
-            if ((*it)->getBodiesId() == bodiesId) {
-                VectorUtil::erase(overlappingPairs, it);
-                break;
-            }
+        if (pairsIndex.contains(bodiesId)) {
+            removeBodyPairId(body1, bodiesId);
+            removeBodyPairId(body2, bodiesId);
+            erasePair(bodiesId);
         }
     }
 
     void VectorPairContainer::removeOverlappingPairs(AbstractBody& body) {
-        auto it = overlappingPairs.begin();
-        while (it != overlappingPairs.end()) {
-            const auto& pair = *it;
-            if (&pair->getBody1() == &body || &pair->getBody2() == &body) {
-                it = overlappingPairs.erase(it);
-            } else {
-                ++it;
-            }
+        auto itBodyPairsId = bodiesPairsId.find(&body);
+        if (itBodyPairsId == bodiesPairsId.end()) {
+            return;
+        }
+
+        std::vector<uint_fast64_t> bodyPairsId = std::move(itBodyPairsId->second);
+        bodiesPairsId.erase(itBodyPairsId);
+        for (uint_fast64_t bodiesId : bodyPairsId) {
+            const OverlappingPair& overlappingPair = *overlappingPairs[pairsIndex.at(bodiesId)];
+            removeBodyPairId(&overlappingPair.getBody1() == &body ? overlappingPair.getBody2() : overlappingPair.getBody1(), bodiesId);
+            erasePair(bodiesId);
         }
     }
 
@@ -49,4 +46,42 @@ namespace urchin {
     void VectorPairContainer::retrieveCopyOverlappingPairs(std::vector<OverlappingPair>& ) const {
         throw std::runtime_error("Not implemented: use 'getOverlappingPairs' method");
     }
+
+    /**
+     * @param overlappingBodies [out] Bodies paired with the body
+     */
+    void VectorPairContainer::retrieveOverlappingBodies(const AbstractBody& body, std::vector<AbstractBody*>& overlappingBodies) const {
+        auto itBodyPairsId = bodiesPairsId.find(&body);
+        if (itBodyPairsId != bodiesPairsId.end()) {
+            for (uint_fast64_t bodiesId : itBodyPairsId->second) {
+                const OverlappingPair& overlappingPair = *overlappingPairs[pairsIndex.at(bodiesId)];
+                overlappingBodies.push_back(&overlappingPair.getBody1() == &body ? &overlappingPair.getBody2() : &overlappingPair.getBody1());
+            }
+        }
+    }
+
+    /**
+     * Remove the pair from the vector and the pairs index. Bodies pairs id must be updated by the caller.
+     */
+    void VectorPairContainer::erasePair(uint_fast64_t bodiesId) {
+        auto itPairIndex = pairsIndex.find(bodiesId);
+        std::size_t pairIndex = itPairIndex->second;
+        pairsIndex.erase(itPairIndex);
+
+        if (pairIndex != overlappingPairs.size() - 1) {
+            pairsIndex[overlappingPairs.back()->getBodiesId()] = pairIndex; //last pair is moved at the index of the removed pair
+        }
+        VectorUtil::erase(overlappingPairs, pairIndex);
+    }
+
+    void VectorPairContainer::removeBodyPairId(const AbstractBody& body, uint_fast64_t bodiesId) {
+        auto itBodyPairsId = bodiesPairsId.find(&body);
+        if (itBodyPairsId != bodiesPairsId.end()) {
+            std::vector<uint_fast64_t>& bodyPairsId = itBodyPairsId->second;
+            VectorUtil::erase(bodyPairsId, std::ranges::find(bodyPairsId, bodiesId));
+            if (bodyPairsId.empty()) {
+                bodiesPairsId.erase(itBodyPairsId);
+            }
+        }
+    }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
 
 #include "collision/OverlappingPair.h"
 #include "collision/broadphase/PairContainer.h"
@@ -9,8 +10,8 @@ namespace urchin {
 
     /**
     * Overlapping pair manager using a std::vector. Vectors have very high performance
-    * to looping over. Add and remove operations have also good performance when number
-    * of elements are limited (< 1000) due to little cache miss.
+    * to looping over. The pairs are indexed by bodies id and by body so that add and
+    * remove operations only visit the pairs of the impacted bodies.
     */
     class VectorPairContainer : public PairContainer {
         public:
@@ -22,9 +23,17 @@ namespace urchin {
 
             const std::vector<std::unique_ptr<OverlappingPair>>& getOverlappingPairs() const override;
             void retrieveCopyOverlappingPairs(std::vector<OverlappingPair>&) const override;
+            void retrieveOverlappingBodies(const AbstractBody&, std::vector<AbstractBody*>&) const;
 
         protected:
             std::vector<std::unique_ptr<OverlappingPair>> overlappingPairs;
+
+        private:
+            void erasePair(uint_fast64_t);
+            void removeBodyPairId(const AbstractBody&, uint_fast64_t);
+
+            std::unordered_map<uint_fast64_t, std::size_t> pairsIndex; //bodies id to index in overlapping pairs
+            std::unordered_map<const AbstractBody*, std::vector<uint_fast64_t>> bodiesPairsId;
     };
 
 }
@@ -16,6 +16,10 @@ namespace urchin {
         tree.removeBody(body);
     }
 
+    void AABBTreeAlgorithm::updateBodyState(const AbstractBody& body) {
+        tree.updateBodyState(body);
+    }
+
     void AABBTreeAlgorithm::updateBodies() {
         tree.updateBodies();
     }
@@ -31,6 +35,13 @@ namespace urchin {
         tree.rayQuery(ray, bodiesAABBoxHitRay);
     }
 
+    /**
+     * @param bodiesAABBoxHitRays [out] Bodies AABBox hit by each ray
+     */
+    void AABBTreeAlgorithm::rayTests(std::span<const Ray<float>> rays, std::vector<std::vector<std::shared_ptr<AbstractBody>>>& bodiesAABBoxHitRays) const {
+        tree.rayQueries(rays, bodiesAABBoxHitRays);
+    }
+
     /**
      * @param bodiesAABBoxHitBody [out] Bodies AABBox hit by a moving body
      */
@@ -42,4 +53,8 @@ namespace urchin {
         tree.enlargedRayQuery(ray, bodyBoundingSphereRadius, bodyPtr, bodiesAABBoxHitBody);
     }
 
+    void AABBTreeAlgorithm::copyTo(BroadPhaseSnapshot& snapshot, const BroadPhaseSnapshot* previousSnapshot) const {
+        tree.copyTo(snapshot, previousSnapshot);
+    }
+
 }
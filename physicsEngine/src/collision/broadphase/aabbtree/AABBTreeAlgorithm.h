@@ -15,13 +15,17 @@ namespace urchin {
 
             void addBody(const std::shared_ptr<AbstractBody>&) override;
             void removeBody(const AbstractBody&) override;
+            void updateBodyState(const AbstractBody&) override;
             void updateBodies() override;
 
             const std::vector<std::unique_ptr<OverlappingPair>>& getOverlappingPairs() const override;
 
             void rayTest(const Ray<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const override;
+            void rayTests(std::span<const Ray<float>>, std::vector<std::vector<std::shared_ptr<AbstractBody>>>&) const override;
             void bodyTest(const AbstractBody&, const PhysicsTransform&, const PhysicsTransform&, std::vector<std::shared_ptr<AbstractBody>>&) const override;
 
+            void copyTo(BroadPhaseSnapshot&, const BroadPhaseSnapshot*) const override;
+
         private:
             BodyAABBTree tree;
     };
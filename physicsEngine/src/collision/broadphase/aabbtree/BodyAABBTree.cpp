@@ -1,5 +1,4 @@
 #include <limits>
-#include <ranges>
 
 #include "collision/broadphase/aabbtree/BodyAABBTree.h"
 #include "collision/broadphase/VectorPairContainer.h"
@@ -7,8 +6,11 @@
 namespace urchin {
 
     BodyAABBTree::BodyAABBTree() :
-            AABBTree<std::shared_ptr<AbstractBody>>(ConfigService::instance().getFloatValue("broadPhase.aabbTreeFatMargin")),
+            staticTree(IndexedAABBTree<std::shared_ptr<AbstractBody>>(ConfigService::instance().getFloatValue("broadPhase.aabbTreeFatMargin"))),
+            dynamicTree(IndexedAABBTree<std::shared_ptr<AbstractBody>>(ConfigService::instance().getFloatValue("broadPhase.aabbTreeFatMargin"))),
             defaultPairContainer(VectorPairContainer()),
+            staticTreeVersion(1),
+            dynamicTreeVersion(1),
             inInitializationPhase(true),
             minYBoundary(std::numeric_limits<float>::max()) {
 
@@ -16,57 +18,214 @@ namespace urchin {
 
     void BodyAABBTree::addBody(const std::shared_ptr<AbstractBody>& body) {
         auto nodeData = std::make_unique<BodyAABBNodeData>(body);
-        addObject(std::move(nodeData));
-    }
-
-    void BodyAABBTree::postAddObjectCallback(AABBNode<std::shared_ptr<AbstractBody>>& newNode) {
-        computeOverlappingPairs(newNode);
+        if (isDynamicBody(*body)) {
+            dynamicTree.addObject(std::move(nodeData));
+            computeOverlappingPairs(*body, true);
+            dynamicTreeVersion++;
+        } else {
+            staticTree.addObject(std::move(nodeData));
+            computeOverlappingPairs(*body, false);
+            staticTreeVersion++;
+        }
     }
 
     void BodyAABBTree::removeBody(const AbstractBody& body) {
+        IndexedAABBTree<std::shared_ptr<AbstractBody>>& tree = getTree(body);
+
         auto* bodyPtr = const_cast<AbstractBody*>(&body);
-        auto& nodeData = getNodeData(bodyPtr);
-        removeObject(nodeData);
+        auto& nodeData = static_cast<BodyAABBNodeData&>(tree.getNodeData(bodyPtr));
+        if (!nodeData.isGhostBody()) {
+            wakeUpOverlappingBodies(body);
+        }
+        removeOverlappingPairs(nodeData);
+        tree.removeObject(nodeData);
+        (&tree == &dynamicTree ? dynamicTreeVersion : staticTreeVersion)++;
     }
 
-    void BodyAABBTree::preRemoveObjectCallback(AABBNode<std::shared_ptr<AbstractBody>>& nodeToDelete) {
-        const auto& bodyNodeToDelete = static_cast<BodyAABBNodeData&>(nodeToDelete.getNodeData());
-        removeOverlappingPairs(bodyNodeToDelete);
+    /**
+     * Move the body in the tree corresponding to its active state. A body moved from the static tree to the dynamic tree
+     * computes its overlapping pairs against the static tree because these pairs are not computed for the static bodies.
+     */
+    void BodyAABBTree::updateBodyState(const AbstractBody& body) {
+        auto* bodyPtr = const_cast<AbstractBody*>(&body);
+        bool inDynamicTree = dynamicTree.containsObject(bodyPtr);
+        if (!inDynamicTree && !staticTree.containsObject(bodyPtr)) [[unlikely]] {
+            return; //body not (yet) in the broad phase
+        }
+
+        if (inDynamicTree && !isDynamicBody(body)) {
+            moveBody(body, dynamicTree, staticTree);
+        } else if (!inDynamicTree && isDynamicBody(body)) {
+            moveBody(body, staticTree, dynamicTree);
+            computeOverlappingPairs(body, true);
+        } else if (!inDynamicTree) { //static body manually moved
+            wakeUpOverlappingBodies(body); //sleeping bodies could lose their support (pairs dropped at reinsertion) or be penetrated
+            if (!staticTree.getFatAABBox(bodyPtr).include(staticTree.getNodeData(bodyPtr).retrieveObjectAABBox())) {
+                reinsertBody(body, staticTree);
+                computeOverlappingPairs(body, false);
+            }
+            staticTreeVersion++; //exact AABBox and transform of the snapshot changed even if the body stays in its fat AABBox
+        }
     }
 
     void BodyAABBTree::updateBodies() {
         if (inInitializationPhase) {
             computeWorldBoundary();
+            staticTree.rebuild(); //bodies are mainly added at initialization: a rebuild provides a better tree than the incremental insertions
+            dynamicTree.rebuild();
+            staticTreeVersion++;
+            dynamicTreeVersion++;
             inInitializationPhase = false;
         }
 
-        updateObjects();
+        dynamicBodies.clear();
+        dynamicTree.getAllNodeObjects(dynamicBodies);
+        for (const auto& body : dynamicBodies) {
+            const AABBNodeData<std::shared_ptr<AbstractBody>>& nodeData = dynamicTree.getNodeData(body.get());
+            if (nodeData.isObjectMoving()) [[unlikely]] {
+                controlBoundaries(*body);
+                dynamicTreeVersion++; //body moved during the previous step or moves during the current step
+
+                if (!dynamicTree.getFatAABBox(body.get()).include(nodeData.retrieveObjectAABBox())) {
+                    reinsertBody(*body, dynamicTree);
+                    computeOverlappingPairs(*body, true);
+                }
+            }
+        }
+        dynamicBodies.clear(); //do not keep a reference on the bodies: they could be removed
+    }
+
+    AABBNodeData<std::shared_ptr<AbstractBody>>& BodyAABBTree::getNodeData(void* bodyPtr) const {
+        if (dynamicTree.containsObject(bodyPtr)) {
+            return dynamicTree.getNodeData(bodyPtr);
+        }
+        return staticTree.getNodeData(bodyPtr);
     }
 
-    void BodyAABBTree::preUpdateObjectCallback(AABBNode<std::shared_ptr<AbstractBody>>& nodeToUpdate) {
-        controlBoundaries(nodeToUpdate);
+    bool BodyAABBTree::isInDynamicTree(const AbstractBody& body) const {
+        return dynamicTree.containsObject(const_cast<AbstractBody*>(&body));
     }
 
     const std::vector<std::unique_ptr<OverlappingPair>>& BodyAABBTree::getOverlappingPairs() const {
         return defaultPairContainer.getOverlappingPairs();
     }
 
-    void BodyAABBTree::computeOverlappingPairs(const AABBNode<std::shared_ptr<AbstractBody>>& leafNode) {
-        browseNodes.clear();
-        browseNodes.push_back(getRootNode());
+    /**
+     * @param bodiesAABBoxHit [out] Bodies AABBox hit by the aabbox
+     */
+    void BodyAABBTree::aabboxQuery(const AABBox<float>& aabbox, std::vector<std::shared_ptr<AbstractBody>>& bodiesAABBoxHit) const {
+        dynamicTree.aabboxQuery(aabbox, bodiesAABBoxHit);
+        staticTree.aabboxQuery(aabbox, bodiesAABBoxHit);
+    }
 
-        for (std::size_t i = 0; i < browseNodes.size(); ++i) { //tree traversal: pre-order (iterative)
-            const AABBNode<std::shared_ptr<AbstractBody>>* currentNode = browseNodes[i];
+    /**
+     * @param bodiesAABBoxHitRay [out] Bodies AABBox hit by the ray
+     */
+    void BodyAABBTree::rayQuery(const Ray<float>& ray, std::vector<std::shared_ptr<AbstractBody>>& bodiesAABBoxHitRay) const {
+        dynamicTree.rayQuery(ray, bodiesAABBoxHitRay);
+        staticTree.rayQuery(ray, bodiesAABBoxHitRay);
+    }
 
-            if (&leafNode != currentNode && leafNode.getAABBox().collideWithAABBox(currentNode->getAABBox())) {
-                if (currentNode->isLeaf()) {
-                    createOverlappingPair(static_cast<BodyAABBNodeData&>(leafNode.getNodeData()), static_cast<BodyAABBNodeData&>(currentNode->getNodeData()));
-                } else {
-                    browseNodes.push_back(currentNode->getRightChild());
-                    browseNodes.push_back(currentNode->getLeftChild());
-                }
+    /**
+     * @param bodiesAABBoxHitRays [out] Bodies AABBox hit by each ray
+     */
+    void BodyAABBTree::rayQueries(std::span<const Ray<float>> rays, std::vector<std::vector<std::shared_ptr<AbstractBody>>>& bodiesAABBoxHitRays) const {
+        dynamicTree.rayQueries(rays, bodiesAABBoxHitRays);
+        staticTree.rayQueries(rays, staticBodiesAABBoxHitRays);
+
+        for (std::size_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex) {
+            std::vector<std::shared_ptr<AbstractBody>>& staticBodiesAABBoxHitRay = staticBodiesAABBoxHitRays[rayIndex];
+            bodiesAABBoxHitRays[rayIndex].insert(bodiesAABBoxHitRays[rayIndex].end(), staticBodiesAABBoxHitRay.begin(), staticBodiesAABBoxHitRay.end());
+            staticBodiesAABBoxHitRay.clear(); //do not keep a reference on the bodies: they could be removed
+        }
+    }
+
+    /**
+     * @param bodiesAABBoxHitEnlargedRay [out] Bodies AABBox hit by the enlarged ray
+     */
+    void BodyAABBTree::enlargedRayQuery(const Ray<float>& ray, float enlargeNodeBoxHalfSize, const void* bodyPtrToExclude,
+            std::vector<std::shared_ptr<AbstractBody>>& bodiesAABBoxHitEnlargedRay) const {
+        dynamicTree.enlargedRayQuery(ray, enlargeNodeBoxHalfSize, bodyPtrToExclude, bodiesAABBoxHitEnlargedRay);
+        staticTree.enlargedRayQuery(ray, enlargeNodeBoxHalfSize, bodyPtrToExclude, bodiesAABBoxHitEnlargedRay);
+    }
+
+    /**
+     * Copy the trees into the snapshot with the current transform of the bodies. A tree unchanged since the previous snapshot is shared instead of copied:
+     * the static tree is therefore only copied when a static/sleeping body is added, removed, manually moved or changes its active state.
+     * @param previousSnapshot Last published snapshot (nullable)
+     */
+    void BodyAABBTree::copyTo(BroadPhaseSnapshot& snapshot, const BroadPhaseSnapshot* previousSnapshot) const {
+        auto toSnapshotBody = [](const std::shared_ptr<AbstractBody>& body) {
+            return SnapshotBody{.body = body, .transform = body->getTransform()};
+        };
+        if (AABBTreeSnapshot<SnapshotBody>* staticTreeSnapshot = snapshot.prepareStaticTree(staticTreeVersion, previousSnapshot)) {
+            staticTree.copyTo(*staticTreeSnapshot, toSnapshotBody);
+        }
+        if (AABBTreeSnapshot<SnapshotBody>* dynamicTreeSnapshot = snapshot.prepareDynamicTree(dynamicTreeVersion, previousSnapshot)) {
+            dynamicTree.copyTo(*dynamicTreeSnapshot, toSnapshotBody);
+        }
+    }
+
+    /**
+     * @return True when the body must be in the dynamic tree. Ghost bodies can be moved without being active and are always in the dynamic tree.
+     */
+    bool BodyAABBTree::isDynamicBody(const AbstractBody& body) {
+        return body.getBodyType() == BodyType::GHOST || body.isActive();
+    }
+
+    IndexedAABBTree<std::shared_ptr<AbstractBody>>& BodyAABBTree::getTree(const AbstractBody& body) {
+        return dynamicTree.containsObject(const_cast<AbstractBody*>(&body)) ? dynamicTree : staticTree;
+    }
+
+    /**
+     * Move a body from a tree to another one. The overlapping pairs of the body are kept.
+     */
+    void BodyAABBTree::moveBody(const AbstractBody& body, IndexedAABBTree<std::shared_ptr<AbstractBody>>& fromTree, IndexedAABBTree<std::shared_ptr<AbstractBody>>& toTree) {
+        auto& nodeData = static_cast<BodyAABBNodeData&>(fromTree.getNodeData(const_cast<AbstractBody*>(&body)));
+        std::unique_ptr<AABBNodeData<std::shared_ptr<AbstractBody>>> clonedNodeData = nodeData.clone();
+        for (PairContainer* ownerPairContainer : nodeData.getOwnerPairContainers()) {
+            static_cast<BodyAABBNodeData&>(*clonedNodeData).addOwnerPairContainer(ownerPairContainer);
+        }
+        fromTree.removeObject(nodeData);
+        toTree.addObject(std::move(clonedNodeData));
+        staticTreeVersion++;
+        dynamicTreeVersion++;
+    }
+
+    /**
+     * Re-insert a body in a tree to refresh its fat AABBox. The overlapping pairs of the body are removed.
+     */
+    void BodyAABBTree::reinsertBody(const AbstractBody& body, IndexedAABBTree<std::shared_ptr<AbstractBody>>& tree) {
+        auto& nodeData = static_cast<BodyAABBNodeData&>(tree.getNodeData(const_cast<AbstractBody*>(&body)));
+        removeOverlappingPairs(nodeData);
+
+        std::unique_ptr<AABBNodeData<std::shared_ptr<AbstractBody>>> clonedNodeData = nodeData.clone();
+        tree.removeObject(nodeData);
+        tree.addObject(std::move(clonedNodeData));
+    }
+
+    /**
+     * Compute the overlapping pairs of a body against the dynamic tree and, optionally, against the static tree.
+     * Pairs between two static/sleeping bodies are not computed.
+     */
+    void BodyAABBTree::computeOverlappingPairs(const AbstractBody& body, bool withStaticTree) {
+        auto* bodyPtr = const_cast<AbstractBody*>(&body);
+        IndexedAABBTree<std::shared_ptr<AbstractBody>>& tree = getTree(body);
+        const AABBox<float>& bodyFatAABBox = tree.getFatAABBox(bodyPtr);
+        auto& bodyNodeData = static_cast<BodyAABBNodeData&>(tree.getNodeData(bodyPtr));
+
+        overlappingBodies.clear();
+        dynamicTree.aabboxQuery(bodyFatAABBox, overlappingBodies);
+        if (withStaticTree) {
+            staticTree.aabboxQuery(bodyFatAABBox, overlappingBodies);
+        }
+
+        for (const auto& overlappingBody : overlappingBodies) {
+            if (overlappingBody.get() != bodyPtr) {
+                createOverlappingPair(bodyNodeData, static_cast<BodyAABBNodeData&>(getNodeData(overlappingBody.get())));
             }
         }
+        overlappingBodies.clear();
     }
 
     void BodyAABBTree::createOverlappingPair(BodyAABBNodeData& nodeData1, BodyAABBNodeData& nodeData2) {
@@ -96,6 +255,21 @@ namespace urchin {
         }
     }
 
+    /**
+     * Wake up the sleeping bodies overlapping a removed or manually moved body: this body could support them.
+     * Sleeping bodies keep their overlapping pairs (see moveBody) and therefore the pairs with their supporting bodies.
+     */
+    void BodyAABBTree::wakeUpOverlappingBodies(const AbstractBody& body) {
+        wakeUpBodies.clear();
+        defaultPairContainer.retrieveOverlappingBodies(body, wakeUpBodies);
+        for (AbstractBody* otherBody : wakeUpBodies) {
+            if (!otherBody->isStatic() && !otherBody->isActive()) {
+                otherBody->setIsActive(true);
+            }
+        }
+        wakeUpBodies.clear();
+    }
+
     void BodyAABBTree::removeBodyPairContainerReferences(const AbstractBody& body, PairContainer* bodyPairContainer) const {
         std::vector<OverlappingPair> overlappingPairs;
         bodyPairContainer->retrieveCopyOverlappingPairs(overlappingPairs);
@@ -109,9 +283,13 @@ namespace urchin {
     }
 
     void BodyAABBTree::computeWorldBoundary() {
+        std::vector<std::shared_ptr<AbstractBody>> allBodies;
+        staticTree.getAllNodeObjects(allBodies);
+        dynamicTree.getAllNodeObjects(allBodies);
+
         float maxYBoundary = -std::numeric_limits<float>::max();
-        for (const auto& objNode : std::views::values(objectsNode)) {
-            const AABBox<float>& nodeAABBox = objNode->getAABBox();
+        for (const auto& body : allBodies) {
+            const AABBox<float>& nodeAABBox = getTree(*body).getFatAABBox(body.get());
             minYBoundary = std::min(nodeAABBox.getMin().Y, minYBoundary);
             maxYBoundary = std::max(nodeAABBox.getMax().Y, maxYBoundary);
         }
@@ -120,14 +298,14 @@ namespace urchin {
         minYBoundary -= worldHeight * BOUNDARIES_MARGIN_PERCENTAGE;
     }
 
-    void BodyAABBTree::controlBoundaries(const AABBNode<std::shared_ptr<AbstractBody>>& leafNode) const {
-        AABBox<float> bodyAABBox = leafNode.getNodeData().retrieveObjectAABBox();
+    void BodyAABBTree::controlBoundaries(const AbstractBody& body) const {
+        AABBox<float> bodyAABBox = getNodeData(const_cast<AbstractBody*>(&body)).retrieveObjectAABBox();
 
         if (bodyAABBox.getMax().Y < minYBoundary) {
-            std::shared_ptr<AbstractBody> body = leafNode.getNodeData().getNodeObject();
-            if (!body->isStatic()) {
-                Logger::instance().logWarning("Body " + body->getId() + " is below the limit of " + TypeConverter::toString(minYBoundary) + ": " + StringUtil::toString(body->getTransform().getPosition()));
-                body->setIsActive(false);
+            std::shared_ptr<AbstractBody> bodyPtr = getNodeData(const_cast<AbstractBody*>(&body)).getNodeObject();
+            if (!bodyPtr->isStatic()) {
+                Logger::instance().logWarning("Body " + bodyPtr->getId() + " is below the limit of " + TypeConverter::toString(minYBoundary) + ": " + StringUtil::toString(bodyPtr->getTransform().getPosition()));
+                bodyPtr->setIsActive(false);
             }
         }
     }
@@ -1,43 +1,70 @@
 #pragma once
 
+#include <span>
 #include <UrchinCommon.h>
 
 #include "body/model/AbstractBody.h"
 #include "collision/OverlappingPair.h"
 #include "collision/broadphase/VectorPairContainer.h"
 #include "collision/broadphase/aabbtree/BodyAABBNodeData.h"
+#include "collision/broadphase/BroadPhaseSnapshot.h"
 
 namespace urchin {
 
-    class BodyAABBTree final : public AABBTree<std::shared_ptr<AbstractBody>> {
+    /**
+    * Dual AABBox tree of bodies: a static tree for the static and sleeping bodies and a dynamic tree for the active bodies.
+    * Only the dynamic tree is updated at each step and the overlapping pairs are only computed for the active bodies (see Bullet).
+    */
+    class BodyAABBTree {
         public:
             BodyAABBTree();
-            ~BodyAABBTree() override = default;
 
             void addBody(const std::shared_ptr<AbstractBody>&);
-            void postAddObjectCallback(AABBNode<std::shared_ptr<AbstractBody>>&) override;
-
             void removeBody(const AbstractBody&);
-            void preRemoveObjectCallback(AABBNode<std::shared_ptr<AbstractBody>>&) override;
-
+            void updateBodyState(const AbstractBody&);
             void updateBodies();
-            void preUpdateObjectCallback(AABBNode<std::shared_ptr<AbstractBody>>&) override;
 
+            AABBNodeData<std::shared_ptr<AbstractBody>>& getNodeData(void*) const;
+            bool isInDynamicTree(const AbstractBody&) const;
             const std::vector<std::unique_ptr<OverlappingPair>>& getOverlappingPairs() const;
 
+            void aabboxQuery(const AABBox<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const;
+            void rayQuery(const Ray<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const;
+            void rayQueries(std::span<const Ray<float>>, std::vector<std::vector<std::shared_ptr<AbstractBody>>>&) const;
+            void enlargedRayQuery(const Ray<float>&, float, const void*, std::vector<std::shared_ptr<AbstractBody>>&) const;
+
+            void copyTo(BroadPhaseSnapshot&, const BroadPhaseSnapshot*) const;
+
         private:
-            void computeOverlappingPairs(const AABBNode<std::shared_ptr<AbstractBody>>&);
+            static bool isDynamicBody(const AbstractBody&);
+            IndexedAABBTree<std::shared_ptr<AbstractBody>>& getTree(const AbstractBody&);
+
+            void moveBody(const AbstractBody&, IndexedAABBTree<std::shared_ptr<AbstractBody>>&, IndexedAABBTree<std::shared_ptr<AbstractBody>>&);
+            void reinsertBody(const AbstractBody&, IndexedAABBTree<std::shared_ptr<AbstractBody>>&);
+
+            void computeOverlappingPairs(const AbstractBody&, bool);
             void createOverlappingPair(BodyAABBNodeData&, BodyAABBNodeData&);
             void removeOverlappingPairs(const BodyAABBNodeData&);
+            void wakeUpOverlappingBodies(const AbstractBody&);
             void removeBodyPairContainerReferences(const AbstractBody&, PairContainer*) const;
 
             void computeWorldBoundary();
-            void controlBoundaries(const AABBNode<std::shared_ptr<AbstractBody>>&) const;
+            void controlBoundaries(const AbstractBody&) const;
 
             static constexpr float BOUNDARIES_MARGIN_PERCENTAGE = 0.3f;
 
+            IndexedAABBTree<std::shared_ptr<AbstractBody>> staticTree;
+            IndexedAABBTree<std::shared_ptr<AbstractBody>> dynamicTree;
             VectorPairContainer defaultPairContainer;
 
+            std::vector<std::shared_ptr<AbstractBody>> dynamicBodies;
+            std::vector<std::shared_ptr<AbstractBody>> overlappingBodies;
+            std::vector<AbstractBody*> wakeUpBodies;
+            mutable std::vector<std::vector<std::shared_ptr<AbstractBody>>> staticBodiesAABBoxHitRays;
+
+            uint64_t staticTreeVersion; //incremented on each change of the static tree content: unchanged trees are shared between the snapshots
+            uint64_t dynamicTreeVersion;
+
             bool inInitializationPhase;
             float minYBoundary;
     };
@@ -1,85 +1,310 @@
+#include <atomic>
+#include <bit>
+
 #include "collision/constraintsolver/ConstraintSolver.h"
 
 namespace urchin {
 
-    ConstraintSolver::ConstraintSolver() :
+    ConstraintSolver::ConstraintSolver(WorkerPool& workerPool) :
+            workerPool(workerPool),
+            contactConstraints(solvingBodies),
+            jointConstraints(solvingBodies),
             biasFactor(ConfigService::instance().getFloatValue("constraintSolver.biasFactor")),
             useWarmStarting(ConfigService::instance().getBoolValue("constraintSolver.useWarmStarting")),
             restitutionVelocityThreshold(ConfigService::instance().getFloatValue("constraintSolver.restitutionVelocityThreshold")) {
-        unsigned int constraintSolvingDataPoolSize = ConfigService::instance().getUnsignedIntValue("constraintSolver.constraintSolvingPoolSize");
-        constraintSolvingDataPool = std::make_unique<FixedSizePool<ConstraintSolvingData>>("constraintSolvingPool", sizeof(ConstraintSolvingData), constraintSolvingDataPoolSize);
-    }
 
-    ConstraintSolver::~ConstraintSolver() {
-        for (auto& constraintSolvingData : constraintsSolvingData) {
-            constraintSolvingDataPool->deallocate(constraintSolvingData);
-        }
     }
 
     /**
      * Solve constraints
      * @param dt Delta of time (sec.) between two simulation steps
-     * @param manifoldResults Constraints to solve
+     * @param manifoldResults Contact constraints to solve
+     * @param joints Joint constraints to solve
      */
-    void ConstraintSolver::process(float dt, std::vector<ManifoldResult>& manifoldResults) {
+    void ConstraintSolver::process(float dt, std::vector<ManifoldResult>& manifoldResults, const std::vector<std::shared_ptr<Joint>>& joints) {
         ScopeProfiler sp(Profiler::physics(), "solveConstraint");
 
+        //order contacts and joints by island and contacts by color
+        collectContacts(manifoldResults);
+        collectJoints(joints);
+        groupConstraintsByIsland();
+        colorContacts();
+        buildBatches();
+
         //setup step to solve constraints
-        setupConstraints(manifoldResults, dt);
+        setupConstraints(dt);
 
-        //iterative constraint solver
-        for (unsigned int i = 0; i < CONSTRAINT_SOLVER_ITERATION; ++i) {
-            solveConstraints();
-        }
+        //iterative constraint solver on each island
+        solveIslandsConstraints();
+        contactConstraints.storeResults();
+        jointConstraints.storeResults();
+        solvingBodies.storeResults();
     }
 
-    void ConstraintSolver::setupConstraints(std::vector<ManifoldResult>& manifoldResults, float dt) { //See http://en.wikipedia.org/wiki/Collision_response for formulas
+    /**
+     * @return Number of contact constraints solved by the last process
+     */
+    std::size_t ConstraintSolver::getConstraintsCount() const {
+        return solvingContacts.size();
+    }
 
-        //clear constraints solving
-        for (auto& constraintSolvingData : constraintsSolvingData) {
-            constraintSolvingDataPool->deallocate(constraintSolvingData);
-        }
-        constraintsSolvingData.clear();
+    /**
+     * @return Number of joint rows (one by constrained degree of freedom) solved by the last process
+     */
+    std::size_t ConstraintSolver::getJointRowsCount() const {
+        return jointConstraints.getRowsCount();
+    }
 
-        //setup constraints solving
+    /**
+     * @return Number of islands of bodies solved independently by the last process
+     */
+    std::size_t ConstraintSolver::getIslandsCount() const {
+        return constraintsIslands.size();
+    }
+
+    void ConstraintSolver::collectContacts(std::vector<ManifoldResult>& manifoldResults) {
+        solvingContacts.clear();
         for (auto& manifoldResult : manifoldResults) {
             for (unsigned int j = 0; j < manifoldResult.getNumContactPoints(); ++j) {
                 ManifoldContactPoint& contact = manifoldResult.getManifoldContactPoint(j);
                 if (contact.getDepth() > 0.0f && !contact.isPredictive()) {
                     continue;
                 }
+                solvingContacts.push_back({.manifoldResult = &manifoldResult, .contactPoint = &contact, .islandId = 0, .color = 0});
+            }
+        }
+    }
 
-                RigidBody& body1 = RigidBody::upCast(manifoldResult.getBody1());
-                RigidBody& body2 = RigidBody::upCast(manifoldResult.getBody2());
+    /**
+     * Collect the joints having at least one active body: the joints between sleeping bodies are not solved
+     */
+    void ConstraintSolver::collectJoints(const std::vector<std::shared_ptr<Joint>>& joints) {
+        solvingJoints.clear();
+        for (const auto& joint : joints) {
+            const RigidBody& body1 = joint->getBody1();
+            const RigidBody& body2 = joint->getBody2();
+            if ((!body1.isStatic() && body1.isActive()) || (!body2.isStatic() && body2.isActive())) {
+                solvingJoints.push_back({.joint = joint.get(), .islandId = 0});
+            }
+        }
+    }
 
-                CommonSolvingData commonSolvingData = fillCommonSolvingData(manifoldResult, contact);
-                ImpulseSolvingData impulseSolvingData = fillImpulseSolvingData(commonSolvingData, dt);
+    /**
+     * Group the contacts and the joints by island of bodies. Islands never share a moving body: they can be solved independently.
+     * Joints keep their original order inside an island. Contacts are reordered by color inside an island afterwards (see colorContacts()).
+     */
+    void ConstraintSolver::groupConstraintsByIsland() {
+        //only the bodies in contact or linked by a joint are in the islands: the step cost does not depend on the number of sleeping bodies
+        islandElements.clear();
+        islandContainer.reset();
+        for (const SolvingContact& solvingContact : solvingContacts) {
+            addIslandElement(solvingContact.manifoldResult->getBody1());
+            addIslandElement(solvingContact.manifoldResult->getBody2());
+        }
+        for (const SolvingJoint& solvingJoint : solvingJoints) {
+            addIslandElement(solvingJoint.joint->getBody1());
+            addIslandElement(solvingJoint.joint->getBody2());
+        }
+
+        for (const SolvingContact& solvingContact : solvingContacts) {
+            const AbstractBody& body1 = solvingContact.manifoldResult->getBody1();
+            const AbstractBody& body2 = solvingContact.manifoldResult->getBody2();
+            if (!body1.isStatic() && !body2.isStatic()) {
+                islandContainer.mergeIsland(body1, body2);
+            }
+        }
+        for (const SolvingJoint& solvingJoint : solvingJoints) {
+            const AbstractBody& body1 = solvingJoint.joint->getBody1();
+            const AbstractBody& body2 = solvingJoint.joint->getBody2();
+            if (!body1.isStatic() && !body2.isStatic()) {
+                islandContainer.mergeIsland(body1, body2);
+            }
+        }
+
+        for (SolvingContact& solvingContact : solvingContacts) {
+            const AbstractBody& body1 = solvingContact.manifoldResult->getBody1();
+            const AbstractBody& body2 = solvingContact.manifoldResult->getBody2();
+            solvingContact.islandId = std::numeric_limits<unsigned int>::max(); //contact between static bodies
+            if (!body1.isStatic()) {
+                solvingContact.islandId = islandContainer.retrieveIslandId(body1);
+            } else if (!body2.isStatic()) {
+                solvingContact.islandId = islandContainer.retrieveIslandId(body2);
+            }
+        }
+        for (SolvingJoint& solvingJoint : solvingJoints) {
+            const AbstractBody& body1 = solvingJoint.joint->getBody1();
+            solvingJoint.islandId = islandContainer.retrieveIslandId(body1.isStatic() ? static_cast<const AbstractBody&>(solvingJoint.joint->getBody2()) : body1);
+        }
+        std::ranges::stable_sort(solvingContacts, [](const SolvingContact& lhs, const SolvingContact& rhs){ return lhs.islandId < rhs.islandId; });
+        std::ranges::stable_sort(solvingJoints, [](const SolvingJoint& lhs, const SolvingJoint& rhs){ return lhs.islandId < rhs.islandId; });
+    }
+
+    void ConstraintSolver::addIslandElement(AbstractBody& body) {
+        if (!body.isStatic() && !islandContainer.containsElement(body)) {
+            islandContainer.addElement(body);
+            islandElements.push_back(&body);
+        }
+    }
 
-                void* memPtr = constraintSolvingDataPool->allocate(sizeof(ConstraintSolvingData));
-                auto* constraintSolving = new(memPtr) ConstraintSolvingData(body1, body2, contact, commonSolvingData, impulseSolvingData);
+    /**
+     * Greedy graph coloring of the contacts: two contacts of the same color never share a moving body and can be solved in the same SIMD lane.
+     * Static bodies are not updated by the solver: they do not constrain the colors.
+     */
+    void ConstraintSolver::colorContacts() {
+        bodiesColorsMask.assign(islandElements.size(), 0);
+
+        for (SolvingContact& solvingContact : solvingContacts) {
+            const AbstractBody& body1 = solvingContact.manifoldResult->getBody1();
+            const AbstractBody& body2 = solvingContact.manifoldResult->getBody2();
+            uint64_t usedColorsMask = 0;
+            if (!body1.isStatic()) {
+                usedColorsMask |= bodiesColorsMask[body1.getIslandElementId()];
+            }
+            if (!body2.isStatic()) {
+                usedColorsMask |= bodiesColorsMask[body2.getIslandElementId()];
+            }
 
-                if (useWarmStarting) {
-                    const Vector3<float> normalImpulseVector = contact.getAccumulatedSolvingData().accNormalImpulse * commonSolvingData.contactNormal;
-                    applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, normalImpulseVector);
+            solvingContact.color = (unsigned int)std::countr_one(usedColorsMask); //MAX_COLORS when all colors are used
+            if (solvingContact.color < MAX_COLORS) {
+                uint64_t colorMask = 1ull << solvingContact.color;
+                if (!body1.isStatic()) {
+                    bodiesColorsMask[body1.getIslandElementId()] |= colorMask;
+                }
+                if (!body2.isStatic()) {
+                    bodiesColorsMask[body2.getIslandElementId()] |= colorMask;
+                }
+            }
+        }
 
-                    const Vector3<float> tangentImpulseVector = contact.getAccumulatedSolvingData().accTangentImpulse * commonSolvingData.contactTangent;
-                    applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, tangentImpulseVector);
+        std::ranges::stable_sort(solvingContacts, [](const SolvingContact& lhs, const SolvingContact& rhs){
+            return lhs.islandId < rhs.islandId || (lhs.islandId == rhs.islandId && lhs.color < rhs.color);
+        });
+    }
+
+    /**
+     * Build a batch of contacts for each color of each island and assign the joints to their island. Islands are sorted from the biggest to the smallest.
+     */
+    void ConstraintSolver::buildBatches() {
+        constraintsBatches.clear();
+        constraintsIslands.clear();
+        std::size_t contactIndex = 0;
+        std::size_t jointIndex = 0;
+        while (contactIndex < solvingContacts.size() || jointIndex < solvingJoints.size()) {
+            unsigned int islandId = std::min(contactIndex < solvingContacts.size() ? solvingContacts[contactIndex].islandId : std::numeric_limits<unsigned int>::max(),
+                                             jointIndex < solvingJoints.size() ? solvingJoints[jointIndex].islandId : std::numeric_limits<unsigned int>::max());
+            ConstraintsIsland constraintsIsland{.beginBatchIndex = constraintsBatches.size(), .endBatchIndex = constraintsBatches.size(), .beginJointIndex = jointIndex,
+                    .endJointIndex = jointIndex, .constraintsCount = 0};
+
+            for (std::size_t beginContactIndex = contactIndex; contactIndex < solvingContacts.size() && solvingContacts[contactIndex].islandId == islandId; ++contactIndex) {
+                if (contactIndex == beginContactIndex || solvingContacts[contactIndex].color != solvingContacts[contactIndex - 1].color) {
+                    constraintsBatches.push_back({.beginContactIndex = contactIndex, .endContactIndex = contactIndex + 1, .independentContacts = solvingContacts[contactIndex].color < MAX_COLORS});
+                } else {
+                    constraintsBatches.back().endContactIndex = contactIndex + 1;
                 }
+                constraintsIsland.constraintsCount++;
+            }
+            for (; jointIndex < solvingJoints.size() && solvingJoints[jointIndex].islandId == islandId; ++jointIndex) {
+                constraintsIsland.constraintsCount++;
+            }
+
+            constraintsIsland.endBatchIndex = constraintsBatches.size();
+            constraintsIsland.endJointIndex = jointIndex;
+            constraintsIslands.push_back(constraintsIsland);
+        }
+        std::ranges::stable_sort(constraintsIslands, [](const ConstraintsIsland& lhs, const ConstraintsIsland& rhs){
+            return lhs.constraintsCount > rhs.constraintsCount;
+        });
+    }
+
+    void ConstraintSolver::setupConstraints(float dt) { //See http://en.wikipedia.org/wiki/Collision_response for formulas
+        solvingBodies.clear();
+        contactConstraints.clear();
+        jointConstraints.clear();
+        movingBodiesIndex.assign(islandElements.size(), NO_BODY_INDEX);
 
-                constraintsSolvingData.push_back(constraintSolving);
+        for (const SolvingContact& solvingContact : solvingContacts) {
+            CommonSolvingData commonSolvingData = fillCommonSolvingData(*solvingContact.manifoldResult, *solvingContact.contactPoint);
+            ImpulseSolvingData impulseSolvingData = fillImpulseSolvingData(commonSolvingData, dt);
+
+            uint32_t body1Index = retrieveBodyIndex(RigidBody::upCast(solvingContact.manifoldResult->getBody1()));
+            uint32_t body2Index = retrieveBodyIndex(RigidBody::upCast(solvingContact.manifoldResult->getBody2()));
+            contactConstraints.addContact(body1Index, body2Index, *solvingContact.contactPoint, commonSolvingData, impulseSolvingData);
+        }
+
+        float invDeltaTime = dt > 0.0f ? 1.0f / dt : 0.0f;
+        jointsBeginRowIndex.clear();
+        for (const SolvingJoint& solvingJoint : solvingJoints) {
+            jointsBeginRowIndex.push_back(jointConstraints.getRowsCount());
+            uint32_t body1Index = retrieveBodyIndex(solvingJoint.joint->getBody1());
+            uint32_t body2Index = retrieveBodyIndex(solvingJoint.joint->getBody2());
+            jointConstraints.addJoint(body1Index, body2Index, *solvingJoint.joint, biasFactor * invDeltaTime);
+        }
+        jointsBeginRowIndex.push_back(jointConstraints.getRowsCount());
+
+        if (useWarmStarting) {
+            for (std::size_t contactIndex = 0; contactIndex < contactConstraints.getContactsCount(); ++contactIndex) {
+                contactConstraints.applyWarmStarting(contactIndex);
+            }
+            for (std::size_t rowIndex = 0; rowIndex < jointConstraints.getRowsCount(); ++rowIndex) {
+                jointConstraints.applyWarmStarting(rowIndex);
             }
         }
     }
 
-    void ConstraintSolver::solveConstraints() const {
-        //solve tangent constraint first because non-penetration is more important than friction
-        for (auto& constraintSolvingData : constraintsSolvingData) {
-            solveTangentConstraint(*constraintSolvingData);
+    /**
+     * @return Index of the body in the solving bodies. Each contact and joint has its own copy of the static body to avoid sharing data between islands.
+     */
+    uint32_t ConstraintSolver::retrieveBodyIndex(RigidBody& body) {
+        if (body.isStatic()) {
+            return solvingBodies.addStaticBody(body);
         }
 
-        //solve normal constraint
-        for (auto& constraintSolvingData : constraintsSolvingData) {
-            solveNormalConstraint(*constraintSolvingData);
+        uint32_t& bodyIndex = movingBodiesIndex[body.getIslandElementId()];
+        if (bodyIndex == NO_BODY_INDEX) {
+            bodyIndex = solvingBodies.addMovingBody(body);
+        }
+        return bodyIndex;
+    }
+
+    /**
+     * Solve the islands in parallel. Each worker picks the next island to solve: the biggest islands are solved first to balance the work between workers.
+     */
+    void ConstraintSolver::solveIslandsConstraints() {
+        if (solvingContacts.size() + solvingJoints.size() < MIN_CONSTRAINTS_PARALLEL_SOLVING || constraintsIslands.size() == 1) {
+            for (const ConstraintsIsland& constraintsIsland : constraintsIslands) {
+                solveConstraints(constraintsIsland);
+            }
+            return;
+        }
+
+        std::atomic<std::size_t> nextIslandIndex = 0;
+        std::size_t workersCount = std::min((std::size_t)workerPool.getWorkersCount(), constraintsIslands.size());
+        workerPool.parallelFor(workersCount, 1, [&](unsigned int, std::size_t, std::size_t) {
+            for (std::size_t islandIndex = nextIslandIndex++; islandIndex < constraintsIslands.size(); islandIndex = nextIslandIndex++) {
+                solveConstraints(constraintsIslands[islandIndex]);
+            }
+        });
+    }
+
+    void ConstraintSolver::solveConstraints(const ConstraintsIsland& constraintsIsland) {
+        std::size_t beginJointRowIndex = jointsBeginRowIndex[constraintsIsland.beginJointIndex];
+        std::size_t endJointRowIndex = jointsBeginRowIndex[constraintsIsland.endJointIndex];
+
+        for (unsigned int i = 0; i < CONSTRAINT_SOLVER_ITERATION; ++i) {
+            //solve joint constraints first: contacts are solved last because non-penetration is the most important
+            jointConstraints.solveConstraints(beginJointRowIndex, endJointRowIndex);
+
+            //solve tangent constraint (friction) first because non-penetration is more important than friction
+            for (std::size_t batchIndex = constraintsIsland.beginBatchIndex; batchIndex < constraintsIsland.endBatchIndex; ++batchIndex) {
+                const ConstraintsBatch& batch = constraintsBatches[batchIndex];
+                contactConstraints.solveTangentConstraints(batch.beginContactIndex, batch.endContactIndex, batch.independentContacts);
+            }
+
+            //solve normal constraint (non-penetration)
+            for (std::size_t batchIndex = constraintsIsland.beginBatchIndex; batchIndex < constraintsIsland.endBatchIndex; ++batchIndex) {
+                const ConstraintsBatch& batch = constraintsBatches[batchIndex];
+                contactConstraints.solveNormalConstraints(batch.beginContactIndex, batch.endContactIndex, batch.independentContacts);
+            }
         }
     }
 
@@ -95,6 +320,7 @@ namespace urchin {
         commonSolvingData.r2 = body2.getTransform().getPosition().vector(contact.getPointOnObject2());
 
         commonSolvingData.depth = contact.getDepth();
+        commonSolvingData.speculativeContact = manifoldResult.isSpeculative();
         commonSolvingData.contactNormal = contact.getNormalFromObject2();
         commonSolvingData.contactTangent = computeTangent(commonSolvingData, contact.getNormalFromObject2());
 
@@ -136,62 +362,15 @@ namespace urchin {
         if (normalRelativeVelocity > restitutionVelocityThreshold) {
             restitutionBias = -restitution * normalRelativeVelocity;
         }
-        impulseSolvingData.bias = std::min(depthBias, restitutionBias);
+        if (commonData.speculativeContact && commonData.depth > 0.0f && restitutionBias == 0.0f) { //speculative contact without bounce: the bodies can move of the full distance separating them during the step
+            impulseSolvingData.bias = invDeltaTime * commonData.depth;
+        } else {
+            impulseSolvingData.bias = std::min(depthBias, restitutionBias);
+        }
 
         return impulseSolvingData;
     }
 
-    /**
-     * Solve normal constraint. Normal constraint is related to non-penetration
-     */
-    void ConstraintSolver::solveNormalConstraint(const ConstraintSolvingData& constraintSolvingData) const {
-        const CommonSolvingData& commonSolvingData = constraintSolvingData.getCommonData();
-        const ImpulseSolvingData& impulseSolvingData = constraintSolvingData.getImpulseData();
-        AccumulatedSolvingData& accumulatedSolvingData = constraintSolvingData.getAccumulatedData();
-
-        float normalRelativeVelocity = computeRelativeVelocity(commonSolvingData).dotProduct(commonSolvingData.contactNormal);
-
-        float normalImpulseNumerator = (-normalRelativeVelocity) + impulseSolvingData.bias;
-        float normalImpulse = normalImpulseNumerator / impulseSolvingData.normalImpulseDenominator;
-
-        float oldAccNormalImpulse = accumulatedSolvingData.accNormalImpulse;
-        accumulatedSolvingData.accNormalImpulse = std::min(oldAccNormalImpulse + normalImpulse, 0.0f);
-        normalImpulse = accumulatedSolvingData.accNormalImpulse - oldAccNormalImpulse;
-
-        const Vector3<float> normalImpulseVector = normalImpulse * commonSolvingData.contactNormal;
-        applyImpulse(constraintSolvingData.getBody1(), constraintSolvingData.getBody2(), commonSolvingData, normalImpulseVector);
-    }
-
-    /**
-     * Solve tangent constraint. Tangent constraint is related to friction
-     */
-    void ConstraintSolver::solveTangentConstraint(const ConstraintSolvingData& constraintSolvingData) const {
-        const CommonSolvingData& commonSolvingData = constraintSolvingData.getCommonData();
-        const ImpulseSolvingData& impulseSolvingData = constraintSolvingData.getImpulseData();
-        AccumulatedSolvingData& accumulatedSolvingData = constraintSolvingData.getAccumulatedData();
-
-        float tangentRelativeVelocity = computeRelativeVelocity(commonSolvingData).dotProduct(commonSolvingData.contactTangent);
-
-        float tangentImpulseNumerator = -tangentRelativeVelocity;
-        float tangentImpulse = tangentImpulseNumerator / impulseSolvingData.tangentImpulseDenominator;
-        float maxFriction = -(impulseSolvingData.friction * accumulatedSolvingData.accNormalImpulse);
-
-        float oldAccTangentImpulse = accumulatedSolvingData.accTangentImpulse;
-        accumulatedSolvingData.accTangentImpulse = std::clamp(oldAccTangentImpulse + tangentImpulse, -maxFriction, maxFriction);
-        tangentImpulse = accumulatedSolvingData.accTangentImpulse - oldAccTangentImpulse;
-
-        const Vector3<float> tangentImpulseVector = tangentImpulse * commonSolvingData.contactTangent;
-        applyImpulse(constraintSolvingData.getBody1(), constraintSolvingData.getBody2(), commonSolvingData, tangentImpulseVector);
-    }
-
-    void ConstraintSolver::applyImpulse(RigidBody& body1, RigidBody& body2, const CommonSolvingData& commonData, const Vector3<float>& impulseVector) const {
-        body1.setVelocity(body1.getLinearVelocity() - (impulseVector * body1.getInvMass() * body1.getLinearFactor()),
-                          body1.getAngularVelocity() - (commonData.invInertia1 * commonData.r1.crossProduct(impulseVector * body1.getLinearFactor()) * body1.getAngularFactor()));
-
-        body2.setVelocity(body2.getLinearVelocity() + (impulseVector * body2.getInvMass() * body2.getLinearFactor()),
-                          body2.getAngularVelocity() + (commonData.invInertia2 * commonData.r2.crossProduct(impulseVector * body2.getLinearFactor()) * body2.getAngularFactor()));
-    }
-
     /**
      * @return Relative velocity at the contact point
      */
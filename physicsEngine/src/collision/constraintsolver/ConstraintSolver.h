@@ -3,42 +3,91 @@
 #include <vector>
 #include <UrchinCommon.h>
 
-#include "collision/constraintsolver/ConstraintSolvingData.h"
+#include "collision/constraintsolver/ContactConstraints.h"
+#include "collision/constraintsolver/JointConstraints.h"
+#include "collision/constraintsolver/SolvingBodies.h"
 #include "collision/constraintsolver/solvingdata/CommonSolvingData.h"
 #include "collision/constraintsolver/solvingdata/ImpulseSolvingData.h"
 #include "collision/ManifoldResult.h"
-#include "utils/pool/FixedSizePool.h"
+#include "collision/bodystate/IslandContainer.h"
 #include "body/model/RigidBody.h"
+#include "joint/model/Joint.h"
 
 namespace urchin {
 
     class ConstraintSolver {
         public:
-            ConstraintSolver();
-            ~ConstraintSolver();
+            explicit ConstraintSolver(WorkerPool&);
 
-            void process(float, std::vector<ManifoldResult>&);
+            void process(float, std::vector<ManifoldResult>&, const std::vector<std::shared_ptr<Joint>>&);
+
+            std::size_t getConstraintsCount() const;
+            std::size_t getJointRowsCount() const;
+            std::size_t getIslandsCount() const;
 
         private:
-            void setupConstraints(std::vector<ManifoldResult>&, float);
-            void solveConstraints() const;
+            struct SolvingContact {
+                ManifoldResult* manifoldResult;
+                ManifoldContactPoint* contactPoint;
+                unsigned int islandId;
+                unsigned int color;
+            };
+            struct SolvingJoint {
+                Joint* joint;
+                unsigned int islandId;
+            };
+            struct ConstraintsBatch { //contacts without common moving body when independentContacts is true
+                std::size_t beginContactIndex;
+                std::size_t endContactIndex;
+                bool independentContacts;
+            };
+            struct ConstraintsIsland {
+                std::size_t beginBatchIndex;
+                std::size_t endBatchIndex;
+                std::size_t beginJointIndex;
+                std::size_t endJointIndex;
+                std::size_t constraintsCount;
+            };
+
+            void collectContacts(std::vector<ManifoldResult>&);
+            void collectJoints(const std::vector<std::shared_ptr<Joint>>&);
+            void groupConstraintsByIsland();
+            void addIslandElement(AbstractBody&);
+            void colorContacts();
+            void buildBatches();
+            void setupConstraints(float);
+            uint32_t retrieveBodyIndex(RigidBody&);
+            void solveIslandsConstraints();
+            void solveConstraints(const ConstraintsIsland&);
 
             CommonSolvingData fillCommonSolvingData(const ManifoldResult&, const ManifoldContactPoint&) const;
             ImpulseSolvingData fillImpulseSolvingData(const CommonSolvingData&, float) const;
 
-            void solveNormalConstraint(const ConstraintSolvingData&) const;
-            void solveTangentConstraint(const ConstraintSolvingData&) const;
-
-            void applyImpulse(RigidBody&, RigidBody&, const CommonSolvingData&, const Vector3<float>&) const;
             Vector3<float> computeRelativeVelocity(const CommonSolvingData&) const;
             Vector3<float> computeTangent(const CommonSolvingData&, const Vector3<float>&) const;
 
             void logCommonData(std::string_view, const CommonSolvingData&) const;
 
-            std::vector<ConstraintSolvingData*> constraintsSolvingData;
-            std::unique_ptr<FixedSizePool<ConstraintSolvingData>> constraintSolvingDataPool;
+            WorkerPool& workerPool;
+
+            std::vector<SolvingContact> solvingContacts;
+            std::vector<SolvingJoint> solvingJoints;
+            SolvingBodies solvingBodies;
+            ContactConstraints contactConstraints;
+            JointConstraints jointConstraints;
+            std::vector<uint32_t> movingBodiesIndex; //index in solving bodies of moving bodies by island element ID
+            std::vector<std::size_t> jointsBeginRowIndex; //index of the first joint row by solving joint index (with an extra end index)
+
+            std::vector<IslandElement*> islandElements;
+            IslandContainer islandContainer;
+            std::vector<uint64_t> bodiesColorsMask;
+            std::vector<ConstraintsBatch> constraintsBatches;
+            std::vector<ConstraintsIsland> constraintsIslands;
 
             static constexpr unsigned int CONSTRAINT_SOLVER_ITERATION = 10;
+            static constexpr unsigned int MAX_COLORS = 64; //colors count of the mask: contacts without available color are grouped in a non-independent batch
+            static constexpr uint32_t NO_BODY_INDEX = std::numeric_limits<uint32_t>::max();
+            static constexpr std::size_t MIN_CONSTRAINTS_PARALLEL_SOLVING = 64;
             const float biasFactor;
             const bool useWarmStarting;
             const float restitutionVelocityThreshold;
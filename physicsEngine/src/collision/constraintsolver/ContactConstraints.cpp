@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <limits>
+
+#include "collision/constraintsolver/ContactConstraints.h"
+
+namespace urchin {
+
+    ContactConstraints::ContactConstraints(SolvingBodies& solvingBodies) :
+            solvingBodies(solvingBodies),
+            linearVelocities(solvingBodies.getLinearVelocities()),
+            angularVelocities(solvingBodies.getAngularVelocities()) {
+
+    }
+
+    void ContactConstraints::DirectionConstraints::clear() {
+        direction.clear();
+        r1CrossDirection.clear();
+        r2CrossDirection.clear();
+        linearImpulse1.clear();
+        angularImpulse1.clear();
+        linearImpulse2.clear();
+        angularImpulse2.clear();
+        impulseDenominator.clear();
+        accumulatedImpulse.clear();
+    }
+
+    /**
+     * @param isBody1Moving False when body 1 is static: impulses have no effect on it
+     * @param isBody2Moving False when body 2 is static: impulses have no effect on it
+     */
+    void ContactConstraints::DirectionConstraints::push_back(const Vector3<float>& direction, const CommonSolvingData& commonData, bool isBody1Moving, bool isBody2Moving,
+            float impulseDenominator, float accumulatedImpulse) {
+        this->direction.push_back(direction);
+        r1CrossDirection.push_back(commonData.r1.crossProduct(direction));
+        r2CrossDirection.push_back(commonData.r2.crossProduct(direction));
+
+        Vector3<float> zero(0.0f, 0.0f, 0.0f);
+        Vector3<float> linearDirection1 = direction * commonData.body1.getLinearFactor();
+        linearImpulse1.push_back(isBody1Moving ? linearDirection1 * commonData.body1.getInvMass() : zero);
+        angularImpulse1.push_back(isBody1Moving ? commonData.invInertia1 * commonData.r1.crossProduct(linearDirection1) * commonData.body1.getAngularFactor() : zero);
+        Vector3<float> linearDirection2 = direction * commonData.body2.getLinearFactor();
+        linearImpulse2.push_back(isBody2Moving ? linearDirection2 * commonData.body2.getInvMass() : zero);
+        angularImpulse2.push_back(isBody2Moving ? commonData.invInertia2 * commonData.r2.crossProduct(linearDirection2) * commonData.body2.getAngularFactor() : zero);
+
+        this->impulseDenominator.push_back(impulseDenominator);
+        this->accumulatedImpulse.push_back(accumulatedImpulse);
+    }
+
+    void ContactConstraints::clear() {
+        bodies1Index.clear();
+        bodies2Index.clear();
+        contactPoints.clear();
+        biases.clear();
+        frictions.clear();
+        normalConstraints.clear();
+        tangentConstraints.clear();
+    }
+
+    void ContactConstraints::addContact(uint32_t body1Index, uint32_t body2Index, ManifoldContactPoint& contactPoint, const CommonSolvingData& commonData,
+            const ImpulseSolvingData& impulseData) {
+        bool isBody1Moving = solvingBodies.isMovingBody(body1Index);
+        bool isBody2Moving = solvingBodies.isMovingBody(body2Index);
+
+        bodies1Index.push_back(body1Index);
+        bodies2Index.push_back(body2Index);
+        contactPoints.push_back(&contactPoint);
+        biases.push_back(impulseData.bias);
+        frictions.push_back(impulseData.friction);
+
+        const AccumulatedSolvingData& accumulatedData = contactPoint.getAccumulatedSolvingData();
+        normalConstraints.push_back(commonData.contactNormal, commonData, isBody1Moving, isBody2Moving, impulseData.normalImpulseDenominator, accumulatedData.accNormalImpulse);
+        tangentConstraints.push_back(commonData.contactTangent, commonData, isBody1Moving, isBody2Moving, impulseData.tangentImpulseDenominator, accumulatedData.accTangentImpulse);
+    }
+
+    /**
+     * Apply previous impulse of the contact which should be similar to the current impulse solution
+     */
+    void ContactConstraints::applyWarmStarting(std::size_t contactIndex) {
+        applyImpulse(normalConstraints, contactIndex, normalConstraints.accumulatedImpulse[contactIndex]);
+        applyImpulse(tangentConstraints, contactIndex, tangentConstraints.accumulatedImpulse[contactIndex]);
+    }
+
+    std::size_t ContactConstraints::getContactsCount() const {
+        return contactPoints.size();
+    }
+
+    /**
+     * Solve tangent constraints (friction) of the contacts
+     * @param independentContacts True when contacts do not share a moving body: they are solved by lanes
+     */
+    void ContactConstraints::solveTangentConstraints(std::size_t beginContactIndex, std::size_t endContactIndex, bool independentContacts) {
+        solveConstraints(tangentConstraints, beginContactIndex, endContactIndex, independentContacts);
+    }
+
+    /**
+     * Solve normal constraints (non-penetration) of the contacts
+     * @param independentContacts True when contacts do not share a moving body: they are solved by lanes
+     */
+    void ContactConstraints::solveNormalConstraints(std::size_t beginContactIndex, std::size_t endContactIndex, bool independentContacts) {
+        solveConstraints(normalConstraints, beginContactIndex, endContactIndex, independentContacts);
+    }
+
+    void ContactConstraints::solveConstraints(DirectionConstraints& constraints, std::size_t beginContactIndex, std::size_t endContactIndex, bool independentContacts) {
+        std::size_t laneSize = independentContacts ? LANES_COUNT : 1;
+        for (std::size_t laneBeginIndex = beginContactIndex; laneBeginIndex < endContactIndex; laneBeginIndex += laneSize) {
+            solveConstraintsLane(constraints, laneBeginIndex, std::min(laneSize, endContactIndex - laneBeginIndex));
+        }
+    }
+
+    void ContactConstraints::solveConstraintsLane(DirectionConstraints& constraints, std::size_t laneBeginIndex, std::size_t contactsCount) {
+        bool isNormalConstraints = &constraints == &normalConstraints;
+
+        //gather contacts and bodies data (unused lanes keep neutral values)
+        Vector3Lanes linearVelocity1;
+        Vector3Lanes angularVelocity1;
+        Vector3Lanes linearVelocity2;
+        Vector3Lanes angularVelocity2;
+        Vector3Lanes direction;
+        Vector3Lanes r1CrossDirection;
+        Vector3Lanes r2CrossDirection;
+        std::array<float, LANES_COUNT> bias{};
+        std::array<float, LANES_COUNT> impulseDenominator;
+        std::array<float, LANES_COUNT> accumulatedImpulse{};
+        std::array<float, LANES_COUNT> minAccumulatedImpulse{};
+        std::array<float, LANES_COUNT> maxAccumulatedImpulse{};
+        impulseDenominator.fill(1.0f);
+        for (std::size_t lane = 0; lane < contactsCount; ++lane) {
+            std::size_t contactIndex = laneBeginIndex + lane;
+            uint32_t body1Index = bodies1Index[contactIndex];
+            uint32_t body2Index = bodies2Index[contactIndex];
+
+            linearVelocity1.X[lane] = linearVelocities.X[body1Index];
+            linearVelocity1.Y[lane] = linearVelocities.Y[body1Index];
+            linearVelocity1.Z[lane] = linearVelocities.Z[body1Index];
+            angularVelocity1.X[lane] = angularVelocities.X[body1Index];
+            angularVelocity1.Y[lane] = angularVelocities.Y[body1Index];
+            angularVelocity1.Z[lane] = angularVelocities.Z[body1Index];
+            linearVelocity2.X[lane] = linearVelocities.X[body2Index];
+            linearVelocity2.Y[lane] = linearVelocities.Y[body2Index];
+            linearVelocity2.Z[lane] = linearVelocities.Z[body2Index];
+            angularVelocity2.X[lane] = angularVelocities.X[body2Index];
+            angularVelocity2.Y[lane] = angularVelocities.Y[body2Index];
+            angularVelocity2.Z[lane] = angularVelocities.Z[body2Index];
+
+            direction.X[lane] = constraints.direction.X[contactIndex];
+            direction.Y[lane] = constraints.direction.Y[contactIndex];
+            direction.Z[lane] = constraints.direction.Z[contactIndex];
+            r1CrossDirection.X[lane] = constraints.r1CrossDirection.X[contactIndex];
+            r1CrossDirection.Y[lane] = constraints.r1CrossDirection.Y[contactIndex];
+            r1CrossDirection.Z[lane] = constraints.r1CrossDirection.Z[contactIndex];
+            r2CrossDirection.X[lane] = constraints.r2CrossDirection.X[contactIndex];
+            r2CrossDirection.Y[lane] = constraints.r2CrossDirection.Y[contactIndex];
+            r2CrossDirection.Z[lane] = constraints.r2CrossDirection.Z[contactIndex];
+
+            impulseDenominator[lane] = constraints.impulseDenominator[contactIndex];
+            accumulatedImpulse[lane] = constraints.accumulatedImpulse[contactIndex];
+            if (isNormalConstraints) {
+                bias[lane] = biases[contactIndex];
+                minAccumulatedImpulse[lane] = -std::numeric_limits<float>::max();
+                maxAccumulatedImpulse[lane] = 0.0f;
+            } else {
+                float maxFriction = -(frictions[contactIndex] * normalConstraints.accumulatedImpulse[contactIndex]);
+                minAccumulatedImpulse[lane] = -maxFriction;
+                maxAccumulatedImpulse[lane] = maxFriction;
+            }
+        }
+
+        //compute impulses
+        std::array<float, LANES_COUNT> impulse;
+        for (std::size_t lane = 0; lane < LANES_COUNT; ++lane) {
+            float velocity1 = linearVelocity1.X[lane] * direction.X[lane] + linearVelocity1.Y[lane] * direction.Y[lane] + linearVelocity1.Z[lane] * direction.Z[lane]
+                    + angularVelocity1.X[lane] * r1CrossDirection.X[lane] + angularVelocity1.Y[lane] * r1CrossDirection.Y[lane] + angularVelocity1.Z[lane] * r1CrossDirection.Z[lane];
+            float velocity2 = linearVelocity2.X[lane] * direction.X[lane] + linearVelocity2.Y[lane] * direction.Y[lane] + linearVelocity2.Z[lane] * direction.Z[lane]
+                    + angularVelocity2.X[lane] * r2CrossDirection.X[lane] + angularVelocity2.Y[lane] * r2CrossDirection.Y[lane] + angularVelocity2.Z[lane] * r2CrossDirection.Z[lane];
+            float relativeVelocity = velocity2 - velocity1;
+
+            float newAccumulatedImpulse = accumulatedImpulse[lane] + (bias[lane] - relativeVelocity) / impulseDenominator[lane];
+            newAccumulatedImpulse = std::min(std::max(newAccumulatedImpulse, minAccumulatedImpulse[lane]), maxAccumulatedImpulse[lane]);
+            impulse[lane] = newAccumulatedImpulse - accumulatedImpulse[lane];
+        }
+
+        //scatter results
+        for (std::size_t lane = 0; lane < contactsCount; ++lane) {
+            std::size_t contactIndex = laneBeginIndex + lane;
+            constraints.accumulatedImpulse[contactIndex] += impulse[lane];
+            applyImpulse(constraints, contactIndex, impulse[lane]);
+        }
+    }
+
+    void ContactConstraints::applyImpulse(const DirectionConstraints& constraints, std::size_t contactIndex, float impulse) {
+        uint32_t body1Index = bodies1Index[contactIndex];
+        linearVelocities.X[body1Index] -= impulse * constraints.linearImpulse1.X[contactIndex];
+        linearVelocities.Y[body1Index] -= impulse * constraints.linearImpulse1.Y[contactIndex];
+        linearVelocities.Z[body1Index] -= impulse * constraints.linearImpulse1.Z[contactIndex];
+        angularVelocities.X[body1Index] -= impulse * constraints.angularImpulse1.X[contactIndex];
+        angularVelocities.Y[body1Index] -= impulse * constraints.angularImpulse1.Y[contactIndex];
+        angularVelocities.Z[body1Index] -= impulse * constraints.angularImpulse1.Z[contactIndex];
+
+        uint32_t body2Index = bodies2Index[contactIndex];
+        linearVelocities.X[body2Index] += impulse * constraints.linearImpulse2.X[contactIndex];
+        linearVelocities.Y[body2Index] += impulse * constraints.linearImpulse2.Y[contactIndex];
+        linearVelocities.Z[body2Index] += impulse * constraints.linearImpulse2.Z[contactIndex];
+        angularVelocities.X[body2Index] += impulse * constraints.angularImpulse2.X[contactIndex];
+        angularVelocities.Y[body2Index] += impulse * constraints.angularImpulse2.Y[contactIndex];
+        angularVelocities.Z[body2Index] += impulse * constraints.angularImpulse2.Z[contactIndex];
+    }
+
+    /**
+     * Store the accumulated impulses in the contact points (for warm starting)
+     */
+    void ContactConstraints::storeResults() const {
+        for (std::size_t contactIndex = 0; contactIndex < contactPoints.size(); ++contactIndex) {
+            AccumulatedSolvingData& accumulatedData = contactPoints[contactIndex]->getAccumulatedSolvingData();
+            accumulatedData.accNormalImpulse = normalConstraints.accumulatedImpulse[contactIndex];
+            accumulatedData.accTangentImpulse = tangentConstraints.accumulatedImpulse[contactIndex];
+        }
+    }
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <UrchinCommon.h>
+
+#include "body/model/RigidBody.h"
+#include "collision/ManifoldContactPoint.h"
+#include "collision/constraintsolver/solvingdata/CommonSolvingData.h"
+#include "collision/constraintsolver/solvingdata/ImpulseSolvingData.h"
+#include "collision/constraintsolver/solvingdata/Vector3Array.h"
+#include "collision/constraintsolver/SolvingBodies.h"
+
+namespace urchin {
+
+    /**
+     * Contact constraints to solve stored in structure of arrays (SoA) layout. Arrays are rebuilt at each step.
+     * Contacts are solved by lanes of LANES_COUNT contacts: the velocities of the lane bodies are gathered once, the impulses of all the lane contacts
+     * are computed side by side on the SoA arrays and the velocities are scattered back. A moving body must appear only once in a lane, otherwise the
+     * scatter of one contact overwrites the velocity update of the other: the colors of ConstraintSolver guarantee it for independent contacts.
+     */
+    class ContactConstraints {
+        public:
+            static constexpr std::size_t LANES_COUNT = 8;
+
+            explicit ContactConstraints(SolvingBodies&);
+
+            void clear();
+
+            void addContact(uint32_t, uint32_t, ManifoldContactPoint&, const CommonSolvingData&, const ImpulseSolvingData&);
+            void applyWarmStarting(std::size_t);
+            std::size_t getContactsCount() const;
+
+            void solveTangentConstraints(std::size_t, std::size_t, bool);
+            void solveNormalConstraints(std::size_t, std::size_t, bool);
+
+            void storeResults() const;
+
+        private:
+            struct Vector3Lanes {
+                std::array<float, LANES_COUNT> X{};
+                std::array<float, LANES_COUNT> Y{};
+                std::array<float, LANES_COUNT> Z{};
+            };
+
+            struct DirectionConstraints { //constraints along a direction (normal or tangent)
+                void clear();
+                void push_back(const Vector3<float>&, const CommonSolvingData&, bool, bool, float, float);
+
+                Vector3Array direction;
+                Vector3Array r1CrossDirection;
+                Vector3Array r2CrossDirection;
+                Vector3Array linearImpulse1; //body 1 linear velocity change for an impulse of one along the direction
+                Vector3Array angularImpulse1; //body 1 angular velocity change for an impulse of one along the direction
+                Vector3Array linearImpulse2;
+                Vector3Array angularImpulse2;
+                std::vector<float> impulseDenominator;
+                std::vector<float> accumulatedImpulse;
+            };
+
+            void solveConstraints(DirectionConstraints&, std::size_t, std::size_t, bool);
+            void solveConstraintsLane(DirectionConstraints&, std::size_t, std::size_t);
+            void applyImpulse(const DirectionConstraints&, std::size_t, float);
+
+            //bodies
+            SolvingBodies& solvingBodies;
+            Vector3Array& linearVelocities;
+            Vector3Array& angularVelocities;
+
+            //contacts
+            std::vector<uint32_t> bodies1Index;
+            std::vector<uint32_t> bodies2Index;
+            std::vector<ManifoldContactPoint*> contactPoints;
+            std::vector<float> biases;
+            std::vector<float> frictions;
+            DirectionConstraints normalConstraints;
+            DirectionConstraints tangentConstraints;
+    };
+
+}
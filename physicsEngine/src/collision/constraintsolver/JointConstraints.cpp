@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <limits>
+
+#include "collision/constraintsolver/JointConstraints.h"
+
+namespace urchin {
+
+    //static
+    thread_local std::array<JointRow, Joint::MAX_ROWS_COUNT> JointConstraints::jointRows;
+
+    JointConstraints::JointConstraints(SolvingBodies& solvingBodies) :
+            solvingBodies(solvingBodies),
+            linearVelocities(solvingBodies.getLinearVelocities()),
+            angularVelocities(solvingBodies.getAngularVelocities()) {
+
+    }
+
+    void JointConstraints::clear() {
+        bodies1Index.clear();
+        bodies2Index.clear();
+        joints.clear();
+        jointRowsIndex.clear();
+        linear1.clear();
+        angular1.clear();
+        linear2.clear();
+        angular2.clear();
+        linearImpulse1.clear();
+        angularImpulse1.clear();
+        linearImpulse2.clear();
+        angularImpulse2.clear();
+        effectiveMasses.clear();
+        biases.clear();
+        minImpulses.clear();
+        maxImpulses.clear();
+        accumulatedImpulses.clear();
+    }
+
+    /**
+     * Add the rows of the joint. The bodies data (mass, inertia...) are read once for all the rows of the joint.
+     * @param biasVelocityFactor Factor converting a position error of the joint into a velocity correction
+     */
+    void JointConstraints::addJoint(uint32_t body1Index, uint32_t body2Index, Joint& joint, float biasVelocityFactor) {
+        std::size_t rowsCount = joint.computeRows(jointRows);
+        for (std::size_t rowIndex = rowsCount; rowIndex < Joint::MAX_ROWS_COUNT; ++rowIndex) {
+            joint.setAccumulatedImpulse(rowIndex, 0.0f); //unused rows must not warm start a future row
+        }
+        if (rowsCount == 0) {
+            return;
+        }
+
+        const RigidBody& body1 = joint.getBody1();
+        const RigidBody& body2 = joint.getBody2();
+        bool isBody1Moving = solvingBodies.isMovingBody(body1Index);
+        bool isBody2Moving = solvingBodies.isMovingBody(body2Index);
+        float invMass1 = isBody1Moving ? body1.getInvMass() : 0.0f;
+        float invMass2 = isBody2Moving ? body2.getInvMass() : 0.0f;
+        Matrix3<float> invInertia1 = isBody1Moving ? body1.getInvWorldInertia() : Matrix3<float>(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+        Matrix3<float> invInertia2 = isBody2Moving ? body2.getInvWorldInertia() : Matrix3<float>(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+        Vector3<float> linearFactor1 = body1.getLinearFactor();
+        Vector3<float> angularFactor1 = body1.getAngularFactor();
+        Vector3<float> linearFactor2 = body2.getLinearFactor();
+        Vector3<float> angularFactor2 = body2.getAngularFactor();
+
+        for (std::size_t rowIndex = 0; rowIndex < rowsCount; ++rowIndex) {
+            const JointRow& row = jointRows[rowIndex];
+            Vector3<float> rowLinearImpulse1 = row.linear1 * linearFactor1 * invMass1;
+            Vector3<float> rowAngularImpulse1 = (invInertia1 * row.angular1) * angularFactor1;
+            Vector3<float> rowLinearImpulse2 = row.linear2 * linearFactor2 * invMass2;
+            Vector3<float> rowAngularImpulse2 = (invInertia2 * row.angular2) * angularFactor2;
+            float impulseDenominator = row.linear1.dotProduct(rowLinearImpulse1) + row.angular1.dotProduct(rowAngularImpulse1)
+                    + row.linear2.dotProduct(rowLinearImpulse2) + row.angular2.dotProduct(rowAngularImpulse2);
+
+            bodies1Index.push_back(body1Index);
+            bodies2Index.push_back(body2Index);
+            joints.push_back(&joint);
+            jointRowsIndex.push_back(rowIndex);
+            linear1.push_back(row.linear1);
+            angular1.push_back(row.angular1);
+            linear2.push_back(row.linear2);
+            angular2.push_back(row.angular2);
+            linearImpulse1.push_back(rowLinearImpulse1);
+            angularImpulse1.push_back(rowAngularImpulse1);
+            linearImpulse2.push_back(rowLinearImpulse2);
+            angularImpulse2.push_back(rowAngularImpulse2);
+            effectiveMasses.push_back(impulseDenominator > std::numeric_limits<float>::epsilon() ? 1.0f / impulseDenominator : 0.0f); //no effect when the degree of freedom is locked
+            biases.push_back(biasVelocityFactor * row.positionError);
+            minImpulses.push_back(row.minImpulse);
+            maxImpulses.push_back(row.maxImpulse);
+            accumulatedImpulses.push_back(std::clamp(joint.getAccumulatedImpulse(rowIndex), row.minImpulse, row.maxImpulse));
+        }
+    }
+
+    /**
+     * Apply previous impulse of the row which should be similar to the current impulse solution
+     */
+    void JointConstraints::applyWarmStarting(std::size_t rowIndex) {
+        applyImpulse(rowIndex, accumulatedImpulses[rowIndex]);
+    }
+
+    std::size_t JointConstraints::getRowsCount() const {
+        return accumulatedImpulses.size();
+    }
+
+    void JointConstraints::solveConstraints(std::size_t beginRowIndex, std::size_t endRowIndex) {
+        for (std::size_t rowIndex = beginRowIndex; rowIndex < endRowIndex; ++rowIndex) {
+            uint32_t body1Index = bodies1Index[rowIndex];
+            uint32_t body2Index = bodies2Index[rowIndex];
+            float rowVelocity = linear1.X[rowIndex] * linearVelocities.X[body1Index] + linear1.Y[rowIndex] * linearVelocities.Y[body1Index] + linear1.Z[rowIndex] * linearVelocities.Z[body1Index]
+                    + angular1.X[rowIndex] * angularVelocities.X[body1Index] + angular1.Y[rowIndex] * angularVelocities.Y[body1Index] + angular1.Z[rowIndex] * angularVelocities.Z[body1Index]
+                    + linear2.X[rowIndex] * linearVelocities.X[body2Index] + linear2.Y[rowIndex] * linearVelocities.Y[body2Index] + linear2.Z[rowIndex] * linearVelocities.Z[body2Index]
+                    + angular2.X[rowIndex] * angularVelocities.X[body2Index] + angular2.Y[rowIndex] * angularVelocities.Y[body2Index] + angular2.Z[rowIndex] * angularVelocities.Z[body2Index];
+
+            float newAccumulatedImpulse = accumulatedImpulses[rowIndex] - (rowVelocity + biases[rowIndex]) * effectiveMasses[rowIndex];
+            newAccumulatedImpulse = std::min(std::max(newAccumulatedImpulse, minImpulses[rowIndex]), maxImpulses[rowIndex]);
+            float impulse = newAccumulatedImpulse - accumulatedImpulses[rowIndex];
+            accumulatedImpulses[rowIndex] = newAccumulatedImpulse;
+            applyImpulse(rowIndex, impulse);
+        }
+    }
+
+    void JointConstraints::applyImpulse(std::size_t rowIndex, float impulse) {
+        uint32_t body1Index = bodies1Index[rowIndex];
+        linearVelocities.X[body1Index] += impulse * linearImpulse1.X[rowIndex];
+        linearVelocities.Y[body1Index] += impulse * linearImpulse1.Y[rowIndex];
+        linearVelocities.Z[body1Index] += impulse * linearImpulse1.Z[rowIndex];
+        angularVelocities.X[body1Index] += impulse * angularImpulse1.X[rowIndex];
+        angularVelocities.Y[body1Index] += impulse * angularImpulse1.Y[rowIndex];
+        angularVelocities.Z[body1Index] += impulse * angularImpulse1.Z[rowIndex];
+
+        uint32_t body2Index = bodies2Index[rowIndex];
+        linearVelocities.X[body2Index] += impulse * linearImpulse2.X[rowIndex];
+        linearVelocities.Y[body2Index] += impulse * linearImpulse2.Y[rowIndex];
+        linearVelocities.Z[body2Index] += impulse * linearImpulse2.Z[rowIndex];
+        angularVelocities.X[body2Index] += impulse * angularImpulse2.X[rowIndex];
+        angularVelocities.Y[body2Index] += impulse * angularImpulse2.Y[rowIndex];
+        angularVelocities.Z[body2Index] += impulse * angularImpulse2.Z[rowIndex];
+    }
+
+    /**
+     * Store the accumulated impulses in the joints (for warm starting)
+     */
+    void JointConstraints::storeResults() const {
+        for (std::size_t rowIndex = 0; rowIndex < joints.size(); ++rowIndex) {
+            joints[rowIndex]->setAccumulatedImpulse(jointRowsIndex[rowIndex], accumulatedImpulses[rowIndex]);
+        }
+    }
+
+}
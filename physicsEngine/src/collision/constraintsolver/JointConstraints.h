@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+#include "collision/constraintsolver/solvingdata/Vector3Array.h"
+#include "collision/constraintsolver/SolvingBodies.h"
+
+namespace urchin {
+
+    /**
+     * Rows of the joints to solve stored in structure of arrays (SoA) layout. Arrays are rebuilt at each step.
+     * Rows are solved sequentially: joints of ragdolls and chains share their bodies.
+     */
+    class JointConstraints {
+        public:
+            explicit JointConstraints(SolvingBodies&);
+
+            void clear();
+
+            void addJoint(uint32_t, uint32_t, Joint&, float);
+            void applyWarmStarting(std::size_t);
+            std::size_t getRowsCount() const;
+
+            void solveConstraints(std::size_t, std::size_t);
+
+            void storeResults() const;
+
+        private:
+            void applyImpulse(std::size_t, float);
+
+            //bodies
+            SolvingBodies& solvingBodies;
+            Vector3Array& linearVelocities;
+            Vector3Array& angularVelocities;
+
+            //rows
+            std::vector<uint32_t> bodies1Index;
+            std::vector<uint32_t> bodies2Index;
+            std::vector<Joint*> joints;
+            std::vector<std::size_t> jointRowsIndex; //index of the row in the joint
+            Vector3Array linear1;
+            Vector3Array angular1;
+            Vector3Array linear2;
+            Vector3Array angular2;
+            Vector3Array linearImpulse1; //body 1 linear velocity change for an impulse of one
+            Vector3Array angularImpulse1; //body 1 angular velocity change for an impulse of one
+            Vector3Array linearImpulse2;
+            Vector3Array angularImpulse2;
+            std::vector<float> effectiveMasses;
+            std::vector<float> biases;
+            std::vector<float> minImpulses;
+            std::vector<float> maxImpulses;
+            std::vector<float> accumulatedImpulses;
+
+            static thread_local std::array<JointRow, Joint::MAX_ROWS_COUNT> jointRows;
+    };
+
+}
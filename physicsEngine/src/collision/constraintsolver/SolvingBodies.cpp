@@ -0,0 +1,54 @@
+#include "collision/constraintsolver/SolvingBodies.h"
+
+namespace urchin {
+
+    void SolvingBodies::clear() {
+        linearVelocities.clear();
+        angularVelocities.clear();
+        movingBodies.clear();
+    }
+
+    /**
+     * @return Index of the body. Velocity of the body is updated by the constraints and stored in the body by storeResults().
+     */
+    uint32_t SolvingBodies::addMovingBody(RigidBody& body) {
+        linearVelocities.push_back(body.getLinearVelocity());
+        angularVelocities.push_back(body.getAngularVelocity());
+        movingBodies.push_back(&body);
+        return (uint32_t)movingBodies.size() - 1;
+    }
+
+    /**
+     * @return Index of the body. Velocity of a static body is never updated: the same static body can be added several times.
+     */
+    uint32_t SolvingBodies::addStaticBody(const RigidBody& body) {
+        linearVelocities.push_back(body.getLinearVelocity());
+        angularVelocities.push_back(body.getAngularVelocity());
+        movingBodies.push_back(nullptr);
+        return (uint32_t)movingBodies.size() - 1;
+    }
+
+    bool SolvingBodies::isMovingBody(uint32_t bodyIndex) const {
+        return movingBodies[bodyIndex] != nullptr;
+    }
+
+    Vector3Array& SolvingBodies::getLinearVelocities() {
+        return linearVelocities;
+    }
+
+    Vector3Array& SolvingBodies::getAngularVelocities() {
+        return angularVelocities;
+    }
+
+    /**
+     * Store the velocities in the moving bodies
+     */
+    void SolvingBodies::storeResults() const {
+        for (std::size_t bodyIndex = 0; bodyIndex < movingBodies.size(); ++bodyIndex) {
+            if (movingBodies[bodyIndex]) {
+                movingBodies[bodyIndex]->setVelocity(linearVelocities.get(bodyIndex), angularVelocities.get(bodyIndex));
+            }
+        }
+    }
+
+}
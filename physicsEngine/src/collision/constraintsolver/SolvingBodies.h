@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "body/model/RigidBody.h"
+#include "collision/constraintsolver/solvingdata/Vector3Array.h"
+
+namespace urchin {
+
+    /**
+     * Velocities of the bodies updated by the contact and joint constraints. Arrays are rebuilt at each step.
+     */
+    class SolvingBodies {
+        public:
+            void clear();
+
+            uint32_t addMovingBody(RigidBody&);
+            uint32_t addStaticBody(const RigidBody&);
+            bool isMovingBody(uint32_t) const;
+
+            Vector3Array& getLinearVelocities();
+            Vector3Array& getAngularVelocities();
+
+            void storeResults() const;
+
+        private:
+            Vector3Array linearVelocities;
+            Vector3Array angularVelocities;
+            std::vector<RigidBody*> movingBodies; //nullptr for static bodies
+    };
+
+}
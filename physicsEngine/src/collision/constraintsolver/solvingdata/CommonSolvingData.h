@@ -25,6 +25,7 @@ namespace urchin {
         Vector3<float> r2; //vector from center of mass of body2 to contact point
 
         float depth; //penetration depth (negative when collision exist)
+        bool speculativeContact; //contact generated by the speculative contacts of a fast body
     };
 
 }
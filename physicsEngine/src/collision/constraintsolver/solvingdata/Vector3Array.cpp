@@ -0,0 +1,21 @@
+#include "collision/constraintsolver/solvingdata/Vector3Array.h"
+
+namespace urchin {
+
+    void Vector3Array::clear() {
+        X.clear();
+        Y.clear();
+        Z.clear();
+    }
+
+    void Vector3Array::push_back(const Vector3<float>& vector) {
+        X.push_back(vector.X);
+        Y.push_back(vector.Y);
+        Z.push_back(vector.Z);
+    }
+
+    Vector3<float> Vector3Array::get(std::size_t index) const {
+        return Vector3(X[index], Y[index], Z[index]);
+    }
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <vector>
+#include <UrchinCommon.h>
+
+namespace urchin {
+
+    /**
+    * Array of vectors stored in structure of arrays (SoA) layout
+    */
+    struct Vector3Array {
+        void clear();
+        void push_back(const Vector3<float>&);
+        Vector3<float> get(std::size_t) const;
+
+        std::vector<float> X;
+        std::vector<float> Y;
+        std::vector<float> Z;
+    };
+
+}
@@ -15,8 +15,8 @@ namespace urchin {
      * @param dt Delta of time between two simulation steps
      */
     void IntegrateTransform::process(float dt) const {
-        for (const auto& abstractBody : bodyContainer.getBodies()) {
-            RigidBody* body = RigidBody::upCast(abstractBody.get());
+        for (AbstractBody* abstractBody : bodyContainer.getActiveBodies()) {
+            RigidBody* body = RigidBody::upCast(abstractBody);
             if (body && body->isActive()) {
                 PhysicsTransform currentTransform = body->getTransform();
                 PhysicsTransform newTransform = currentTransform.integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
@@ -24,7 +24,7 @@ namespace urchin {
                 float ccdMotionThreshold = body->getCcdMotionThreshold();
                 float motion = currentTransform.getPosition().vector(newTransform.getPosition()).length();
 
-                if (motion > ccdMotionThreshold) {
+                if (motion > ccdMotionThreshold && !narrowPhase.isSpeculativeContacts()) { //speculative contacts already limit the velocity of fast bodies
                     handleContinuousCollision(*body, currentTransform, newTransform, dt);
                 } else {
                     body->setTransform(newTransform);
@@ -11,19 +11,25 @@ namespace urchin {
     /**
      * @param dt Delta of time (sec.) between two simulation steps
      * @param gravity Gravity expressed in units/s^2
+     * @param journal Journal recording the momentum applied on the bodies since the last step. Null when no journal is recorded.
      */
-    void IntegrateVelocity::process(float dt, const std::vector<std::unique_ptr<OverlappingPair>>& overlappingPairs, const Vector3<float>& gravity) const {
+    void IntegrateVelocity::process(float dt, const std::vector<std::unique_ptr<OverlappingPair>>& overlappingPairs, const Vector3<float>& gravity, PhysicsJournal* journal) const {
+        consumeExternalMomentum(journal);
+
         //apply internal forces
         applyGravityForce(gravity, dt);
         applyRollingFrictionResistanceForce(dt, overlappingPairs);
 
         //integrate velocities and apply damping
-        for (const auto& abstractBody : bodyContainer.getBodies()) {
-            RigidBody* body = RigidBody::upCast(abstractBody.get());
+        for (std::size_t bodyIndex = 0; bodyIndex < bodyContainer.getActiveBodies().size(); ++bodyIndex) {
+            RigidBody* body = RigidBody::upCast(bodyContainer.getActiveBodies()[bodyIndex]);
             if (body && body->isActive()) {
                 float dampingLinearFactor = powf(1.0f - body->getLinearDamping(), dt);
                 float dampingAngularFactor = powf(1.0f - body->getAngularDamping(), dt);
-                BodyMomentum bodyMomentum = body->getMomentumAndReset();
+                BodyMomentum bodyMomentum = externalMomentums[bodyIndex];
+                BodyMomentum internalMomentum = body->getMomentumAndReset();
+                bodyMomentum.addMomentum(internalMomentum.getMomentum());
+                bodyMomentum.addTorqueMomentum(internalMomentum.getTorqueMomentum());
 
                 Vector3<float> newLinearVelocity = (body->getLinearVelocity() + bodyMomentum.getMomentum() * body->getInvMass()) * dampingLinearFactor;
                 Vector3<float> newAngularVelocity = (body->getAngularVelocity() + bodyMomentum.getTorqueMomentum() * body->getInvWorldInertia()) * dampingAngularFactor;
@@ -32,12 +38,28 @@ namespace urchin {
         }
     }
 
+    /**
+     * Consume the momentum applied on the bodies since the last step before adding the internal forces: the journal only records the external momentum.
+     */
+    void IntegrateVelocity::consumeExternalMomentum(PhysicsJournal* journal) const {
+        externalMomentums.assign(bodyContainer.getActiveBodies().size(), BodyMomentum());
+        for (std::size_t bodyIndex = 0; bodyIndex < bodyContainer.getActiveBodies().size(); ++bodyIndex) {
+            RigidBody* body = RigidBody::upCast(bodyContainer.getActiveBodies()[bodyIndex]);
+            if (body && body->isActive()) {
+                externalMomentums[bodyIndex] = body->getMomentumAndReset();
+                if (journal) {
+                    journal->recordMomentum(*body, externalMomentums[bodyIndex]);
+                }
+            }
+        }
+    }
+
     /**
      * @param gravity Gravity expressed in units/s^2
      */
     void IntegrateVelocity::applyGravityForce(const Vector3<float>& gravity, float dt) const {
-        for (const auto& abstractBody : bodyContainer.getBodies()) {
-            RigidBody* body = RigidBody::upCast(abstractBody.get());
+        for (AbstractBody* abstractBody : bodyContainer.getActiveBodies()) {
+            RigidBody* body = RigidBody::upCast(abstractBody);
             if (body && body->isActive()) {
                 body->applyCentralMomentum(gravity * body->getMass() * dt);
             }
@@ -5,6 +5,7 @@
 
 #include "body/BodyContainer.h"
 #include "collision/OverlappingPair.h"
+#include "journal/PhysicsJournal.h"
 
 namespace urchin {
 
@@ -15,13 +16,15 @@ namespace urchin {
         public:
             explicit IntegrateVelocity(const BodyContainer&);
 
-            void process(float, const std::vector<std::unique_ptr<OverlappingPair>>&, const Vector3<float>&) const;
+            void process(float, const std::vector<std::unique_ptr<OverlappingPair>>&, const Vector3<float>&, PhysicsJournal*) const;
 
         private:
+            void consumeExternalMomentum(PhysicsJournal*) const;
             void applyGravityForce(const Vector3<float>&, float) const;
             void applyRollingFrictionResistanceForce(float , const std::vector<std::unique_ptr<OverlappingPair>>&) const;
 
             const BodyContainer& bodyContainer;
+            mutable std::vector<BodyMomentum> externalMomentums;
     };
 
 }
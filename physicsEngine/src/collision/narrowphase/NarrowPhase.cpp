@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "collision/narrowphase/NarrowPhase.h"
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionSphereShape.h"
@@ -10,12 +12,19 @@ namespace urchin {
 
     //static
     thread_local std::vector<OverlappingPair> NarrowPhase::overlappingPairsCache;
+    thread_local std::vector<CollisionTriangleShape> NarrowPhase::trianglesCache;
+    thread_local std::vector<std::shared_ptr<AbstractBody>> NarrowPhase::bodiesAABBoxHitCache;
+    thread_local std::vector<NarrowPhase::SpeculativeContact> NarrowPhase::speculativeContactsCache;
 
-    NarrowPhase::NarrowPhase(const BodyContainer& bodyContainer, const BroadPhase& broadPhase) :
+    NarrowPhase::NarrowPhase(const BodyContainer& bodyContainer, const BroadPhase& broadPhase, WorkerPool& workerPool) :
             bodyContainer(bodyContainer),
             broadPhase(broadPhase),
-            collisionAlgorithmSelector(CollisionAlgorithmSelector()),
-            bodiesMutex(LockById::getInstance("narrowPhaseBodyIds")) {
+            workerPool(workerPool),
+            collisionAlgorithmSelector(CollisionAlgorithmSelector(algorithmCounters)),
+            speculativeContacts(ConfigService::instance().getBoolValue("narrowPhase.speculativeContacts")),
+            bodiesMutex(LockById::getInstance("narrowPhaseBodyIds")),
+            workersManifoldResults(workerPool.getWorkersCount()),
+            workersCollisionAlgorithms(workerPool.getWorkersCount()) {
 
     }
 
@@ -45,32 +54,108 @@ namespace urchin {
         }
     }
 
+    /**
+     * Store the accumulated solving data computed by the constraint solver in the persistent manifold results of the overlapping pairs. These data are used for warm
+     * starting at next step.
+     * @param manifoldResults Manifold results returned by the last process() call and solved by the constraint solver
+     */
+    void NarrowPhase::storeAccumulatedSolvingData(const std::vector<ManifoldResult>& manifoldResults) const {
+        for (std::size_t i = 0; i < manifoldResultsCollisionAlgorithm.size(); ++i) {
+            manifoldResultsCollisionAlgorithm[i]->storeAccumulatedSolvingData(manifoldResults[i]);
+        }
+    }
+
+    /**
+     * @return Counters of the collision algorithms executed by the narrow phase, including the ghost bodies processed by the other threads
+     */
+    AlgorithmCounters& NarrowPhase::getAlgorithmCounters() {
+        return algorithmCounters;
+    }
+
+    /**
+     * @param speculativeContacts Generate speculative contacts for the fast bodies instead of computing their time of impact. Speculative contacts are
+     * generated from the closest points of the bodies swept by the fast body and are solved by the constraint solver like the regular contacts.
+     */
+    void NarrowPhase::setSpeculativeContacts(bool speculativeContacts) {
+        this->speculativeContacts = speculativeContacts;
+    }
+
+    bool NarrowPhase::isSpeculativeContacts() const {
+        return speculativeContacts;
+    }
+
+    /**
+     * Process the overlapping pairs in parallel. Each worker processes a contiguous range of pairs and fills its own manifold results.
+     * The workers manifold results are merged in the workers order: the result is identical whatever the number of workers.
+     */
     void NarrowPhase::processOverlappingPairs(const std::vector<std::unique_ptr<OverlappingPair>>& overlappingPairs, std::vector<ManifoldResult>& manifoldResults) const {
         ScopeProfiler sp(Profiler::physics(), "procOverlapPair");
 
-        for (const auto& overlappingPair : overlappingPairs) {
-            processOverlappingPair(*overlappingPair, manifoldResults);
+        workerPool.parallelFor(overlappingPairs.size(), MIN_PAIRS_BY_WORKER, [&](unsigned int workerIndex, std::size_t beginPairIndex, std::size_t endPairIndex) {
+            for (std::size_t pairIndex = beginPairIndex; pairIndex < endPairIndex; ++pairIndex) {
+                if (processOverlappingPair(*overlappingPairs[pairIndex], workersManifoldResults[workerIndex])) {
+                    workersCollisionAlgorithms[workerIndex].push_back(overlappingPairs[pairIndex]->getCollisionAlgorithm());
+                }
+            }
+        });
+
+        manifoldResultsCollisionAlgorithm.clear();
+        for (std::size_t workerIndex = 0; workerIndex < workersManifoldResults.size(); ++workerIndex) {
+            for (ManifoldResult& workerManifoldResult : workersManifoldResults[workerIndex]) {
+                manifoldResults.push_back(std::move(workerManifoldResult));
+            }
+            workersManifoldResults[workerIndex].clear();
+
+            manifoldResultsCollisionAlgorithm.insert(manifoldResultsCollisionAlgorithm.end(), workersCollisionAlgorithms[workerIndex].begin(), workersCollisionAlgorithms[workerIndex].end());
+            workersCollisionAlgorithms[workerIndex].clear();
         }
     }
 
-    void NarrowPhase::processOverlappingPair(OverlappingPair& overlappingPair, std::vector<ManifoldResult>& manifoldResults) const {
+    /**
+     * @param manifoldResults [OUT] Collision constraints
+     * @return True when a manifold result has been added
+     */
+    bool NarrowPhase::processOverlappingPair(OverlappingPair& overlappingPair, std::vector<ManifoldResult>& manifoldResults) const {
         const AbstractBody& body1 = overlappingPair.getBody1();
         const AbstractBody& body2 = overlappingPair.getBody2();
 
         if (body1.isActive() || body2.isActive()) {
-            ScopeLockById lockBody1(bodiesMutex, body1.getObjectId());
-            ScopeLockById lockBody2(bodiesMutex, body2.getObjectId());
-
             CollisionAlgorithm* collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
 
-            CollisionObjectWrapper collisionObject1(body1.getShape(), body1.getTransform());
-            CollisionObjectWrapper collisionObject2(body2.getShape(), body2.getTransform());
-            collisionAlgorithm->processCollisionAlgorithm(collisionObject1, collisionObject2, true);
+            auto [body1Transform, body2Transform] = snapshotTransforms(body1, body2);
+            PhysicsTransform relativeTransform = body1Transform.inverse() * body2Transform;
+            if (canReuseCollisionResult(overlappingPair, relativeTransform)) {
+                collisionAlgorithm->refreshContactPoints();
+            } else {
+                CollisionObjectWrapper collisionObject1(body1.getShape(), body1Transform);
+                CollisionObjectWrapper collisionObject2(body2.getShape(), body2Transform);
+                collisionAlgorithm->processCollisionAlgorithm(collisionObject1, collisionObject2, true);
+                overlappingPair.setCollisionRelativeTransform(relativeTransform);
+                algorithmCounters.addAlgorithmCall(body1.getShape().getShapeType(), body2.getShape().getShapeType());
+            }
 
             if (collisionAlgorithm->getConstManifoldResult().getNumContactPoints() != 0) {
                 manifoldResults.push_back(collisionAlgorithm->getConstManifoldResult());
+                return true;
             }
         }
+        return false;
+    }
+
+    /**
+     * Copy the transforms of the bodies. Only the active bodies are locked and only during the copy: the collision algorithm is executed unlocked on the copied
+     * transforms. The static and sleeping bodies are never locked because they are shared by many pairs (e.g. terrain under a crowd of characters).
+     */
+    std::pair<PhysicsTransform, PhysicsTransform> NarrowPhase::snapshotTransforms(const AbstractBody& body1, const AbstractBody& body2) const {
+        if (body1.isActive() && body2.isActive()) {
+            //lock bodies in the order of their identifiers to avoid deadlock between the workers and the other threads
+            ScopeLockById lockFirstBody(bodiesMutex, std::min(body1.getObjectId(), body2.getObjectId()));
+            ScopeLockById lockSecondBody(bodiesMutex, std::max(body1.getObjectId(), body2.getObjectId()));
+            return std::make_pair(body1.getTransform(), body2.getTransform());
+        }
+
+        ScopeLockById lockActiveBody(bodiesMutex, body1.isActive() ? body1.getObjectId() : body2.getObjectId());
+        return std::make_pair(body1.getTransform(), body2.getTransform());
     }
 
     CollisionAlgorithm* NarrowPhase::retrieveCollisionAlgorithm(OverlappingPair& overlappingPair) const {
@@ -85,11 +170,28 @@ namespace urchin {
         return overlappingPair.getCollisionAlgorithm();
     }
 
+    /**
+     * Collision algorithm result can be reused when the bodies did not move relatively to each other since the last collision algorithm execution (e.g. resting contacts).
+     * In such case, the contact points of the persistent manifold result only need to be refreshed.
+     * @param relativeTransform Current transform of body 2 relative to body 1
+     */
+    bool NarrowPhase::canReuseCollisionResult(const OverlappingPair& overlappingPair, const PhysicsTransform& relativeTransform) const {
+        const std::optional<PhysicsTransform>& collisionRelativeTransform = overlappingPair.getCollisionRelativeTransform();
+        if (!collisionRelativeTransform.has_value()) {
+            return false;
+        }
+
+        float squareTranslation = collisionRelativeTransform->getPosition().vector(relativeTransform.getPosition()).squareLength();
+        float orientationDot = std::abs(collisionRelativeTransform->getOrientation().dotProduct(relativeTransform.getOrientation()));
+        return squareTranslation <= MAX_REUSE_TRANSLATION * MAX_REUSE_TRANSLATION && orientationDot >= MIN_REUSE_ORIENTATION_DOT;
+    }
+
     void NarrowPhase::processPredictiveContacts(float dt, std::vector<ManifoldResult>& manifoldResults) const {
         ScopeProfiler sp(Profiler::physics(), "proPrediContact");
 
-        for (const auto& abstractBody : bodyContainer.getBodies()) {
-            RigidBody* body = RigidBody::upCast(abstractBody.get());
+        speculativeBodies.clear();
+        for (AbstractBody* abstractBody : bodyContainer.getActiveBodies()) {
+            RigidBody* body = RigidBody::upCast(abstractBody);
             if (body && body->isActive()) {
                 ScopeLockById lockBody(bodiesMutex, body->getObjectId());
 
@@ -100,10 +202,18 @@ namespace urchin {
                 float motion = currentTransform.getPosition().vector(newTransform.getPosition()).length();
 
                 if (motion > ccdMotionThreshold) {
-                    handleContinuousCollision(*body, currentTransform, newTransform, manifoldResults);
+                    if (speculativeContacts) {
+                        speculativeBodies.push_back({.body = body, .from = currentTransform, .to = newTransform});
+                    } else {
+                        handleContinuousCollision(*body, currentTransform, newTransform, manifoldResults);
+                    }
                 }
             }
         }
+
+        if (!speculativeBodies.empty()) {
+            processSpeculativeContacts(dt, manifoldResults);
+        }
     }
 
     void NarrowPhase::handleContinuousCollision(AbstractBody& body, const PhysicsTransform& from, const PhysicsTransform& to, std::vector<ManifoldResult>& manifoldResults) const {
@@ -145,6 +255,145 @@ namespace urchin {
         }
     }
 
+    /**
+     * Generate the speculative contacts of the fast bodies in parallel. Each fast body costs a broad phase query and a closest points computation by body swept
+     * (no time of impact iterations). The workers manifold results are merged in the workers order: the result is identical whatever the number of workers.
+     * @param manifoldResults [OUT] Speculative contacts
+     */
+    void NarrowPhase::processSpeculativeContacts(float dt, std::vector<ManifoldResult>& manifoldResults) const {
+        ScopeProfiler sp(Profiler::physics(), "proSpecuContact");
+
+        workerPool.parallelFor(speculativeBodies.size(), MIN_SPECULATIVE_BODIES_BY_WORKER, [&](unsigned int workerIndex, std::size_t beginBodyIndex, std::size_t endBodyIndex) {
+            for (std::size_t bodyIndex = beginBodyIndex; bodyIndex < endBodyIndex; ++bodyIndex) {
+                speculativeContactsTest(speculativeBodies[bodyIndex], dt, workersManifoldResults[workerIndex]);
+            }
+        });
+
+        for (std::vector<ManifoldResult>& workerManifoldResults : workersManifoldResults) {
+            for (ManifoldResult& workerManifoldResult : workerManifoldResults) {
+                manifoldResults.push_back(std::move(workerManifoldResult));
+            }
+            workerManifoldResults.clear();
+        }
+    }
+
+    /**
+     * Speculative contacts are generated for the bodies which could be reached by the fast body during the step. Only the closest bodies are kept.
+     * @param manifoldResults [OUT] Speculative contacts of the fast body
+     */
+    void NarrowPhase::speculativeContactsTest(const PredictiveBody& predictiveBody, float dt, std::vector<ManifoldResult>& manifoldResults) const {
+        RigidBody& body = *predictiveBody.body;
+        bodiesAABBoxHitCache.clear();
+        broadPhase.bodyTest(body, predictiveBody.from, predictiveBody.to, bodiesAABBoxHitCache);
+
+        speculativeContactsCache.clear();
+        Vector3<float> bodyMotion = predictiveBody.from.getPosition().vector(predictiveBody.to.getPosition());
+        float bodyAngularMotion = body.getAngularVelocity().length() * dt * body.getShape().getMaxDistanceToCenter();
+        for (const auto& bodyAABBoxHit : bodiesAABBoxHitCache) {
+            if (bodyAABBoxHit->getBodyType() == BodyType::GHOST) {
+                continue;
+            }
+
+            //lock bodies in the order of their identifiers to avoid deadlock between the workers and the other threads
+            ScopeLockById lockFirstBody(bodiesMutex, std::min(body.getObjectId(), bodyAABBoxHit->getObjectId()));
+            ScopeLockById lockSecondBody(bodiesMutex, std::max(body.getObjectId(), bodyAABBoxHit->getObjectId()));
+
+            Vector3<float> relativeMotion = bodyMotion;
+            float angularMotion = bodyAngularMotion;
+            if (const RigidBody* rigidBodyHit = RigidBody::upCast(bodyAABBoxHit.get()); rigidBodyHit && rigidBodyHit->isActive()) {
+                relativeMotion -= rigidBodyHit->getLinearVelocity() * dt;
+                angularMotion += rigidBodyHit->getAngularVelocity().length() * dt * rigidBodyHit->getShape().getMaxDistanceToCenter();
+            }
+
+            SpeculativeContact speculativeContact{.body2 = bodyAABBoxHit.get(), .normalFromObject2 = Vector3<float>(), .pointOnObject2 = Point3<float>(), .distance = std::numeric_limits<float>::max()};
+            const auto& bodyShape = body.getShape();
+            if (bodyShape.isCompound()) {
+                const auto& compoundShape = static_cast<const CollisionCompoundShape&>(bodyShape);
+                for (const auto& localizedShape : compoundShape.getLocalizedShapes()) {
+                    speculativeContactTest(*localizedShape->shape, predictiveBody.from * localizedShape->transform, predictiveBody.to * localizedShape->transform,
+                            *bodyAABBoxHit, bodyAABBoxHit->getTransform(), relativeMotion, angularMotion, speculativeContact);
+                }
+            } else {
+                speculativeContactTest(bodyShape, predictiveBody.from, predictiveBody.to, *bodyAABBoxHit, bodyAABBoxHit->getTransform(), relativeMotion, angularMotion, speculativeContact);
+            }
+
+            if (speculativeContact.distance != std::numeric_limits<float>::max()) {
+                speculativeContactsCache.push_back(speculativeContact);
+            }
+        }
+
+        if (speculativeContactsCache.size() > MAX_SPECULATIVE_CONTACTS_BY_BODY) {
+            std::ranges::partial_sort(speculativeContactsCache, speculativeContactsCache.begin() + MAX_SPECULATIVE_CONTACTS_BY_BODY,
+                    [](const SpeculativeContact& lhs, const SpeculativeContact& rhs){ return lhs.distance < rhs.distance; });
+            speculativeContactsCache.resize(MAX_SPECULATIVE_CONTACTS_BY_BODY);
+        }
+        for (const SpeculativeContact& speculativeContact : speculativeContactsCache) {
+            ManifoldResult manifoldResult(body, *speculativeContact.body2);
+            manifoldResult.markAsSpeculative();
+            manifoldResult.addContactPoint(speculativeContact.normalFromObject2, speculativeContact.pointOnObject2, speculativeContact.distance, true);
+            manifoldResults.push_back(manifoldResult);
+        }
+    }
+
+    /**
+     * @param closestContact [in/out] Updated when a closer speculative contact is found between the shape and the body 2
+     */
+    void NarrowPhase::speculativeContactTest(const CollisionShape3D& shape1, const PhysicsTransform& from1, const PhysicsTransform& to1, const AbstractBody& body2,
+            const PhysicsTransform& transform2, const Vector3<float>& relativeMotion, float angularMotion, SpeculativeContact& closestContact) const {
+        const auto& bodyShape = body2.getShape();
+        if (bodyShape.isCompound()) {
+            const auto& compoundShape = static_cast<const CollisionCompoundShape&>(bodyShape);
+            for (const auto& localizedShape : compoundShape.getLocalizedShapes()) {
+                convexSpeculativeContactTest(shape1, from1, *localizedShape->shape, transform2 * localizedShape->transform, relativeMotion, angularMotion, closestContact);
+            }
+        } else if (bodyShape.isConvex()) {
+            convexSpeculativeContactTest(shape1, from1, bodyShape, transform2, relativeMotion, angularMotion, closestContact);
+        } else if (bodyShape.isConcave()) {
+            const auto& concaveShape = dynamic_cast<const CollisionConcaveShape&>(bodyShape);
+
+            PhysicsTransform inverseTransform2 = transform2.inverse();
+            AABBox<float> fromAABBoxLocalToObject2 = shape1.toAABBox(inverseTransform2 * from1);
+            AABBox<float> toAABBoxLocalToObject2 = shape1.toAABBox(inverseTransform2 * to1);
+            concaveShape.findTrianglesInAABBox(fromAABBoxLocalToObject2.merge(toAABBoxLocalToObject2), trianglesCache);
+            for (const auto& triangle : trianglesCache) {
+                convexSpeculativeContactTest(shape1, from1, triangle, transform2, relativeMotion, angularMotion, closestContact);
+            }
+        } else {
+            throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape.getShapeType()));
+        }
+    }
+
+    /**
+     * Compute the closest points between two separated convex shapes. A speculative contact is kept when the relative motion could close the distance.
+     * Overlapping shapes are ignored: they are handled by the collision algorithms of the overlapping pairs.
+     * @param relativeMotion Motion of the shape 1 relative to the shape 2 during the step
+     * @param angularMotion Maximum motion of the shapes surface due to the rotation during the step
+     * @param closestContact [in/out] Updated when the speculative contact is closer
+     */
+    void NarrowPhase::convexSpeculativeContactTest(const CollisionShape3D& shape1, const PhysicsTransform& transform1, const CollisionShape3D& shape2,
+            const PhysicsTransform& transform2, const Vector3<float>& relativeMotion, float angularMotion, SpeculativeContact& closestContact) const {
+        std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject1 = shape1.toConvexObject(transform1);
+        std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject2 = shape2.toConvexObject(transform2);
+
+        GJKResult<double> gjkResult = gjkAlgorithm.processGJK(GJKConvexObjectWrapper(*convexObject1, true), GJKConvexObjectWrapper(*convexObject2, true));
+        algorithmCounters.addGJKIterations(gjkResult.getIterationsCount());
+        if (!gjkResult.isValidResult() || gjkResult.isCollide()) {
+            return;
+        }
+
+        auto distance = (float)gjkResult.getSeparatingDistance();
+        if (distance <= 0.0f || distance >= closestContact.distance) {
+            return;
+        }
+        Vector3<float> normalFromObject2 = gjkResult.getClosestPointB().vector(gjkResult.getClosestPointA()).cast<float>() / distance;
+        float closingMotion = -relativeMotion.dotProduct(normalFromObject2) + angularMotion;
+        if (closingMotion >= distance) {
+            closestContact.normalFromObject2 = normalFromObject2;
+            closestContact.pointOnObject2 = gjkResult.getClosestPointB().cast<float>();
+            closestContact.distance = distance;
+        }
+    }
+
     /**
      * @param continuousCollisionResults [out] In case of collision detected: continuous collision result will be updated with collision details
      */
@@ -157,42 +406,47 @@ namespace urchin {
             }
             ScopeLockById lockBody(bodiesMutex, bodyAABBoxHit->getObjectId());
 
-            const auto& bodyShape = bodyAABBoxHit->getShape();
-            if (bodyShape.isCompound()) {
-                const auto& compoundShape = static_cast<const CollisionCompoundShape&>(bodyShape);
-                const std::vector<std::shared_ptr<const LocalizedCollisionShape>>& localizedShapes = compoundShape.getLocalizedShapes();
-                for (const auto& localizedShape : localizedShapes) {
-                    PhysicsTransform fromToObject2 = bodyAABBoxHit->getTransform() * localizedShape->transform;
-                    TemporalObject temporalObject2(*localizedShape->shape, localizedShape->shapeIndex, fromToObject2, fromToObject2);
-
-                    continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
-                }
-            } else if (bodyShape.isConvex()) {
-                PhysicsTransform fromToObject2 = bodyAABBoxHit->getTransform();
-                TemporalObject temporalObject2(bodyShape, 0, fromToObject2, fromToObject2);
-
-                continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
-            } else if (bodyShape.isConcave()) {
-                const auto& concaveShape = dynamic_cast<const CollisionConcaveShape&>(bodyShape);
+            continuousCollisionTest(temporalObject1, bodyAABBoxHit, bodyAABBoxHit->getTransform(), continuousCollisionResults);
+        }
+    }
 
-                PhysicsTransform inverseTransformObject2 = bodyAABBoxHit->getTransform().inverse();
-                AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape().toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
-                AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape().toAABBox(inverseTransformObject2 * temporalObject1.getTo());
+    /**
+     * Continuous collision test against a body at the provided transform. Method can be called from any thread when the transform is not read from the body.
+     * @param continuousCollisionResults [out] In case of collision detected: continuous collision result will be updated with collision details
+     */
+    void NarrowPhase::continuousCollisionTest(const TemporalObject& temporalObject1, const std::shared_ptr<AbstractBody>& body2, const PhysicsTransform& body2Transform,
+            std::vector<ContinuousCollisionResult<float>>& continuousCollisionResults) const {
+        const auto& bodyShape = body2->getShape();
+        if (bodyShape.isCompound()) {
+            const auto& compoundShape = static_cast<const CollisionCompoundShape&>(bodyShape);
+            const std::vector<std::shared_ptr<const LocalizedCollisionShape>>& localizedShapes = compoundShape.getLocalizedShapes();
+            for (const auto& localizedShape : localizedShapes) {
+                PhysicsTransform fromToObject2 = body2Transform * localizedShape->transform;
+                TemporalObject temporalObject2(*localizedShape->shape, localizedShape->shapeIndex, fromToObject2, fromToObject2);
+
+                continuousCollisionTest(temporalObject1, temporalObject2, body2, continuousCollisionResults);
+            }
+        } else if (bodyShape.isConvex()) {
+            TemporalObject temporalObject2(bodyShape, 0, body2Transform, body2Transform);
 
-                if (temporalObject1.isRay()) {
-                    LineSegment3D ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
-                    const std::vector<CollisionTriangleShape>& triangles = concaveShape.findTrianglesHitByRay(ray);
+            continuousCollisionTest(temporalObject1, temporalObject2, body2, continuousCollisionResults);
+        } else if (bodyShape.isConcave()) {
+            const auto& concaveShape = dynamic_cast<const CollisionConcaveShape&>(bodyShape);
 
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
-                } else {
-                    AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
-                    const std::vector<CollisionTriangleShape>& triangles = concaveShape.findTrianglesInAABBox(temporalAABBoxLocalToObject1);
+            PhysicsTransform inverseTransformObject2 = body2Transform.inverse();
+            AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape().toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
+            AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape().toAABBox(inverseTransformObject2 * temporalObject1.getTo());
 
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
-                }
+            if (temporalObject1.isRay()) {
+                LineSegment3D ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
+                concaveShape.findTrianglesHitByRay(ray, trianglesCache);
             } else {
-                throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape.getShapeType()));
+                AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
+                concaveShape.findTrianglesInAABBox(temporalAABBoxLocalToObject1, trianglesCache);
             }
+            trianglesContinuousCollisionTest(trianglesCache, temporalObject1, body2, body2Transform, continuousCollisionResults);
+        } else {
+            throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape.getShapeType()));
         }
     }
 
@@ -200,9 +454,7 @@ namespace urchin {
      * @param continuousCollisionResults [OUT] In case of collision detected: continuous collision result will be updated with collision details
      */
     void NarrowPhase::trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape>& triangles, const TemporalObject& temporalObject1, const std::shared_ptr<AbstractBody>& body2,
-            std::vector<ContinuousCollisionResult<float>>& continuousCollisionResults) const {
-        PhysicsTransform fromToObject2 = body2->getTransform();
-
+            const PhysicsTransform& fromToObject2, std::vector<ContinuousCollisionResult<float>>& continuousCollisionResults) const {
         for (const auto& triangle : triangles) {
             TemporalObject temporalObject2(triangle, 0, fromToObject2, fromToObject2);
             continuousCollisionTest(temporalObject1, temporalObject2, body2, continuousCollisionResults);
@@ -9,43 +9,90 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/narrowphase/algorithm/continuous/GJKContinuousCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/gjk/GJKConvexObjectWrapper.h"
 #include "collision/broadphase/BroadPhase.h"
+#include "metrics/AlgorithmCounters.h"
 #include "body/BodyContainer.h"
 #include "body/model/AbstractBody.h"
 #include "body/model/GhostBody.h"
+#include "body/model/RigidBody.h"
 #include "object/TemporalObject.h"
 #include "shape/CollisionTriangleShape.h"
 
 namespace urchin {
     class NarrowPhase {
         public:
-            NarrowPhase(const BodyContainer&, const BroadPhase&);
+            NarrowPhase(const BodyContainer&, const BroadPhase&, WorkerPool&);
 
             void process(float, const std::vector<std::unique_ptr<OverlappingPair>>&, std::vector<ManifoldResult>&) const;
             void processGhostBody(const GhostBody&, std::vector<ManifoldResult>&) const;
+            void storeAccumulatedSolvingData(const std::vector<ManifoldResult>&) const;
+            AlgorithmCounters& getAlgorithmCounters();
+
+            void setSpeculativeContacts(bool);
+            bool isSpeculativeContacts() const;
 
             void continuousCollisionTest(const TemporalObject&, const std::vector<std::shared_ptr<AbstractBody>>&, std::vector<ContinuousCollisionResult<float>>&) const;
+            void continuousCollisionTest(const TemporalObject&, const std::shared_ptr<AbstractBody>&, const PhysicsTransform&, std::vector<ContinuousCollisionResult<float>>&) const;
             void rayTest(const Ray<float>&, const std::vector<std::shared_ptr<AbstractBody>>&, std::vector<ContinuousCollisionResult<float>>&) const;
 
         private:
+            struct PredictiveBody {
+                RigidBody* body;
+                PhysicsTransform from;
+                PhysicsTransform to;
+            };
+            struct SpeculativeContact {
+                AbstractBody* body2;
+                Vector3<float> normalFromObject2;
+                Point3<float> pointOnObject2;
+                float distance;
+            };
+
             void processOverlappingPairs(const std::vector<std::unique_ptr<OverlappingPair>>&, std::vector<ManifoldResult>&) const;
-            void processOverlappingPair(OverlappingPair&, std::vector<ManifoldResult>&) const;
+            bool processOverlappingPair(OverlappingPair&, std::vector<ManifoldResult>&) const;
+            std::pair<PhysicsTransform, PhysicsTransform> snapshotTransforms(const AbstractBody&, const AbstractBody&) const;
             CollisionAlgorithm* retrieveCollisionAlgorithm(OverlappingPair&) const;
+            bool canReuseCollisionResult(const OverlappingPair&, const PhysicsTransform&) const;
 
             void processPredictiveContacts(float, std::vector<ManifoldResult>&) const;
             void handleContinuousCollision(AbstractBody&, const PhysicsTransform&, const PhysicsTransform&, std::vector<ManifoldResult>&) const;
-            void trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape>&, const TemporalObject&, const std::shared_ptr<AbstractBody>&, std::vector<ContinuousCollisionResult<float>>&) const;
+            void processSpeculativeContacts(float, std::vector<ManifoldResult>&) const;
+            void speculativeContactsTest(const PredictiveBody&, float, std::vector<ManifoldResult>&) const;
+            void speculativeContactTest(const CollisionShape3D&, const PhysicsTransform&, const PhysicsTransform&, const AbstractBody&, const PhysicsTransform&, const Vector3<float>&, float, SpeculativeContact&) const;
+            void convexSpeculativeContactTest(const CollisionShape3D&, const PhysicsTransform&, const CollisionShape3D&, const PhysicsTransform&, const Vector3<float>&, float, SpeculativeContact&) const;
+            void trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape>&, const TemporalObject&, const std::shared_ptr<AbstractBody>&, const PhysicsTransform&, std::vector<ContinuousCollisionResult<float>>&) const;
             void continuousCollisionTest(const TemporalObject&, const TemporalObject&, std::shared_ptr<AbstractBody>, std::vector<ContinuousCollisionResult<float>>&) const;
 
             const BodyContainer& bodyContainer;
             const BroadPhase& broadPhase;
+            WorkerPool& workerPool;
 
+            mutable AlgorithmCounters algorithmCounters;
             CollisionAlgorithmSelector collisionAlgorithmSelector;
             GJKContinuousCollisionAlgorithm<double, float> gjkContinuousCollisionAlgorithm;
+            GJKAlgorithm<double> gjkAlgorithm;
+            bool speculativeContacts;
 
             std::shared_ptr<LockById> bodiesMutex;
 
+            static constexpr std::size_t MIN_PAIRS_BY_WORKER = 16;
+            mutable std::vector<std::vector<ManifoldResult>> workersManifoldResults;
+            mutable std::vector<std::vector<CollisionAlgorithm*>> workersCollisionAlgorithms;
+            mutable std::vector<CollisionAlgorithm*> manifoldResultsCollisionAlgorithm; //persistent collision algorithm of each manifold result of the overlapping pairs
+
+            mutable std::vector<PredictiveBody> speculativeBodies; //fast bodies for which speculative contacts are generated
+
+            static constexpr float MAX_REUSE_TRANSLATION = 0.001f;
+            static constexpr float MIN_REUSE_ORIENTATION_DOT = 0.999997f; //cosine of half the rotation angle: rotation of 0.005 radian
+
+            static constexpr std::size_t MIN_SPECULATIVE_BODIES_BY_WORKER = 8;
+            static constexpr std::size_t MAX_SPECULATIVE_CONTACTS_BY_BODY = 4; //bound the solver work of a fast body moving through many bodies
+
             static thread_local std::vector<OverlappingPair> overlappingPairsCache;
+            static thread_local std::vector<CollisionTriangleShape> trianglesCache;
+            static thread_local std::vector<std::shared_ptr<AbstractBody>> bodiesAABBoxHitCache;
+            static thread_local std::vector<SpeculativeContact> speculativeContactsCache;
     };
 
 }
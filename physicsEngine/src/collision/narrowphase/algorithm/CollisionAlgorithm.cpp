@@ -26,6 +26,22 @@ namespace urchin {
         }
     }
 
+    /**
+     * Refresh the contact points of the manifold result without executing the collision algorithm
+     */
+    void CollisionAlgorithm::refreshContactPoints() {
+        ScopeProfiler sp(Profiler::physics(), "reContactPts");
+
+        manifoldResult.refreshContactPoints();
+    }
+
+    /**
+     * @param solvedManifoldResult Copy of the manifold result on which the constraint solver stored the accumulated solving data
+     */
+    void CollisionAlgorithm::storeAccumulatedSolvingData(const ManifoldResult& solvedManifoldResult) {
+        manifoldResult.copyAccumulatedSolvingData(solvedManifoldResult);
+    }
+
     const ManifoldResult& CollisionAlgorithm::getConstManifoldResult() const {
         return manifoldResult;
     }
@@ -50,12 +66,6 @@ namespace urchin {
         manifoldResult.addContactPoint(normalFromObject2, pointOnObject2, depth, false);
     }
 
-    void CollisionAlgorithm::refreshContactPoints() {
-        ScopeProfiler sp(Profiler::physics(), "reContactPts");
-
-        manifoldResult.refreshContactPoints();
-    }
-
     float CollisionAlgorithm::getContactBreakingThreshold() const {
         return manifoldResult.getContactBreakingThreshold();
     }
@@ -15,6 +15,8 @@ namespace urchin {
             void setupCollisionAlgorithmSelector(const CollisionAlgorithmSelector*);
 
             void processCollisionAlgorithm(const CollisionObjectWrapper&, const CollisionObjectWrapper&, bool);
+            void refreshContactPoints();
+            void storeAccumulatedSolvingData(const ManifoldResult&);
 
             bool isObjectSwapped() const;
             const ManifoldResult& getConstManifoldResult() const;
@@ -29,8 +31,6 @@ namespace urchin {
             float getContactBreakingThreshold() const;
 
         private:
-            void refreshContactPoints();
-
             bool objectSwapped;
             ManifoldResult manifoldResult;
 
@@ -19,7 +19,11 @@ namespace urchin {
         algorithmPool->deallocate(collisionAlgorithm);
     }
 
-    CollisionAlgorithmSelector::CollisionAlgorithmSelector() :
+    /**
+     * @param algorithmCounters Counters incremented by the collision algorithms created by this selector
+     */
+    CollisionAlgorithmSelector::CollisionAlgorithmSelector(AlgorithmCounters& algorithmCounters) :
+            algorithmCounters(algorithmCounters),
             algorithmPool(std::unique_ptr<SyncFixedSizePool<CollisionAlgorithm>>(nullptr)) {
         initializeCollisionAlgorithmBuilderMatrix();
         for (unsigned int i = 0; i < CollisionShape3D::SHAPE_MAX; ++i) {
@@ -59,12 +63,14 @@ namespace urchin {
     }
 
     void CollisionAlgorithmSelector::initializeConcaveAlgorithm() {
-        //heightfield shape
-        for (unsigned int shapeId = 0; shapeId < CollisionShape3D::SHAPE_MAX; ++shapeId) {
-            collisionAlgorithmBuilderMatrix[CollisionShape3D::HEIGHTFIELD_SHAPE][shapeId] = std::make_unique<ConcaveAnyCollisionAlgorithm::Builder>();
+        //heightfield and triangle mesh shapes
+        for (CollisionShape3D::ShapeType concaveShapeType : CollisionShape3D::concaveShapes()) {
+            for (unsigned int shapeId = 0; shapeId < CollisionShape3D::SHAPE_MAX; ++shapeId) {
+                collisionAlgorithmBuilderMatrix[concaveShapeType][shapeId] = std::make_unique<ConcaveAnyCollisionAlgorithm::Builder>();
 
-            if (shapeId != CollisionShape3D::HEIGHTFIELD_SHAPE) {
-                collisionAlgorithmBuilderMatrix[shapeId][CollisionShape3D::HEIGHTFIELD_SHAPE] = std::make_unique<ConcaveAnyCollisionAlgorithm::Builder>();
+                if (shapeId != concaveShapeType) {
+                    collisionAlgorithmBuilderMatrix[shapeId][concaveShapeType] = std::make_unique<ConcaveAnyCollisionAlgorithm::Builder>();
+                }
             }
         }
     }
@@ -118,4 +124,8 @@ namespace urchin {
         return collisionAlgorithm;
     }
 
+    AlgorithmCounters& CollisionAlgorithmSelector::getAlgorithmCounters() const {
+        return algorithmCounters;
+    }
+
 }
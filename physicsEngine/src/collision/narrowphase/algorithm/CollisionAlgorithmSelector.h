@@ -6,6 +6,7 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "utils/pool/SyncFixedSizePool.h"
+#include "metrics/AlgorithmCounters.h"
 
 namespace urchin {
 
@@ -21,10 +22,11 @@ namespace urchin {
 
     class CollisionAlgorithmSelector {
         public:
-            CollisionAlgorithmSelector();
+            explicit CollisionAlgorithmSelector(AlgorithmCounters&);
 
             std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> createCollisionAlgorithm(
                     AbstractBody&, const CollisionShape3D&, AbstractBody&, const CollisionShape3D&) const;
+            AlgorithmCounters& getAlgorithmCounters() const;
 
         private:
             void initializeCollisionAlgorithmBuilderMatrix();
@@ -33,6 +35,7 @@ namespace urchin {
 
             void initializeAlgorithmPool();
 
+            AlgorithmCounters& algorithmCounters;
             std::shared_ptr<SyncFixedSizePool<CollisionAlgorithm>> algorithmPool;
             std::array<std::array<std::unique_ptr<CollisionAlgorithmBuilder>, CollisionShape3D::SHAPE_MAX>, CollisionShape3D::SHAPE_MAX> collisionAlgorithmBuilderMatrix;
     };
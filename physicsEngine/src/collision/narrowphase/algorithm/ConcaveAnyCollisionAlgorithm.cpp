@@ -7,6 +7,10 @@
 
 namespace urchin {
 
+    //static
+    thread_local std::deque<std::vector<CollisionTriangleShape>> ConcaveAnyCollisionAlgorithm::trianglesCaches;
+    thread_local std::size_t ConcaveAnyCollisionAlgorithm::nestingLevel = 0;
+
     ConcaveAnyCollisionAlgorithm::ConcaveAnyCollisionAlgorithm(bool objectSwapped, const ManifoldResult& result) :
             CollisionAlgorithm(objectSwapped, result) {
 
@@ -23,8 +27,15 @@ namespace urchin {
         AABBox<float> aabboxLocalToObject1 = object2.getShape().toAABBox(object1.getShapeWorldTransform().inverse() * object2.getShapeWorldTransform());
         const auto& concaveShape = dynamic_cast<const CollisionConcaveShape&>(object1.getShape());
 
-        const std::vector<CollisionTriangleShape>& triangles = concaveShape.findTrianglesInAABBox(aabboxLocalToObject1);
-        for (const auto& triangle : triangles) {
+        //a concave shape tested against another concave shape re-enters this algorithm for each triangle: the nested call must not refill the iterated cache
+        if (trianglesCaches.size() == nestingLevel) {
+            trianglesCaches.emplace_back();
+        }
+        std::vector<CollisionTriangleShape>& trianglesCache = trianglesCaches[nestingLevel];
+        NestingLevelGuard nestingLevelGuard; //nesting level restored even when a nested algorithm throws
+
+        concaveShape.findTrianglesInAABBox(aabboxLocalToObject1, trianglesCache);
+        for (const auto& triangle : trianglesCache) {
             auto collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(body1, triangle, body2, otherShape);
 
             CollisionObjectWrapper subObject1(triangle, object1.getShapeWorldTransform());
@@ -37,6 +48,14 @@ namespace urchin {
         }
     }
 
+    ConcaveAnyCollisionAlgorithm::NestingLevelGuard::NestingLevelGuard() {
+        nestingLevel++;
+    }
+
+    ConcaveAnyCollisionAlgorithm::NestingLevelGuard::~NestingLevelGuard() {
+        nestingLevel--;
+    }
+
     void ConcaveAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult& manifoldResult, bool manifoldSwapped) {
         for (unsigned int i = 0; i < manifoldResult.getNumContactPoints(); ++i) {
             const ManifoldContactPoint& manifoldContactPoint = manifoldResult.getManifoldContactPoint(i);
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <deque>
+#include <vector>
+
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionTriangleShape.h"
 
 namespace urchin {
 
@@ -22,7 +26,18 @@ namespace urchin {
             };
 
         private:
+            class NestingLevelGuard {
+                public:
+                    NestingLevelGuard();
+                    NestingLevelGuard(const NestingLevelGuard&) = delete;
+                    NestingLevelGuard& operator=(const NestingLevelGuard&) = delete;
+                    ~NestingLevelGuard();
+            };
+
             void addContactPointsToManifold(const ManifoldResult&, bool);
+
+            static thread_local std::deque<std::vector<CollisionTriangleShape>> trianglesCaches; //one cache by nesting level
+            static thread_local std::size_t nestingLevel;
     };
 
 }
@@ -1,13 +1,15 @@
 #include <memory>
 
 #include "collision/narrowphase/algorithm/ConvexConvexCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/narrowphase/algorithm/gjk/GJKConvexObjectWrapper.h"
 #include "object/CollisionConvexObject3D.h"
 
 namespace urchin {
 
     ConvexConvexCollisionAlgorithm::ConvexConvexCollisionAlgorithm(bool objectSwapped, const ManifoldResult& result) :
-            CollisionAlgorithm(objectSwapped, result) {
+            CollisionAlgorithm(objectSwapped, result),
+            separatingAxis(Vector3<double>(-1.0, 0.0, 0.0)) {
 
     }
 
@@ -19,7 +21,10 @@ namespace urchin {
         std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject2 = object2.getShape().toConvexObject(object2.getShapeWorldTransform());
 
         //process GJK and EPA hybrid algorithms
-        GJKResult<double> gjkResultWithoutMargin = gjkAlgorithm.processGJK(GJKConvexObjectWrapper(*convexObject1, false), GJKConvexObjectWrapper(*convexObject2, false));
+        float sumMargins = convexObject1->getOuterMargin() + convexObject2->getOuterMargin();
+        auto earlyOutDistance = (double)(sumMargins + getContactBreakingThreshold()); //no contact point beyond this distance
+        GJKResult<double> gjkResultWithoutMargin = gjkAlgorithm.processGJK(GJKConvexObjectWrapper(*convexObject1, false), GJKConvexObjectWrapper(*convexObject2, false), separatingAxis, earlyOutDistance);
+        getCollisionAlgorithmSelector()->getAlgorithmCounters().addGJKIterations(gjkResultWithoutMargin.getIterationsCount());
 
         if (gjkResultWithoutMargin.isValidResult()) {
             if (gjkResultWithoutMargin.isCollide()) { //collision detected on reduced objects (without margins)
@@ -27,7 +32,9 @@ namespace urchin {
             } else { //collision detected on enlarged objects (with margins) OR no collision detected
                 Vector3<double> vectorBA = gjkResultWithoutMargin.getClosestPointB().vector(gjkResultWithoutMargin.getClosestPointA());
                 auto vectorBALength = (float)vectorBA.length();
-                float sumMargins = convexObject1->getOuterMargin() + convexObject2->getOuterMargin();
+                if (vectorBALength > 0.0f) {
+                    separatingAxis = vectorBA / (double)vectorBALength; //cache the axis for the next frame: objects move slightly between two frames
+                }
                 if (sumMargins > vectorBALength - getContactBreakingThreshold()) { //collision detected on enlarged objects
                     Vector3<double> normalFromObject2 = vectorBA.normalize();
                     Point3<double> pointOnObject2 = gjkResultWithoutMargin.getClosestPointB().translate(normalFromObject2 * (double)convexObject2->getOuterMargin());
@@ -41,9 +48,11 @@ namespace urchin {
 
     void ConvexConvexCollisionAlgorithm::processCollisionAlgorithmWithMargin(const CollisionConvexObject3D& convexObject1, const CollisionConvexObject3D& convexObject2) {
         GJKResult<double> gjkResultWithMargin = gjkAlgorithm.processGJK(GJKConvexObjectWrapper(convexObject1, true), GJKConvexObjectWrapper(convexObject2, true));
+        getCollisionAlgorithmSelector()->getAlgorithmCounters().addGJKIterations(gjkResultWithMargin.getIterationsCount());
 
         if (gjkResultWithMargin.isValidResult() && gjkResultWithMargin.isCollide()) {
             EPAResult<double> epaResult = epaAlgorithm.processEPA(convexObject1, convexObject2, gjkResultWithMargin);
+            getCollisionAlgorithmSelector()->getAlgorithmCounters().addEPAIterations(epaResult.getIterationsCount());
 
             if (epaResult.isValidResult() && epaResult.isCollide()) { //should be always true except for problems due to float imprecision
                 const Vector3<double>& normalFromObject2 = (-epaResult.getNormal());
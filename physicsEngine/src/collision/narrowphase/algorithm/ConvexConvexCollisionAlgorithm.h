@@ -29,6 +29,7 @@ namespace urchin {
 
             GJKAlgorithm<double> gjkAlgorithm;
             EPAAlgorithm<double> epaAlgorithm;
+            Vector3<double> separatingAxis; //last axis separating the objects: used to speed up the GJK algorithm
     };
 
 }
@@ -24,42 +24,26 @@ namespace urchin {
             return EPAResult<T>::newNoCollideResult();
         }
 
-        //2. initialize global variables
-        std::map<std::size_t, Point3<T>> supportPointsA; //first: index of point in convex hull, second: support points
-        std::map<std::size_t, Point3<T>> supportPointsB; //first: index of point in convex hull, second: support points
-        std::map<std::size_t, EPATriangleData<T>> trianglesData; //first: index of triangle in convex hull, second: EPA triangle data
-
-        //3. create initial convex hull
-        std::map<std::size_t, ConvexHullPoint<T>> convexHullPoints;
-        std::map<std::size_t, IndexedTriangle3D<T>> indexedTriangles;
-
-        determineInitialPoints(simplex, convexObject1, convexObject2, convexHullPoints, supportPointsA, supportPointsB);
-        if (convexHullPoints.size() >= 4) {
-            determineInitialTriangles(convexHullPoints, indexedTriangles);
+        //2. create initial polytope
+        std::array<EPAVertex<T>, 4> initialVertices;
+        if (!determineInitialPoints(simplex, convexObject1, convexObject2, initialVertices) || !polytope.initialize(initialVertices)) {
+            //due to numerical imprecision, it's impossible to create the initial polytope correctly
+            return EPAResult<T>::newInvalidResult(0);
         }
 
-        if (indexedTriangles.size() != 4) {//due to numerical imprecision, it's impossible to create indexed triangles correctly
-            return EPAResult<T>::newInvalidResult();
-        }
-
-        ConvexHullShape3D<T> convexHullShape(convexHullPoints, indexedTriangles);
-        for (auto it = indexedTriangles.begin(); it != indexedTriangles.end(); ++it) {
-            trianglesData.emplace(it->first, createTriangleData(convexHullShape, it->first));
-        }
-
-        //4. find closest plane of extended polytope
+        //3. find closest plane of extended polytope
         T upperBoundPenDepth = std::numeric_limits<T>::max();
-        typename std::map<std::size_t, EPATriangleData<T>>::const_iterator itClosestTriangleData;
+        uint32_t closestFaceIndex;
         unsigned int iterationNumber = 0;
         Vector3<T> normal;
         T distanceToOrigin;
 
         while (true) {
-            itClosestTriangleData = getClosestTriangleData(trianglesData);
-            const EPATriangleData<T>& closestTriangleData = itClosestTriangleData->second;
+            closestFaceIndex = polytope.findClosestFace();
+            const EPAFace<T>& closestFace = polytope.getFace(closestFaceIndex);
 
-            normal = closestTriangleData.getNormal();
-            distanceToOrigin = closestTriangleData.getDistanceToOrigin();
+            normal = closestFace.normal;
+            distanceToOrigin = closestFace.distanceToOrigin;
 
             if (iterationNumber > MAX_ITERATION) { //can happen on spherical forms where EPA algorithm doesn't progress enough fast
                 break;
@@ -73,44 +57,27 @@ namespace urchin {
             upperBoundPenDepth = std::min(upperBoundPenDepth, std::abs(minkowskiDiffPoint.toVector().dotProduct(normal)));
             bool closeEnough = upperBoundPenDepth <= (1.0 + TERMINATION_TOLERANCE) * distanceToOrigin;
 
-            if (!closeEnough) { //polytope can be extended in direction of normal: add a new point
-                std::vector<std::size_t> removedTriangleIndices;
-                std::size_t index = convexHullShape.addNewPoint(minkowskiDiffPoint, removedTriangleIndices);
-                if (index == 0) { //finally, polytope cannot be extended in direction of normal. Cause: numerical imprecision.
-                    break;
-                }
-
-                //compute new triangles data
-                const std::vector<std::size_t>& newTriangleIndices = convexHullShape.getConvexHullPoints().at(index).triangleIndices;
-                for (std::size_t newTriangleIndex : newTriangleIndices) {
-                    trianglesData.emplace(newTriangleIndex, createTriangleData(convexHullShape, newTriangleIndex));
-                }
-
-                //remove triangle data not used anymore
-                for (std::size_t removedTriangleIndex : removedTriangleIndices) {
-                    trianglesData.erase(removedTriangleIndex);
-                }
-
-                //save support points
-                supportPointsA[index] = supportPointNormal;
-                supportPointsB[index] = supportPointMinusNormal;
-            } else { //polytope cannot be extended in direction of normal: solution is found
+            if (closeEnough) { //polytope cannot be extended in direction of normal: solution is found
                 break;
             }
+
+            //polytope can be extended in direction of normal: add a new point
+            if (!polytope.addVertex(EPAVertex<T>{minkowskiDiffPoint, supportPointNormal, supportPointMinusNormal}, closestFaceIndex)) {
+                break; //finally, polytope cannot be extended in direction of normal. Cause: numerical imprecision.
+            }
             iterationNumber++;
         }
 
-        //5. compute EPA result: normal, penetration depth and contact points of collision
-        const EPATriangleData<T>& closestTriangleData = itClosestTriangleData->second;
-        const IndexedTriangle3D<T>& indexedTriangle = convexHullShape.getIndexedTriangles().at(itClosestTriangleData->first);
-        const std::size_t pointIndex1 = indexedTriangle.getIndex(0);
-        const std::size_t pointIndex2 = indexedTriangle.getIndex(1);
-        const std::size_t pointIndex3 = indexedTriangle.getIndex(2);
+        //4. compute EPA result: normal, penetration depth and contact points of collision
+        const EPAFace<T>& closestFace = polytope.getFace(closestFaceIndex);
+        const EPAVertex<T>& vertex1 = polytope.getVertex(closestFace.vertexIndices[0]);
+        const EPAVertex<T>& vertex2 = polytope.getVertex(closestFace.vertexIndices[1]);
+        const EPAVertex<T>& vertex3 = polytope.getVertex(closestFace.vertexIndices[2]);
 
-        const Point3<T> contactPointA = closestTriangleData.getBarycentric(0) * supportPointsA[pointIndex1] + closestTriangleData.getBarycentric(1) * supportPointsA[pointIndex2]
-                + closestTriangleData.getBarycentric(2) * supportPointsA[pointIndex3];
-        const Point3<T> contactPointB = closestTriangleData.getBarycentric(0) * supportPointsB[pointIndex1] + closestTriangleData.getBarycentric(1) * supportPointsB[pointIndex2]
-                + closestTriangleData.getBarycentric(2) * supportPointsB[pointIndex3];
+        const Point3<T> contactPointA = closestFace.barycentrics[0] * vertex1.supportPointA + closestFace.barycentrics[1] * vertex2.supportPointA
+                + closestFace.barycentrics[2] * vertex3.supportPointA;
+        const Point3<T> contactPointB = closestFace.barycentrics[0] * vertex1.supportPointB + closestFace.barycentrics[1] * vertex2.supportPointB
+                + closestFace.barycentrics[2] * vertex3.supportPointB;
 
         if (DebugCheck::additionalChecksEnable()) {
             const T distanceDelta = contactPointA.vector(contactPointB).length() - distanceToOrigin;
@@ -119,7 +86,7 @@ namespace urchin {
             }
         }
 
-        return EPAResult<T>::newCollideResult(contactPointA, contactPointB, normal, distanceToOrigin);
+        return EPAResult<T>::newCollideResult(contactPointA, contactPointB, normal, distanceToOrigin, iterationNumber);
     }
 
     template<class T> EPAResult<T> EPAAlgorithm<T>::handleSubTriangle(const CollisionConvexObject3D& convexObject1, const CollisionConvexObject3D& convexObject2) const {
@@ -141,7 +108,7 @@ namespace urchin {
             otherObject = &convexObject1;
             needSwap = true;
         } else {
-            return EPAResult<T>::newInvalidResult();
+            return EPAResult<T>::newInvalidResult(0);
         }
 
         Triangle3D<float> triangle = triangleObject->retrieveTriangle();
@@ -153,25 +120,23 @@ namespace urchin {
             Vector3<T> normal = contactPointOther.vector(contactPointTriangle).normalize().cast<T>();
 
             if (needSwap) {
-                return EPAResult<T>::newCollideResult(contactPointOther.cast<T>(), contactPointTriangle.cast<T>(), -normal, distanceToOrigin);
+                return EPAResult<T>::newCollideResult(contactPointOther.cast<T>(), contactPointTriangle.cast<T>(), -normal, distanceToOrigin, 0);
             }
 
-            return EPAResult<T>::newCollideResult(contactPointTriangle.cast<T>(), contactPointOther.cast<T>(), normal, distanceToOrigin);
+            return EPAResult<T>::newCollideResult(contactPointTriangle.cast<T>(), contactPointOther.cast<T>(), normal, distanceToOrigin, 0);
         }
 
-        return EPAResult<T>::newInvalidResult();
+        return EPAResult<T>::newInvalidResult(0);
     }
 
     /**
      * Determine initial points useful for EPA algorithm: points of initial convex hull as well as the linked support points
      * @param simplex Simplex resulting from GJK algorithm
-     * @param convexHullPoints [out] Initial points for EPA algorithm
-     * @param supportPointsA [out] Support points of object A used to compute indexed points
-     * @param supportPointsB [out] Support points of object B used to compute indexed points
+     * @param initialVertices [out] Vertices of the initial tetrahedron containing the origin with the linked support points
+     * @return False when no tetrahedron containing the origin is found due to numerical imprecision
      */
-    template<class T> void EPAAlgorithm<T>::determineInitialPoints(const Simplex<T>& simplex, const CollisionConvexObject3D& convexObject1,
-            const CollisionConvexObject3D& convexObject2, std::map<std::size_t, ConvexHullPoint<T>>& convexHullPoints,
-            std::map<std::size_t, Point3<T>>& supportPointsA, std::map<std::size_t, Point3<T>>& supportPointsB) const {
+    template<class T> bool EPAAlgorithm<T>::determineInitialPoints(const Simplex<T>& simplex, const CollisionConvexObject3D& convexObject1,
+            const CollisionConvexObject3D& convexObject2, std::array<EPAVertex<T>, 4>& initialVertices) const {
         if (simplex.getSize() == 2) { //simplex is a segment line containing the origin
             //compute normalized direction vector
             const Vector3<T> lineDirection = simplex.getPoint(0).vector(simplex.getPoint(1)).normalize();
@@ -208,30 +173,23 @@ namespace urchin {
                     convexObject2.getSupportPoint((-v2).template cast<float>(), true).template cast<T>(),
                     convexObject2.getSupportPoint((-v3).template cast<float>(), true).template cast<T>()};
 
+            std::array<EPAVertex<T>, 5> vertices;
             for (std::size_t i = 0; i < 2; ++i) {
-                convexHullPoints[i].point = simplex.getPoint(i);
-                supportPointsA[i] = simplex.getSupportPointA(i);
-                supportPointsB[i] = simplex.getSupportPointB(i);
+                vertices[i] = EPAVertex<T>{simplex.getPoint(i), simplex.getSupportPointA(i), simplex.getSupportPointB(i)};
             }
             for (std::size_t i = 0; i < 3; ++i) {
-                convexHullPoints[i + 2].point = supportPoints[i] - supportPointsMinus[i];
-                supportPointsA[i + 2] = supportPoints[i];
-                supportPointsB[i + 2] = supportPointsMinus[i];
+                vertices[i + 2] = EPAVertex<T>{supportPoints[i] - supportPointsMinus[i], supportPoints[i], supportPointsMinus[i]};
             }
 
             //keep only the tetrahedron containing the origin
-            if (Tetrahedron<T>(convexHullPoints[0].point, convexHullPoints[2].point, convexHullPoints[3].point, convexHullPoints[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
+            if (Tetrahedron<T>(vertices[0].point, vertices[2].point, vertices[3].point, vertices[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
                 //we use the point 4 instead of point 1 for the initial tetrahedron
-                convexHullPoints[1].point = convexHullPoints[4].point;
-                supportPointsA[1] = supportPointsA[4];
-                supportPointsB[1] = supportPointsB[4];
-            } else if (Tetrahedron<T>(convexHullPoints[4].point, convexHullPoints[1].point, convexHullPoints[2].point, convexHullPoints[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
+                initialVertices = {vertices[0], vertices[4], vertices[2], vertices[3]};
+            } else if (Tetrahedron<T>(vertices[4].point, vertices[1].point, vertices[2].point, vertices[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
                 //we use the point 4 instead of point 0 for the initial tetrahedron
-                convexHullPoints[0].point = convexHullPoints[4].point;
-                supportPointsA[0] = supportPointsA[4];
-                supportPointsB[0] = supportPointsB[4];
+                initialVertices = {vertices[4], vertices[1], vertices[2], vertices[3]};
             } else { //no tetrahedron containing the origin due to float imprecision
-                convexHullPoints.clear();
+                return false;
             }
         } else if (simplex.getSize() == 3) { //simplex is a triangle containing the origin
             //create two vectors based on three points
@@ -248,136 +206,29 @@ namespace urchin {
                     convexObject2.getSupportPoint((-v2).template cast<float>(), true).template cast<T>()};
 
             for (std::size_t i = 0; i < 3; ++i) {
-                convexHullPoints[i].point = simplex.getPoint(i);
-                supportPointsA[i] = simplex.getSupportPointA(i);
-                supportPointsB[i] = simplex.getSupportPointB(i);
-            }
-            for (std::size_t i = 0; i < 2; ++i) {
-                convexHullPoints[i+3].point = supportPoints[i] - supportPointsMinus[i];
-                supportPointsA[i+3] = supportPoints[i];
-                supportPointsB[i+3] = supportPointsMinus[i];
+                initialVertices[i] = EPAVertex<T>{simplex.getPoint(i), simplex.getSupportPointA(i), simplex.getSupportPointB(i)};
             }
+            std::array<EPAVertex<T>, 2> extraVertices = {
+                    EPAVertex<T>{supportPoints[0] - supportPointsMinus[0], supportPoints[0], supportPointsMinus[0]},
+                    EPAVertex<T>{supportPoints[1] - supportPointsMinus[1], supportPoints[1], supportPointsMinus[1]}};
 
             //keep only the tetrahedron containing the origin
-            if (Tetrahedron<T>(convexHullPoints[0].point, convexHullPoints[1].point, convexHullPoints[2].point, convexHullPoints[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
-                //we use the 4 first point - nothing to do
-            } else if (Tetrahedron<T>(convexHullPoints[0].point, convexHullPoints[1].point, convexHullPoints[2].point, convexHullPoints[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
+            if (Tetrahedron<T>(initialVertices[0].point, initialVertices[1].point, initialVertices[2].point, extraVertices[0].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
+                initialVertices[3] = extraVertices[0];
+            } else if (Tetrahedron<T>(initialVertices[0].point, initialVertices[1].point, initialVertices[2].point, extraVertices[1].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0))) {
                 //we use the point 4 instead of point 3 for the initial tetrahedron
-                convexHullPoints[3].point = convexHullPoints[4].point;
-                supportPointsA[3] = supportPointsA[4];
-                supportPointsB[3] = supportPointsB[4];
+                initialVertices[3] = extraVertices[1];
             } else { //no tetrahedron containing the origin due to float imprecision
-                convexHullPoints.clear();
+                return false;
             }
         } else if (simplex.getSize() == 4) { //simplex is a tetrahedron containing the origin
             for (std::size_t i = 0; i < 4; ++i) {
-                convexHullPoints[i].point = simplex.getPoint(i);
-                supportPointsA[i] = simplex.getSupportPointA(i);
-                supportPointsB[i] = simplex.getSupportPointB(i);
+                initialVertices[i] = EPAVertex<T>{simplex.getPoint(i), simplex.getSupportPointA(i), simplex.getSupportPointB(i)};
             }
         } else {
             throw std::invalid_argument("Size of simplex unsupported: " + std::to_string(simplex.getSize()) + ".");
         }
-    }
-
-    /**
-     * Determine triangles of initial convex hull of EPA algorithm. Normal of triangle must be outside the convex hull.
-     * @param convexHullPoints [in/out] Points of initial convex hull. Linked triangles to points are updated.
-     * @param indexedTriangles [out] Triangle of initial convex hull. When points are too close together or almost on same
-     * plane: the indexed triangles can be incomplete
-     */
-    template<class T> void EPAAlgorithm<T>::determineInitialTriangles(std::map<std::size_t, ConvexHullPoint<T>>& convexHullPoints,
-            std::map<std::size_t, IndexedTriangle3D<T>>& indexedTriangles) const {
-        for (std::size_t i = 0; i < 3; ++i) {
-            for (std::size_t j = i + 1; j < 4; ++j) {
-                T distance = convexHullPoints.at(i).point.vector(convexHullPoints.at(j).point).length();
-                T minPointsDistance = (std::nextafter(distance, std::numeric_limits<T>::max()) - distance) * (T)10.0;
-
-                if (distance < minPointsDistance) {
-                    return;
-                }
-            }
-        }
-
-        std::array<std::array<std::size_t, 3>, 4> indices = {{{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}}};
-        std::array<std::array<std::size_t, 3>, 4> revIndices = {{{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}}};
-        for (std::size_t i = 0; i < indices.size(); ++i) {
-            const std::size_t pointOutsideTriangle = 6 - (indices[i][0] + indices[i][1] + indices[i][2]);
-            const Vector3<T> normalTriangle = IndexedTriangle3D<T>(indices[i].data()).computeNormal(
-                    convexHullPoints.at(indices[i][0]).point,
-                    convexHullPoints.at(indices[i][1]).point,
-                    convexHullPoints.at(indices[i][2]).point);
-            const Vector3<T> trianglePointToOutsidePoint = convexHullPoints.at(indices[i][0]).point.vector(convexHullPoints.at(pointOutsideTriangle).point);
-            T dotProduct = normalTriangle.dotProduct(trianglePointToOutsidePoint);
-
-            T trianglePointToOutsidePointLength = trianglePointToOutsidePoint.length();
-            T dotProductTolerance = (std::nextafter(trianglePointToOutsidePointLength, std::numeric_limits<T>::max()) - trianglePointToOutsidePointLength);
-
-            if (dotProduct < -dotProductTolerance) {
-                indexedTriangles.emplace(i, IndexedTriangle3D<T>(indices[i].data()));
-                for (std::size_t index : indices[i]) {
-                    convexHullPoints.at(index).triangleIndices.push_back(i);
-                }
-            } else if (dotProduct > dotProductTolerance) {
-                indexedTriangles.emplace(i, IndexedTriangle3D<T>(revIndices[i].data()));
-                for (std::size_t revIndex : revIndices[i]) {
-                    convexHullPoints.at(revIndex).triangleIndices.push_back(i);
-                }
-            } else {
-                return;
-            }
-        }
-    }
-
-    /**
-     * Find closest plane (triangle plane) near the origin
-     * @param trianglesData Triangles data
-     * @return Iterator on closest triangle data
-     */
-    template<class T> typename std::map<std::size_t, EPATriangleData<T>>::const_iterator EPAAlgorithm<T>::getClosestTriangleData(
-            const std::map<std::size_t, EPATriangleData<T>>& trianglesData) const {
-        T minDistanceToOrigin = std::numeric_limits<T>::max();
-        typename std::map<std::size_t, EPATriangleData<T>>::const_iterator closestTriangleData;
-
-        for (auto it = trianglesData.begin(); it != trianglesData.end(); ++it) {
-            const EPATriangleData<T>& triangleData = it->second;
-            T distanceToOrigin = std::abs(triangleData.getDistanceToOrigin());
-
-            if (minDistanceToOrigin > distanceToOrigin) {
-                minDistanceToOrigin = distanceToOrigin;
-                closestTriangleData = it;
-            }
-        }
-
-        return closestTriangleData;
-    }
-
-    /**
-     * @param triangleIndex Index of triangle in convex hull shape used to compute the data
-     * @return Computed triangle data (normal, distance to origin...).
-     */
-    template<class T> EPATriangleData<T> EPAAlgorithm<T>::createTriangleData(const ConvexHullShape3D<T>& convexHullShape, std::size_t triangleIndex) const {
-        const IndexedTriangle3D<T>& indexedTriangle = convexHullShape.getIndexedTriangles().at(triangleIndex);
-        const std::size_t pointIndex1 = indexedTriangle.getIndex(0);
-        const std::size_t pointIndex2 = indexedTriangle.getIndex(1);
-        const std::size_t pointIndex3 = indexedTriangle.getIndex(2);
-
-        const Point3<T>& point1 = convexHullShape.getConvexHullPoints().at(pointIndex1).point;
-        const Point3<T>& point2 = convexHullShape.getConvexHullPoints().at(pointIndex2).point;
-        const Point3<T>& point3 = convexHullShape.getConvexHullPoints().at(pointIndex3).point;
-        const Triangle3D<T> triangle(point1, point2, point3);
-
-        //compute point on the triangle nearest to origin
-        std::array<T, 3> barycentrics{};
-        Point3<T> closestPointToOrigin = triangle.closestPoint(Point3<T>(0.0, 0.0, 0.0), barycentrics);
-
-        //compute minimum distance between triangle and the origin
-        T distanceToOrigin = closestPointToOrigin.toVector().length();
-
-        //compute normal (external to convex hull)
-        const Vector3<T> normal = triangle.computeNormal();
-
-        return EPATriangleData<T>(distanceToOrigin, normal, closestPointToOrigin, barycentrics);
+        return true;
     }
 
     template<class T> void EPAAlgorithm<T>::logInputData(std::string_view errorMessage, const CollisionConvexObject3D& convexObject1,const CollisionConvexObject3D& convexObject2,
@@ -393,6 +244,9 @@ namespace urchin {
         Logger::instance().logError(logStream.str());
     }
 
+    //static
+    template<class T> thread_local EPAPolytope<T> EPAAlgorithm<T>::polytope;
+
     //explicit template
     template class EPAAlgorithm<float>;
     template class EPAAlgorithm<double>;
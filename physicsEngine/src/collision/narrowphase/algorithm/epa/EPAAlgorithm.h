@@ -1,11 +1,11 @@
 #pragma once
 
-#include <map>
+#include <array>
 #include <cmath>
 #include <UrchinCommon.h>
 
 #include "object/CollisionConvexObject3D.h"
-#include "collision/narrowphase/algorithm/epa/EPATriangleData.h"
+#include "collision/narrowphase/algorithm/epa/EPAPolytope.h"
 #include "collision/narrowphase/algorithm/epa/EPAResult.h"
 
 namespace urchin {
@@ -17,17 +17,14 @@ namespace urchin {
         private:
             EPAResult<T> handleSubTriangle(const CollisionConvexObject3D&, const CollisionConvexObject3D&) const;
 
-            void determineInitialPoints(const Simplex<T>&, const CollisionConvexObject3D&, const CollisionConvexObject3D&,
-                    std::map<std::size_t, ConvexHullPoint<T>>&, std::map<std::size_t, Point3<T>>&, std::map<std::size_t, Point3<T>>&) const;
-            void determineInitialTriangles(std::map<std::size_t, ConvexHullPoint<T>>&, std::map<std::size_t, IndexedTriangle3D<T>>&) const;
-
-            typename std::map<std::size_t, EPATriangleData<T>>::const_iterator getClosestTriangleData(const std::map<std::size_t, EPATriangleData<T>>&) const;
-            EPATriangleData<T> createTriangleData(const ConvexHullShape3D<T>&, std::size_t) const;
+            bool determineInitialPoints(const Simplex<T>&, const CollisionConvexObject3D&, const CollisionConvexObject3D&, std::array<EPAVertex<T>, 4>&) const;
 
             void logInputData(std::string_view, const CollisionConvexObject3D&, const CollisionConvexObject3D&, const GJKResult<T>&) const;
 
             static constexpr unsigned int MAX_ITERATION = 30;
             static constexpr float TERMINATION_TOLERANCE = 0.01f;
+
+            static thread_local EPAPolytope<T> polytope;
     };
 
 }
@@ -0,0 +1,190 @@
+#include <limits>
+#include <cmath>
+
+#include "collision/narrowphase/algorithm/epa/EPAPolytope.h"
+
+namespace urchin {
+
+    /**
+     * Initialize the polytope with a tetrahedron
+     * @return False when the tetrahedron is degenerated (points too close together or almost on the same plane)
+     */
+    template<class T> bool EPAPolytope<T>::initialize(std::array<EPAVertex<T>, 4> tetrahedronVertices) {
+        vertices.clear();
+        faces.clear();
+
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = i + 1; j < 4; ++j) {
+                T distance = tetrahedronVertices[i].point.vector(tetrahedronVertices[j].point).length();
+                T minPointsDistance = (std::nextafter(distance, std::numeric_limits<T>::max()) - distance) * (T)10.0;
+                if (distance < minPointsDistance) {
+                    return false;
+                }
+            }
+        }
+
+        //orient the tetrahedron to have the fourth point behind the face 0-1-2
+        Vector3<T> normal012 = tetrahedronVertices[0].point.vector(tetrahedronVertices[1].point).crossProduct(tetrahedronVertices[0].point.vector(tetrahedronVertices[2].point));
+        if (normal012.dotProduct(tetrahedronVertices[0].point.vector(tetrahedronVertices[3].point)) > (T)0.0) {
+            std::swap(tetrahedronVertices[1], tetrahedronVertices[2]);
+        }
+        vertices.assign(tetrahedronVertices.begin(), tetrahedronVertices.end());
+
+        constexpr std::array<std::array<uint32_t, 3>, 4> facesIndices = {{{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}}};
+        for (const std::array<uint32_t, 3>& faceIndices : facesIndices) {
+            if (!addFace(faceIndices[0], faceIndices[1], faceIndices[2])) {
+                return false;
+            }
+
+            const EPAFace<T>& face = faces.back();
+            uint32_t pointOutsideFace = 6 - (faceIndices[0] + faceIndices[1] + faceIndices[2]);
+            Vector3<T> facePointToOutsidePoint = vertices[faceIndices[0]].point.vector(vertices[pointOutsideFace].point);
+            T facePointToOutsidePointLength = facePointToOutsidePoint.length();
+            T dotProductTolerance = std::nextafter(facePointToOutsidePointLength, std::numeric_limits<T>::max()) - facePointToOutsidePointLength;
+            if (face.normal.dotProduct(facePointToOutsidePoint) >= -dotProductTolerance) {
+                return false;
+            }
+        }
+
+        for (uint32_t faceIndex = 0; faceIndex < faces.size(); ++faceIndex) {
+            for (uint8_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+                uint32_t edgeStart = faces[faceIndex].vertexIndices[edgeIndex];
+                uint32_t edgeEnd = faces[faceIndex].vertexIndices[(edgeIndex + 1u) % 3u];
+                for (uint32_t otherFaceIndex = faceIndex + 1; otherFaceIndex < faces.size(); ++otherFaceIndex) {
+                    for (uint8_t otherEdgeIndex = 0; otherEdgeIndex < 3; ++otherEdgeIndex) {
+                        if (faces[otherFaceIndex].vertexIndices[otherEdgeIndex] == edgeEnd && faces[otherFaceIndex].vertexIndices[(otherEdgeIndex + 1u) % 3u] == edgeStart) {
+                            linkFaces(faceIndex, edgeIndex, otherFaceIndex, otherEdgeIndex);
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Add a new vertex to the polytope: faces visible from the vertex are removed and new faces are created between the horizon edges and the vertex.
+     * @param visibleFaceIndex Index of a face visible from the new vertex (e.g. face used to compute the support direction of the vertex)
+     * @return False when the polytope cannot be extended with the vertex. Cause: numerical imprecision.
+     */
+    template<class T> bool EPAPolytope<T>::addVertex(const EPAVertex<T>& vertex, uint32_t visibleFaceIndex) {
+        if (!isVisible(faces[visibleFaceIndex], vertex.point)) {
+            return false;
+        }
+
+        //flood fill from the visible face to find the horizon edges
+        horizonEdges.clear();
+        browseEdges.clear();
+        faces[visibleFaceIndex].obsolete = true;
+        for (int edgeIndex = 2; edgeIndex >= 0; --edgeIndex) {
+            browseEdges.emplace_back(faces[visibleFaceIndex].adjacentFaces[(std::size_t)edgeIndex], faces[visibleFaceIndex].adjacentEdges[(std::size_t)edgeIndex]);
+        }
+        while (!browseEdges.empty()) {
+            auto [faceIndex, edgeIndex] = browseEdges.back();
+            browseEdges.pop_back();
+
+            EPAFace<T>& face = faces[faceIndex];
+            if (face.obsolete) {
+                continue;
+            }
+            if (!isVisible(face, vertex.point)) {
+                horizonEdges.emplace_back(faceIndex, edgeIndex);
+                continue;
+            }
+
+            face.obsolete = true;
+            auto nextEdgeIndex = (uint8_t)((edgeIndex + 2) % 3);
+            browseEdges.emplace_back(face.adjacentFaces[nextEdgeIndex], face.adjacentEdges[nextEdgeIndex]);
+            nextEdgeIndex = (uint8_t)((edgeIndex + 1) % 3);
+            browseEdges.emplace_back(face.adjacentFaces[nextEdgeIndex], face.adjacentEdges[nextEdgeIndex]);
+        }
+
+        //create the new faces: one by horizon edge
+        auto newVertexIndex = (uint32_t)vertices.size();
+        vertices.push_back(vertex);
+        auto firstNewFaceIndex = (uint32_t)faces.size();
+        for (auto [horizonFaceIndex, horizonEdgeIndex] : horizonEdges) {
+            const EPAFace<T>& horizonFace = faces[horizonFaceIndex];
+            if (!addFace(horizonFace.vertexIndices[(horizonEdgeIndex + 1u) % 3u], horizonFace.vertexIndices[horizonEdgeIndex], newVertexIndex)) {
+                return false;
+            }
+            linkFaces((uint32_t)faces.size() - 1, 0, horizonFaceIndex, horizonEdgeIndex);
+        }
+
+        //link the new faces together: edge 1 (from horizon edge end to new vertex) is the twin of the edge 2 (from new vertex to horizon edge start) of another new face
+        for (auto faceIndex = firstNewFaceIndex; faceIndex < faces.size(); ++faceIndex) {
+            uint32_t horizonEdgeEnd = faces[faceIndex].vertexIndices[1];
+            bool linked = false;
+            for (auto otherFaceIndex = firstNewFaceIndex; otherFaceIndex < faces.size() && !linked; ++otherFaceIndex) {
+                if (faces[otherFaceIndex].vertexIndices[0] == horizonEdgeEnd) {
+                    linkFaces(faceIndex, 1, otherFaceIndex, 2);
+                    linked = true;
+                }
+            }
+            if (!linked) { //horizon is not a closed loop due to numerical imprecision
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @return Index of the face closest to the origin
+     */
+    template<class T> uint32_t EPAPolytope<T>::findClosestFace() const {
+        T minDistanceToOrigin = std::numeric_limits<T>::max();
+        uint32_t closestFaceIndex = 0;
+        for (uint32_t faceIndex = 0; faceIndex < faces.size(); ++faceIndex) {
+            if (!faces[faceIndex].obsolete && faces[faceIndex].distanceToOrigin < minDistanceToOrigin) {
+                minDistanceToOrigin = faces[faceIndex].distanceToOrigin;
+                closestFaceIndex = faceIndex;
+            }
+        }
+        return closestFaceIndex;
+    }
+
+    template<class T> const EPAFace<T>& EPAPolytope<T>::getFace(uint32_t faceIndex) const {
+        return faces[faceIndex];
+    }
+
+    template<class T> const EPAVertex<T>& EPAPolytope<T>::getVertex(uint32_t vertexIndex) const {
+        return vertices[vertexIndex];
+    }
+
+    /**
+     * @return False when the face is degenerated
+     */
+    template<class T> bool EPAPolytope<T>::addFace(uint32_t vertexIndex1, uint32_t vertexIndex2, uint32_t vertexIndex3) {
+        const Point3<T>& point1 = vertices[vertexIndex1].point;
+        const Point3<T>& point2 = vertices[vertexIndex2].point;
+        const Point3<T>& point3 = vertices[vertexIndex3].point;
+        if (point1.vector(point2).crossProduct(point1.vector(point3)).squareLength() <= (T)0.0) {
+            return false;
+        }
+        const Triangle3D<T> triangle(point1, point2, point3);
+
+        EPAFace<T>& face = faces.emplace_back();
+        face.vertexIndices = {vertexIndex1, vertexIndex2, vertexIndex3};
+        face.normal = triangle.computeNormal();
+        face.distanceToOrigin = triangle.closestPoint(Point3<T>(0.0, 0.0, 0.0), face.barycentrics).toVector().length();
+        face.obsolete = false;
+        return true;
+    }
+
+    template<class T> void EPAPolytope<T>::linkFaces(uint32_t faceIndex1, uint8_t edgeIndex1, uint32_t faceIndex2, uint8_t edgeIndex2) {
+        faces[faceIndex1].adjacentFaces[edgeIndex1] = faceIndex2;
+        faces[faceIndex1].adjacentEdges[edgeIndex1] = edgeIndex2;
+        faces[faceIndex2].adjacentFaces[edgeIndex2] = faceIndex1;
+        faces[faceIndex2].adjacentEdges[edgeIndex2] = edgeIndex1;
+    }
+
+    template<class T> bool EPAPolytope<T>::isVisible(const EPAFace<T>& face, const Point3<T>& point) const {
+        return face.normal.dotProduct(vertices[face.vertexIndices[0]].point.vector(point)) > (T)0.0;
+    }
+
+    //explicit template
+    template class EPAPolytope<float>;
+    template class EPAPolytope<double>;
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <UrchinCommon.h>
+
+namespace urchin {
+
+    template<class T> struct EPAVertex {
+        Point3<T> point; //point of the Minkowski difference: supportPointA - supportPointB
+        Point3<T> supportPointA;
+        Point3<T> supportPointB;
+    };
+
+    template<class T> struct EPAFace {
+        std::array<uint32_t, 3> vertexIndices; //counter-clockwise order when seen from outside
+        std::array<uint32_t, 3> adjacentFaces; //adjacent face of the edge i (from vertex i to vertex (i + 1) % 3)
+        std::array<uint8_t, 3> adjacentEdges; //index of the edge i in the adjacent face
+        Vector3<T> normal; //normal external to the polytope
+        T distanceToOrigin; //minimum distance between the face and the origin
+        std::array<T, 3> barycentrics; //barycentrics of the face point closest to the origin
+        bool obsolete; //face removed from the polytope
+    };
+
+    /**
+    * Convex polytope expanded by the EPA algorithm. Each face edge knows its twin edge in the adjacent face: the faces visible from a new point are found
+    * by a flood fill starting from a visible face instead of testing all the faces of the polytope.
+    */
+    template<class T> class EPAPolytope {
+        public:
+            bool initialize(std::array<EPAVertex<T>, 4>);
+            bool addVertex(const EPAVertex<T>&, uint32_t);
+
+            uint32_t findClosestFace() const;
+            const EPAFace<T>& getFace(uint32_t) const;
+            const EPAVertex<T>& getVertex(uint32_t) const;
+
+        private:
+            bool addFace(uint32_t, uint32_t, uint32_t);
+            void linkFaces(uint32_t, uint8_t, uint32_t, uint8_t);
+            bool isVisible(const EPAFace<T>&, const Point3<T>&) const;
+
+            std::vector<EPAVertex<T>> vertices;
+            std::vector<EPAFace<T>> faces;
+
+            std::vector<std::pair<uint32_t, uint8_t>> browseEdges; //pair of face index and edge index
+            std::vector<std::pair<uint32_t, uint8_t>> horizonEdges; //edges of the non-visible faces bordering the visible faces
+    };
+
+}
@@ -2,25 +2,26 @@
 
 namespace urchin {
 
-    template<class T> EPAResult<T>::EPAResult(bool validResult, const Point3<T>& contactPointA, const Point3<T>& contactPointB, const Vector3<T>& normal, T depth) :
+    template<class T> EPAResult<T>::EPAResult(bool validResult, const Point3<T>& contactPointA, const Point3<T>& contactPointB, const Vector3<T>& normal, T depth, unsigned int iterationsCount) :
             validResult(validResult),
             contactPointA(contactPointA),
             contactPointB(contactPointB),
             normal(normal),
-            depth(depth) {
+            depth(depth),
+            iterationsCount(iterationsCount) {
 
     }
 
-    template<class T> EPAResult<T> EPAResult<T>::newInvalidResult() {
-        return EPAResult<T>(false, Point3<T>(), Point3<T>(), Vector3<T>(), -std::numeric_limits<T>::max());
+    template<class T> EPAResult<T> EPAResult<T>::newInvalidResult(unsigned int iterationsCount) {
+        return EPAResult<T>(false, Point3<T>(), Point3<T>(), Vector3<T>(), -std::numeric_limits<T>::max(), iterationsCount);
     }
 
-    template<class T> EPAResult<T> EPAResult<T>::newCollideResult(const Point3<T>& contactPointA, const Point3<T>& contactPointB, const Vector3<T>& normal, T depth) {
-        return EPAResult<T>(true, contactPointA, contactPointB, normal, depth);
+    template<class T> EPAResult<T> EPAResult<T>::newCollideResult(const Point3<T>& contactPointA, const Point3<T>& contactPointB, const Vector3<T>& normal, T depth, unsigned int iterationsCount) {
+        return EPAResult<T>(true, contactPointA, contactPointB, normal, depth, iterationsCount);
     }
 
     template<class T> EPAResult<T> EPAResult<T>::newNoCollideResult() {
-        return EPAResult<T>(true, Point3<T>(), Point3<T>(), Vector3<T>(), -std::numeric_limits<T>::max());
+        return EPAResult<T>(true, Point3<T>(), Point3<T>(), Vector3<T>(), -std::numeric_limits<T>::max(), 0);
     }
 
     template<class T> bool EPAResult<T>::isValidResult() const {
@@ -74,6 +75,13 @@ namespace urchin {
         return depth;
     }
 
+    /**
+     * @return Number of iterations executed to expand the polytope
+     */
+    template<class T> unsigned int EPAResult<T>::getIterationsCount() const {
+        return iterationsCount;
+    }
+
     //explicit template
     template class EPAResult<float>;
     template class EPAResult<double>;
@@ -6,8 +6,8 @@ namespace urchin {
 
     template<class T> class EPAResult {
         public:
-            static EPAResult<T> newInvalidResult();
-            static EPAResult<T> newCollideResult(const Point3<T>&, const Point3<T>&, const Vector3<T>&, T);
+            static EPAResult<T> newInvalidResult(unsigned int);
+            static EPAResult<T> newCollideResult(const Point3<T>&, const Point3<T>&, const Vector3<T>&, T, unsigned int);
             static EPAResult<T> newNoCollideResult();
 
             bool isValidResult() const;
@@ -17,9 +17,10 @@ namespace urchin {
             const Point3<T>& getContactPointB() const;
             const Vector3<T>& getNormal() const;
             T getPenetrationDepth() const;
+            unsigned int getIterationsCount() const;
 
         private:
-            EPAResult(bool, const Point3<T>&, const Point3<T>&, const Vector3<T>&, T);
+            EPAResult(bool, const Point3<T>&, const Point3<T>&, const Vector3<T>&, T, unsigned int);
 
             bool validResult;
 
@@ -27,6 +28,7 @@ namespace urchin {
             Point3<T> contactPointB;
             Vector3<T> normal;
             T depth;
+            unsigned int iterationsCount;
     };
 
 }
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <utility>
+
+#include "joint/JointContainer.h"
+
+namespace urchin {
+
+    JointContainer::JointContainer(BodyContainer& bodyContainer) :
+            bodyContainer(bodyContainer) {
+        bodyContainer.addObserver(this, BodyContainer::REMOVE_BODY);
+    }
+
+    JointContainer::~JointContainer() {
+        bodyContainer.removeObserver(this, BodyContainer::REMOVE_BODY);
+    }
+
+    void JointContainer::notify(Observable* observable, int notificationType) {
+        if (const auto* notifyingBodyContainer = dynamic_cast<BodyContainer*>(observable)) {
+            if (notificationType == BodyContainer::REMOVE_BODY) {
+                const AbstractBody& removedBody = *notifyingBodyContainer->getLastUpdatedBody();
+                std::erase_if(joints, [this, &removedBody](const auto& joint) {
+                    if (joint->isLinkedToBody(removedBody)) {
+                        wakeUpBodies(*joint);
+                        return true;
+                    }
+                    return false;
+                });
+            }
+        }
+    }
+
+    void JointContainer::addJoint(std::shared_ptr<Joint> joint) {
+        std::scoped_lock lock(jointsMutex);
+        jointsToRefresh.emplace_back(JointRefresh{nullptr, std::move(joint)});
+    }
+
+    void JointContainer::removeJoint(const Joint& joint) {
+        std::scoped_lock lock(jointsMutex);
+        jointsToRefresh.emplace_back(JointRefresh{&joint, std::shared_ptr<Joint>(nullptr)});
+    }
+
+    /**
+     * Refresh joints list. Method must be called by the physics thread after the bodies refresh.
+     */
+    void JointContainer::refreshJoints() {
+        std::scoped_lock lock(jointsMutex);
+
+        for (const auto& jointToRefresh : jointsToRefresh) {
+            if (jointToRefresh.jointToAdd) {
+                if (areBodiesInWorld(*jointToRefresh.jointToAdd)) {
+                    joints.emplace_back(jointToRefresh.jointToAdd);
+                    wakeUpBodies(*jointToRefresh.jointToAdd);
+                } else {
+                    Logger::instance().logWarning("Joint ignored because one of its bodies is not in the world: " + jointToRefresh.jointToAdd->getBody1().getId() + ", " + jointToRefresh.jointToAdd->getBody2().getId());
+                }
+            }
+
+            if (jointToRefresh.jointToRemove) {
+                auto itFind = std::ranges::find_if(joints, [&jointToRefresh](const auto& joint){ return joint.get() == jointToRefresh.jointToRemove; });
+                if (itFind != joints.end()) {
+                    wakeUpBodies(**itFind);
+                    joints.erase(itFind);
+                }
+            }
+        }
+        jointsToRefresh.clear();
+    }
+
+    const std::vector<std::shared_ptr<Joint>>& JointContainer::getJoints() const {
+        return joints;
+    }
+
+    /**
+     * @return True when the bodies of the joint are in the world: a joint added before its bodies or after the removal of one of its bodies is never refreshed
+     * by the body removal notification
+     */
+    bool JointContainer::areBodiesInWorld(const Joint& joint) const {
+        return joint.getBody1().getBodyContainer() == &bodyContainer && joint.getBody2().getBodyContainer() == &bodyContainer;
+    }
+
+    /**
+     * Wake up the bodies of a joint added or removed: the sleeping bodies must react to the new constraints
+     */
+    void JointContainer::wakeUpBodies(const Joint& joint) const {
+        for (RigidBody* body : {&joint.getBody1(), &joint.getBody2()}) {
+            if (!body->isStatic()) {
+                body->setIsActive(true);
+            }
+        }
+    }
+
+}
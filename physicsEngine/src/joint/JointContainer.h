@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+#include "body/BodyContainer.h"
+
+namespace urchin {
+
+    struct JointRefresh {
+        const Joint* jointToRemove;
+        std::shared_ptr<Joint> jointToAdd;
+    };
+
+    /**
+    * A joints manager allowing to add/remove joints from a thread different of the physics thread. The joints are refreshed by the physics thread after
+    * the bodies refresh: the joint bodies must be added in the world before the joint. A joint is removed when one of its bodies is removed from the world.
+    */
+    class JointContainer final : public Observer {
+        public:
+            explicit JointContainer(BodyContainer&);
+            ~JointContainer() override;
+
+            void notify(Observable*, int) override;
+
+            void addJoint(std::shared_ptr<Joint>);
+            void removeJoint(const Joint&);
+            void refreshJoints();
+
+            const std::vector<std::shared_ptr<Joint>>& getJoints() const;
+
+        private:
+            bool areBodiesInWorld(const Joint&) const;
+            void wakeUpBodies(const Joint&) const;
+
+            BodyContainer& bodyContainer;
+
+            std::mutex jointsMutex;
+            std::vector<JointRefresh> jointsToRefresh;
+            std::vector<std::shared_ptr<Joint>> joints;
+    };
+
+}
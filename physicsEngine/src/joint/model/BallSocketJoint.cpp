@@ -0,0 +1,19 @@
+#include "joint/model/BallSocketJoint.h"
+
+namespace urchin {
+
+    /**
+     * @param anchor Anchor point in world space
+     */
+    BallSocketJoint::BallSocketJoint(std::shared_ptr<RigidBody> body1, std::shared_ptr<RigidBody> body2, const Point3<float>& anchor) :
+            Joint(std::move(body1), std::move(body2)),
+            localAnchor1(getBody1().getTransform().inverseTransform(anchor)),
+            localAnchor2(getBody2().getTransform().inverseTransform(anchor)) {
+
+    }
+
+    std::size_t BallSocketJoint::computeRows(std::array<JointRow, MAX_ROWS_COUNT>& rows) const {
+        return computePointRows(localAnchor1, localAnchor2, rows, 0);
+    }
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+
+namespace urchin {
+
+    /**
+    * Ball-socket joint: the bodies share an anchor point and rotate freely around it
+    */
+    class BallSocketJoint final : public Joint {
+        public:
+            BallSocketJoint(std::shared_ptr<RigidBody>, std::shared_ptr<RigidBody>, const Point3<float>&);
+
+            std::size_t computeRows(std::array<JointRow, MAX_ROWS_COUNT>&) const override;
+
+        private:
+            Point3<float> localAnchor1;
+            Point3<float> localAnchor2;
+    };
+
+}
@@ -0,0 +1,64 @@
+#include <limits>
+#include <stdexcept>
+
+#include "joint/model/DistanceJoint.h"
+
+namespace urchin {
+
+    /**
+     * @param anchor1 Anchor point of body 1 in world space
+     * @param anchor2 Anchor point of body 2 in world space
+     * @param minDistance Minimum distance between the anchor points. Use the same value for minimum and maximum distances to keep a constant distance.
+     * @param maxDistance Maximum distance between the anchor points (e.g. rope length)
+     */
+    DistanceJoint::DistanceJoint(std::shared_ptr<RigidBody> body1, std::shared_ptr<RigidBody> body2, const Point3<float>& anchor1, const Point3<float>& anchor2,
+                                 float minDistance, float maxDistance) :
+            Joint(std::move(body1), std::move(body2)),
+            localAnchor1(getBody1().getTransform().inverseTransform(anchor1)),
+            localAnchor2(getBody2().getTransform().inverseTransform(anchor2)),
+            minDistance(minDistance),
+            maxDistance(maxDistance) {
+        if (minDistance < 0.0f || minDistance > maxDistance) {
+            throw std::invalid_argument("Invalid distance range for distance joint: " + std::to_string(minDistance) + " - " + std::to_string(maxDistance));
+        }
+    }
+
+    float DistanceJoint::getMinDistance() const {
+        return minDistance;
+    }
+
+    float DistanceJoint::getMaxDistance() const {
+        return maxDistance;
+    }
+
+    std::size_t DistanceJoint::computeRows(std::array<JointRow, MAX_ROWS_COUNT>& rows) const {
+        PhysicsTransform transform1 = getBody1().getTransform();
+        PhysicsTransform transform2 = getBody2().getTransform();
+        Point3<float> anchor1 = transform1.transform(localAnchor1);
+        Point3<float> anchor2 = transform2.transform(localAnchor2);
+        Vector3<float> anchorsVector = anchor1.vector(anchor2);
+        float distance = anchorsVector.length();
+        if (distance <= std::numeric_limits<float>::epsilon()) {
+            return 0; //direction is undefined
+        }
+
+        Vector3<float> direction = anchorsVector / distance;
+        Vector3<float> r1 = transform1.getPosition().vector(anchor1);
+        Vector3<float> r2 = transform2.getPosition().vector(anchor2);
+        if (minDistance == maxDistance) {
+            fillLinearRow(direction, r1, r2, distance - minDistance, rows[0]);
+        } else if (distance >= maxDistance) {
+            fillLinearRow(direction, r1, r2, distance - maxDistance, rows[0]);
+            rows[0].minImpulse = -std::numeric_limits<float>::max(); //pull the anchor points only
+            rows[0].maxImpulse = 0.0f;
+        } else if (distance <= minDistance) {
+            fillLinearRow(direction, r1, r2, distance - minDistance, rows[0]);
+            rows[0].minImpulse = 0.0f; //push the anchor points only
+            rows[0].maxImpulse = std::numeric_limits<float>::max();
+        } else {
+            return 0;
+        }
+        return 1;
+    }
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+
+namespace urchin {
+
+    /**
+    * Distance joint: the distance between an anchor point of each body stays in a range (e.g. rope, chain link, spring stop)
+    */
+    class DistanceJoint final : public Joint {
+        public:
+            DistanceJoint(std::shared_ptr<RigidBody>, std::shared_ptr<RigidBody>, const Point3<float>&, const Point3<float>&, float, float);
+
+            float getMinDistance() const;
+            float getMaxDistance() const;
+
+            std::size_t computeRows(std::array<JointRow, MAX_ROWS_COUNT>&) const override;
+
+        private:
+            Point3<float> localAnchor1;
+            Point3<float> localAnchor2;
+            float minDistance;
+            float maxDistance;
+    };
+
+}
@@ -0,0 +1,17 @@
+#include "joint/model/FixedJoint.h"
+
+namespace urchin {
+
+    FixedJoint::FixedJoint(std::shared_ptr<RigidBody> body1, std::shared_ptr<RigidBody> body2) :
+            Joint(std::move(body1), std::move(body2)),
+            localAnchor1(getBody1().getTransform().inverseTransform(getBody2().getTransform().getPosition())),
+            localRelativeOrientation(getBody1().getTransform().getOrientation().conjugate() * getBody2().getTransform().getOrientation()) {
+
+    }
+
+    std::size_t FixedJoint::computeRows(std::array<JointRow, MAX_ROWS_COUNT>& rows) const {
+        std::size_t rowIndex = computePointRows(localAnchor1, Point3(0.0f, 0.0f, 0.0f), rows, 0);
+        return computeOrientationRows(localRelativeOrientation, rows, rowIndex);
+    }
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+
+namespace urchin {
+
+    /**
+    * Fixed joint: the bodies keep their relative position and orientation (e.g. breakable assembly)
+    */
+    class FixedJoint final : public Joint {
+        public:
+            FixedJoint(std::shared_ptr<RigidBody>, std::shared_ptr<RigidBody>);
+
+            std::size_t computeRows(std::array<JointRow, MAX_ROWS_COUNT>&) const override;
+
+        private:
+            Point3<float> localAnchor1; //body 2 center of mass in body 1 local space at the joint creation
+            Quaternion<float> localRelativeOrientation;
+    };
+
+}
@@ -0,0 +1,36 @@
+#include "joint/model/HingeJoint.h"
+
+namespace urchin {
+
+    /**
+     * @param anchor Anchor point in world space
+     * @param axis Rotation axis in world space
+     */
+    HingeJoint::HingeJoint(std::shared_ptr<RigidBody> body1, std::shared_ptr<RigidBody> body2, const Point3<float>& anchor, const Vector3<float>& axis) :
+            Joint(std::move(body1), std::move(body2)),
+            localAnchor1(getBody1().getTransform().inverseTransform(anchor)),
+            localAnchor2(getBody2().getTransform().inverseTransform(anchor)),
+            localAxis1(getBody1().getTransform().getOrientation().conjugate().rotateVector(axis.normalize())),
+            localAxis2(getBody2().getTransform().getOrientation().conjugate().rotateVector(axis.normalize())),
+            localPerpendicularAxis1(localAxis1.perpendicularVector().normalize()),
+            localPerpendicularAxis2(localAxis1.crossProduct(localPerpendicularAxis1)) {
+
+    }
+
+    std::size_t HingeJoint::computeRows(std::array<JointRow, MAX_ROWS_COUNT>& rows) const {
+        std::size_t rowIndex = computePointRows(localAnchor1, localAnchor2, rows, 0);
+
+        //keep the hinge axis of the bodies aligned: relative rotation is only allowed around the axis
+        Quaternion<float> orientation1 = getBody1().getTransform().getOrientation();
+        Vector3<float> axis1 = orientation1.rotateVector(localAxis1);
+        Vector3<float> axis2 = getBody2().getTransform().getOrientation().rotateVector(localAxis2);
+        Vector3<float> angleError = axis1.crossProduct(axis2);
+        Vector3<float> perpendicularAxis1 = orientation1.rotateVector(localPerpendicularAxis1); //fixed in body 1: rows directions stay continuous between steps
+        Vector3<float> perpendicularAxis2 = orientation1.rotateVector(localPerpendicularAxis2);
+        fillAngularRow(perpendicularAxis1, angleError.dotProduct(perpendicularAxis1), rows[rowIndex++]);
+        fillAngularRow(perpendicularAxis2, angleError.dotProduct(perpendicularAxis2), rows[rowIndex++]);
+
+        return rowIndex;
+    }
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+
+namespace urchin {
+
+    /**
+    * Hinge joint: the bodies share an anchor point and rotate around an axis only (e.g. door, wheel, knee)
+    */
+    class HingeJoint final : public Joint {
+        public:
+            HingeJoint(std::shared_ptr<RigidBody>, std::shared_ptr<RigidBody>, const Point3<float>&, const Vector3<float>&);
+
+            std::size_t computeRows(std::array<JointRow, MAX_ROWS_COUNT>&) const override;
+
+        private:
+            Point3<float> localAnchor1;
+            Point3<float> localAnchor2;
+            Vector3<float> localAxis1;
+            Vector3<float> localAxis2;
+            Vector3<float> localPerpendicularAxis1;
+            Vector3<float> localPerpendicularAxis2;
+    };
+
+}
@@ -0,0 +1,110 @@
+#include <limits>
+#include <stdexcept>
+
+#include "joint/model/Joint.h"
+
+namespace urchin {
+
+    Joint::Joint(std::shared_ptr<RigidBody> body1, std::shared_ptr<RigidBody> body2) :
+            body1(std::move(body1)),
+            body2(std::move(body2)),
+            accumulatedImpulses({}) {
+        if (!this->body1 || !this->body2 || this->body1 == this->body2) {
+            throw std::invalid_argument("A joint must link two different bodies");
+        }
+    }
+
+    RigidBody& Joint::getBody1() const {
+        return *body1;
+    }
+
+    RigidBody& Joint::getBody2() const {
+        return *body2;
+    }
+
+    bool Joint::isLinkedToBody(const AbstractBody& body) const {
+        return body1.get() == &body || body2.get() == &body;
+    }
+
+    float Joint::getAccumulatedImpulse(std::size_t rowIndex) const {
+        return accumulatedImpulses[rowIndex];
+    }
+
+    /**
+     * Method must be called by the physics thread
+     */
+    void Joint::setAccumulatedImpulse(std::size_t rowIndex, float accumulatedImpulse) {
+        accumulatedImpulses[rowIndex] = accumulatedImpulse;
+    }
+
+    /**
+     * Compute three rows keeping the anchor points of the bodies at the same position
+     * @param localAnchor1 Anchor point in body 1 local space
+     * @param localAnchor2 Anchor point in body 2 local space
+     * @param rows [out] Rows filled from the row index
+     * @return Next row index
+     */
+    std::size_t Joint::computePointRows(const Point3<float>& localAnchor1, const Point3<float>& localAnchor2, std::array<JointRow, MAX_ROWS_COUNT>& rows, std::size_t rowIndex) const {
+        PhysicsTransform transform1 = body1->getTransform();
+        PhysicsTransform transform2 = body2->getTransform();
+        Point3<float> anchor1 = transform1.transform(localAnchor1);
+        Point3<float> anchor2 = transform2.transform(localAnchor2);
+        Vector3<float> r1 = transform1.getPosition().vector(anchor1);
+        Vector3<float> r2 = transform2.getPosition().vector(anchor2);
+        Vector3<float> positionError = anchor1.vector(anchor2);
+
+        for (const Vector3<float>& direction : {Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)}) {
+            fillLinearRow(direction, r1, r2, positionError.dotProduct(direction), rows[rowIndex++]);
+        }
+        return rowIndex;
+    }
+
+    /**
+     * Compute three rows keeping the bodies in the same relative orientation
+     * @param localRelativeOrientation Orientation of body 2 in body 1 local space
+     * @param rows [out] Rows filled from the row index
+     * @return Next row index
+     */
+    std::size_t Joint::computeOrientationRows(const Quaternion<float>& localRelativeOrientation, std::array<JointRow, MAX_ROWS_COUNT>& rows, std::size_t rowIndex) const {
+        Quaternion<float> expectedOrientation2 = body1->getTransform().getOrientation() * localRelativeOrientation;
+        Quaternion<float> orientationError = body2->getTransform().getOrientation() * expectedOrientation2.conjugate();
+        float errorSign = orientationError.W < 0.0f ? -1.0f : 1.0f; //shortest rotation
+        Vector3<float> angleError = Vector3(orientationError.X, orientationError.Y, orientationError.Z) * (2.0f * errorSign); //small angle approximation
+
+        for (const Vector3<float>& axis : {Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)}) {
+            fillAngularRow(axis, angleError.dotProduct(axis), rows[rowIndex++]);
+        }
+        return rowIndex;
+    }
+
+    /**
+     * Fill a row constraining the relative velocity of two points along a direction
+     * @param r1 Vector from body 1 center of mass to the point of body 1
+     * @param r2 Vector from body 2 center of mass to the point of body 2
+     * @param row [out] Row to fill
+     */
+    void Joint::fillLinearRow(const Vector3<float>& direction, const Vector3<float>& r1, const Vector3<float>& r2, float positionError, JointRow& row) {
+        row.linear1 = -direction;
+        row.angular1 = -r1.crossProduct(direction);
+        row.linear2 = direction;
+        row.angular2 = r2.crossProduct(direction);
+        row.positionError = positionError;
+        row.minImpulse = -std::numeric_limits<float>::max();
+        row.maxImpulse = std::numeric_limits<float>::max();
+    }
+
+    /**
+     * Fill a row constraining the relative angular velocity of the bodies around an axis
+     * @param row [out] Row to fill
+     */
+    void Joint::fillAngularRow(const Vector3<float>& axis, float angleError, JointRow& row) {
+        row.linear1 = Vector3(0.0f, 0.0f, 0.0f);
+        row.angular1 = -axis;
+        row.linear2 = Vector3(0.0f, 0.0f, 0.0f);
+        row.angular2 = axis;
+        row.positionError = angleError;
+        row.minImpulse = -std::numeric_limits<float>::max();
+        row.maxImpulse = std::numeric_limits<float>::max();
+    }
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <UrchinCommon.h>
+
+#include "body/model/RigidBody.h"
+
+namespace urchin {
+
+    /**
+    * Constraint on the relative velocity of the joint bodies along one degree of freedom: the row is satisfied when
+    * linear1.v1 + angular1.w1 + linear2.v2 + angular2.w2 is zero.
+    */
+    struct JointRow {
+        Vector3<float> linear1;
+        Vector3<float> angular1;
+        Vector3<float> linear2;
+        Vector3<float> angular2;
+        float positionError; //position drift along the degree of freedom: corrected over the next steps
+        float minImpulse;
+        float maxImpulse;
+    };
+
+    /**
+    * Joint linking two rigid bodies. One of the bodies can be static to link the other body to the world.
+    * Joint frames are expressed in the local space of the bodies at the joint creation: the joint keeps the bodies in their relative position of the creation.
+    */
+    class Joint {
+        public:
+            static constexpr std::size_t MAX_ROWS_COUNT = 6;
+
+            Joint(std::shared_ptr<RigidBody>, std::shared_ptr<RigidBody>);
+            virtual ~Joint() = default;
+
+            RigidBody& getBody1() const;
+            RigidBody& getBody2() const;
+            bool isLinkedToBody(const AbstractBody&) const;
+
+            virtual std::size_t computeRows(std::array<JointRow, MAX_ROWS_COUNT>&) const = 0;
+
+            float getAccumulatedImpulse(std::size_t) const;
+            void setAccumulatedImpulse(std::size_t, float);
+
+        protected:
+            std::size_t computePointRows(const Point3<float>&, const Point3<float>&, std::array<JointRow, MAX_ROWS_COUNT>&, std::size_t) const;
+            std::size_t computeOrientationRows(const Quaternion<float>&, std::array<JointRow, MAX_ROWS_COUNT>&, std::size_t) const;
+
+            static void fillLinearRow(const Vector3<float>&, const Vector3<float>&, const Vector3<float>&, float, JointRow&);
+            static void fillAngularRow(const Vector3<float>&, float, JointRow&);
+
+        private:
+            std::shared_ptr<RigidBody> body1;
+            std::shared_ptr<RigidBody> body2;
+
+            std::array<float, MAX_ROWS_COUNT> accumulatedImpulses; //impulses of the last step for warm starting
+    };
+
+}
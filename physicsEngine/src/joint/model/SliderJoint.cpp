@@ -0,0 +1,34 @@
+#include "joint/model/SliderJoint.h"
+
+namespace urchin {
+
+    /**
+     * @param axis Translation axis in world space
+     */
+    SliderJoint::SliderJoint(std::shared_ptr<RigidBody> body1, std::shared_ptr<RigidBody> body2, const Vector3<float>& axis) :
+            Joint(std::move(body1), std::move(body2)),
+            localAnchor1(getBody1().getTransform().inverseTransform(getBody2().getTransform().getPosition())),
+            localRelativeOrientation(getBody1().getTransform().getOrientation().conjugate() * getBody2().getTransform().getOrientation()) {
+        Vector3<float> localAxis1 = getBody1().getTransform().getOrientation().conjugate().rotateVector(axis.normalize());
+        localPerpendicularAxis1 = localAxis1.perpendicularVector().normalize();
+        localPerpendicularAxis2 = localAxis1.crossProduct(localPerpendicularAxis1);
+    }
+
+    std::size_t SliderJoint::computeRows(std::array<JointRow, MAX_ROWS_COUNT>& rows) const {
+        PhysicsTransform transform1 = getBody1().getTransform();
+        Point3<float> anchor1 = transform1.transform(localAnchor1);
+        Point3<float> anchor2 = getBody2().getTransform().getPosition();
+
+        //keep body 2 on the slider axis: the point of body 1 at the body 2 center of mass is constrained
+        Vector3<float> r1 = transform1.getPosition().vector(anchor2);
+        Vector3<float> r2(0.0f, 0.0f, 0.0f);
+        Vector3<float> positionError = anchor1.vector(anchor2);
+        Vector3<float> perpendicularAxis1 = transform1.getOrientation().rotateVector(localPerpendicularAxis1); //fixed in body 1: rows directions stay continuous between steps
+        Vector3<float> perpendicularAxis2 = transform1.getOrientation().rotateVector(localPerpendicularAxis2);
+        fillLinearRow(perpendicularAxis1, r1, r2, positionError.dotProduct(perpendicularAxis1), rows[0]);
+        fillLinearRow(perpendicularAxis2, r1, r2, positionError.dotProduct(perpendicularAxis2), rows[1]);
+
+        return computeOrientationRows(localRelativeOrientation, rows, 2);
+    }
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <UrchinCommon.h>
+
+#include "joint/model/Joint.h"
+
+namespace urchin {
+
+    /**
+    * Slider joint: the bodies keep their relative orientation and translate along an axis only (e.g. piston, drawer)
+    */
+    class SliderJoint final : public Joint {
+        public:
+            SliderJoint(std::shared_ptr<RigidBody>, std::shared_ptr<RigidBody>, const Vector3<float>&);
+
+            std::size_t computeRows(std::array<JointRow, MAX_ROWS_COUNT>&) const override;
+
+        private:
+            Point3<float> localAnchor1; //body 2 center of mass in body 1 local space at the joint creation
+            Vector3<float> localPerpendicularAxis1; //axes perpendicular to the slider axis in body 1 local space
+            Vector3<float> localPerpendicularAxis2;
+            Quaternion<float> localRelativeOrientation;
+    };
+
+}
@@ -0,0 +1,221 @@
+#include <stdexcept>
+
+#include "journal/JournalBodySerializer.h"
+#include "body/model/RigidBody.h"
+#include "body/model/GhostBody.h"
+#include "shape/CollisionSphereShape.h"
+#include "shape/CollisionBoxShape.h"
+#include "shape/CollisionCapsuleShape.h"
+#include "shape/CollisionCylinderShape.h"
+#include "shape/CollisionConeShape.h"
+#include "shape/CollisionConvexHullShape.h"
+#include "shape/CollisionTriangleShape.h"
+#include "shape/CollisionCompoundShape.h"
+#include "shape/CollisionHeightfieldShape.h"
+#include "shape/CollisionTriangleMeshShape.h"
+
+namespace urchin {
+
+    void JournalBodySerializer::serialize(const AbstractBody& body, JournalStream& stream) {
+        stream.writeUInt8((uint8_t)body.getBodyType());
+        stream.writeString(body.getId());
+        stream.writeTransform(body.getTransform());
+        serializeShape(body.getShape(), stream);
+
+        stream.writeFloat(body.getRestitution());
+        stream.writeFloat(body.getFriction());
+        stream.writeFloat(body.getRollingFriction());
+        stream.writeFloat(body.getCcdMotionThreshold());
+
+        if (body.getBodyType() == BodyType::RIGID) {
+            const auto& rigidBody = static_cast<const RigidBody&>(body);
+            stream.writeFloat(rigidBody.getMass());
+            stream.writeFloat(rigidBody.getLinearDamping());
+            stream.writeFloat(rigidBody.getAngularDamping());
+            stream.writeVector(rigidBody.getLinearFactor());
+            stream.writeVector(rigidBody.getAngularFactor());
+            stream.writeVector(rigidBody.getLinearVelocity());
+            stream.writeVector(rigidBody.getAngularVelocity());
+        }
+        stream.writeUInt8(body.isActive() ? 1 : 0);
+    }
+
+    std::shared_ptr<AbstractBody> JournalBodySerializer::deserialize(JournalStream& stream) {
+        auto bodyType = (BodyType)stream.readUInt8();
+        std::string id = stream.readString();
+        PhysicsTransform transform = stream.readTransform();
+        std::unique_ptr<const CollisionShape3D> shape = deserializeShape(stream);
+
+        float restitution = stream.readFloat();
+        float friction = stream.readFloat();
+        float rollingFriction = stream.readFloat();
+        float ccdMotionThreshold = stream.readFloat();
+
+        std::shared_ptr<AbstractBody> body;
+        if (bodyType == BodyType::RIGID) {
+            auto rigidBody = std::make_shared<RigidBody>(std::move(id), transform, std::move(shape));
+            rigidBody->setMass(stream.readFloat());
+            float linearDamping = stream.readFloat();
+            float angularDamping = stream.readFloat();
+            rigidBody->setDamping(linearDamping, angularDamping);
+            rigidBody->setLinearFactor(stream.readVector());
+            rigidBody->setAngularFactor(stream.readVector());
+            Vector3<float> linearVelocity = stream.readVector();
+            Vector3<float> angularVelocity = stream.readVector();
+            rigidBody->setVelocity(linearVelocity, angularVelocity);
+            body = std::move(rigidBody);
+        } else if (bodyType == BodyType::GHOST) {
+            body = std::make_shared<GhostBody>(std::move(id), transform, std::move(shape));
+        } else {
+            throw std::runtime_error("Unknown body type in physics journal: " + std::to_string((int)bodyType));
+        }
+
+        body->setRestitution(restitution);
+        body->setFriction(friction);
+        body->setRollingFriction(rollingFriction);
+        body->setCcdMotionThreshold(ccdMotionThreshold);
+        bool isActive = stream.readUInt8() != 0;
+        if (!body->isStatic()) {
+            body->setIsActive(isActive);
+        }
+        return body;
+    }
+
+    void JournalBodySerializer::serializeShape(const CollisionShape3D& shape, JournalStream& stream) {
+        stream.writeUInt8((uint8_t)shape.getShapeType());
+
+        if (shape.getShapeType() == CollisionShape3D::SPHERE_SHAPE) {
+            stream.writeFloat(static_cast<const CollisionSphereShape&>(shape).getRadius());
+        } else if (shape.getShapeType() == CollisionShape3D::BOX_SHAPE) {
+            stream.writeVector(static_cast<const CollisionBoxShape&>(shape).getHalfSizes());
+        } else if (shape.getShapeType() == CollisionShape3D::CAPSULE_SHAPE) {
+            const auto& capsuleShape = static_cast<const CollisionCapsuleShape&>(shape);
+            stream.writeFloat(capsuleShape.getRadius());
+            stream.writeFloat(capsuleShape.getCylinderHeight());
+            stream.writeUInt8((uint8_t)capsuleShape.getCapsuleOrientation());
+        } else if (shape.getShapeType() == CollisionShape3D::CYLINDER_SHAPE) {
+            const auto& cylinderShape = static_cast<const CollisionCylinderShape&>(shape);
+            stream.writeFloat(cylinderShape.getRadius());
+            stream.writeFloat(cylinderShape.getHeight());
+            stream.writeUInt8((uint8_t)cylinderShape.getCylinderOrientation());
+        } else if (shape.getShapeType() == CollisionShape3D::CONE_SHAPE) {
+            const auto& coneShape = static_cast<const CollisionConeShape&>(shape);
+            stream.writeFloat(coneShape.getRadius());
+            stream.writeFloat(coneShape.getHeight());
+            stream.writeUInt8((uint8_t)coneShape.getConeOrientation());
+        } else if (shape.getShapeType() == CollisionShape3D::CONVEX_HULL_SHAPE) {
+            std::vector<Point3<float>> points = static_cast<const CollisionConvexHullShape&>(shape).getPoints();
+            stream.writeUInt32((uint32_t)points.size());
+            for (const Point3<float>& point : points) {
+                stream.writePoint(point);
+            }
+        } else if (shape.getShapeType() == CollisionShape3D::TRIANGLE_SHAPE) {
+            for (const Point3<float>& point : static_cast<const TriangleShape3D<float>&>(shape.getSingleShape()).getPoints()) {
+                stream.writePoint(point);
+            }
+        } else if (shape.getShapeType() == CollisionShape3D::COMPOUND_SHAPE) {
+            const auto& localizedShapes = static_cast<const CollisionCompoundShape&>(shape).getLocalizedShapes();
+            stream.writeUInt32((uint32_t)localizedShapes.size());
+            for (const auto& localizedShape : localizedShapes) {
+                stream.writeUInt32((uint32_t)localizedShape->shapeIndex);
+                stream.writeTransform(localizedShape->transform);
+                serializeShape(*localizedShape->shape, stream);
+            }
+        } else if (shape.getShapeType() == CollisionShape3D::HEIGHTFIELD_SHAPE) {
+            const auto& heightfieldShape = static_cast<const CollisionHeightfieldShape&>(shape);
+            stream.writeUInt32(heightfieldShape.getXLength());
+            stream.writeUInt32(heightfieldShape.getZLength());
+            for (unsigned int z = 0; z < heightfieldShape.getZLength(); ++z) {
+                for (unsigned int x = 0; x < heightfieldShape.getXLength(); ++x) {
+                    stream.writePoint(heightfieldShape.getVertex(x, z));
+                }
+            }
+        } else if (shape.getShapeType() == CollisionShape3D::TRIANGLE_MESH_SHAPE) {
+            const auto& triangleMeshShape = static_cast<const CollisionTriangleMeshShape&>(shape);
+            stream.writeUInt32((uint32_t)triangleMeshShape.getVertices().size());
+            for (const Point3<float>& vertex : triangleMeshShape.getVertices()) {
+                stream.writePoint(vertex);
+            }
+            stream.writeUInt32((uint32_t)triangleMeshShape.getTriangles().size());
+            for (const IndexedTriangle3D<float>& triangle : triangleMeshShape.getTriangles()) {
+                for (std::size_t i = 0; i < 3; ++i) {
+                    stream.writeUInt32((uint32_t)triangle.getIndex(i));
+                }
+            }
+        } else {
+            throw std::invalid_argument("Unknown shape type to serialize in physics journal: " + std::to_string(shape.getShapeType()));
+        }
+    }
+
+    std::unique_ptr<const CollisionShape3D> JournalBodySerializer::deserializeShape(JournalStream& stream) {
+        auto shapeType = (CollisionShape3D::ShapeType)stream.readUInt8();
+
+        if (shapeType == CollisionShape3D::SPHERE_SHAPE) {
+            return std::make_unique<CollisionSphereShape>(stream.readFloat());
+        } else if (shapeType == CollisionShape3D::BOX_SHAPE) {
+            return std::make_unique<CollisionBoxShape>(stream.readVector());
+        } else if (shapeType == CollisionShape3D::CAPSULE_SHAPE) {
+            float radius = stream.readFloat();
+            float cylinderHeight = stream.readFloat();
+            auto orientation = (CapsuleShape<float>::CapsuleOrientation)stream.readUInt8();
+            return std::make_unique<CollisionCapsuleShape>(radius, cylinderHeight, orientation);
+        } else if (shapeType == CollisionShape3D::CYLINDER_SHAPE) {
+            float radius = stream.readFloat();
+            float height = stream.readFloat();
+            auto orientation = (CylinderShape<float>::CylinderOrientation)stream.readUInt8();
+            return std::make_unique<CollisionCylinderShape>(radius, height, orientation);
+        } else if (shapeType == CollisionShape3D::CONE_SHAPE) {
+            float radius = stream.readFloat();
+            float height = stream.readFloat();
+            auto orientation = (ConeShape<float>::ConeOrientation)stream.readUInt8();
+            return std::make_unique<CollisionConeShape>(radius, height, orientation);
+        } else if (shapeType == CollisionShape3D::CONVEX_HULL_SHAPE) {
+            std::vector<Point3<float>> points(stream.readUInt32());
+            for (Point3<float>& point : points) {
+                point = stream.readPoint();
+            }
+            return std::make_unique<CollisionConvexHullShape>(points);
+        } else if (shapeType == CollisionShape3D::TRIANGLE_SHAPE) {
+            std::array<Point3<float>, 3> points;
+            for (Point3<float>& point : points) {
+                point = stream.readPoint();
+            }
+            return std::make_unique<CollisionTriangleShape>(points);
+        } else if (shapeType == CollisionShape3D::COMPOUND_SHAPE) {
+            std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes(stream.readUInt32());
+            for (std::shared_ptr<const LocalizedCollisionShape>& localizedShape : localizedShapes) {
+                auto newLocalizedShape = std::make_shared<LocalizedCollisionShape>();
+                newLocalizedShape->shapeIndex = stream.readUInt32();
+                newLocalizedShape->transform = stream.readTransform();
+                newLocalizedShape->shape = deserializeShape(stream);
+                localizedShape = std::move(newLocalizedShape);
+            }
+            return std::make_unique<CollisionCompoundShape>(std::move(localizedShapes));
+        } else if (shapeType == CollisionShape3D::HEIGHTFIELD_SHAPE) {
+            unsigned int xLength = stream.readUInt32();
+            unsigned int zLength = stream.readUInt32();
+            std::vector<Point3<float>> vertices((std::size_t)xLength * zLength);
+            for (Point3<float>& vertex : vertices) {
+                vertex = stream.readPoint();
+            }
+            return std::make_unique<CollisionHeightfieldShape>(std::move(vertices), xLength, zLength);
+        } else if (shapeType == CollisionShape3D::TRIANGLE_MESH_SHAPE) {
+            std::vector<Point3<float>> vertices(stream.readUInt32());
+            for (Point3<float>& vertex : vertices) {
+                vertex = stream.readPoint();
+            }
+            std::size_t trianglesCount = stream.readUInt32();
+            std::vector<IndexedTriangle3D<float>> triangles;
+            triangles.reserve(trianglesCount);
+            for (std::size_t i = 0; i < trianglesCount; ++i) {
+                std::size_t index1 = stream.readUInt32();
+                std::size_t index2 = stream.readUInt32();
+                std::size_t index3 = stream.readUInt32();
+                triangles.emplace_back(index1, index2, index3);
+            }
+            return std::make_unique<CollisionTriangleMeshShape>(std::move(vertices), std::move(triangles));
+        }
+        throw std::runtime_error("Unknown shape type in physics journal: " + std::to_string(shapeType));
+    }
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+#include "body/model/AbstractBody.h"
+#include "journal/JournalStream.h"
+
+namespace urchin {
+
+    /**
+    * Serialize the bodies (description, shape and current state) in the physics journal
+    */
+    class JournalBodySerializer {
+        public:
+            static void serialize(const AbstractBody&, JournalStream&);
+            static std::shared_ptr<AbstractBody> deserialize(JournalStream&);
+
+        private:
+            JournalBodySerializer() = default;
+            ~JournalBodySerializer() = default;
+
+            static void serializeShape(const CollisionShape3D&, JournalStream&);
+            static std::unique_ptr<const CollisionShape3D> deserializeShape(JournalStream&);
+    };
+
+}
@@ -0,0 +1,134 @@
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "journal/JournalStream.h"
+
+namespace urchin {
+
+    JournalStream::JournalStream() :
+            readOffset(0) {
+
+    }
+
+    JournalStream::JournalStream(std::vector<char> data) :
+            data(std::move(data)),
+            readOffset(0) {
+
+    }
+
+    void JournalStream::writeUInt8(uint8_t value) {
+        writeValue(value);
+    }
+
+    void JournalStream::writeUInt32(uint32_t value) {
+        writeValue(value);
+    }
+
+    void JournalStream::writeUInt64(uint64_t value) {
+        writeValue(value);
+    }
+
+    void JournalStream::writeFloat(float value) {
+        writeValue(value);
+    }
+
+    void JournalStream::writeString(std::string_view value) {
+        writeUInt32((uint32_t)value.size());
+        data.insert(data.end(), value.begin(), value.end());
+    }
+
+    void JournalStream::writePoint(const Point3<float>& point) {
+        writeFloat(point.X);
+        writeFloat(point.Y);
+        writeFloat(point.Z);
+    }
+
+    void JournalStream::writeVector(const Vector3<float>& vector) {
+        writeFloat(vector.X);
+        writeFloat(vector.Y);
+        writeFloat(vector.Z);
+    }
+
+    void JournalStream::writeTransform(const PhysicsTransform& transform) {
+        writePoint(transform.getPosition());
+        writeFloat(transform.getOrientation().X);
+        writeFloat(transform.getOrientation().Y);
+        writeFloat(transform.getOrientation().Z);
+        writeFloat(transform.getOrientation().W);
+    }
+
+    uint8_t JournalStream::readUInt8() {
+        return readValue<uint8_t>();
+    }
+
+    uint32_t JournalStream::readUInt32() {
+        return readValue<uint32_t>();
+    }
+
+    uint64_t JournalStream::readUInt64() {
+        return readValue<uint64_t>();
+    }
+
+    float JournalStream::readFloat() {
+        return readValue<float>();
+    }
+
+    std::string JournalStream::readString() {
+        std::size_t size = readUInt32();
+        if (readOffset + size > data.size()) {
+            throw std::runtime_error("Physics journal is truncated at offset " + std::to_string(readOffset));
+        }
+        std::string value(data.data() + readOffset, size);
+        readOffset += size;
+        return value;
+    }
+
+    Point3<float> JournalStream::readPoint() {
+        float x = readFloat();
+        float y = readFloat();
+        float z = readFloat();
+        return Point3(x, y, z);
+    }
+
+    Vector3<float> JournalStream::readVector() {
+        float x = readFloat();
+        float y = readFloat();
+        float z = readFloat();
+        return Vector3(x, y, z);
+    }
+
+    PhysicsTransform JournalStream::readTransform() {
+        Point3<float> position = readPoint();
+        float x = readFloat();
+        float y = readFloat();
+        float z = readFloat();
+        float w = readFloat();
+        return PhysicsTransform(position, Quaternion(x, y, z, w));
+    }
+
+    bool JournalStream::isEndOfStream() const {
+        return readOffset >= data.size();
+    }
+
+    const std::vector<char>& JournalStream::getData() const {
+        return data;
+    }
+
+    template<class T> void JournalStream::writeValue(T value) {
+        std::size_t offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    template<class T> T JournalStream::readValue() {
+        if (readOffset + sizeof(T) > data.size()) {
+            throw std::runtime_error("Physics journal is truncated at offset " + std::to_string(readOffset));
+        }
+        T value;
+        std::memcpy(&value, data.data() + readOffset, sizeof(T));
+        readOffset += sizeof(T);
+        return value;
+    }
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <UrchinCommon.h>
+
+#include "utils/math/PhysicsTransform.h"
+
+namespace urchin {
+
+    /**
+    * Binary stream of a physics journal. Values are stored with the native byte order: a journal must be replayed on the same platform as the recording.
+    */
+    class JournalStream {
+        public:
+            JournalStream();
+            explicit JournalStream(std::vector<char>);
+
+            void writeUInt8(uint8_t);
+            void writeUInt32(uint32_t);
+            void writeUInt64(uint64_t);
+            void writeFloat(float);
+            void writeString(std::string_view);
+            void writePoint(const Point3<float>&);
+            void writeVector(const Vector3<float>&);
+            void writeTransform(const PhysicsTransform&);
+
+            uint8_t readUInt8();
+            uint32_t readUInt32();
+            uint64_t readUInt64();
+            float readFloat();
+            std::string readString();
+            Point3<float> readPoint();
+            Vector3<float> readVector();
+            PhysicsTransform readTransform();
+
+            bool isEndOfStream() const;
+            const std::vector<char>& getData() const;
+
+        private:
+            template<class T> void writeValue(T);
+            template<class T> T readValue();
+
+            std::vector<char> data;
+            std::size_t readOffset;
+    };
+
+}
@@ -0,0 +1,198 @@
+#include <bit>
+#include <fstream>
+#include <stdexcept>
+
+#include "journal/PhysicsJournal.h"
+#include "journal/JournalBodySerializer.h"
+#include "body/model/RigidBody.h"
+
+namespace urchin {
+
+    /**
+     * Start to record a journal. The bodies already in the container are recorded as added bodies with their current state.
+     */
+    PhysicsJournal::PhysicsJournal(BodyContainer& bodyContainer) :
+            bodyContainer(bodyContainer),
+            nextJournalBodyId(0),
+            stepsCount(0),
+            hasUnsupportedJoints(false) {
+        stream.writeUInt32(JOURNAL_MAGIC);
+        stream.writeUInt32(JOURNAL_VERSION);
+
+        for (const auto& body : bodyContainer.getBodies()) {
+            recordBodyAdd(*body);
+        }
+
+        bodyContainer.addObserver(this, BodyContainer::ADD_BODY);
+        bodyContainer.addObserver(this, BodyContainer::REMOVE_BODY);
+    }
+
+    PhysicsJournal::~PhysicsJournal() {
+        bodyContainer.removeObserver(this, BodyContainer::REMOVE_BODY);
+        bodyContainer.removeObserver(this, BodyContainer::ADD_BODY);
+    }
+
+    void PhysicsJournal::notify(Observable* observable, int notificationType) {
+        if (const auto* notifyingBodyContainer = dynamic_cast<BodyContainer*>(observable)) {
+            if (notificationType == BodyContainer::ADD_BODY) {
+                recordBodyAdd(*notifyingBodyContainer->getLastUpdatedBody());
+            } else if (notificationType == BodyContainer::REMOVE_BODY) {
+                recordBodyRemove(*notifyingBodyContainer->getLastUpdatedBody());
+            }
+        }
+    }
+
+    /**
+     * Record the gravity and the bodies state modified since the end of the last step. Method must be called before the bodies refresh of the step.
+     * @param gravity Gravity used by the step. Gravity is only recorded when it changes.
+     */
+    void PhysicsJournal::beginStep(const Vector3<float>& gravity) {
+        if (!lastGravity.has_value() || !(*lastGravity == gravity)) {
+            stream.writeUInt8(GRAVITY);
+            stream.writeVector(gravity);
+            lastGravity = gravity;
+        }
+
+        for (const auto& body : bodyContainer.getBodies()) {
+            recordBodyStateIfModified(*body, journalBodies.at(body.get()));
+        }
+    }
+
+    /**
+     * Record the momentum applied on a body since the last step. Method must be called before the step adds its own forces (gravity...) to the body momentum.
+     */
+    void PhysicsJournal::recordMomentum(const AbstractBody& body, const BodyMomentum& bodyMomentum) {
+        if (bodyMomentum.hasMomentum()) {
+            stream.writeUInt8(BODY_MOMENTUM);
+            stream.writeUInt32(journalBodies.at(&body).journalBodyId);
+            stream.writeVector(bodyMomentum.getMomentum());
+            stream.writeVector(bodyMomentum.getTorqueMomentum());
+        }
+    }
+
+    /**
+     * Joints are not recorded: mark the journal as not replayable. Method must be called at each step having joints.
+     */
+    void PhysicsJournal::recordUnsupportedJoints() {
+        if (!hasUnsupportedJoints) {
+            Logger::instance().logWarning("Physics journal cannot record the joints: the journal will not be replayable");
+            stream.writeUInt8(UNSUPPORTED_JOINTS);
+            hasUnsupportedJoints = true;
+        }
+    }
+
+    /**
+     * @param dt Delta of time (sec.) of the step
+     */
+    void PhysicsJournal::endStep(float dt) {
+        stream.writeUInt8(STEP);
+        stream.writeFloat(dt);
+        stream.writeUInt64(computeStateHash(bodyContainer));
+        stepsCount++;
+
+        for (const auto& body : bodyContainer.getBodies()) {
+            journalBodies.at(body.get()).lastStepState = retrieveBodyState(*body);
+        }
+    }
+
+    unsigned int PhysicsJournal::getStepsCount() const {
+        return stepsCount;
+    }
+
+    const JournalStream& PhysicsJournal::getStream() const {
+        return stream;
+    }
+
+    void PhysicsJournal::saveToFile(const std::string& journalFilename) const {
+        std::ofstream file(journalFilename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Unable to open file: " + journalFilename);
+        }
+        file.write(stream.getData().data(), (std::streamsize)stream.getData().size());
+    }
+
+    /**
+     * @return Hash (FNV-1a) of the bit representation of the bodies state: transform, velocities and active state
+     */
+    uint64_t PhysicsJournal::computeStateHash(const BodyContainer& bodyContainer) {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        auto hashValue = [&hash](uint32_t value) {
+            for (unsigned int i = 0; i < 4; ++i) {
+                hash = (hash ^ ((value >> (i * 8u)) & 0xFFu)) * FNV_PRIME;
+            }
+        };
+        auto hashVector = [&hashValue](float x, float y, float z) {
+            hashValue(std::bit_cast<uint32_t>(x));
+            hashValue(std::bit_cast<uint32_t>(y));
+            hashValue(std::bit_cast<uint32_t>(z));
+        };
+
+        for (const auto& body : bodyContainer.getBodies()) {
+            PhysicsTransform transform = body->getTransform();
+            hashVector(transform.getPosition().X, transform.getPosition().Y, transform.getPosition().Z);
+            hashVector(transform.getOrientation().X, transform.getOrientation().Y, transform.getOrientation().Z);
+            hashValue(std::bit_cast<uint32_t>(transform.getOrientation().W));
+            hashValue(body->isActive() ? 1u : 0u);
+
+            if (const RigidBody* rigidBody = RigidBody::upCast(body.get())) {
+                Vector3<float> linearVelocity = rigidBody->getLinearVelocity();
+                Vector3<float> angularVelocity = rigidBody->getAngularVelocity();
+                hashVector(linearVelocity.X, linearVelocity.Y, linearVelocity.Z);
+                hashVector(angularVelocity.X, angularVelocity.Y, angularVelocity.Z);
+            }
+        }
+        return hash;
+    }
+
+    void PhysicsJournal::recordBodyAdd(const AbstractBody& body) {
+        uint32_t journalBodyId = nextJournalBodyId++;
+        journalBodies.insert_or_assign(&body, JournalBody{.journalBodyId = journalBodyId, .lastStepState = retrieveBodyState(body)});
+
+        stream.writeUInt8(BODY_ADD);
+        stream.writeUInt32(journalBodyId);
+        JournalBodySerializer::serialize(body, stream);
+    }
+
+    void PhysicsJournal::recordBodyRemove(const AbstractBody& body) {
+        auto itFind = journalBodies.find(&body);
+        if (itFind != journalBodies.end()) {
+            stream.writeUInt8(BODY_REMOVE);
+            stream.writeUInt32(itFind->second.journalBodyId);
+            journalBodies.erase(itFind);
+        }
+    }
+
+    /**
+     * Record the body state when it has been modified outside the physics steps: transform/velocity updated by the user, character controller...
+     */
+    void PhysicsJournal::recordBodyStateIfModified(const AbstractBody& body, JournalBody& journalBody) {
+        BodyState bodyState = retrieveBodyState(body);
+        if (!isSameState(bodyState, journalBody.lastStepState)) {
+            stream.writeUInt8(BODY_STATE);
+            stream.writeUInt32(journalBody.journalBodyId);
+            stream.writeUInt8(body.hasPendingManualMove() ? 1 : 0); //transform updated from a thread different of the physics thread
+            stream.writeTransform(bodyState.transform);
+            stream.writeVector(bodyState.linearVelocity);
+            stream.writeVector(bodyState.angularVelocity);
+            stream.writeUInt8(bodyState.isActive ? 1 : 0);
+            journalBody.lastStepState = bodyState;
+        }
+    }
+
+    PhysicsJournal::BodyState PhysicsJournal::retrieveBodyState(const AbstractBody& body) {
+        BodyState bodyState{.transform = body.getTransform(), .linearVelocity = Vector3<float>(), .angularVelocity = Vector3<float>(), .isActive = body.isActive()};
+        if (const RigidBody* rigidBody = RigidBody::upCast(&body)) {
+            bodyState.linearVelocity = rigidBody->getLinearVelocity();
+            bodyState.angularVelocity = rigidBody->getAngularVelocity();
+        }
+        return bodyState;
+    }
+
+    bool PhysicsJournal::isSameState(const BodyState& bodyState1, const BodyState& bodyState2) {
+        return bodyState1.transform.equals(bodyState2.transform)
+                && bodyState1.linearVelocity == bodyState2.linearVelocity
+                && bodyState1.angularVelocity == bodyState2.angularVelocity
+                && bodyState1.isActive == bodyState2.isActive;
+    }
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <optional>
+#include <cstdint>
+#include <unordered_map>
+#include <UrchinCommon.h>
+
+#include "body/BodyContainer.h"
+#include "body/BodyMomentum.h"
+#include "journal/JournalStream.h"
+
+namespace urchin {
+
+    /**
+    * Compact binary journal of the physics inputs of each step: bodies added/removed, momentum applied on the bodies, gravity changes and bodies state
+    * modified outside the physics steps (transform/velocity set manually, character controller ghost bodies...). These modifications are sampled at the
+    * beginning of the next step. A hash of the bodies state is recorded at the end of each step: a replay of the journal (see PhysicsReplayer) must produce
+    * the same hashes. Joints are not recorded: a journal of a world having joints is marked as not replayable.
+    */
+    class PhysicsJournal final : public Observer {
+        public:
+            explicit PhysicsJournal(BodyContainer&);
+            ~PhysicsJournal() override;
+
+            enum RecordType : uint8_t {
+                GRAVITY = 0,
+                BODY_ADD,
+                BODY_REMOVE,
+                BODY_MOMENTUM,
+                STEP,
+                BODY_STATE,
+                UNSUPPORTED_JOINTS
+            };
+
+            static constexpr uint32_t JOURNAL_MAGIC = 0x4A505255; //"URPJ"
+            static constexpr uint32_t JOURNAL_VERSION = 2;
+
+            void notify(Observable*, int) override;
+
+            void beginStep(const Vector3<float>&);
+            void recordMomentum(const AbstractBody&, const BodyMomentum&);
+            void recordUnsupportedJoints();
+            void endStep(float);
+
+            unsigned int getStepsCount() const;
+            const JournalStream& getStream() const;
+            void saveToFile(const std::string&) const;
+
+            static uint64_t computeStateHash(const BodyContainer&);
+
+        private:
+            struct BodyState {
+                PhysicsTransform transform;
+                Vector3<float> linearVelocity;
+                Vector3<float> angularVelocity;
+                bool isActive;
+            };
+
+            struct JournalBody {
+                uint32_t journalBodyId;
+                BodyState lastStepState; //state at the end of the last step: a difference at the next step begin comes from an external modification
+            };
+
+            void recordBodyAdd(const AbstractBody&);
+            void recordBodyRemove(const AbstractBody&);
+            void recordBodyStateIfModified(const AbstractBody&, JournalBody&);
+            static BodyState retrieveBodyState(const AbstractBody&);
+            static bool isSameState(const BodyState&, const BodyState&);
+
+            static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+            static constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+            BodyContainer& bodyContainer;
+            JournalStream stream;
+            std::unordered_map<const AbstractBody*, JournalBody> journalBodies;
+            uint32_t nextJournalBodyId;
+            std::optional<Vector3<float>> lastGravity;
+            unsigned int stepsCount;
+            bool hasUnsupportedJoints;
+    };
+
+}
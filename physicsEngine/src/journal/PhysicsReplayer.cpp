@@ -0,0 +1,123 @@
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "journal/PhysicsReplayer.h"
+#include "journal/PhysicsJournal.h"
+#include "journal/JournalBodySerializer.h"
+#include "body/model/RigidBody.h"
+
+namespace urchin {
+
+    PhysicsReplayer::PhysicsReplayer(const std::string& journalFilename) :
+            PhysicsReplayer(JournalStream(loadJournalFile(journalFilename))) {
+
+    }
+
+    PhysicsReplayer::PhysicsReplayer(JournalStream stream) :
+            stream(std::move(stream)),
+            collisionWorld(std::make_unique<CollisionWorld>(bodyContainer)) {
+        collisionWorld->setDeterministic(true);
+        checkHeader();
+    }
+
+    /**
+     * Replay all the steps of the journal
+     */
+    ReplayResult PhysicsReplayer::replay() {
+        ReplayResult replayResult{.stepsCount = 0, .firstDivergentStep = std::nullopt, .stepsExecutionTimeInSec = 0.0f};
+
+        while (!stream.isEndOfStream()) {
+            auto recordType = (PhysicsJournal::RecordType)stream.readUInt8();
+            if (recordType == PhysicsJournal::GRAVITY) {
+                gravity = stream.readVector();
+            } else if (recordType == PhysicsJournal::BODY_ADD) {
+                uint32_t journalBodyId = stream.readUInt32();
+                if (journalBodyId >= journalBodies.size()) {
+                    journalBodies.resize(journalBodyId + 1);
+                }
+                journalBodies[journalBodyId] = JournalBodySerializer::deserialize(stream);
+                bodyContainer.addBody(journalBodies[journalBodyId]);
+            } else if (recordType == PhysicsJournal::BODY_REMOVE) {
+                uint32_t journalBodyId = stream.readUInt32();
+                bodyContainer.removeBody(getJournalBody(journalBodyId));
+                journalBodies[journalBodyId].reset();
+            } else if (recordType == PhysicsJournal::BODY_MOMENTUM) {
+                RigidBody& body = RigidBody::upCast(getJournalBody(stream.readUInt32()));
+                body.applyCentralMomentum(stream.readVector());
+                body.applyTorqueMomentum(stream.readVector());
+            } else if (recordType == PhysicsJournal::BODY_STATE) {
+                replayBodyState(getJournalBody(stream.readUInt32()));
+            } else if (recordType == PhysicsJournal::UNSUPPORTED_JOINTS) {
+                throw std::runtime_error("Physics journal cannot be replayed: joints were used during the recording and are not recorded");
+            } else if (recordType == PhysicsJournal::STEP) {
+                float dt = stream.readFloat();
+                uint64_t expectedStateHash = stream.readUInt64();
+
+                auto stepStartTime = std::chrono::steady_clock::now();
+                collisionWorld->process(dt, gravity);
+                replayResult.stepsExecutionTimeInSec += std::chrono::duration<float>(std::chrono::steady_clock::now() - stepStartTime).count();
+
+                if (!replayResult.firstDivergentStep.has_value() && PhysicsJournal::computeStateHash(bodyContainer) != expectedStateHash) {
+                    replayResult.firstDivergentStep = replayResult.stepsCount;
+                }
+                replayResult.stepsCount++;
+            } else {
+                throw std::runtime_error("Unknown record type in physics journal: " + std::to_string(recordType));
+            }
+        }
+
+        return replayResult;
+    }
+
+    const BodyContainer& PhysicsReplayer::getBodyContainer() const {
+        return bodyContainer;
+    }
+
+    void PhysicsReplayer::checkHeader() {
+        if (stream.readUInt32() != PhysicsJournal::JOURNAL_MAGIC) {
+            throw std::runtime_error("Invalid physics journal: wrong magic number");
+        }
+        uint32_t journalVersion = stream.readUInt32();
+        if (journalVersion != PhysicsJournal::JOURNAL_VERSION) {
+            throw std::runtime_error("Unsupported physics journal version: " + std::to_string(journalVersion));
+        }
+    }
+
+    void PhysicsReplayer::replayBodyState(AbstractBody& body) {
+        bool manuallyMoved = stream.readUInt8() != 0;
+        PhysicsTransform transform = stream.readTransform();
+        Vector3<float> linearVelocity = stream.readVector();
+        Vector3<float> angularVelocity = stream.readVector();
+        bool isActive = stream.readUInt8() != 0;
+
+        if (RigidBody* rigidBody = RigidBody::upCast(&body)) {
+            if (manuallyMoved) {
+                rigidBody->setManualTransform(transform); //replay thread is the physics thread: force the manual move behavior
+            } else {
+                rigidBody->setTransform(transform);
+            }
+            rigidBody->setVelocity(linearVelocity, angularVelocity);
+        } else {
+            body.setTransform(transform);
+        }
+        body.setIsActive(isActive);
+    }
+
+    AbstractBody& PhysicsReplayer::getJournalBody(uint32_t journalBodyId) const {
+        if (journalBodyId >= journalBodies.size() || !journalBodies[journalBodyId]) {
+            throw std::runtime_error("Unknown body in physics journal: " + std::to_string(journalBodyId));
+        }
+        return *journalBodies[journalBodyId];
+    }
+
+    std::vector<char> PhysicsReplayer::loadJournalFile(const std::string& journalFilename) {
+        std::ifstream file(journalFilename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Unable to open file: " + journalFilename);
+        }
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <UrchinCommon.h>
+
+#include "body/BodyContainer.h"
+#include "collision/CollisionWorld.h"
+#include "journal/JournalStream.h"
+
+namespace urchin {
+
+    struct ReplayResult {
+        unsigned int stepsCount;
+        std::optional<unsigned int> firstDivergentStep; //index of the first step producing a bodies state different from the recorded one
+        float stepsExecutionTimeInSec;
+    };
+
+    /**
+    * Headless replay of a physics journal (see PhysicsJournal): rebuild the recorded world in deterministic mode and execute the recorded steps on the caller thread.
+    * The bodies state hash is verified after each step. The execution time of the steps allows to use the recorded sessions as performance regression tests.
+    */
+    class PhysicsReplayer {
+        public:
+            explicit PhysicsReplayer(const std::string&);
+            explicit PhysicsReplayer(JournalStream);
+
+            ReplayResult replay();
+
+            const BodyContainer& getBodyContainer() const;
+
+        private:
+            void checkHeader();
+            void replayBodyState(AbstractBody&);
+            AbstractBody& getJournalBody(uint32_t) const;
+            static std::vector<char> loadJournalFile(const std::string&);
+
+            JournalStream stream;
+            BodyContainer bodyContainer;
+            std::unique_ptr<CollisionWorld> collisionWorld;
+
+            std::vector<std::shared_ptr<AbstractBody>> journalBodies;
+            Vector3<float> gravity;
+    };
+
+}
@@ -0,0 +1,49 @@
+#include <algorithm>
+
+#include "metrics/AlgorithmCounters.h"
+
+namespace urchin {
+
+    AlgorithmCounters::AlgorithmCounters() {
+        reset();
+    }
+
+    void AlgorithmCounters::reset() {
+        for (auto& algorithmCallsLine : algorithmCalls) {
+            for (std::atomic_uint& algorithmCall : algorithmCallsLine) {
+                algorithmCall.store(0, std::memory_order_relaxed);
+            }
+        }
+        gjkIterations.store(0, std::memory_order_relaxed);
+        epaIterations.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Count a collision algorithm call. The shape types order does not matter: the call is counted on the pair (min shape type, max shape type).
+     */
+    void AlgorithmCounters::addAlgorithmCall(CollisionShape3D::ShapeType shapeType1, CollisionShape3D::ShapeType shapeType2) {
+        algorithmCalls[std::min(shapeType1, shapeType2)][std::max(shapeType1, shapeType2)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AlgorithmCounters::addGJKIterations(unsigned int iterationsCount) {
+        gjkIterations.fetch_add(iterationsCount, std::memory_order_relaxed);
+    }
+
+    void AlgorithmCounters::addEPAIterations(unsigned int iterationsCount) {
+        epaIterations.fetch_add(iterationsCount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @param stepCounters [out] Step counters filled with the collision algorithms counters
+     */
+    void AlgorithmCounters::fillStepCounters(StepCounters& stepCounters) const {
+        for (std::size_t i = 0; i < algorithmCalls.size(); ++i) {
+            for (std::size_t j = 0; j < algorithmCalls[i].size(); ++j) {
+                stepCounters.algorithmCalls[i][j] = algorithmCalls[i][j].load(std::memory_order_relaxed);
+            }
+        }
+        stepCounters.gjkIterations = gjkIterations.load(std::memory_order_relaxed);
+        stepCounters.epaIterations = epaIterations.load(std::memory_order_relaxed);
+    }
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "shape/CollisionShape3D.h"
+#include "metrics/StepCounters.h"
+
+namespace urchin {
+
+    /**
+    * Counters of the collision algorithms executed since the last reset. Counters can be incremented by several threads at the same time.
+    */
+    class AlgorithmCounters {
+        public:
+            AlgorithmCounters();
+
+            void reset();
+
+            void addAlgorithmCall(CollisionShape3D::ShapeType, CollisionShape3D::ShapeType);
+            void addGJKIterations(unsigned int);
+            void addEPAIterations(unsigned int);
+
+            void fillStepCounters(StepCounters&) const;
+
+        private:
+            std::array<std::array<std::atomic_uint, CollisionShape3D::SHAPE_MAX>, CollisionShape3D::SHAPE_MAX> algorithmCalls;
+            std::atomic_ulong gjkIterations;
+            std::atomic_ulong epaIterations;
+    };
+
+}
@@ -0,0 +1,198 @@
+#include <cassert>
+
+#include "metrics/PhysicsMetrics.h"
+
+namespace urchin {
+
+    PhysicsMetrics::PhysicsMetrics() :
+            currentPhasesDurationSec({}),
+            rayTestsCount(0),
+            stepsCount(0),
+            stepRecords(ConfigService::instance().getUnsignedIntValue("physicsMetrics.windowSize")),
+            phasesHistogram(PHASE_MAX, LatencyHistogram(stepRecords.size())),
+            stepHistogram(LatencyHistogram(stepRecords.size())) {
+
+    }
+
+    /**
+     * Start the time measurement of a step. Method must be called by the physics thread.
+     */
+    void PhysicsMetrics::beginStep() {
+        stepStartTime = std::chrono::steady_clock::now();
+        phaseStartTime = stepStartTime;
+        currentPhasesDurationSec.fill(0.0f);
+    }
+
+    /**
+     * End the time measurement of a phase: the phase duration is the time elapsed since the end of the previous phase (or the step start). Method must be called
+     * by the physics thread.
+     */
+    void PhysicsMetrics::endPhase(Phase phase) {
+        auto phaseEndTime = std::chrono::steady_clock::now();
+        currentPhasesDurationSec[phase] += std::chrono::duration<float>(phaseEndTime - phaseStartTime).count();
+        phaseStartTime = phaseEndTime;
+    }
+
+    /**
+     * Record the step counters and the phases durations. Method must be called by the physics thread.
+     * @param stepCounters Counters of the step. The ray tests counter is filled with the ray tests added since the previous step.
+     */
+    void PhysicsMetrics::endStep(StepCounters stepCounters) {
+        float stepDurationSec = std::chrono::duration<float>(std::chrono::steady_clock::now() - stepStartTime).count();
+        stepCounters.rayTests = rayTestsCount.exchange(0, std::memory_order_relaxed);
+
+        std::scoped_lock lock(mutex);
+        StepRecord& stepRecord = stepRecords[stepsCount % stepRecords.size()];
+        stepRecord.stepIndex = stepsCount;
+        stepRecord.counters = stepCounters;
+        for (std::size_t phaseIndex = 0; phaseIndex < PHASE_MAX; ++phaseIndex) {
+            stepRecord.phasesDurationMs[phaseIndex] = currentPhasesDurationSec[phaseIndex] * 1000.0f;
+            phasesHistogram[phaseIndex].registerLatency(currentPhasesDurationSec[phaseIndex]);
+        }
+        stepRecord.stepDurationMs = stepDurationSec * 1000.0f;
+        stepHistogram.registerLatency(stepDurationSec);
+        stepsCount++;
+    }
+
+    /**
+     * Count ray tests executed outside the collision world process (e.g. scene queries): they are counted in the next recorded step. Method can be called from any thread.
+     */
+    void PhysicsMetrics::addRayTests(unsigned int rayTests) {
+        rayTestsCount.fetch_add(rayTests, std::memory_order_relaxed);
+    }
+
+    /**
+     * Count ray tests executed on the result of the last recorded step (e.g. ray testers executed after the collision world process). Method can be called from any thread.
+     */
+    void PhysicsMetrics::addLastStepRayTests(unsigned int rayTests) {
+        std::scoped_lock lock(mutex);
+        if (stepsCount > 0) {
+            stepRecords[(stepsCount - 1) % stepRecords.size()].counters.rayTests += rayTests;
+        }
+    }
+
+    unsigned long PhysicsMetrics::getStepsCount() const {
+        std::scoped_lock lock(mutex);
+        return stepsCount;
+    }
+
+    /**
+     * @return Counters of the last step or empty counters when no step has been executed
+     */
+    StepCounters PhysicsMetrics::getLastStepCounters() const {
+        std::scoped_lock lock(mutex);
+        if (stepsCount == 0) {
+            return StepCounters();
+        }
+        return stepRecords[(stepsCount - 1) % stepRecords.size()].counters;
+    }
+
+    LatencyHistogram PhysicsMetrics::getPhaseHistogram(Phase phase) const {
+        std::scoped_lock lock(mutex);
+        return phasesHistogram[phase];
+    }
+
+    LatencyHistogram PhysicsMetrics::getStepHistogram() const {
+        std::scoped_lock lock(mutex);
+        return stepHistogram;
+    }
+
+    std::string_view PhysicsMetrics::getPhaseName(Phase phase) {
+        static constexpr std::array<std::string_view, PHASE_MAX> PHASE_NAMES = {"refreshBodies", "broadPhase", "integrateVelocity", "narrowPhase", "constraintSolver",
+                "bodyStateUpdate", "integrateTransform", "publishSnapshot"};
+        assert(phase < PHASE_MAX);
+        return PHASE_NAMES[phase];
+    }
+
+    /**
+     * @return One line by step of the rolling window (from the oldest to the newest step) with the phases durations and the counters of the step
+     */
+    std::string PhysicsMetrics::toCsv() const {
+        std::string result = "step,stepMs";
+        for (std::size_t phaseIndex = 0; phaseIndex < PHASE_MAX; ++phaseIndex) {
+            result += "," + std::string(getPhaseName((Phase)phaseIndex)) + "Ms";
+        }
+        result += ",overlappingPairs,manifoldResults,constraints,islands,activeBodies,inactiveBodies,rayTests,gjkIterations,epaIterations,algorithmCalls\n";
+
+        std::scoped_lock lock(mutex);
+        unsigned long firstStepIndex = (stepsCount > stepRecords.size()) ? stepsCount - stepRecords.size() : 0;
+        for (unsigned long stepIndex = firstStepIndex; stepIndex < stepsCount; ++stepIndex) {
+            const StepRecord& stepRecord = stepRecords[stepIndex % stepRecords.size()];
+            const StepCounters& counters = stepRecord.counters;
+
+            unsigned long algorithmCalls = 0;
+            for (const auto& algorithmCallsLine : counters.algorithmCalls) {
+                for (unsigned int algorithmCall : algorithmCallsLine) {
+                    algorithmCalls += algorithmCall;
+                }
+            }
+
+            result += std::to_string(stepRecord.stepIndex) + "," + TypeConverter::toString(stepRecord.stepDurationMs, 3);
+            for (float phaseDurationMs : stepRecord.phasesDurationMs) {
+                result += "," + TypeConverter::toString(phaseDurationMs, 3);
+            }
+            result += "," + std::to_string(counters.overlappingPairs) + "," + std::to_string(counters.manifoldResults) + "," + std::to_string(counters.constraints)
+                    + "," + std::to_string(counters.islands) + "," + std::to_string(counters.activeBodies) + "," + std::to_string(counters.inactiveBodies)
+                    + "," + std::to_string(counters.rayTests) + "," + std::to_string(counters.gjkIterations) + "," + std::to_string(counters.epaIterations)
+                    + "," + std::to_string(algorithmCalls) + "\n";
+        }
+        return result;
+    }
+
+    /**
+     * @return Counters of the last step (including the collision algorithm calls by shape types) and latency histograms of the step and of each phase
+     */
+    std::string PhysicsMetrics::toJson() const {
+        std::scoped_lock lock(mutex);
+        StepCounters counters = (stepsCount == 0) ? StepCounters() : stepRecords[(stepsCount - 1) % stepRecords.size()].counters;
+        std::string result = "{\"stepsCount\":" + std::to_string(stepsCount);
+
+        result += ",\"lastStep\":{\"overlappingPairs\":" + std::to_string(counters.overlappingPairs) + ",\"manifoldResults\":" + std::to_string(counters.manifoldResults)
+                + ",\"constraints\":" + std::to_string(counters.constraints) + ",\"islands\":" + std::to_string(counters.islands)
+                + ",\"activeBodies\":" + std::to_string(counters.activeBodies) + ",\"inactiveBodies\":" + std::to_string(counters.inactiveBodies)
+                + ",\"rayTests\":" + std::to_string(counters.rayTests) + ",\"gjkIterations\":" + std::to_string(counters.gjkIterations)
+                + ",\"epaIterations\":" + std::to_string(counters.epaIterations) + ",\"algorithmCalls\":{";
+        bool firstAlgorithmCall = true;
+        for (std::size_t i = 0; i < counters.algorithmCalls.size(); ++i) {
+            for (std::size_t j = 0; j < counters.algorithmCalls[i].size(); ++j) {
+                if (counters.algorithmCalls[i][j] != 0) {
+                    result += (firstAlgorithmCall ? "\"" : ",\"") + std::string(getShapeTypeName((CollisionShape3D::ShapeType)i)) + "/"
+                            + std::string(getShapeTypeName((CollisionShape3D::ShapeType)j)) + "\":" + std::to_string(counters.algorithmCalls[i][j]);
+                    firstAlgorithmCall = false;
+                }
+            }
+        }
+        result += "}}";
+
+        result += ",\"stepLatency\":" + toJson(stepHistogram);
+        result += ",\"phasesLatency\":{";
+        for (std::size_t phaseIndex = 0; phaseIndex < PHASE_MAX; ++phaseIndex) {
+            result += (phaseIndex == 0 ? "\"" : ",\"") + std::string(getPhaseName((Phase)phaseIndex)) + "\":" + toJson(phasesHistogram[phaseIndex]);
+        }
+        result += "}}";
+        return result;
+    }
+
+    std::string PhysicsMetrics::toJson(const LatencyHistogram& histogram) const {
+        std::string result = "{\"latenciesCount\":" + std::to_string(histogram.getLatenciesCount())
+                + ",\"p50Ms\":" + TypeConverter::toString(histogram.computePercentileMs(0.50f), 3)
+                + ",\"p95Ms\":" + TypeConverter::toString(histogram.computePercentileMs(0.95f), 3)
+                + ",\"p99Ms\":" + TypeConverter::toString(histogram.computePercentileMs(0.99f), 3)
+                + ",\"maxMs\":" + TypeConverter::toString(histogram.getMaxMs(), 3) + ",\"buckets\":[";
+        for (std::size_t bucketIndex = 0; bucketIndex < histogram.getBucketsCount(); ++bucketIndex) {
+            float bucketMaxMs = histogram.getBucketMaxMs(bucketIndex);
+            std::string bucketMaxMsString = (bucketMaxMs == std::numeric_limits<float>::max()) ? "null" : TypeConverter::toString(bucketMaxMs, 2);
+            result += (bucketIndex == 0 ? "" : ",") + std::string("{\"maxMs\":") + bucketMaxMsString + ",\"count\":" + std::to_string(histogram.getBucketCount(bucketIndex)) + "}";
+        }
+        result += "]}";
+        return result;
+    }
+
+    std::string_view PhysicsMetrics::getShapeTypeName(CollisionShape3D::ShapeType shapeType) {
+        static constexpr std::array<std::string_view, CollisionShape3D::SHAPE_MAX> SHAPE_TYPE_NAMES = {"sphere", "box", "capsule", "cylinder", "cone", "convexHull",
+                "triangle", "compound", "heightfield", "triangleMesh"};
+        assert(shapeType < CollisionShape3D::SHAPE_MAX);
+        return SHAPE_TYPE_NAMES[shapeType];
+    }
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "metrics/StepCounters.h"
+
+namespace urchin {
+
+    /**
+    * Metrics of the last physics steps: counters of the work done by each step and rolling latency histograms of the phases of the collision world process.
+    * Metrics are recorded by the physics thread and can be read from any thread.
+    */
+    class PhysicsMetrics {
+        public:
+            enum Phase {
+                REFRESH_BODIES = 0,
+                BROAD_PHASE,
+                INTEGRATE_VELOCITY,
+                NARROW_PHASE,
+                CONSTRAINT_SOLVER,
+                BODY_STATE_UPDATE,
+                INTEGRATE_TRANSFORM,
+                PUBLISH_SNAPSHOT,
+
+                PHASE_MAX
+            };
+
+            PhysicsMetrics();
+
+            void beginStep();
+            void endPhase(Phase);
+            void endStep(StepCounters);
+            void addRayTests(unsigned int);
+            void addLastStepRayTests(unsigned int);
+
+            unsigned long getStepsCount() const;
+            StepCounters getLastStepCounters() const;
+            LatencyHistogram getPhaseHistogram(Phase) const;
+            LatencyHistogram getStepHistogram() const;
+            static std::string_view getPhaseName(Phase);
+
+            std::string toCsv() const;
+            std::string toJson() const;
+
+        private:
+            struct StepRecord {
+                unsigned long stepIndex;
+                StepCounters counters;
+                std::array<float, PHASE_MAX> phasesDurationMs;
+                float stepDurationMs;
+            };
+
+            std::string toJson(const LatencyHistogram&) const;
+            static std::string_view getShapeTypeName(CollisionShape3D::ShapeType);
+
+            std::chrono::steady_clock::time_point stepStartTime;
+            std::chrono::steady_clock::time_point phaseStartTime;
+            std::array<float, PHASE_MAX> currentPhasesDurationSec;
+            std::atomic_uint rayTestsCount;
+
+            mutable std::mutex mutex;
+            unsigned long stepsCount;
+            std::vector<StepRecord> stepRecords; //ring buffer of the last steps
+            std::vector<LatencyHistogram> phasesHistogram;
+            LatencyHistogram stepHistogram;
+    };
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <array>
+
+#include "shape/CollisionShape3D.h"
+
+namespace urchin {
+
+    /**
+    * Counters of the work done by a physics step
+    */
+    struct StepCounters {
+        std::size_t overlappingPairs = 0;
+        std::size_t manifoldResults = 0;
+        std::size_t constraints = 0;
+        std::size_t islands = 0;
+        std::size_t activeBodies = 0;
+        std::size_t inactiveBodies = 0; //sleeping and static bodies
+        unsigned int rayTests = 0;
+        unsigned long gjkIterations = 0;
+        unsigned long epaIterations = 0;
+        std::array<std::array<unsigned int, CollisionShape3D::SHAPE_MAX>, CollisionShape3D::SHAPE_MAX> algorithmCalls = {}; //indexed by [min shape type][max shape type]
+    };
+
+}
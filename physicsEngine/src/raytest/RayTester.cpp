@@ -19,6 +19,10 @@ namespace urchin {
         this->rayTestVersion++;
     }
 
+    const Ray<float>& RayTester::getRay() const {
+        return ray;
+    }
+
     bool RayTester::isRayTestTriggerred() const {
         return rayTestVersion != 0;
     }
@@ -33,9 +37,18 @@ namespace urchin {
 
     void RayTester::execute(CollisionWorld& collisionWorld) {
         collisionWorld.getBroadPhase().rayTest(ray, bodiesAABBoxHitRay);
+        collisionWorld.getMetrics().addLastStepRayTests(1);
 
-        collisionWorld.getNarrowPhase().rayTest(ray, bodiesAABBoxHitRay, rayCastResults);
+        execute(collisionWorld, bodiesAABBoxHitRay);
         bodiesAABBoxHitRay.clear();
+    }
+
+    /**
+     * Execute the ray test with the result of the broad phase already computed
+     * @param bodiesAABBoxHitRay Bodies AABBox hit by the ray
+     */
+    void RayTester::execute(CollisionWorld& collisionWorld, const std::vector<std::shared_ptr<AbstractBody>>& bodiesAABBoxHitRay) {
+        collisionWorld.getNarrowPhase().rayTest(ray, bodiesAABBoxHitRay, rayCastResults);
 
         rayTestResult.updateResults(rayCastResults, rayTestVersion);
         rayCastResults.clear();
@@ -23,8 +23,10 @@ namespace urchin {
 
         protected:
             void updateRay(const Ray<float>&);
+            const Ray<float>& getRay() const;
 
             void execute(CollisionWorld&);
+            void execute(CollisionWorld&, const std::vector<std::shared_ptr<AbstractBody>>&);
 
         private:
             Ray<float> ray;
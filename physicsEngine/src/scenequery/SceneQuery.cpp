@@ -0,0 +1,182 @@
+#include <algorithm>
+
+#include "scenequery/SceneQuery.h"
+#include "collision/narrowphase/algorithm/gjk/GJKConvexObjectWrapper.h"
+#include "shape/CollisionCompoundShape.h"
+#include "shape/CollisionConcaveShape.h"
+#include "shape/CollisionSphereShape.h"
+#include "object/TemporalObject.h"
+
+namespace urchin {
+
+    //static
+    thread_local std::vector<const SnapshotBody*> SceneQuery::snapshotBodiesCache;
+    thread_local std::vector<ContinuousCollisionResult<float>> SceneQuery::continuousCollisionResultsCache;
+    thread_local std::vector<CollisionTriangleShape> SceneQuery::trianglesCache;
+
+    SceneQuery::SceneQuery(const NarrowPhase& narrowPhase, PhysicsMetrics& metrics) :
+            narrowPhase(narrowPhase),
+            metrics(metrics) {
+
+    }
+
+    /**
+     * Publish a snapshot of the broad phase for the queries. Method must be called by the physics thread at the end of each physics step.
+     */
+    void SceneQuery::publishSnapshot(const BroadPhase& broadPhase) {
+        ScopeProfiler sp(Profiler::physics(), "pubQuerySnap");
+
+        std::shared_ptr<BroadPhaseSnapshot> snapshot = retrieveFreeSnapshot();
+        {
+            std::shared_ptr<const BroadPhaseSnapshot> previousSnapshot = publishedSnapshot.load(std::memory_order_relaxed); //only written by the physics thread
+            broadPhase.copyTo(*snapshot, previousSnapshot.get()); //trees unchanged since the previous snapshot are shared
+        }
+        publishedSnapshot.store(snapshot, std::memory_order_release);
+
+        for (const std::shared_ptr<BroadPhaseSnapshot>& freeSnapshot : snapshots) {
+            if (freeSnapshot != snapshot && isFree(freeSnapshot)) {
+                freeSnapshot->clear(); //do not keep a reference on the bodies removed since this old snapshot
+            }
+        }
+    }
+
+    std::shared_ptr<BroadPhaseSnapshot> SceneQuery::retrieveFreeSnapshot() {
+        for (const std::shared_ptr<BroadPhaseSnapshot>& snapshot : snapshots) {
+            if (isFree(snapshot)) {
+                return snapshot;
+            }
+        }
+        return snapshots.emplace_back(std::make_shared<BroadPhaseSnapshot>());
+    }
+
+    /**
+     * @return True when the snapshot is only referenced by the pool: it is not published and not used by a query anymore. Other threads cannot acquire a new reference on it.
+     */
+    bool SceneQuery::isFree(const std::shared_ptr<BroadPhaseSnapshot>& snapshot) const {
+        if (snapshot.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire); //synchronize with the release of the last query
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @return Nearest body hit by the ray. Ghost bodies are ignored.
+     */
+    std::optional<ContinuousCollisionResult<float>> SceneQuery::rayCast(const Ray<float>& ray) const {
+        metrics.addRayTests(1);
+        std::shared_ptr<const BroadPhaseSnapshot> snapshot = publishedSnapshot.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return std::nullopt;
+        }
+
+        snapshotBodiesCache.clear();
+        snapshot->rayQuery(ray, snapshotBodiesCache);
+
+        CollisionSphereShape pointShape(0.0f);
+        TemporalObject rayCastObject(pointShape, 0, PhysicsTransform(ray.getOrigin()), PhysicsTransform(ray.computeTo()));
+        return findNearestContinuousCollision(rayCastObject, snapshotBodiesCache);
+    }
+
+    /**
+     * Sweep a convex shape (e.g. sphere, capsule) from a transform to another one.
+     * @return Nearest body hit by the shape. Ghost bodies are ignored.
+     */
+    std::optional<ContinuousCollisionResult<float>> SceneQuery::sweepTest(const CollisionShape3D& shape, const PhysicsTransform& from, const PhysicsTransform& to) const {
+        if (!shape.isConvex()) {
+            throw std::invalid_argument("Sweep test is only supported for convex shape: " + std::to_string(shape.getShapeType()));
+        }
+
+        std::shared_ptr<const BroadPhaseSnapshot> snapshot = publishedSnapshot.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return std::nullopt;
+        }
+
+        snapshotBodiesCache.clear();
+        snapshot->aabboxQuery(shape.toAABBox(from).merge(shape.toAABBox(to)), snapshotBodiesCache);
+
+        TemporalObject sweptObject(shape, 0, from, to);
+        return findNearestContinuousCollision(sweptObject, snapshotBodiesCache);
+    }
+
+    /**
+     * @param bodiesAABBoxHit [out] Bodies having their AABBox overlapping the provided AABBox
+     */
+    void SceneQuery::aabboxOverlapTest(const AABBox<float>& aabbox, std::vector<std::shared_ptr<AbstractBody>>& bodiesAABBoxHit) const {
+        std::shared_ptr<const BroadPhaseSnapshot> snapshot = publishedSnapshot.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return;
+        }
+
+        snapshotBodiesCache.clear();
+        snapshot->aabboxQuery(aabbox, snapshotBodiesCache); //AABBox of the snapshot leaves are exact: no additional check required
+        for (const SnapshotBody* snapshotBody : snapshotBodiesCache) {
+            bodiesAABBoxHit.push_back(snapshotBody->body);
+        }
+    }
+
+    /**
+     * @param bodiesOverlapping [out] Bodies overlapping the convex shape (margins included)
+     */
+    void SceneQuery::shapeOverlapTest(const CollisionShape3D& shape, const PhysicsTransform& transform, std::vector<std::shared_ptr<AbstractBody>>& bodiesOverlapping) const {
+        if (!shape.isConvex()) {
+            throw std::invalid_argument("Overlap test is only supported for convex shape: " + std::to_string(shape.getShapeType()));
+        }
+
+        std::shared_ptr<const BroadPhaseSnapshot> snapshot = publishedSnapshot.load(std::memory_order_acquire);
+        if (!snapshot) {
+            return;
+        }
+
+        snapshotBodiesCache.clear();
+        snapshot->aabboxQuery(shape.toAABBox(transform), snapshotBodiesCache);
+
+        std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject = shape.toConvexObject(transform);
+        for (const SnapshotBody* snapshotBody : snapshotBodiesCache) {
+            if (isOverlapping(shape, transform, *convexObject, *snapshotBody)) {
+                bodiesOverlapping.push_back(snapshotBody->body);
+            }
+        }
+    }
+
+    std::optional<ContinuousCollisionResult<float>> SceneQuery::findNearestContinuousCollision(const TemporalObject& temporalObject, const std::vector<const SnapshotBody*>& snapshotBodies) const {
+        continuousCollisionResultsCache.clear();
+        for (const SnapshotBody* snapshotBody : snapshotBodies) {
+            if (snapshotBody->body->getBodyType() == BodyType::GHOST) {
+                continue;
+            }
+            narrowPhase.continuousCollisionTest(temporalObject, snapshotBody->body, snapshotBody->transform, continuousCollisionResultsCache);
+        }
+
+        if (continuousCollisionResultsCache.empty()) {
+            return std::nullopt;
+        }
+        return *std::ranges::min_element(continuousCollisionResultsCache, ContinuousCollisionResultComparator<float>());
+    }
+
+    bool SceneQuery::isOverlapping(const CollisionShape3D& shape, const PhysicsTransform& transform, const CollisionConvexObject3D& convexObject, const SnapshotBody& snapshotBody) const {
+        const CollisionShape3D& bodyShape = snapshotBody.body->getShape();
+        if (bodyShape.isCompound()) {
+            const auto& compoundShape = static_cast<const CollisionCompoundShape&>(bodyShape);
+            return std::ranges::any_of(compoundShape.getLocalizedShapes(), [&](const auto& localizedShape) {
+                return isOverlapping(convexObject, *localizedShape->shape, snapshotBody.transform * localizedShape->transform);
+            });
+        } else if (bodyShape.isConvex()) {
+            return isOverlapping(convexObject, bodyShape, snapshotBody.transform);
+        } else if (bodyShape.isConcave()) {
+            const auto& concaveShape = dynamic_cast<const CollisionConcaveShape&>(bodyShape);
+            concaveShape.findTrianglesInAABBox(shape.toAABBox(snapshotBody.transform.inverse() * transform), trianglesCache);
+            return std::ranges::any_of(trianglesCache, [&](const CollisionTriangleShape& triangle) {
+                return isOverlapping(convexObject, triangle, snapshotBody.transform);
+            });
+        }
+        throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape.getShapeType()));
+    }
+
+    bool SceneQuery::isOverlapping(const CollisionConvexObject3D& convexObject, const CollisionShape3D& bodyConvexShape, const PhysicsTransform& bodyShapeTransform) const {
+        std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> bodyConvexObject = bodyConvexShape.toConvexObject(bodyShapeTransform);
+        GJKResult<double> gjkResult = gjkAlgorithm.processGJK(GJKConvexObjectWrapper(convexObject, true), GJKConvexObjectWrapper(*bodyConvexObject, true));
+        return gjkResult.isValidResult() && gjkResult.isCollide();
+    }
+
+}
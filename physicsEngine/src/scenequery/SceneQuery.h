@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "body/model/AbstractBody.h"
+#include "collision/broadphase/BroadPhase.h"
+#include "collision/broadphase/BroadPhaseSnapshot.h"
+#include "collision/narrowphase/NarrowPhase.h"
+#include "collision/narrowphase/algorithm/continuous/ContinuousCollisionResult.h"
+#include "metrics/PhysicsMetrics.h"
+#include "shape/CollisionShape3D.h"
+#include "shape/CollisionTriangleShape.h"
+
+namespace urchin {
+
+    /**
+    * Synchronous scene queries executed on the caller thread against the last broad phase snapshot published by the physics thread.
+    * Contrary to RayTester, the result is immediately available and the physics thread is never blocked. Query methods can be called from any thread.
+    */
+    class SceneQuery {
+        public:
+            SceneQuery(const NarrowPhase&, PhysicsMetrics&);
+
+            void publishSnapshot(const BroadPhase&);
+
+            std::optional<ContinuousCollisionResult<float>> rayCast(const Ray<float>&) const;
+            std::optional<ContinuousCollisionResult<float>> sweepTest(const CollisionShape3D&, const PhysicsTransform&, const PhysicsTransform&) const;
+            void aabboxOverlapTest(const AABBox<float>&, std::vector<std::shared_ptr<AbstractBody>>&) const;
+            void shapeOverlapTest(const CollisionShape3D&, const PhysicsTransform&, std::vector<std::shared_ptr<AbstractBody>>&) const;
+
+        private:
+            std::shared_ptr<BroadPhaseSnapshot> retrieveFreeSnapshot();
+            bool isFree(const std::shared_ptr<BroadPhaseSnapshot>&) const;
+
+            std::optional<ContinuousCollisionResult<float>> findNearestContinuousCollision(const TemporalObject&, const std::vector<const SnapshotBody*>&) const;
+            bool isOverlapping(const CollisionShape3D&, const PhysicsTransform&, const CollisionConvexObject3D&, const SnapshotBody&) const;
+            bool isOverlapping(const CollisionConvexObject3D&, const CollisionShape3D&, const PhysicsTransform&) const;
+
+            const NarrowPhase& narrowPhase;
+            PhysicsMetrics& metrics;
+            GJKAlgorithm<double> gjkAlgorithm;
+
+            std::vector<std::shared_ptr<BroadPhaseSnapshot>> snapshots; //snapshots owned by the physics thread, reused when no more referenced by the queries
+            std::atomic<std::shared_ptr<const BroadPhaseSnapshot>> publishedSnapshot;
+
+            static thread_local std::vector<const SnapshotBody*> snapshotBodiesCache;
+            static thread_local std::vector<ContinuousCollisionResult<float>> continuousCollisionResultsCache;
+            static thread_local std::vector<CollisionTriangleShape> trianglesCache;
+    };
+
+}
@@ -10,8 +10,8 @@ namespace urchin {
         public:
             virtual ~CollisionConcaveShape() = default;
 
-            virtual const std::vector<CollisionTriangleShape>& findTrianglesInAABBox(const AABBox<float>&) const = 0;
-            virtual const std::vector<CollisionTriangleShape>& findTrianglesHitByRay(const LineSegment3D<float>&) const = 0;
+            virtual void findTrianglesInAABBox(const AABBox<float>&, std::vector<CollisionTriangleShape>&) const = 0;
+            virtual void findTrianglesHitByRay(const LineSegment3D<float>&, std::vector<CollisionTriangleShape>&) const = 0;
     };
 
 }
@@ -1,46 +1,109 @@
 #include <limits>
 #include <cassert>
+#include <cmath>
+#include <array>
 #include <algorithm>
 
 #include "shape/CollisionHeightfieldShape.h"
 
 namespace urchin {
 
-    CollisionHeightfieldShape::CollisionHeightfieldShape(std::vector<Point3<float>> vertices, unsigned int xLength, unsigned int zLength) :
-            vertices(std::move(vertices)),
+    thread_local std::vector<CollisionHeightfieldShape::QuadtreeNode> CollisionHeightfieldShape::browseNodes;
+
+    CollisionHeightfieldShape::CollisionHeightfieldShape(const std::vector<Point3<float>>& vertices, unsigned int xLength, unsigned int zLength) :
             xLength(xLength),
             zLength(zLength),
-            localAABBox(buildLocalAABBox()) {
-        assert(this->vertices.size() == xLength * zLength);
+            gridOrigin(Point2<float>(vertices[0].X, vertices[0].Z)),
+            cellSize(Vector2<float>(0.0f, 0.0f)),
+            minHeight(0.0f),
+            heightStep(0.0f) {
+        assert(vertices.size() == xLength * zLength);
+
+        if (xLength > 1) {
+            cellSize.X = (vertices[xLength - 1].X - vertices[0].X) / (float)(xLength - 1);
+        }
+        if (zLength > 1) {
+            cellSize.Y = (vertices[vertices.size() - 1].Z - vertices[0].Z) / (float)(zLength - 1);
+        }
+
+        quantizeHeights(vertices);
+        buildQuadtree();
+        localAABBox = buildLocalAABBox();
     }
 
-    CollisionHeightfieldShape::~CollisionHeightfieldShape() {
-        trianglesInAABBox.clear();
+    void CollisionHeightfieldShape::quantizeHeights(const std::vector<Point3<float>>& vertices) {
+        auto [minVertex, maxVertex] = std::ranges::minmax_element(vertices, [](const Point3<float>& v1, const Point3<float>& v2) { return v1.Y < v2.Y; });
+        minHeight = minVertex->Y;
+        heightStep = (maxVertex->Y - minHeight) / (float)std::numeric_limits<uint16_t>::max();
+
+        quantizedHeights.resize(vertices.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i) {
+            float quantizedHeight = heightStep > 0.0f ? std::round((vertices[i].Y - minHeight) / heightStep) : 0.0f;
+            quantizedHeights[i] = (uint16_t)std::clamp(quantizedHeight, 0.0f, (float)std::numeric_limits<uint16_t>::max());
+        }
     }
 
-    BoxShape<float> CollisionHeightfieldShape::buildLocalAABBox() const {
-        Point3 min(vertices[0].X, std::numeric_limits<float>::max(), vertices[0].Z);
-        Point3 max(vertices[xLength - 1].X, -std::numeric_limits<float>::max(), vertices[vertices.size() - 1].Z);
+    void CollisionHeightfieldShape::buildQuadtree() {
+        if (xLength < 2 || zLength < 2) {
+            return;
+        }
 
-        for (const auto& vertex : vertices) {
-            if (min.Y > vertex.Y) {
-                min.Y = vertex.Y;
+        //leaf tiles level
+        QuadtreeLevel leafLevel;
+        leafLevel.xTilesCount = MathFunction::ceilToUInt((float)(xLength - 1) / (float)TILE_CELLS_COUNT);
+        leafLevel.zTilesCount = MathFunction::ceilToUInt((float)(zLength - 1) / (float)TILE_CELLS_COUNT);
+        leafLevel.tilesHeightRange.reserve((std::size_t)leafLevel.xTilesCount * leafLevel.zTilesCount);
+        for (unsigned int zTile = 0; zTile < leafLevel.zTilesCount; ++zTile) {
+            for (unsigned int xTile = 0; xTile < leafLevel.xTilesCount; ++xTile) {
+                HeightRange heightRange = {.min = std::numeric_limits<uint16_t>::max(), .max = 0};
+                unsigned int zEnd = std::min((zTile + 1) * TILE_CELLS_COUNT, zLength - 1);
+                unsigned int xEnd = std::min((xTile + 1) * TILE_CELLS_COUNT, xLength - 1);
+                for (unsigned int z = zTile * TILE_CELLS_COUNT; z <= zEnd; ++z) {
+                    for (unsigned int x = xTile * TILE_CELLS_COUNT; x <= xEnd; ++x) {
+                        uint16_t quantizedHeight = quantizedHeights[x + xLength * z];
+                        heightRange.min = std::min(heightRange.min, quantizedHeight);
+                        heightRange.max = std::max(heightRange.max, quantizedHeight);
+                    }
+                }
+                leafLevel.tilesHeightRange.push_back(heightRange);
             }
-            if (max.Y < vertex.Y) {
-                max.Y = vertex.Y;
+        }
+        quadtreeLevels.push_back(std::move(leafLevel));
+
+        //upper levels: each tile merges the 2x2 tiles of the level below
+        while (quadtreeLevels.back().xTilesCount > 1 || quadtreeLevels.back().zTilesCount > 1) {
+            const QuadtreeLevel& childLevel = quadtreeLevels.back();
+            QuadtreeLevel level;
+            level.xTilesCount = (childLevel.xTilesCount + 1) / 2;
+            level.zTilesCount = (childLevel.zTilesCount + 1) / 2;
+            level.tilesHeightRange.reserve((std::size_t)level.xTilesCount * level.zTilesCount);
+            for (unsigned int zTile = 0; zTile < level.zTilesCount; ++zTile) {
+                for (unsigned int xTile = 0; xTile < level.xTilesCount; ++xTile) {
+                    HeightRange heightRange = {.min = std::numeric_limits<uint16_t>::max(), .max = 0};
+                    for (unsigned int zChild = zTile * 2; zChild < std::min(zTile * 2 + 2, childLevel.zTilesCount); ++zChild) {
+                        for (unsigned int xChild = xTile * 2; xChild < std::min(xTile * 2 + 2, childLevel.xTilesCount); ++xChild) {
+                            const HeightRange& childHeightRange = childLevel.tilesHeightRange[xChild + childLevel.xTilesCount * zChild];
+                            heightRange.min = std::min(heightRange.min, childHeightRange.min);
+                            heightRange.max = std::max(heightRange.max, childHeightRange.max);
+                        }
+                    }
+                    level.tilesHeightRange.push_back(heightRange);
+                }
             }
+            quadtreeLevels.push_back(std::move(level));
         }
+    }
+
+    BoxShape<float> CollisionHeightfieldShape::buildLocalAABBox() const {
+        float maxHeight = toHeight(std::numeric_limits<uint16_t>::max());
 
         //center on Y axis
-        float maxAbsoluteYValue = std::max(std::abs(min.Y), std::abs(max.Y));
-        min.Y = -maxAbsoluteYValue;
-        max.Y = maxAbsoluteYValue;
+        float maxAbsoluteYValue = std::max(std::abs(minHeight), std::abs(maxHeight));
 
-        assert(std::abs(std::abs(min.X) - max.X) < 0.01f);
-        assert(std::abs(std::abs(min.Y) - max.Y) < 0.01f);
-        assert(std::abs(std::abs(min.Z) - max.Z) < 0.01f);
+        Vector3 halfSizes(cellSize.X * (float)(xLength - 1) / 2.0f, maxAbsoluteYValue, cellSize.Y * (float)(zLength - 1) / 2.0f);
+        assert(std::abs(gridOrigin.X + halfSizes.X) < 0.01f);
+        assert(std::abs(gridOrigin.Y + halfSizes.Z) < 0.01f);
 
-        Vector3 halfSizes((max.X - min.X) / 2.0f, (max.Y - min.Y) / 2.0f, (max.Z - min.Z) / 2.0f);
         return BoxShape(halfSizes);
     }
 
@@ -52,16 +115,25 @@ namespace urchin {
         throw std::runtime_error("Impossible to retrieve single convex shape for heightfield shape");
     }
 
+    /**
+     * @return Heightfield scaled from the quantized heights: the quantization parameters are scaled instead of re-quantizing the heights
+     */
     std::unique_ptr<CollisionShape3D> CollisionHeightfieldShape::scale(const Vector3<float>& scale) const {
-        if (!MathFunction::isOne(scale.X, 0.001f) || !MathFunction::isOne(scale.Y, 0.001f) || !MathFunction::isOne(scale.Z, 0.001f)) {
-            throw std::runtime_error("Scaling a heightfield shape is currently not supported");
+        if (scale.X <= 0.0f || scale.Y <= 0.0f || scale.Z <= 0.0f) {
+            throw std::runtime_error("Scaling a heightfield shape with a negative or null scale is not supported");
         }
 
-        return std::make_unique<CollisionHeightfieldShape>(vertices, xLength, zLength);
+        auto scaledShape = std::unique_ptr<CollisionHeightfieldShape>(new CollisionHeightfieldShape(*this));
+        scaledShape->gridOrigin = Point2<float>(gridOrigin.X * scale.X, gridOrigin.Y * scale.Z);
+        scaledShape->cellSize = Vector2<float>(cellSize.X * scale.X, cellSize.Y * scale.Z);
+        scaledShape->minHeight = minHeight * scale.Y;
+        scaledShape->heightStep = heightStep * scale.Y;
+        scaledShape->localAABBox = scaledShape->buildLocalAABBox();
+        return scaledShape;
     }
 
-    const std::vector<Point3<float>>& CollisionHeightfieldShape::getVertices() const {
-        return vertices;
+    Point3<float> CollisionHeightfieldShape::getVertex(unsigned int x, unsigned int z) const {
+        return Point3<float>(gridOrigin.X + (float)x * cellSize.X, getHeight(x, z), gridOrigin.Y + (float)z * cellSize.Y);
     }
 
     unsigned int CollisionHeightfieldShape::getXLength() const {
@@ -72,6 +144,14 @@ namespace urchin {
         return zLength;
     }
 
+    const Point2<float>& CollisionHeightfieldShape::getGridOrigin() const {
+        return gridOrigin;
+    }
+
+    const Vector2<float>& CollisionHeightfieldShape::getCellSize() const {
+        return cellSize;
+    }
+
     AABBox<float> CollisionHeightfieldShape::toAABBox(const PhysicsTransform& physicsTransform) const {
         Matrix3<float> orientation = physicsTransform.retrieveOrientationMatrix();
         Point3 extend(
@@ -109,113 +189,248 @@ namespace urchin {
     }
 
     std::unique_ptr<CollisionShape3D> CollisionHeightfieldShape::clone() const {
-        return std::make_unique<CollisionHeightfieldShape>(vertices, xLength, zLength);
+        return std::unique_ptr<CollisionHeightfieldShape>(new CollisionHeightfieldShape(*this));
     }
 
-    const std::vector<CollisionTriangleShape>& CollisionHeightfieldShape::findTrianglesInAABBox(const AABBox<float>& checkAABBox) const {
+    /**
+     * @param trianglesInAABBox [out] Triangles potentially in the AABBox
+     */
+    void CollisionHeightfieldShape::findTrianglesInAABBox(const AABBox<float>& checkAABBox, std::vector<CollisionTriangleShape>& trianglesInAABBox) const {
         trianglesInAABBox.clear();
+        if (quadtreeLevels.empty()) {
+            return;
+        }
+
+        auto [cellXMin, cellXMax] = computeStartEndIndices(checkAABBox.getMin().X, checkAABBox.getMax().X, X);
+        auto [cellZMin, cellZMax] = computeStartEndIndices(checkAABBox.getMin().Z, checkAABBox.getMax().Z, Z);
+        if (cellXMin >= cellXMax || cellZMin >= cellZMax) {
+            return;
+        }
 
-        auto [vertexXMin, vertexXMax] = computeStartEndIndices(checkAABBox.getMin().X, checkAABBox.getMax().X, X);
-        auto [vertexZMin, vertexZMax] = computeStartEndIndices(checkAABBox.getMin().Z, checkAABBox.getMax().Z, Z);
+        browseNodes.clear();
+        browseNodes.push_back({.levelIndex = quadtreeLevels.size() - 1, .xTile = 0, .zTile = 0});
+        while (!browseNodes.empty()) {
+            QuadtreeNode node = browseNodes.back();
+            browseNodes.pop_back();
 
-        for (unsigned int z = vertexZMin; z < vertexZMax; ++z) {
-            for (unsigned int x = vertexXMin; x < vertexXMax; ++x) {
-                createTrianglesMatchHeight(x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y);
+            const QuadtreeLevel& level = quadtreeLevels[node.levelIndex];
+            const HeightRange& heightRange = level.tilesHeightRange[node.xTile + level.xTilesCount * node.zTile];
+            if (toHeight(heightRange.max) < checkAABBox.getMin().Y || toHeight(heightRange.min) > checkAABBox.getMax().Y) {
+                continue;
             }
-        }
 
-        return trianglesInAABBox;
+            unsigned int tileCellsCount = TILE_CELLS_COUNT << node.levelIndex;
+            unsigned int tileXMin = std::max(node.xTile * tileCellsCount, cellXMin);
+            unsigned int tileXMax = std::min((node.xTile + 1) * tileCellsCount, cellXMax);
+            unsigned int tileZMin = std::max(node.zTile * tileCellsCount, cellZMin);
+            unsigned int tileZMax = std::min((node.zTile + 1) * tileCellsCount, cellZMax);
+            if (tileXMin >= tileXMax || tileZMin >= tileZMax) {
+                continue;
+            }
+
+            if (node.levelIndex == 0) {
+                for (unsigned int z = tileZMin; z < tileZMax; ++z) {
+                    for (unsigned int x = tileXMin; x < tileXMax; ++x) {
+                        createTrianglesMatchHeight(x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y, trianglesInAABBox);
+                    }
+                }
+            } else {
+                const QuadtreeLevel& childLevel = quadtreeLevels[node.levelIndex - 1];
+                for (unsigned int zChild = std::min(node.zTile * 2 + 2, childLevel.zTilesCount); zChild-- > node.zTile * 2;) {
+                    for (unsigned int xChild = std::min(node.xTile * 2 + 2, childLevel.xTilesCount); xChild-- > node.xTile * 2;) {
+                        browseNodes.push_back({.levelIndex = node.levelIndex - 1, .xTile = xChild, .zTile = zChild});
+                    }
+                }
+            }
+        }
     }
 
-    const std::vector<CollisionTriangleShape>& CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float>& ray) const {
-        trianglesInAABBox.clear();
+    /**
+     * @param trianglesHitByRay [out] Triangles potentially hit by the ray
+     */
+    void CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float>& ray, std::vector<CollisionTriangleShape>& trianglesHitByRay) const {
+        trianglesHitByRay.clear();
+        if (quadtreeLevels.empty()) {
+            return;
+        }
 
-        bool raySameXValues = ray.getA().X == ray.getB().X;
-        bool raySameZValues = ray.getA().Z == ray.getB().Z;
-
-        //2d line equation variables
-        float slopeLineZX = (ray.getB().X - ray.getA().X) / (ray.getB().Z - ray.getA().Z);
-        float slopeLineXY = (ray.getB().Y - ray.getA().Y) / (ray.getB().X - ray.getA().X);
-        float slopeLineZY = (ray.getB().Y - ray.getA().Y) / (ray.getB().Z - ray.getA().Z);
-        float interceptLineZX = ray.getA().X - (slopeLineZX * ray.getA().Z);
-        float interceptLineXY = ray.getA().Y - (slopeLineXY * ray.getA().X);
-        float interceptLineZY = ray.getA().Y - (slopeLineZY * ray.getA().Z);
-
-        float rayMinZ = std::min(ray.getA().Z, ray.getB().Z);
-        float rayMaxZ = std::max(ray.getA().Z, ray.getB().Z);
-        auto [vertexZMin, vertexZMax] = computeStartEndIndices(rayMinZ, rayMaxZ, Z);
-
-        for (unsigned int z = vertexZMin; z < vertexZMax; ++z) {
-            float zStartValue = vertices[xLength * z].Z;
-            float zEndValue = vertices[xLength * (z + 1)].Z;
-            float xFirstValue = raySameZValues ? ray.getA().X : slopeLineZX * zStartValue + interceptLineZX;
-            float xSecondValue = raySameZValues ? ray.getB().X : slopeLineZX * zEndValue + interceptLineZX;
-            auto [xMinValue, xMaxValue] = std::minmax(xFirstValue, xSecondValue);
-
-            auto [vertexXMin, vertexXMax] = computeStartEndIndices(xMinValue, xMaxValue, X);
-
-            for (unsigned int x = vertexXMin; x < vertexXMax; ++x) {
-                //compute min and max Y values based on X value (don't give satisfying result when ray is parallel to Z axis)
-                float xCurrentValue = vertices[x].X;
-                float xNextValue = vertices[x + 1].X;
-                float yFirstValue1 = raySameXValues ? ray.getA().Y : slopeLineXY * xCurrentValue + interceptLineXY;
-                float ySecondValue1 = raySameXValues ? ray.getB().Y : slopeLineXY * xNextValue + interceptLineXY;
-                auto [yMinValue1, yMaxValue1] = std::minmax(yFirstValue1, ySecondValue1);
-
-                //compute min and max Y values based on Z value (don't give satisfying result when ray is parallel to X axis)
-                float yFirstValue2 = raySameZValues ? ray.getA().Y : slopeLineZY * zStartValue + interceptLineZY;
-                float ySecondValue2 = raySameZValues ? ray.getB().Y : slopeLineZY * zEndValue + interceptLineZY;
-                auto [yMinValue2, yMaxValue2] = std::minmax(yFirstValue2, ySecondValue2);
-
-                //combine both results to get a more satisfying result
-                float rayMinY = std::max(yMinValue1, yMinValue2);
-                float rayMaxY = std::min(yMaxValue1, yMaxValue2);
-
-                createTrianglesMatchHeight(x, z, rayMinY, rayMaxY);
+        //ray in grid coordinates: one unit by cell
+        Point2<float> start((ray.getA().X - gridOrigin.X) / cellSize.X, (ray.getA().Z - gridOrigin.Y) / cellSize.Y);
+        Vector2<float> direction((ray.getB().X - ray.getA().X) / cellSize.X, (ray.getB().Z - ray.getA().Z) / cellSize.Y);
+        float rayDeltaY = ray.getB().Y - ray.getA().Y;
+
+        float tStart = 0.0f;
+        float tEnd = 1.0f;
+        if (!clipRayOnGrid(start, direction, tStart, tEnd)) {
+            return;
+        }
+
+        const QuadtreeLevel& leafLevel = quadtreeLevels[0];
+        Point2<int> maxTile((int)leafLevel.xTilesCount - 1, (int)leafLevel.zTilesCount - 1);
+        GridTraversal tileTraversal(start, direction, (float)TILE_CELLS_COUNT, tStart, tEnd, Point2<int>(0, 0), maxTile);
+        while (tileTraversal.next()) {
+            auto xTile = (unsigned int)tileTraversal.xCell;
+            auto zTile = (unsigned int)tileTraversal.zCell;
+            auto [tileRayMinY, tileRayMaxY] = std::minmax(ray.getA().Y + tileTraversal.tEnter * rayDeltaY, ray.getA().Y + tileTraversal.tExit * rayDeltaY);
+            const HeightRange& heightRange = leafLevel.tilesHeightRange[xTile + leafLevel.xTilesCount * zTile];
+            if (toHeight(heightRange.max) < tileRayMinY || toHeight(heightRange.min) > tileRayMaxY) {
+                continue;
+            }
+
+            Point2<int> minCell((int)(xTile * TILE_CELLS_COUNT), (int)(zTile * TILE_CELLS_COUNT));
+            Point2<int> maxCell((int)std::min((xTile + 1) * TILE_CELLS_COUNT, xLength - 1) - 1, (int)std::min((zTile + 1) * TILE_CELLS_COUNT, zLength - 1) - 1);
+            GridTraversal cellTraversal(start, direction, 1.0f, tileTraversal.tEnter, tileTraversal.tExit, minCell, maxCell);
+            while (cellTraversal.next()) {
+                auto [rayMinY, rayMaxY] = std::minmax(ray.getA().Y + cellTraversal.tEnter * rayDeltaY, ray.getA().Y + cellTraversal.tExit * rayDeltaY);
+                createTrianglesMatchHeight((unsigned int)cellTraversal.xCell, (unsigned int)cellTraversal.zCell, rayMinY, rayMaxY, trianglesHitByRay);
             }
         }
+    }
+
+    unsigned int CollisionHeightfieldShape::getQuadtreeDepth() const {
+        return (unsigned int)quadtreeLevels.size();
+    }
 
-        return trianglesInAABBox;
+    float CollisionHeightfieldShape::getHeight(unsigned int x, unsigned int z) const {
+        return toHeight(quantizedHeights[x + xLength * z]);
+    }
+
+    float CollisionHeightfieldShape::toHeight(uint16_t quantizedHeight) const {
+        return minHeight + (float)quantizedHeight * heightStep;
     }
 
     /**
      * @param minValue Lower bound value on X (or Z) axis
      * @param maxValue Upper bound value on X (or Z) axis
+     * @return Start (inclusive) and end (exclusive) cell indices
      */
     std::pair<unsigned int, unsigned int> CollisionHeightfieldShape::computeStartEndIndices(float minValue, float maxValue, Axis axis) const {
-        float halfSize = axis == X ? localAABBox.getHalfSizes().X : localAABBox.getHalfSizes().Z;
-        float verticesDistance = axis == X ? vertices[1].X - vertices[0].X : vertices[xLength].Z - vertices[0].Z;
+        float origin = axis == X ? gridOrigin.X : gridOrigin.Y;
+        float verticesDistance = axis == X ? cellSize.X : cellSize.Y;
         int maxLength = axis == X ? (int)xLength - 1 : (int)zLength - 1;
 
-        auto rawStartVertex = (int)((minValue + halfSize) / verticesDistance);
+        auto rawStartVertex = (int)((minValue - origin) / verticesDistance);
         auto startVertex = (unsigned int)std::clamp(rawStartVertex, 0, maxLength);
 
-        auto rawEndVertex = (int)((maxValue + halfSize) / verticesDistance) + 1;
+        auto rawEndVertex = (int)((maxValue - origin) / verticesDistance) + 1;
         auto endVertex = (unsigned int)std::clamp(rawEndVertex, 0, maxLength);
 
         return std::make_pair(startVertex, endVertex);
     }
 
-    void CollisionHeightfieldShape::createTrianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY) const {
-        Point3<float> point1 = vertices[x + xLength * z]; //far-left
-        Point3<float> point2 = vertices[x + 1 + xLength * z]; //far-right
-        Point3<float> point3 = vertices[x + xLength * (z + 1)]; //near-left
-        Point3<float> point4 = vertices[x + 1 + xLength * (z + 1)]; //near-right
+    /**
+     * Clip the ray (expressed in grid coordinates) on the grid bounds
+     * @param tStart [in,out] Ray parameter where the ray enters in the grid
+     * @param tEnd [in,out] Ray parameter where the ray exits the grid
+     * @return True when the ray crosses the grid
+     */
+    bool CollisionHeightfieldShape::clipRayOnGrid(const Point2<float>& start, const Vector2<float>& direction, float& tStart, float& tEnd) const {
+        std::array<float, 2> gridSizes = {(float)(xLength - 1), (float)(zLength - 1)};
+        for (std::size_t i = 0; i < 2; ++i) {
+            if (direction[i] == 0.0f) {
+                if (start[i] < 0.0f || start[i] > gridSizes[i]) {
+                    return false;
+                }
+            } else {
+                auto [t0, t1] = std::minmax((0.0f - start[i]) / direction[i], (gridSizes[i] - start[i]) / direction[i]);
+                tStart = std::max(tStart, t0);
+                tEnd = std::min(tEnd, t1);
+                if (tStart > tEnd) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @param triangles [out] Triangles of the cell matching the height range are added
+     */
+    void CollisionHeightfieldShape::createTrianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY, std::vector<CollisionTriangleShape>& triangles) const {
+        Point3<float> point1 = getVertex(x, z); //far-left
+        Point3<float> point2 = getVertex(x + 1, z); //far-right
+        Point3<float> point3 = getVertex(x, z + 1); //near-left
+        Point3<float> point4 = getVertex(x + 1, z + 1); //near-right
 
         bool hasDiagonalPointAbove = point2.Y > minY || point3.Y > minY;
         bool hasDiagonalPointBelow = point2.Y < maxY || point3.Y < maxY;
 
         if ( (point1.Y > minY || hasDiagonalPointAbove) && (point1.Y < maxY || hasDiagonalPointBelow) ) {
-            createCollisionTriangleShape(point1, point3, point2);
+            triangles.emplace_back(TriangleShape3D(point1, point3, point2));
         }
 
         if ( (point4.Y > minY || hasDiagonalPointAbove) && (point4.Y < maxY || hasDiagonalPointBelow) ) {
-            createCollisionTriangleShape(point2, point3, point4);
+            triangles.emplace_back(TriangleShape3D(point2, point3, point4));
+        }
+    }
+
+    /**
+     * @param start Ray start point in grid coordinates
+     * @param direction Ray direction in grid coordinates
+     * @param cellSize Size of the traversed cells in grid coordinates
+     * @param tStart Ray parameter where the traversal starts
+     * @param tEnd Ray parameter where the traversal ends
+     * @param minCell Lower bound of the traversed cells (inclusive)
+     * @param maxCell Upper bound of the traversed cells (inclusive)
+     */
+    CollisionHeightfieldShape::GridTraversal::GridTraversal(const Point2<float>& start, const Vector2<float>& direction, float cellSize, float tStart, float tEnd,
+                                                          const Point2<int>& minCell, const Point2<int>& maxCell) :
+            xCell(0),
+            zCell(0),
+            tEnter(tStart),
+            tExit(tStart),
+            xStep(direction.X > 0.0f ? 1 : -1),
+            zStep(direction.Y > 0.0f ? 1 : -1),
+            tDeltaX(direction.X == 0.0f ? std::numeric_limits<float>::max() : cellSize / std::abs(direction.X)),
+            tDeltaZ(direction.Y == 0.0f ? std::numeric_limits<float>::max() : cellSize / std::abs(direction.Y)),
+            tMaxX(std::numeric_limits<float>::max()),
+            tMaxZ(std::numeric_limits<float>::max()),
+            tEnd(tEnd),
+            minCell(minCell),
+            maxCell(maxCell),
+            started(false) {
+        //start cell is clamped to handle a start point located on the cells bounds
+        Point2<float> enterPoint = start.translate(direction * tStart);
+        xCell = std::clamp((int)std::floor(enterPoint.X / cellSize), this->minCell.X, this->maxCell.X);
+        zCell = std::clamp((int)std::floor(enterPoint.Y / cellSize), this->minCell.Y, this->maxCell.Y);
+
+        if (direction.X != 0.0f) {
+            float nextBoundX = (float)(xStep > 0 ? xCell + 1 : xCell) * cellSize;
+            tMaxX = (nextBoundX - start.X) / direction.X;
+        }
+        if (direction.Y != 0.0f) {
+            float nextBoundZ = (float)(zStep > 0 ? zCell + 1 : zCell) * cellSize;
+            tMaxZ = (nextBoundZ - start.Y) / direction.Y;
         }
     }
 
-    void CollisionHeightfieldShape::createCollisionTriangleShape(const Point3<float>& p1, const Point3<float>& p2, const Point3<float>& p3) const {
-        trianglesInAABBox.emplace_back(TriangleShape3D(p1, p2, p3));
+    /**
+     * Move to the next cell crossed by the ray
+     * @return False when there is no more cell to traverse
+     */
+    bool CollisionHeightfieldShape::GridTraversal::next() {
+        if (!started) {
+            started = true;
+        } else {
+            if (tExit >= tEnd) {
+                return false;
+            }
+
+            if (tMaxX < tMaxZ) {
+                xCell += xStep;
+                tMaxX += tDeltaX;
+            } else {
+                zCell += zStep;
+                tMaxZ += tDeltaZ;
+            }
+            if (xCell < minCell.X || xCell > maxCell.X || zCell < minCell.Y || zCell > maxCell.Y) {
+                return false;
+            }
+            tEnter = tExit;
+        }
+
+        tExit = std::max(tEnter, std::min(std::min(tMaxX, tMaxZ), tEnd));
+        return true;
     }
 
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <vector>
+#include <cstdint>
 #include <UrchinCommon.h>
 
 #include "shape/CollisionShape3D.h"
@@ -9,18 +10,23 @@
 
 namespace urchin {
 
+    /**
+    * Static heightfield shape on a regular grid. Only the heights are stored (quantized on 16 bits) and the triangles are generated on demand.
+    * A min/max heights quadtree of the tiles allows to cull whole tiles during the AABBox and ray queries.
+    */
     class CollisionHeightfieldShape final : public CollisionShape3D, public CollisionConcaveShape {
         public:
-            CollisionHeightfieldShape(std::vector<Point3<float>>, unsigned int, unsigned int);
+            CollisionHeightfieldShape(const std::vector<Point3<float>>&, unsigned int, unsigned int);
             CollisionHeightfieldShape(CollisionHeightfieldShape&&) = delete;
-            CollisionHeightfieldShape(const CollisionHeightfieldShape&) = delete;
-            ~CollisionHeightfieldShape() override;
 
             ShapeType getShapeType() const override;
             const ConvexShape3D<float>& getSingleShape() const override;
-            const std::vector<Point3<float>>& getVertices() const;
+            Point3<float> getVertex(unsigned int, unsigned int) const;
+            float getHeight(unsigned int, unsigned int) const;
             unsigned int getXLength() const;
             unsigned int getZLength() const;
+            const Point2<float>& getGridOrigin() const;
+            const Vector2<float>& getCellSize() const;
 
             std::unique_ptr<CollisionShape3D> scale(const Vector3<float>&) const override;
 
@@ -33,27 +39,81 @@ namespace urchin {
 
             std::unique_ptr<CollisionShape3D> clone() const override;
 
-            const std::vector<CollisionTriangleShape>& findTrianglesInAABBox(const AABBox<float>&) const override;
-            const std::vector<CollisionTriangleShape>& findTrianglesHitByRay(const LineSegment3D<float>&) const override;
+            void findTrianglesInAABBox(const AABBox<float>&, std::vector<CollisionTriangleShape>&) const override;
+            void findTrianglesHitByRay(const LineSegment3D<float>&, std::vector<CollisionTriangleShape>&) const override;
+
+            unsigned int getQuadtreeDepth() const;
 
         private:
+            CollisionHeightfieldShape(const CollisionHeightfieldShape&) = default;
+
             enum Axis {
                 X,
                 Z
             };
 
+            struct HeightRange {
+                uint16_t min;
+                uint16_t max;
+            };
+            struct QuadtreeLevel {
+                unsigned int xTilesCount;
+                unsigned int zTilesCount;
+                std::vector<HeightRange> tilesHeightRange;
+            };
+            struct QuadtreeNode {
+                std::size_t levelIndex;
+                unsigned int xTile;
+                unsigned int zTile;
+            };
+
+            /**
+            * Traversal (DDA) of the cells of a 2D grid crossed by a line segment
+            */
+            struct GridTraversal {
+                GridTraversal(const Point2<float>&, const Vector2<float>&, float, float, float, const Point2<int>&, const Point2<int>&);
+                bool next();
+
+                int xCell;
+                int zCell;
+                float tEnter;
+                float tExit;
+
+                private:
+                    int xStep;
+                    int zStep;
+                    float tDeltaX;
+                    float tDeltaZ;
+                    float tMaxX;
+                    float tMaxZ;
+                    float tEnd;
+                    Point2<int> minCell;
+                    Point2<int> maxCell;
+                    bool started;
+            };
+
+            void quantizeHeights(const std::vector<Point3<float>>&);
+            void buildQuadtree();
             BoxShape<float> buildLocalAABBox() const;
+
+            float toHeight(uint16_t) const;
             std::pair<unsigned int, unsigned int> computeStartEndIndices(float, float, Axis) const;
-            void createTrianglesMatchHeight(unsigned int, unsigned int, float, float) const;
-            void createCollisionTriangleShape(const Point3<float>&, const Point3<float>&, const Point3<float>&) const;
+            bool clipRayOnGrid(const Point2<float>&, const Vector2<float>&, float&, float&) const;
+            void createTrianglesMatchHeight(unsigned int, unsigned int, float, float, std::vector<CollisionTriangleShape>&) const;
+
+            static constexpr unsigned int TILE_CELLS_COUNT = 8; //number of cells on each axis of a quadtree leaf tile
 
-            std::vector<Point3<float>> vertices;
             unsigned int xLength;
             unsigned int zLength;
+            Point2<float> gridOrigin;
+            Vector2<float> cellSize;
+            float minHeight;
+            float heightStep;
+            std::vector<uint16_t> quantizedHeights;
+            std::vector<QuadtreeLevel> quadtreeLevels; //from the leaf tiles level to the root level
 
             BoxShape<float> localAABBox;
-            
-            mutable std::vector<CollisionTriangleShape> trianglesInAABBox;
+            static thread_local std::vector<QuadtreeNode> browseNodes;
     };
 
 }
@@ -24,7 +24,7 @@ namespace urchin {
     }
 
     const std::vector<CollisionShape3D::ShapeType>& CollisionShape3D::concaveShapes() {
-        static std::vector concaveShapes = {HEIGHTFIELD_SHAPE};
+        static std::vector concaveShapes = {HEIGHTFIELD_SHAPE, TRIANGLE_MESH_SHAPE};
         return concaveShapes;
     }
 
@@ -31,6 +31,7 @@ namespace urchin {
                 COMPOUND_SHAPE,
                 //Concave:
                 HEIGHTFIELD_SHAPE,
+                TRIANGLE_MESH_SHAPE,
 
                 SHAPE_MAX
             };
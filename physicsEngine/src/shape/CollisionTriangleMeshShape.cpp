@@ -0,0 +1,323 @@
+#include <limits>
+#include <algorithm>
+#include <array>
+
+#include "shape/CollisionTriangleMeshShape.h"
+
+namespace urchin {
+
+    CollisionTriangleMeshShape::CollisionTriangleMeshShape(std::vector<Point3<float>> vertices, std::vector<IndexedTriangle3D<float>> triangles) :
+            vertices(std::move(vertices)),
+            triangles(std::move(triangles)),
+            bvhHeight(0) {
+        if (this->triangles.empty()) {
+            throw std::invalid_argument("Triangle mesh shape requires at least one triangle");
+        }
+        buildBvh();
+    }
+
+    void CollisionTriangleMeshShape::buildBvh() {
+        std::vector<BuildTriangle> buildTriangles;
+        buildTriangles.reserve(triangles.size());
+        for (std::size_t triangleIndex = 0; triangleIndex < triangles.size(); ++triangleIndex) {
+            const Point3<float>& point1 = vertices[triangles[triangleIndex].getIndex(0)];
+            const Point3<float>& point2 = vertices[triangles[triangleIndex].getIndex(1)];
+            const Point3<float>& point3 = vertices[triangles[triangleIndex].getIndex(2)];
+
+            Point3 min(std::min({point1.X, point2.X, point3.X}), std::min({point1.Y, point2.Y, point3.Y}), std::min({point1.Z, point2.Z, point3.Z}));
+            Point3 max(std::max({point1.X, point2.X, point3.X}), std::max({point1.Y, point2.Y, point3.Y}), std::max({point1.Z, point2.Z, point3.Z}));
+            buildTriangles.push_back(BuildTriangle{.min = min, .max = max, .centroid = (min + max) / 2.0f, .triangleIndex = triangleIndex});
+        }
+
+        bvhNodes.reserve(2 * triangles.size());
+        bvhTrianglesPoints.reserve(3 * triangles.size());
+        buildBvhNode(buildTriangles, 0, buildTriangles.size(), 1);
+
+        localAABBox = AABBox(bvhNodes[0].min, bvhNodes[0].max);
+    }
+
+    /**
+     * Build the BVH node containing the triangles [begin, end[ and its children. The split plane of internal node is selected with a binned surface area heuristic (SAH).
+     * @return Index of the built node
+     */
+    unsigned int CollisionTriangleMeshShape::buildBvhNode(std::vector<BuildTriangle>& buildTriangles, std::size_t begin, std::size_t end, unsigned int depth) {
+        bvhHeight = std::max(bvhHeight, depth);
+
+        auto nodeIndex = (unsigned int)bvhNodes.size();
+        Point3 nodeMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        Point3 nodeMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+        Point3 centroidMin = nodeMin;
+        Point3 centroidMax = nodeMax;
+        for (std::size_t i = begin; i < end; ++i) {
+            for (unsigned int axis = 0; axis < 3; ++axis) {
+                nodeMin[axis] = std::min(nodeMin[axis], buildTriangles[i].min[axis]);
+                nodeMax[axis] = std::max(nodeMax[axis], buildTriangles[i].max[axis]);
+                centroidMin[axis] = std::min(centroidMin[axis], buildTriangles[i].centroid[axis]);
+                centroidMax[axis] = std::max(centroidMax[axis], buildTriangles[i].centroid[axis]);
+            }
+        }
+        bvhNodes.push_back(BvhNode{.min = nodeMin, .firstIndex = 0, .max = nodeMax, .trianglesCount = 0});
+
+        std::size_t splitIndex = end;
+        if (end - begin > MAX_TRIANGLES_BY_LEAF && depth < MAX_BVH_DEPTH) {
+            splitIndex = partitionTriangles(buildTriangles, begin, end, centroidMin, centroidMax);
+        }
+
+        if (splitIndex == begin || splitIndex == end) { //leaf node
+            bvhNodes[nodeIndex].firstIndex = (unsigned int)(bvhTrianglesPoints.size() / 3);
+            bvhNodes[nodeIndex].trianglesCount = (unsigned int)(end - begin);
+            for (std::size_t i = begin; i < end; ++i) {
+                const IndexedTriangle3D<float>& triangle = triangles[buildTriangles[i].triangleIndex];
+                bvhTrianglesPoints.push_back(vertices[triangle.getIndex(0)]);
+                bvhTrianglesPoints.push_back(vertices[triangle.getIndex(1)]);
+                bvhTrianglesPoints.push_back(vertices[triangle.getIndex(2)]);
+            }
+        } else {
+            buildBvhNode(buildTriangles, begin, splitIndex, depth + 1);
+            bvhNodes[nodeIndex].firstIndex = buildBvhNode(buildTriangles, splitIndex, end, depth + 1);
+        }
+        return nodeIndex;
+    }
+
+    /**
+     * @return Index of the first triangle of the second partition. Return the end index when the triangles cannot be split.
+     */
+    std::size_t CollisionTriangleMeshShape::partitionTriangles(std::vector<BuildTriangle>& buildTriangles, std::size_t begin, std::size_t end,
+                                                               const Point3<float>& centroidMin, const Point3<float>& centroidMax) const {
+        unsigned int splitAxis = 0;
+        for (unsigned int axis = 1; axis < 3; ++axis) {
+            if (centroidMax[axis] - centroidMin[axis] > centroidMax[splitAxis] - centroidMin[splitAxis]) {
+                splitAxis = axis;
+            }
+        }
+        float centroidExtent = centroidMax[splitAxis] - centroidMin[splitAxis];
+        if (centroidExtent <= std::numeric_limits<float>::epsilon()) {
+            return end; //all triangles have the same centroid
+        }
+
+        float binsFactor = (float)BINS_COUNT * (1.0f - 0.0001f) / centroidExtent;
+        auto computeBinIndex = [&](const BuildTriangle& buildTriangle) {
+            return (std::size_t)((buildTriangle.centroid[splitAxis] - centroidMin[splitAxis]) * binsFactor);
+        };
+
+        std::array<Bin, BINS_COUNT> bins;
+        for (Bin& bin : bins) {
+            bin.min = Point3(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+            bin.max = Point3(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+            bin.trianglesCount = 0;
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            Bin& bin = bins[computeBinIndex(buildTriangles[i])];
+            for (unsigned int axis = 0; axis < 3; ++axis) {
+                bin.min[axis] = std::min(bin.min[axis], buildTriangles[i].min[axis]);
+                bin.max[axis] = std::max(bin.max[axis], buildTriangles[i].max[axis]);
+            }
+            bin.trianglesCount++;
+        }
+
+        //sweep from right to left to compute the cost of the right part of each split plane
+        std::array<float, BINS_COUNT> rightCosts{};
+        Bin rightBin = bins[BINS_COUNT - 1];
+        for (std::size_t binIndex = BINS_COUNT - 1; binIndex > 0; --binIndex) {
+            rightCosts[binIndex] = computeHalfSurfaceArea(rightBin.min, rightBin.max) * (float)rightBin.trianglesCount;
+            for (unsigned int axis = 0; axis < 3; ++axis) {
+                rightBin.min[axis] = std::min(rightBin.min[axis], bins[binIndex - 1].min[axis]);
+                rightBin.max[axis] = std::max(rightBin.max[axis], bins[binIndex - 1].max[axis]);
+            }
+            rightBin.trianglesCount += bins[binIndex - 1].trianglesCount;
+        }
+
+        //sweep from left to right to find the split plane of minimum cost
+        std::size_t bestSplitBin = 0;
+        float bestCost = std::numeric_limits<float>::max();
+        Bin leftBin = bins[0];
+        for (std::size_t binIndex = 1; binIndex < BINS_COUNT; ++binIndex) {
+            if (leftBin.trianglesCount > 0 && leftBin.trianglesCount < end - begin) {
+                float cost = computeHalfSurfaceArea(leftBin.min, leftBin.max) * (float)leftBin.trianglesCount + rightCosts[binIndex];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestSplitBin = binIndex;
+                }
+            }
+            for (unsigned int axis = 0; axis < 3; ++axis) {
+                leftBin.min[axis] = std::min(leftBin.min[axis], bins[binIndex].min[axis]);
+                leftBin.max[axis] = std::max(leftBin.max[axis], bins[binIndex].max[axis]);
+            }
+            leftBin.trianglesCount += bins[binIndex].trianglesCount;
+        }
+        if (bestSplitBin == 0) {
+            return end;
+        }
+
+        auto splitIt = std::partition(buildTriangles.begin() + (long)begin, buildTriangles.begin() + (long)end, [&](const BuildTriangle& buildTriangle) {
+            return computeBinIndex(buildTriangle) < bestSplitBin;
+        });
+        return (std::size_t)std::distance(buildTriangles.begin(), splitIt);
+    }
+
+    float CollisionTriangleMeshShape::computeHalfSurfaceArea(const Point3<float>& min, const Point3<float>& max) {
+        Vector3<float> size = min.vector(max);
+        return size.X * size.Y + size.Y * size.Z + size.Z * size.X;
+    }
+
+    CollisionShape3D::ShapeType CollisionTriangleMeshShape::getShapeType() const {
+        return TRIANGLE_MESH_SHAPE;
+    }
+
+    const ConvexShape3D<float>& CollisionTriangleMeshShape::getSingleShape() const {
+        throw std::runtime_error("Impossible to retrieve single convex shape for triangle mesh shape");
+    }
+
+    const std::vector<Point3<float>>& CollisionTriangleMeshShape::getVertices() const {
+        return vertices;
+    }
+
+    const std::vector<IndexedTriangle3D<float>>& CollisionTriangleMeshShape::getTriangles() const {
+        return triangles;
+    }
+
+    std::unique_ptr<CollisionShape3D> CollisionTriangleMeshShape::scale(const Vector3<float>& scale) const {
+        std::vector<Point3<float>> scaledVertices;
+        scaledVertices.reserve(vertices.size());
+        for (const Point3<float>& vertex : vertices) {
+            scaledVertices.emplace_back(vertex.X * scale.X, vertex.Y * scale.Y, vertex.Z * scale.Z);
+        }
+        return std::make_unique<CollisionTriangleMeshShape>(std::move(scaledVertices), triangles);
+    }
+
+    AABBox<float> CollisionTriangleMeshShape::toAABBox(const PhysicsTransform& physicsTransform) const {
+        Matrix3<float> orientation = physicsTransform.retrieveOrientationMatrix();
+        Point3 extend(
+                localAABBox.getHalfSize(0) * std::abs(orientation(0, 0)) + localAABBox.getHalfSize(1) * std::abs(orientation(0, 1)) + localAABBox.getHalfSize(2) * std::abs(orientation(0, 2)),
+                localAABBox.getHalfSize(0) * std::abs(orientation(1, 0)) + localAABBox.getHalfSize(1) * std::abs(orientation(1, 1)) + localAABBox.getHalfSize(2) * std::abs(orientation(1, 2)),
+                localAABBox.getHalfSize(0) * std::abs(orientation(2, 0)) + localAABBox.getHalfSize(1) * std::abs(orientation(2, 1)) + localAABBox.getHalfSize(2) * std::abs(orientation(2, 2))
+        );
+
+        Point3<float> center = physicsTransform.transform(localAABBox.getCenterOfMass());
+        return AABBox(center - extend, center + extend);
+    }
+
+    std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> CollisionTriangleMeshShape::toConvexObject(const PhysicsTransform&) const {
+        throw std::runtime_error("Impossible to transform triangle mesh shape to convex object");
+    }
+
+    Vector3<float> CollisionTriangleMeshShape::computeLocalInertia(float mass) const {
+        float width = 2.0f * localAABBox.getHalfSize(0);
+        float height = 2.0f * localAABBox.getHalfSize(1);
+        float depth = 2.0f * localAABBox.getHalfSize(2);
+
+        float localInertia1 = (1.0f / 12.0f) * mass * (height * height + depth * depth);
+        float localInertia2 = (1.0f / 12.0f) * mass * (width * width + depth * depth);
+        float localInertia3 = (1.0f / 12.0f) * mass * (width * width + height * height);
+        return Vector3(localInertia1, localInertia2, localInertia3);
+    }
+
+    float CollisionTriangleMeshShape::getMaxDistanceToCenter() const {
+        throw std::runtime_error("Impossible to get max distance to center for triangle mesh shape. A triangle mesh body must be static.");
+    }
+
+    float CollisionTriangleMeshShape::getMinDistanceToCenter() const {
+        return 0.0f;
+    }
+
+    std::unique_ptr<CollisionShape3D> CollisionTriangleMeshShape::clone() const {
+        return std::make_unique<CollisionTriangleMeshShape>(vertices, triangles);
+    }
+
+    /**
+     * @param foundTriangles [out] Triangles having their bounding box overlapping the AABBox
+     */
+    void CollisionTriangleMeshShape::findTrianglesInAABBox(const AABBox<float>& checkAABBox, std::vector<CollisionTriangleShape>& foundTriangles) const {
+        foundTriangles.clear();
+
+        std::array<unsigned int, MAX_BVH_DEPTH + 1> nodeIndicesStack; //depth-first traversal: stack size never exceeds the BVH height plus one
+        std::size_t stackSize = 0;
+        nodeIndicesStack[stackSize++] = 0;
+
+        while (stackSize > 0) {
+            const BvhNode& node = bvhNodes[nodeIndicesStack[--stackSize]];
+            if (!overlap(node.min, node.max, checkAABBox)) {
+                continue;
+            }
+
+            if (node.trianglesCount > 0) {
+                for (unsigned int triangleIndex = node.firstIndex; triangleIndex < node.firstIndex + node.trianglesCount; ++triangleIndex) {
+                    const Point3<float>* trianglePoints = &bvhTrianglesPoints[3 * (std::size_t)triangleIndex];
+                    Point3 min(std::min({trianglePoints[0].X, trianglePoints[1].X, trianglePoints[2].X}), std::min({trianglePoints[0].Y, trianglePoints[1].Y, trianglePoints[2].Y}),
+                               std::min({trianglePoints[0].Z, trianglePoints[1].Z, trianglePoints[2].Z}));
+                    Point3 max(std::max({trianglePoints[0].X, trianglePoints[1].X, trianglePoints[2].X}), std::max({trianglePoints[0].Y, trianglePoints[1].Y, trianglePoints[2].Y}),
+                               std::max({trianglePoints[0].Z, trianglePoints[1].Z, trianglePoints[2].Z}));
+                    if (overlap(min, max, checkAABBox)) {
+                        addTriangle(triangleIndex, foundTriangles);
+                    }
+                }
+            } else {
+                nodeIndicesStack[stackSize++] = node.firstIndex;
+                nodeIndicesStack[stackSize++] = (unsigned int)(&node - bvhNodes.data()) + 1;
+            }
+        }
+    }
+
+    /**
+     * @param foundTriangles [out] Triangles which could be hit by the ray (triangles of the BVH leaves hit by the ray)
+     */
+    void CollisionTriangleMeshShape::findTrianglesHitByRay(const LineSegment3D<float>& ray, std::vector<CollisionTriangleShape>& foundTriangles) const {
+        if (ray.getA().squareDistance(ray.getB()) <= std::numeric_limits<float>::epsilon()) {
+            findTrianglesInAABBox(AABBox(ray.getA(), ray.getA()), foundTriangles);
+            return;
+        }
+        foundTriangles.clear();
+
+        Ray<float> bvhRay(ray.getA(), ray.getB());
+        std::array<unsigned int, MAX_BVH_DEPTH + 1> nodeIndicesStack; //depth-first traversal: stack size never exceeds the BVH height plus one
+        std::size_t stackSize = 0;
+        nodeIndicesStack[stackSize++] = 0;
+
+        while (stackSize > 0) {
+            const BvhNode& node = bvhNodes[nodeIndicesStack[--stackSize]];
+            if (!collideWithRay(node.min, node.max, bvhRay)) {
+                continue;
+            }
+
+            if (node.trianglesCount > 0) {
+                for (unsigned int triangleIndex = node.firstIndex; triangleIndex < node.firstIndex + node.trianglesCount; ++triangleIndex) {
+                    addTriangle(triangleIndex, foundTriangles);
+                }
+            } else {
+                nodeIndicesStack[stackSize++] = node.firstIndex;
+                nodeIndicesStack[stackSize++] = (unsigned int)(&node - bvhNodes.data()) + 1;
+            }
+        }
+    }
+
+    /**
+     * @return Height of the BVH: one for a BVH composed of a single leaf
+     */
+    unsigned int CollisionTriangleMeshShape::getBvhHeight() const {
+        return bvhHeight;
+    }
+
+    bool CollisionTriangleMeshShape::overlap(const Point3<float>& min, const Point3<float>& max, const AABBox<float>& aabbox) {
+        return min.X <= aabbox.getMax().X && max.X >= aabbox.getMin().X
+                && min.Y <= aabbox.getMax().Y && max.Y >= aabbox.getMin().Y
+                && min.Z <= aabbox.getMax().Z && max.Z >= aabbox.getMin().Z;
+    }
+
+    bool CollisionTriangleMeshShape::collideWithRay(const Point3<float>& min, const Point3<float>& max, const Ray<float>& ray) {
+        float lengthToNearPlanes = 0.0f;
+        float lengthToFarPlanes = ray.getLength();
+        for (unsigned int axis = 0; axis < 3; ++axis) {
+            float lengthToMinPlane = (min[axis] - ray.getOrigin()[axis]) * ray.getInverseDirection()[axis];
+            float lengthToMaxPlane = (max[axis] - ray.getOrigin()[axis]) * ray.getInverseDirection()[axis];
+            lengthToNearPlanes = std::max(lengthToNearPlanes, std::min(lengthToMinPlane, lengthToMaxPlane));
+            lengthToFarPlanes = std::min(lengthToFarPlanes, std::max(lengthToMinPlane, lengthToMaxPlane));
+        }
+        return lengthToNearPlanes <= lengthToFarPlanes;
+    }
+
+    void CollisionTriangleMeshShape::addTriangle(unsigned int triangleIndex, std::vector<CollisionTriangleShape>& foundTriangles) const {
+        std::size_t firstPointIndex = 3 * (std::size_t)triangleIndex;
+        foundTriangles.emplace_back(TriangleShape3D(bvhTrianglesPoints[firstPointIndex], bvhTrianglesPoints[firstPointIndex + 1], bvhTrianglesPoints[firstPointIndex + 2]));
+    }
+
+}
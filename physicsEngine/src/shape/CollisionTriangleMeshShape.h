@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <UrchinCommon.h>
+
+#include "shape/CollisionShape3D.h"
+#include "shape/CollisionConcaveShape.h"
+
+namespace urchin {
+
+    /**
+    * Static concave shape composed of triangles. Triangles are stored in a bounding volume hierarchy (BVH) built once at the shape creation.
+    * The BVH is never modified after its creation: queries can be executed from several threads.
+    */
+    class CollisionTriangleMeshShape final : public CollisionShape3D, public CollisionConcaveShape {
+        public:
+            CollisionTriangleMeshShape(std::vector<Point3<float>>, std::vector<IndexedTriangle3D<float>>);
+            CollisionTriangleMeshShape(CollisionTriangleMeshShape&&) = delete;
+            CollisionTriangleMeshShape(const CollisionTriangleMeshShape&) = delete;
+
+            ShapeType getShapeType() const override;
+            const ConvexShape3D<float>& getSingleShape() const override;
+            const std::vector<Point3<float>>& getVertices() const;
+            const std::vector<IndexedTriangle3D<float>>& getTriangles() const;
+
+            std::unique_ptr<CollisionShape3D> scale(const Vector3<float>&) const override;
+
+            AABBox<float> toAABBox(const PhysicsTransform&) const override;
+            std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> toConvexObject(const PhysicsTransform&) const override;
+
+            Vector3<float> computeLocalInertia(float) const override;
+            float getMaxDistanceToCenter() const override;
+            float getMinDistanceToCenter() const override;
+
+            std::unique_ptr<CollisionShape3D> clone() const override;
+
+            void findTrianglesInAABBox(const AABBox<float>&, std::vector<CollisionTriangleShape>&) const override;
+            void findTrianglesHitByRay(const LineSegment3D<float>&, std::vector<CollisionTriangleShape>&) const override;
+
+            unsigned int getBvhHeight() const;
+
+        private:
+            struct BvhNode {
+                Point3<float> min;
+                unsigned int firstIndex; //first triangle index for leaf node, right child node index for internal node (left child node is the next node)
+                Point3<float> max;
+                unsigned int trianglesCount; //zero for internal node
+            };
+            struct BuildTriangle {
+                Point3<float> min;
+                Point3<float> max;
+                Point3<float> centroid;
+                std::size_t triangleIndex;
+            };
+            struct Bin {
+                Point3<float> min;
+                Point3<float> max;
+                std::size_t trianglesCount;
+            };
+
+            void buildBvh();
+            unsigned int buildBvhNode(std::vector<BuildTriangle>&, std::size_t, std::size_t, unsigned int);
+            std::size_t partitionTriangles(std::vector<BuildTriangle>&, std::size_t, std::size_t, const Point3<float>&, const Point3<float>&) const;
+            static float computeHalfSurfaceArea(const Point3<float>&, const Point3<float>&);
+            static bool overlap(const Point3<float>&, const Point3<float>&, const AABBox<float>&);
+            static bool collideWithRay(const Point3<float>&, const Point3<float>&, const Ray<float>&);
+            void addTriangle(unsigned int, std::vector<CollisionTriangleShape>&) const;
+
+            static constexpr unsigned int MAX_TRIANGLES_BY_LEAF = 4;
+            static constexpr unsigned int MAX_BVH_DEPTH = 64;
+            static constexpr std::size_t BINS_COUNT = 16;
+
+            std::vector<Point3<float>> vertices;
+            std::vector<IndexedTriangle3D<float>> triangles;
+
+            std::vector<BvhNode> bvhNodes; //nodes in depth-first order
+            std::vector<Point3<float>> bvhTrianglesPoints; //three points by triangle ordered by BVH leaf
+            unsigned int bvhHeight;
+            AABBox<float> localAABBox;
+    };
+
+}
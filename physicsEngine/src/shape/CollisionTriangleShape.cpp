@@ -25,8 +25,15 @@ namespace urchin {
         throw std::runtime_error("Scaling is currently not supported (triangle is only usable as a sub-shape)");
     }
 
-    AABBox<float> CollisionTriangleShape::toAABBox(const PhysicsTransform&) const {
-        throw std::runtime_error("Retrieving AABBox is currently not supported (triangle is only usable as a sub-shape)");
+    /**
+     * AABBox of the triangle: used by the concave collision algorithm when a triangle of a concave shape is tested against another concave shape
+     */
+    AABBox<float> CollisionTriangleShape::toAABBox(const PhysicsTransform& physicsTransform) const {
+        std::array<Point3<float>, 3> points = {
+                physicsTransform.transform(triangleShape.getPoints()[0]),
+                physicsTransform.transform(triangleShape.getPoints()[1]),
+                physicsTransform.transform(triangleShape.getPoints()[2])};
+        return AABBox<float>(std::span<Point3<float>>(points));
     }
 
     std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> CollisionTriangleShape::toConvexObject(const PhysicsTransform& physicsTransform) const {
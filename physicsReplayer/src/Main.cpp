@@ -0,0 +1,42 @@
+#include <iostream>
+#include <string>
+#include <exception>
+#include <UrchinCommon.h>
+#include <UrchinPhysicsEngine.h>
+using namespace urchin;
+
+/**
+ * Headless replay of a physics journal recorded with PhysicsWorld::startJournal/stopJournal.
+ * Exit code: 0 when the replayed steps produce the recorded bodies state, 1 when a divergence is detected and 2 on error.
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <resources directory containing engine.properties> <journal file>" << std::endl;
+        return 2;
+    }
+
+    try {
+        std::string resourcesDirectory = argv[1];
+        if (!resourcesDirectory.ends_with('/')) {
+            resourcesDirectory += '/';
+        }
+        FileSystem::instance().setupResourcesDirectory(resourcesDirectory);
+        ConfigService::instance().loadProperties("engine.properties");
+
+        PhysicsReplayer replayer((std::string(argv[2])));
+        ReplayResult replayResult = replayer.replay();
+
+        float stepAverageTimeInMs = replayResult.stepsCount == 0 ? 0.0f : replayResult.stepsExecutionTimeInSec * 1000.0f / (float)replayResult.stepsCount;
+        std::cout << "Replayed steps: " << replayResult.stepsCount << std::endl;
+        std::cout << "Steps execution time: " << replayResult.stepsExecutionTimeInSec << " sec (" << stepAverageTimeInMs << " ms by step)" << std::endl;
+        if (replayResult.firstDivergentStep.has_value()) {
+            std::cout << "First divergent step: " << *replayResult.firstDivergentStep << std::endl;
+            return 1;
+        }
+        std::cout << "No divergence" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Replay error: " << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -5,9 +5,12 @@
 #include "common/io/map/MapSerializerTest.h"
 #include "common/io/uda/UdaParserTest.h"
 #include "common/system/SystemInfoTest.h"
+#include "common/system/thread/WorkerPoolTest.h"
+#include "common/system/thread/TripleBufferTest.h"
 #include "common/util/StringUtilTest.h"
 #include "common/util/HashUtilTest.h"
 #include "common/util/FileUtilTest.h"
+#include "common/profiler/LatencyHistogramTest.h"
 #include "common/container/EverGrowQueueTest.h"
 #include "common/container/EverGrowHashMapTest.h"
 #include "common/container/EverGrowHashSetTest.h"
@@ -31,7 +34,12 @@
 #include "common/math/geometry/3d/voxel/VoxelServiceTest.h"
 #include "common/math/geometry/3d/Line3DTest.h"
 #include "common/math/geometry/3d/PlaneTest.h"
+#include "common/math/geometry/3d/RayPacketTest.h"
+#include "common/math/geometry/3d/SimplexTest.h"
 #include "common/partitioning/GridContainerTest.h"
+#include "common/partitioning/aabbtree/AABBTreeTest.h"
+#include "common/partitioning/aabbtree/IndexedAABBTreeTest.h"
+#include "common/partitioning/aabbtree/IndexedAABBTreeBT.h"
 #include "common/pattern/observer/ObservableTest.h"
 #include "3d/graphics/render/GenericRendererComparatorTest.h"
 #include "3d/scene/renderer3d/Renderer3dTest.h"
@@ -44,18 +52,32 @@
 #include "3d/scene/ui/widget/textarea/TextareaTest.h"
 #include "physics/shape/ShapeToAABBoxTest.h"
 #include "physics/shape/ShapeToConvexObjectTest.h"
+#include "physics/shape/CollisionTriangleMeshShapeTest.h"
+#include "physics/shape/CollisionHeightfieldShapeTest.h"
 #include "physics/object/SupportPointTest.h"
 #include "physics/body/BodyContainerTest.h"
 #include "physics/body/InertiaCalculationTest.h"
 #include "physics/collision/broadphase/aabbtree/BodyAABBTreeTest.h"
+#include "physics/collision/narrowphase/NarrowPhaseTest.h"
+#include "physics/collision/constraintsolver/ConstraintSolverTest.h"
+#include "physics/collision/constraintsolver/ContactConstraintsTest.h"
 #include "physics/collision/narrowphase/algorithm/epa/EPAAlgorithmTest.h"
 #include "physics/collision/narrowphase/algorithm/continuous/GJKContinuousCollisionAlgorithmTest.h"
+#include "physics/collision/narrowphase/algorithm/GJKEPAAlgorithmBT.h"
 #include "physics/collision/bodystate/IslandContainerTest.h"
 #include "physics/collision/CollisionWorldIT.h"
+#include "physics/joint/JointIT.h"
+#include "physics/journal/PhysicsJournalIT.h"
+#include "physics/scenequery/SceneQueryTest.h"
 #include "physics/character/CharacterControllerIT.h"
 #include "physics/character/CharacterControllerMT.h"
+#include "physics/character/CharacterControllerSystemBT.h"
+#include "ai/path/navmesh/NavMeshGeneratorTest.h"
+#include "ai/path/navmesh/model/output/NavMeshTest.h"
 #include "ai/path/pathfinding/FunnelAlgorithmTest.h"
 #include "ai/path/pathfinding/PathfindingAStarTest.h"
+#include "ai/path/pathfinding/PathfindingAStarBT.h"
+#include "ai/path/PathRequestSchedulerTest.h"
 #include "sound/player/filereader/SoundFileReaderTest.h"
 using namespace urchin;
 
@@ -69,6 +91,8 @@ void addCommonUnitTests(CppUnit::TextUi::TestRunner& runner) {
 
     //system
     runner.addTest(SystemInfoTest::suite());
+    runner.addTest(WorkerPoolTest::suite());
+    runner.addTest(TripleBufferTest::suite());
 
     //container
     runner.addTest(EverGrowQueueTest::suite());
@@ -80,6 +104,9 @@ void addCommonUnitTests(CppUnit::TextUi::TestRunner& runner) {
     runner.addTest(HashUtilTest::suite());
     runner.addTest(StringUtilTest::suite());
 
+    //profiler
+    runner.addTest(LatencyHistogramTest::suite());
+
     //math - algebra
     runner.addTest(QuaternionTest::suite());
     runner.addTest(PointTest::suite());
@@ -105,9 +132,13 @@ void addCommonUnitTests(CppUnit::TextUi::TestRunner& runner) {
     runner.addTest(VoxelServiceTest::suite());
     runner.addTest(Line3DTest::suite());
     runner.addTest(PlaneTest::suite());
+    runner.addTest(RayPacketTest::suite());
+    runner.addTest(SimplexTest::suite());
 
     //partitioning
     runner.addTest(GridContainerTest::suite());
+    runner.addTest(AABBTreeTest::suite());
+    runner.addTest(IndexedAABBTreeTest::suite());
 
     //pattern
     runner.addTest(ObservableTest::suite());
@@ -138,6 +169,8 @@ void addPhysicsUnitTests(CppUnit::TextUi::TestRunner& runner) {
     //shape
     runner.addTest(ShapeToAABBoxTest::suite());
     runner.addTest(ShapeToConvexObjectTest::suite());
+    runner.addTest(CollisionTriangleMeshShapeTest::suite());
+    runner.addTest(CollisionHeightfieldShapeTest::suite());
 
     //object
     runner.addTest(SupportPointTest::suite());
@@ -150,17 +183,31 @@ void addPhysicsUnitTests(CppUnit::TextUi::TestRunner& runner) {
     runner.addTest(BodyAABBTreeTest::suite());
 
     //narrow phase
+    runner.addTest(NarrowPhaseTest::suite());
     runner.addTest(EPAAlgorithmTest::suite());
     runner.addTest(GJKContinuousCollisionAlgorithmTest::suite());
 
+    //constraint solver
+    runner.addTest(ConstraintSolverTest::suite());
+    runner.addTest(ContactConstraintsTest::suite());
+
     //island
     runner.addTest(IslandContainerTest::suite());
+
+    //scene query
+    runner.addTest(SceneQueryTest::suite());
 }
 
 void addPhysicsIntegrationTests(CppUnit::TextUi::TestRunner& runner) {
     //collision world
     runner.addTest(CollisionWorldIT::suite());
 
+    //joint
+    runner.addTest(JointIT::suite());
+
+    //journal
+    runner.addTest(PhysicsJournalIT::suite());
+
     //character
     runner.addTest(CharacterControllerIT::suite());
 }
@@ -170,10 +217,33 @@ void addPhysicsMonkeyTests(CppUnit::TextUi::TestRunner& runner) {
     runner.addTest(CharacterControllerMT::suite());
 }
 
+void addCommonBenchmarkTests(CppUnit::TextUi::TestRunner& runner) {
+    //partitioning
+    runner.addTest(IndexedAABBTreeBT::suite());
+}
+
+void addPhysicsBenchmarkTests(CppUnit::TextUi::TestRunner& runner) {
+    //collision
+    runner.addTest(GJKEPAAlgorithmBT::suite());
+
+    //character
+    runner.addTest(CharacterControllerSystemBT::suite());
+}
+
 void addAiUnitTests(CppUnit::TextUi::TestRunner& runner) {
+    //navigation mesh
+    runner.addTest(NavMeshGeneratorTest::suite());
+    runner.addTest(NavMeshTest::suite());
+
     //pathfinding
     runner.addTest(FunnelAlgorithmTest::suite());
     runner.addTest(PathfindingAStarTest::suite());
+    runner.addTest(PathRequestSchedulerTest::suite());
+}
+
+void addAiBenchmarkTests(CppUnit::TextUi::TestRunner& runner) {
+    //pathfinding
+    runner.addTest(PathfindingAStarBT::suite());
 }
 
 void addSoundTests(CppUnit::TextUi::TestRunner& runner) {
@@ -196,6 +266,12 @@ void addAllMonkeyTests(CppUnit::TextUi::TestRunner& runner) {
     addPhysicsMonkeyTests(runner);
 }
 
+void addAllBenchmarkTests(CppUnit::TextUi::TestRunner& runner) {
+    addCommonBenchmarkTests(runner);
+    addPhysicsBenchmarkTests(runner);
+    addAiBenchmarkTests(runner);
+}
+
 int main(int argc, char *argv[]) {
     FileSystem::instance().setupResourcesDirectory(SystemInfo::executableDirectory() + "resources/");
     ConfigService::instance().loadProperties("engine.properties");
@@ -204,6 +280,7 @@ int main(int argc, char *argv[]) {
     std::string hasUnitTests = "no";
     std::string hasIntegrationTests = "no";
     std::string hasMonkeyTests = "no";
+    std::string hasBenchmarkTests = "no";
 
     for (int i = 1; i < argc; ++i) {
         if (std::strcmp(argv[i], "unit") == 0) {
@@ -215,12 +292,15 @@ int main(int argc, char *argv[]) {
         } else if (std::strcmp(argv[i], "monkey") == 0) {
             addAllMonkeyTests(runner);
             hasMonkeyTests = "yes";
+        } else if (std::strcmp(argv[i], "benchmark") == 0) {
+            addAllBenchmarkTests(runner);
+            hasBenchmarkTests = "yes";
         } else {
             throw std::invalid_argument("Unknown program argument: " + std::string(argv[i]));
         }
     }
 
-    std::cout << "Start running tests (unit: "<< hasUnitTests << ", integration: " << hasIntegrationTests << ", monkey: " << hasMonkeyTests << ")" << std::endl;
+    std::cout << "Start running tests (unit: "<< hasUnitTests << ", integration: " << hasIntegrationTests << ", monkey: " << hasMonkeyTests << ", benchmark: " << hasBenchmarkTests << ")" << std::endl;
     bool success = runner.run();
 
     Logger::instance().purge();
@@ -0,0 +1,118 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "ai/path/PathRequestSchedulerTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void PathRequestSchedulerTest::replanOnlyWhenPointsMove() {
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    PathRequestScheduler pathRequestScheduler(0.3f, 2.0f, 100, 30);
+    auto pathRequest = std::make_shared<PathRequest>(Point3(1.0f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+
+    unsigned int firstPlannedPaths = pathRequestScheduler.update(navMesh, {pathRequest});
+    unsigned int unchangedPlannedPaths = pathRequestScheduler.update(navMesh, {pathRequest});
+    pathRequest->updatePoints(Point3(1.1f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+    unsigned int smallMovePlannedPaths = pathRequestScheduler.update(navMesh, {pathRequest});
+    pathRequest->updatePoints(Point3(1.0f, 0.0f, 2.0f), Point3(3.0f, 0.0f, 3.0f));
+    unsigned int bigMovePlannedPaths = pathRequestScheduler.update(navMesh, {pathRequest});
+
+    AssertHelper::assertUnsignedIntEquals(firstPlannedPaths, 1);
+    AssertHelper::assertUnsignedIntEquals(unchangedPlannedPaths, 0);
+    AssertHelper::assertUnsignedIntEquals(smallMovePlannedPaths, 0);
+    AssertHelper::assertUnsignedIntEquals(bigMovePlannedPaths, 1);
+    AssertHelper::assertTrue(pathRequest->isPathReady());
+    AssertHelper::assertPoint3FloatEquals(pathRequest->getPath()[0].getPoint(), Point3(1.0f, 0.0f, 2.0f));
+}
+
+void PathRequestSchedulerTest::replanOnNavMeshUpdate() {
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    PathRequestScheduler pathRequestScheduler(0.3f, 2.0f, 100, 30);
+    auto pathRequest = std::make_shared<PathRequest>(Point3(1.0f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+
+    pathRequestScheduler.update(navMesh, {pathRequest});
+    unsigned int newNavMeshPlannedPaths = pathRequestScheduler.update(buildNavMesh(), {pathRequest});
+
+    AssertHelper::assertUnsignedIntEquals(newNavMeshPlannedPaths, 1);
+}
+
+void PathRequestSchedulerTest::sharedCachedPath() {
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    PathRequestScheduler pathRequestScheduler(0.3f, 2.0f, 100, 30);
+    auto pathRequest1 = std::make_shared<PathRequest>(Point3(1.0f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+    auto pathRequest2 = std::make_shared<PathRequest>(Point3(1.1f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+
+    unsigned int plannedPaths = pathRequestScheduler.update(navMesh, {pathRequest1, pathRequest2});
+
+    AssertHelper::assertUnsignedIntEquals(plannedPaths, 1);
+    AssertHelper::assertTrue(pathRequest1->isPathReady() && pathRequest2->isPathReady());
+    AssertHelper::assertPoint3FloatEquals(pathRequest2->getPath().front().getPoint(), Point3(1.1f, 0.0f, 1.0f));
+    AssertHelper::assertPoint3FloatEquals(pathRequest2->getPath().back().getPoint(), Point3(3.0f, 0.0f, 3.0f));
+}
+
+void PathRequestSchedulerTest::priorityWithTimeBudget() {
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    PathRequestScheduler pathRequestScheduler(0.3f, 0.0f, 100, 30); //no time budget: one request planned by update
+    auto lowPriorityRequest = std::make_shared<PathRequest>(Point3(1.0f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+    auto highPriorityRequest = std::make_shared<PathRequest>(Point3(0.5f, 0.0f, 3.0f), Point3(3.0f, 0.0f, 3.0f));
+    highPriorityRequest->setPriority(5);
+    auto mediumPriorityRequest = std::make_shared<PathRequest>(Point3(3.5f, 0.0f, 0.5f), Point3(0.5f, 0.0f, 3.0f));
+    mediumPriorityRequest->setPriority(1);
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = {lowPriorityRequest, highPriorityRequest, mediumPriorityRequest};
+
+    pathRequestScheduler.update(navMesh, pathRequests);
+    bool highPriorityFirst = highPriorityRequest->isPathReady() && !mediumPriorityRequest->isPathReady() && !lowPriorityRequest->isPathReady();
+    pathRequestScheduler.update(navMesh, pathRequests);
+    bool mediumPrioritySecond = mediumPriorityRequest->isPathReady() && !lowPriorityRequest->isPathReady();
+    pathRequestScheduler.update(navMesh, pathRequests);
+
+    AssertHelper::assertTrue(highPriorityFirst);
+    AssertHelper::assertTrue(mediumPrioritySecond);
+    AssertHelper::assertTrue(lowPriorityRequest->isPathReady());
+}
+
+void PathRequestSchedulerTest::priorityAging() {
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    PathRequestScheduler pathRequestScheduler(0.3f, 0.0f, 100, 2); //no time budget: one request planned by update
+    auto lowPriorityRequest = std::make_shared<PathRequest>(Point3(1.0f, 0.0f, 1.0f), Point3(3.0f, 0.0f, 3.0f));
+    auto highPriorityRequest = std::make_shared<PathRequest>(Point3(0.5f, 0.0f, 3.0f), Point3(3.0f, 0.0f, 3.0f));
+    highPriorityRequest->setPriority(1);
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = {lowPriorityRequest, highPriorityRequest};
+
+    pathRequestScheduler.update(navMesh, pathRequests);
+    bool highPriorityFirst = highPriorityRequest->isPathReady() && !lowPriorityRequest->isPathReady();
+    for (int i = 0; i < 10 && !lowPriorityRequest->isPathReady(); ++i) {
+        highPriorityRequest->updatePoints(Point3(i % 2 == 0 ? 1.5f : 0.5f, 0.0f, 3.0f), Point3(3.0f, 0.0f, 3.0f)); //high priority request always needs a new path
+        pathRequestScheduler.update(navMesh, pathRequests);
+    }
+
+    AssertHelper::assertTrue(highPriorityFirst);
+    AssertHelper::assertTrue(lowPriorityRequest->isPathReady());
+}
+
+std::shared_ptr<NavMesh> PathRequestSchedulerTest::buildNavMesh() {
+    std::vector polygonPoints = {Point3(0.0f, 0.0f, 0.0f), Point3(0.0f, 0.0f, 4.0f), Point3(4.0f, 0.0f, 4.0f), Point3(4.0f, 0.0f, 0.0f)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+    navTriangle1->addStandardLink(1, navTriangle2);
+    navTriangle2->addStandardLink(2, navTriangle1);
+
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({navPolygon});
+    return navMesh;
+}
+
+CppUnit::Test* PathRequestSchedulerTest::suite() {
+    auto* suite = new CppUnit::TestSuite("PathRequestSchedulerTest");
+
+    suite->addTest(new CppUnit::TestCaller("replanOnlyWhenPointsMove", &PathRequestSchedulerTest::replanOnlyWhenPointsMove));
+    suite->addTest(new CppUnit::TestCaller("replanOnNavMeshUpdate", &PathRequestSchedulerTest::replanOnNavMeshUpdate));
+    suite->addTest(new CppUnit::TestCaller("sharedCachedPath", &PathRequestSchedulerTest::sharedCachedPath));
+    suite->addTest(new CppUnit::TestCaller("priorityWithTimeBudget", &PathRequestSchedulerTest::priorityWithTimeBudget));
+    suite->addTest(new CppUnit::TestCaller("priorityAging", &PathRequestSchedulerTest::priorityAging));
+
+    return suite;
+}
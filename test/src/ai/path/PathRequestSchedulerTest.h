@@ -0,0 +1,20 @@
+#pragma once
+
+#include <memory>
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinAIEngine.h>
+
+class PathRequestSchedulerTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void replanOnlyWhenPointsMove();
+        void replanOnNavMeshUpdate();
+        void sharedCachedPath();
+        void priorityWithTimeBudget();
+        void priorityAging();
+
+    private:
+        static std::shared_ptr<urchin::NavMesh> buildNavMesh();
+};
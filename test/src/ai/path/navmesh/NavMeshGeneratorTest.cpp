@@ -0,0 +1,231 @@
+#include <thread>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "ai/path/navmesh/NavMeshGeneratorTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void NavMeshGeneratorTest::emptyWorld() {
+    AIWorld aiWorld;
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+
+    AssertHelper::assertUnsignedIntEquals(navMesh->getPolygons().size(), 0);
+}
+
+void NavMeshGeneratorTest::flatGround() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> pathPoints = findPath(navMesh, Point3(1.0f, 0.5f, 1.0f), Point3(9.0f, 0.5f, 9.0f));
+
+    AssertHelper::assertTrue(!navMesh->getPolygons().empty());
+    for (const auto& navPolygon : navMesh->getPolygons()) {
+        for (const auto& point : navPolygon->getPoints()) {
+            AssertHelper::assertFloatEquals(point.Y, 0.0f);
+            AssertHelper::assertTrue(point.X >= 0.199f && point.X <= 9.801f && point.Z >= 0.199f && point.Z <= 9.801f); //eroded by the agent radius
+        }
+    }
+    AssertHelper::assertUnsignedIntEquals(pathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints[0].getPoint(), Point3(1.0f, 0.5f, 1.0f));
+    AssertHelper::assertPoint3FloatEquals(pathPoints[1].getPoint(), Point3(9.0f, 0.5f, 9.0f));
+}
+
+void NavMeshGeneratorTest::flatTerrain() {
+    std::vector<float> terrainHeights(11 * 11, 0.0f);
+    AIWorld aiWorld;
+    aiWorld.addEntity(std::make_shared<AITerrain>("terrain", Transform<float>(), false, terrainHeights, 11, 11, Point2(0.0f, 0.0f), Vector2(1.0f, 1.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> pathPoints = findPath(navMesh, Point3(1.0f, 0.5f, 9.0f), Point3(9.0f, 0.5f, 1.0f));
+
+    AssertHelper::assertUnsignedIntEquals(pathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints[1].getPoint(), Point3(9.0f, 0.5f, 1.0f));
+}
+
+void NavMeshGeneratorTest::obstacleOnGround() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f)));
+    aiWorld.addEntity(buildBox("wall", Point3(5.0f, 1.0f, 4.0f), Vector3(0.5f, 1.0f, 4.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> pathPoints = findPath(navMesh, Point3(2.0f, 0.5f, 2.0f), Point3(8.0f, 0.5f, 2.0f));
+
+    AssertHelper::assertTrue(pathPoints.size() > 2);
+    AssertHelper::assertTrue(std::ranges::any_of(pathPoints, [](const PathPoint& pathPoint) { return pathPoint.getPoint().Z > 8.0f; })); //path goes around the wall
+}
+
+void NavMeshGeneratorTest::unreachableBoxTop() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f)));
+    aiWorld.addEntity(buildBox("box", Point3(5.0f, 1.0f, 5.0f), Vector3(1.0f, 1.0f, 1.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> groundToBoxTopPath = findPath(navMesh, Point3(1.0f, 0.5f, 1.0f), Point3(5.0f, 2.5f, 5.0f));
+    std::vector<PathPoint> boxTopPath = findPath(navMesh, Point3(4.5f, 2.5f, 4.5f), Point3(5.5f, 2.5f, 5.5f));
+
+    AssertHelper::assertUnsignedIntEquals(groundToBoxTopPath.size(), 0);
+    AssertHelper::assertUnsignedIntEquals(boxTopPath.size(), 2);
+}
+
+void NavMeshGeneratorTest::lowCeiling() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f)));
+    aiWorld.addEntity(buildBox("slab", Point3(5.0f, 1.1f, 5.0f), Vector3(1.0f, 0.1f, 5.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> underSlabPath = findPath(navMesh, Point3(2.0f, 0.5f, 5.0f), Point3(8.0f, 0.5f, 5.0f));
+    std::vector<PathPoint> slabTopPath = findPath(navMesh, Point3(5.0f, 1.7f, 1.0f), Point3(5.0f, 1.7f, 9.0f));
+
+    AssertHelper::assertUnsignedIntEquals(underSlabPath.size(), 0);
+    AssertHelper::assertUnsignedIntEquals(slabTopPath.size(), 2);
+}
+
+void NavMeshGeneratorTest::rampOntoPlatform() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f)));
+    aiWorld.addEntity(buildBox("platform", Point3(5.0f, 2.4f, 2.5f), Vector3(1.5f, 0.1f, 1.5f))); //walkable ground under the platform: platform in another region
+    aiWorld.addEntity(buildBox("ramp", Point3(5.0f, 1.165f, 5.947f), Vector3(1.5f, 0.1f, 2.5f), Quaternion<float>::rotationX(std::atan2(2.5f, 4.0f)))); //from (z=8, y=0) to (z=4, y=2.5)
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> pathPoints = findPath(navMesh, Point3(1.0f, 0.5f, 1.0f), Point3(5.0f, 3.0f, 2.5f));
+
+    AssertHelper::assertTrue(pathPoints.size() >= 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints.back().getPoint(), Point3(5.0f, 3.0f, 2.5f));
+}
+
+void NavMeshGeneratorTest::linkTiles() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(15.0f, -0.5f, 15.0f), Vector3(15.0f, 0.5f, 15.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<PathPoint> pathPoints = findPath(navMesh, Point3(1.0f, 0.5f, 1.0f), Point3(29.0f, 0.5f, 29.0f));
+
+    std::set<std::string> tileNames;
+    bool hasJoinPolygonsLink = false;
+    for (const auto& navPolygon : navMesh->getPolygons()) {
+        tileNames.insert(navPolygon->getName().substr(0, navPolygon->getName().find("_region")));
+        for (const auto& navTriangle : navPolygon->getTriangles()) {
+            hasJoinPolygonsLink = hasJoinPolygonsLink || std::ranges::any_of(navMesh->getLinks(*navTriangle), [](const auto& link) { return link->getLinkType() == JOIN_POLYGONS; });
+        }
+    }
+    AssertHelper::assertUnsignedIntEquals(tileNames.size(), 16); //30m ground: 4x4 tiles of 48 voxels of 0.2m
+    AssertHelper::assertTrue(hasJoinPolygonsLink);
+    AssertHelper::assertUnsignedIntEquals(pathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints[1].getPoint(), Point3(29.0f, 0.5f, 29.0f));
+}
+
+void NavMeshGeneratorTest::moveObstacle() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(15.0f, -0.5f, 15.0f), Vector3(15.0f, 0.5f, 15.0f)));
+    std::shared_ptr<AIObject> wall = buildBox("wall", Point3(10.0f, 1.0f, 12.0f), Vector3(0.5f, 1.0f, 12.0f));
+    aiWorld.addEntity(wall);
+    NavMeshGenerator navMeshGenerator;
+
+    std::vector<PathPoint> aroundWallPath = findPath(navMeshGenerator.generate(aiWorld), Point3(5.0f, 0.5f, 5.0f), Point3(15.0f, 0.5f, 5.0f));
+    wall->updateTransform(Point3(25.0f, 1.0f, 18.0f), Quaternion<float>());
+    std::vector<PathPoint> straightPath = findPath(navMeshGenerator.generate(aiWorld), Point3(5.0f, 0.5f, 5.0f), Point3(15.0f, 0.5f, 5.0f));
+    std::vector<PathPoint> aroundMovedWallPath = findPath(navMeshGenerator.generate(aiWorld), Point3(20.0f, 0.5f, 10.0f), Point3(29.0f, 0.5f, 10.0f));
+
+    AssertHelper::assertTrue(std::ranges::any_of(aroundWallPath, [](const PathPoint& pathPoint) { return pathPoint.getPoint().Z > 24.0f; }));
+    AssertHelper::assertUnsignedIntEquals(straightPath.size(), 2);
+    AssertHelper::assertTrue(std::ranges::any_of(aroundMovedWallPath, [](const PathPoint& pathPoint) { return pathPoint.getPoint().Z < 6.0f; }));
+}
+
+void NavMeshGeneratorTest::shareUnchangedTiles() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(15.0f, -0.5f, 15.0f), Vector3(15.0f, 0.5f, 15.0f)));
+    std::shared_ptr<AIObject> obstacle = buildBox("obstacle", Point3(3.0f, 0.5f, 7.0f), Vector3(0.5f, 0.5f, 0.5f));
+    aiWorld.addEntity(obstacle);
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    obstacle->updateTransform(Point3(4.0f, 0.5f, 7.0f), Quaternion<float>());
+    std::shared_ptr<NavMesh> updatedNavMesh = navMeshGenerator.generate(aiWorld);
+
+    std::vector<PathPoint> pathPoints = findPath(navMesh, Point3(1.0f, 0.5f, 1.0f), Point3(29.0f, 0.5f, 29.0f));
+    std::vector<PathPoint> updatedPathPoints = findPath(updatedNavMesh, Point3(1.0f, 0.5f, 1.0f), Point3(29.0f, 0.5f, 29.0f));
+    std::vector<PathPoint> copiedPathPoints = findPath(std::make_shared<NavMesh>(*updatedNavMesh), Point3(1.0f, 0.5f, 1.0f), Point3(29.0f, 0.5f, 29.0f));
+
+    auto findPolygon = [](const std::shared_ptr<NavMesh>& mesh, const std::string& name) {
+        return *std::ranges::find_if(mesh->getPolygons(), [&name](const auto& navPolygon) { return navPolygon->getName() == name; });
+    };
+    AssertHelper::assertTrue(findPolygon(navMesh, "tile2_2_region0") == findPolygon(updatedNavMesh, "tile2_2_region0")); //far from the obstacle
+    AssertHelper::assertTrue(findPolygon(navMesh, "tile1_0_region0") == findPolygon(updatedNavMesh, "tile1_0_region0")); //adjacent tile: only its border links change
+    AssertHelper::assertTrue(findPolygon(navMesh, "tile0_0_region0") != findPolygon(updatedNavMesh, "tile0_0_region0"));
+    AssertHelper::assertPoint3FloatEquals(pathPoints.back().getPoint(), Point3(29.0f, 0.5f, 29.0f)); //previous navigation mesh still usable
+    AssertHelper::assertPoint3FloatEquals(updatedPathPoints.back().getPoint(), Point3(29.0f, 0.5f, 29.0f));
+    AssertHelper::assertUnsignedIntEquals(copiedPathPoints.size(), updatedPathPoints.size());
+}
+
+void NavMeshGeneratorTest::backgroundGeneration() {
+    AIWorld aiWorld;
+    aiWorld.addEntity(buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f)));
+    NavMeshGenerator navMeshGenerator;
+
+    std::shared_ptr<NavMesh> initialNavMesh = navMeshGenerator.generateInBackground(aiWorld);
+    std::shared_ptr<NavMesh> navMesh = initialNavMesh;
+    for (int i = 0; i < 1000 && navMesh == initialNavMesh; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        navMesh = navMeshGenerator.generateInBackground(aiWorld);
+    }
+
+    AssertHelper::assertUnsignedIntEquals(initialNavMesh->getPolygons().size(), 0);
+    AssertHelper::assertTrue(navMesh->getUpdateId() > initialNavMesh->getUpdateId());
+    AssertHelper::assertUnsignedIntEquals(findPath(navMesh, Point3(1.0f, 0.5f, 1.0f), Point3(9.0f, 0.5f, 9.0f)).size(), 2);
+}
+
+void NavMeshGeneratorTest::removeEntity() {
+    AIWorld aiWorld;
+    std::shared_ptr<AIObject> ground = buildBox("ground", Point3(5.0f, -0.5f, 5.0f), Vector3(5.0f, 0.5f, 5.0f));
+    aiWorld.addEntity(ground);
+    NavMeshGenerator navMeshGenerator;
+
+    unsigned int firstUpdateId = navMeshGenerator.generate(aiWorld)->getUpdateId();
+    unsigned int unchangedUpdateId = navMeshGenerator.generate(aiWorld)->getUpdateId();
+    aiWorld.removeEntity(ground);
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+
+    AssertHelper::assertUnsignedIntEquals(unchangedUpdateId, firstUpdateId);
+    AssertHelper::assertTrue(navMesh->getUpdateId() > firstUpdateId);
+    AssertHelper::assertUnsignedIntEquals(navMesh->getPolygons().size(), 0);
+}
+
+std::shared_ptr<AIObject> NavMeshGeneratorTest::buildBox(std::string name, const Point3<float>& position, const Vector3<float>& halfSizes, const Quaternion<float>& orientation) {
+    auto boxShape = std::make_unique<AIShape>(std::make_unique<BoxShape<float>>(halfSizes));
+    return std::make_shared<AIObject>(std::move(name), Transform(position, orientation), true, std::move(boxShape));
+}
+
+std::vector<PathPoint> NavMeshGeneratorTest::findPath(const std::shared_ptr<NavMesh>& navMesh, const Point3<float>& startPoint, const Point3<float>& endPoint) {
+    return PathfindingAStar(navMesh).findPath(startPoint, endPoint);
+}
+
+CppUnit::Test* NavMeshGeneratorTest::suite() {
+    auto* suite = new CppUnit::TestSuite("NavMeshGeneratorTest");
+
+    suite->addTest(new CppUnit::TestCaller("emptyWorld", &NavMeshGeneratorTest::emptyWorld));
+    suite->addTest(new CppUnit::TestCaller("flatGround", &NavMeshGeneratorTest::flatGround));
+    suite->addTest(new CppUnit::TestCaller("flatTerrain", &NavMeshGeneratorTest::flatTerrain));
+    suite->addTest(new CppUnit::TestCaller("obstacleOnGround", &NavMeshGeneratorTest::obstacleOnGround));
+    suite->addTest(new CppUnit::TestCaller("unreachableBoxTop", &NavMeshGeneratorTest::unreachableBoxTop));
+    suite->addTest(new CppUnit::TestCaller("lowCeiling", &NavMeshGeneratorTest::lowCeiling));
+    suite->addTest(new CppUnit::TestCaller("rampOntoPlatform", &NavMeshGeneratorTest::rampOntoPlatform));
+    suite->addTest(new CppUnit::TestCaller("linkTiles", &NavMeshGeneratorTest::linkTiles));
+    suite->addTest(new CppUnit::TestCaller("removeEntity", &NavMeshGeneratorTest::removeEntity));
+    suite->addTest(new CppUnit::TestCaller("moveObstacle", &NavMeshGeneratorTest::moveObstacle));
+    suite->addTest(new CppUnit::TestCaller("shareUnchangedTiles", &NavMeshGeneratorTest::shareUnchangedTiles));
+    suite->addTest(new CppUnit::TestCaller("backgroundGeneration", &NavMeshGeneratorTest::backgroundGeneration));
+
+    return suite;
+}
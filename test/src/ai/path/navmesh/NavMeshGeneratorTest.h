@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinAIEngine.h>
+
+class NavMeshGeneratorTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void emptyWorld();
+        void flatGround();
+        void flatTerrain();
+        void obstacleOnGround();
+        void unreachableBoxTop();
+        void lowCeiling();
+        void rampOntoPlatform();
+        void linkTiles();
+        void removeEntity();
+        void moveObstacle();
+        void shareUnchangedTiles();
+        void backgroundGeneration();
+
+    private:
+        static std::shared_ptr<urchin::AIObject> buildBox(std::string, const urchin::Point3<float>&, const urchin::Vector3<float>&,
+                                                          const urchin::Quaternion<float>& = urchin::Quaternion<float>());
+        static std::vector<urchin::PathPoint> findPath(const std::shared_ptr<urchin::NavMesh>&, const urchin::Point3<float>&, const urchin::Point3<float>&);
+};
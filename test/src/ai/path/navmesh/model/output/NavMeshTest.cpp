@@ -0,0 +1,90 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "ai/path/navmesh/model/output/NavMeshTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void NavMeshTest::findTriangle() {
+    std::vector<std::shared_ptr<NavPolygon>> polygons;
+    for (int z = 0; z < 10; ++z) {
+        for (int x = 0; x < 10; ++x) {
+            polygons.push_back(buildSquarePolygon("square" + std::to_string(x) + "_" + std::to_string(z), (float)x, (float)z, 1.0f, 0.0f));
+        }
+    }
+    NavMesh navMesh;
+    navMesh.copyAllPolygons(polygons);
+
+    std::shared_ptr<NavTriangle> triangle = navMesh.findTriangle(Point3(7.2f, 0.5f, 3.6f));
+
+    AssertHelper::assertTrue(triangle != nullptr);
+    AssertHelper::assertStringEquals(triangle->getNavPolygon()->getName(), "square7_3");
+    AssertHelper::assertTrue(triangle->getCenterPoint().X > 7.0f && triangle->getCenterPoint().Z > 3.0f);
+}
+
+void NavMeshTest::findTriangleOnEdge() {
+    NavMesh navMesh;
+    navMesh.copyAllPolygons({buildSquarePolygon("square1", 0.0f, 0.0f, 2.0f, 0.0f), buildSquarePolygon("square2", 2.0f, 0.0f, 2.0f, 0.0f)});
+
+    std::shared_ptr<NavTriangle> triangle = navMesh.findTriangle(Point3(2.0f, 0.5f, 1.0f));
+
+    AssertHelper::assertTrue(triangle != nullptr);
+}
+
+void NavMeshTest::findTriangleOnEdgeLine() {
+    NavMesh navMesh;
+    navMesh.copyAllPolygons({buildSquarePolygon("square1", 0.0f, 0.0f, 2.0f, 0.0f), buildSquarePolygon("square2", 4.0f, 4.0f, 1.0f, 0.0f)});
+
+    //points located on the line of a triangle edge, outside the triangles
+    AssertHelper::assertTrue(navMesh.findTriangle(Point3(3.0f, 0.5f, 0.0f)) == nullptr);
+    AssertHelper::assertTrue(navMesh.findTriangle(Point3(0.0f, 0.5f, 3.0f)) == nullptr);
+    AssertHelper::assertTrue(navMesh.findTriangle(Point3(2.0f, 0.5f, 3.0f)) == nullptr);
+}
+
+void NavMeshTest::findTriangleBelowPoint() {
+    NavMesh navMesh;
+    navMesh.copyAllPolygons({buildSquarePolygon("ground", 0.0f, 0.0f, 4.0f, 0.0f), buildSquarePolygon("floor", 0.0f, 0.0f, 4.0f, 3.0f)});
+
+    std::shared_ptr<NavTriangle> groundTriangle = navMesh.findTriangle(Point3(1.0f, 0.5f, 1.0f));
+    std::shared_ptr<NavTriangle> floorTriangle = navMesh.findTriangle(Point3(1.0f, 3.5f, 1.0f));
+    std::shared_ptr<NavTriangle> undergroundTriangle = navMesh.findTriangle(Point3(1.0f, -0.5f, 1.0f));
+
+    AssertHelper::assertStringEquals(groundTriangle->getNavPolygon()->getName(), "ground");
+    AssertHelper::assertStringEquals(floorTriangle->getNavPolygon()->getName(), "floor");
+    AssertHelper::assertTrue(undergroundTriangle == nullptr);
+}
+
+void NavMeshTest::findTriangleOutside() {
+    NavMesh navMesh;
+    navMesh.copyAllPolygons({buildSquarePolygon("square1", 0.0f, 0.0f, 1.0f, 0.0f), buildSquarePolygon("square2", 5.0f, 5.0f, 1.0f, 0.0f)});
+    NavMesh emptyNavMesh;
+
+    AssertHelper::assertTrue(navMesh.findTriangle(Point3(3.0f, 0.5f, 3.0f)) == nullptr);
+    AssertHelper::assertTrue(navMesh.findTriangle(Point3(-1.0f, 0.5f, 0.5f)) == nullptr);
+    AssertHelper::assertTrue(NavMesh(navMesh).findTriangle(Point3(5.5f, 0.5f, 5.5f)) != nullptr);
+    AssertHelper::assertTrue(emptyNavMesh.findTriangle(Point3(0.5f, 0.5f, 0.5f)) == nullptr);
+}
+
+std::shared_ptr<NavPolygon> NavMeshTest::buildSquarePolygon(std::string name, float minX, float minZ, float size, float y) {
+    std::vector polygonPoints = {Point3(minX, y, minZ), Point3(minX, y, minZ + size), Point3(minX + size, y, minZ + size), Point3(minX + size, y, minZ)};
+    auto navPolygon = std::make_shared<NavPolygon>(std::move(name), std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+    navTriangle1->addStandardLink(1, navTriangle2);
+    navTriangle2->addStandardLink(2, navTriangle1);
+    return navPolygon;
+}
+
+CppUnit::Test* NavMeshTest::suite() {
+    auto* suite = new CppUnit::TestSuite("NavMeshTest");
+
+    suite->addTest(new CppUnit::TestCaller("findTriangle", &NavMeshTest::findTriangle));
+    suite->addTest(new CppUnit::TestCaller("findTriangleOnEdge", &NavMeshTest::findTriangleOnEdge));
+    suite->addTest(new CppUnit::TestCaller("findTriangleOnEdgeLine", &NavMeshTest::findTriangleOnEdgeLine));
+    suite->addTest(new CppUnit::TestCaller("findTriangleBelowPoint", &NavMeshTest::findTriangleBelowPoint));
+    suite->addTest(new CppUnit::TestCaller("findTriangleOutside", &NavMeshTest::findTriangleOutside));
+
+    return suite;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinAIEngine.h>
+
+class NavMeshTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void findTriangle();
+        void findTriangleOnEdge();
+        void findTriangleOnEdgeLine();
+        void findTriangleBelowPoint();
+        void findTriangleOutside();
+
+    private:
+        static std::shared_ptr<urchin::NavPolygon> buildSquarePolygon(std::string, float, float, float, float);
+};
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "ai/path/pathfinding/PathfindingAStarBT.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void PathfindingAStarBT::openGroundPaths() {
+    benchmarkPaths("open ground", buildNavMesh(false));
+}
+
+void PathfindingAStarBT::pillarsGroundPaths() {
+    benchmarkPaths("pillars ground", buildNavMesh(true));
+}
+
+std::shared_ptr<NavMesh> PathfindingAStarBT::buildNavMesh(bool withPillars) const {
+    AIWorld aiWorld;
+    float halfGroundSize = GROUND_SIZE / 2.0f;
+    auto groundShape = std::make_unique<AIShape>(std::make_unique<BoxShape<float>>(Vector3(halfGroundSize, 0.5f, halfGroundSize)));
+    aiWorld.addEntity(std::make_shared<AIObject>("ground", Transform(Point3(halfGroundSize, -0.5f, halfGroundSize)), true, std::move(groundShape)));
+    if (withPillars) { //pillars every 4 meters: paths cross many small triangles
+        for (int z = 0; z < (int)(GROUND_SIZE / 4.0f); ++z) {
+            for (int x = 0; x < (int)(GROUND_SIZE / 4.0f); ++x) {
+                auto pillarShape = std::make_unique<AIShape>(std::make_unique<BoxShape<float>>(Vector3(0.5f, 1.5f, 0.5f)));
+                Point3 pillarPosition((float)x * 4.0f + 2.0f, 1.5f, (float)z * 4.0f + 2.0f);
+                aiWorld.addEntity(std::make_shared<AIObject>("pillar" + std::to_string(x) + "_" + std::to_string(z), Transform(pillarPosition), true, std::move(pillarShape)));
+            }
+        }
+    }
+
+    return NavMeshGenerator().generate(aiWorld);
+}
+
+void PathfindingAStarBT::benchmarkPaths(const std::string& benchmarkName, const std::shared_ptr<NavMesh>& navMesh) const {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution cellDistribution(0, (int)(GROUND_SIZE / 4.0f) - 1);
+    std::vector<std::pair<Point3<float>, Point3<float>>> pathEndpoints;
+    for (unsigned int i = 0; i < PATHS_COUNT; ++i) { //endpoints at the corner of the 4 meters cells: never inside a pillar
+        Point3 startPoint((float)cellDistribution(generator) * 4.0f + 0.5f, 0.5f, (float)cellDistribution(generator) * 4.0f + 0.5f);
+        Point3 endPoint((float)cellDistribution(generator) * 4.0f + 0.5f, 0.5f, (float)cellDistribution(generator) * 4.0f + 0.5f);
+        pathEndpoints.emplace_back(startPoint, endPoint);
+    }
+
+    PathfindingAStar pathfindingAStar(navMesh);
+    std::size_t pathPointsCount = 0;
+    unsigned int pathsNotFound = 0;
+    auto pathsStart = std::chrono::steady_clock::now();
+    for (const auto& [startPoint, endPoint] : pathEndpoints) {
+        std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(startPoint, endPoint);
+        pathPointsCount += pathPoints.size();
+        pathsNotFound += pathPoints.empty() ? 1 : 0;
+    }
+    auto pathsDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - pathsStart).count();
+
+    std::cout << "PathfindingAStar " << benchmarkName << " (" << navMesh->getTrianglesCount() << " triangles, " << PATHS_COUNT << " paths): "
+              << pathsDuration << "us, " << (double)PATHS_COUNT * 1000000.0 / (double)std::max(1L, (long)pathsDuration) << " paths/s, "
+              << pathPointsCount << " path points" << std::endl;
+    AssertHelper::assertUnsignedIntEquals(pathsNotFound, 0);
+}
+
+CppUnit::Test* PathfindingAStarBT::suite() {
+    auto* suite = new CppUnit::TestSuite("PathfindingAStarBT");
+
+    suite->addTest(new CppUnit::TestCaller("openGroundPaths", &PathfindingAStarBT::openGroundPaths));
+    suite->addTest(new CppUnit::TestCaller("pillarsGroundPaths", &PathfindingAStarBT::pillarsGroundPaths));
+
+    return suite;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinAIEngine.h>
+
+class PathfindingAStarBT final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void openGroundPaths();
+        void pillarsGroundPaths();
+
+    private:
+        std::shared_ptr<urchin::NavMesh> buildNavMesh(bool) const;
+        void benchmarkPaths(const std::string&, const std::shared_ptr<urchin::NavMesh>&) const;
+
+        static constexpr float GROUND_SIZE = 60.0f;
+        static constexpr unsigned int PATHS_COUNT = 200;
+};
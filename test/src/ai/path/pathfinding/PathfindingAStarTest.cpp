@@ -27,6 +27,25 @@ void PathfindingAStarTest::straightPath() {
     AssertHelper::assertFalse(pathPoints[1].isJumpPoint());
 }
 
+void PathfindingAStarTest::sameTrianglePath() {
+    std::vector polygonPoints = {Point3(0.0f, 0.0f, 0.0f), Point3(0.0f, 0.0f, 4.0f), Point3(4.0f, 0.0f, 4.0f), Point3(4.0f, 0.0f, 0.0f)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+
+    navTriangle1->addStandardLink(1, navTriangle2);
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({navPolygon});
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(Point3(0.5f, 0.0f, 0.5f), Point3(0.5f, 0.0f, 2.5f));
+
+    AssertHelper::assertUnsignedIntEquals(pathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints[0].getPoint(), Point3(0.5f, 0.0f, 0.5f));
+    AssertHelper::assertPoint3FloatEquals(pathPoints[1].getPoint(), Point3(0.5f, 0.0f, 2.5f));
+}
+
 void PathfindingAStarTest::joinPolygonsPath() {
     std::vector polygon1Points = {Point3(0.0f, 0.0f, 0.0f), Point3(0.0f, 0.0f, 4.0f), Point3(4.0f, 0.0f, 0.0f)};
     auto navPolygon1 = std::make_shared<NavPolygon>("poly1TestName", std::move(polygon1Points), nullptr);
@@ -105,6 +124,7 @@ CppUnit::Test* PathfindingAStarTest::suite() {
     auto* suite = new CppUnit::TestSuite("PathfindingAStarTest");
 
     suite->addTest(new CppUnit::TestCaller("straightPath", &PathfindingAStarTest::straightPath));
+    suite->addTest(new CppUnit::TestCaller("sameTrianglePath", &PathfindingAStarTest::sameTrianglePath));
 
     suite->addTest(new CppUnit::TestCaller("joinPolygonsPath", &PathfindingAStarTest::joinPolygonsPath));
 
@@ -10,6 +10,7 @@ class PathfindingAStarTest final : public CppUnit::TestFixture {
         static CppUnit::Test* suite();
 
         void straightPath();
+        void sameTrianglePath();
 
         void joinPolygonsPath();
 
@@ -0,0 +1,54 @@
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "common/math/geometry/3d/RayPacketTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void RayPacketTest::sameResultAsSingleRay() {
+    AABBox box(Point3(0.0f, 0.0f, 0.0f), Point3(1.0f, 1.0f, 1.0f));
+    std::vector<Ray<float>> rays = {
+        Ray(Point3(2.0f, 0.5f, 2.0f), Vector3(1.0f, 0.0f, 0.0f), 10.0f), //right to box
+        Ray(Point3(1.5f, 2.0f, 0.5f), Vector3(1.0f, 1.0f, 0.0f), 10.0f), //right top to box
+        Ray(Point3(0.1f, 0.1f, 0.1f), Vector3(1.0f, 1.0f, 1.0f), 1.0f), //inside box
+        Ray(Point3(-1.0f, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 10.0f), //through X planes
+        Ray(Point3(0.5f, 2.0f, 0.5f), Vector3(0.0f, -1.0f, 0.0f), 2.0f), //through Y planes
+        Ray(Point3(0.5f, 0.5f, 2.0f), Vector3(0.0f, 0.0f, -1.0f), 10.0f), //through Z planes
+        Ray(Point3(1.5f, 2.0f, 0.5f), Vector3(-1.0f, -1.0f, 0.0f), 4.0f), //through XY planes
+        Ray(Point3(0.5f, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 5.0f), //inside to X plane
+        Ray(Point3(-1.0f, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 0.5f), //too short
+        Ray(Point3(2.0f, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 10.0f), //opposite direction
+    };
+    RayPacket rayPacket;
+    rayPacket.setup(rays);
+
+    uint64_t collideRaysMask = rayPacket.collideWithAABBox(box, rayPacket.getAllRaysMask());
+
+    AssertHelper::assertUnsignedIntEquals(rayPacket.getRaysCount(), rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        AssertHelper::assertTrue(((collideRaysMask >> i) & 1ull) == (box.collideWithRay(rays[i]) ? 1ull : 0ull), "Wrong result for ray " + std::to_string(i));
+    }
+}
+
+void RayPacketTest::ignoreUnmaskedRays() {
+    AABBox box(Point3(0.0f, 0.0f, 0.0f), Point3(1.0f, 1.0f, 1.0f));
+    std::vector<Ray<float>> rays = {
+        Ray(Point3(-1.0f, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 10.0f),
+        Ray(Point3(0.5f, 2.0f, 0.5f), Vector3(0.0f, -1.0f, 0.0f), 2.0f),
+        Ray(Point3(0.5f, 0.5f, 2.0f), Vector3(0.0f, 0.0f, -1.0f), 10.0f)
+    };
+    RayPacket rayPacket;
+    rayPacket.setup(rays);
+
+    AssertHelper::assertTrue(rayPacket.getAllRaysMask() == 0b111ull);
+    AssertHelper::assertTrue(rayPacket.collideWithAABBox(box, 0b101ull) == 0b101ull);
+    AssertHelper::assertTrue(rayPacket.collideWithAABBox(box, 0ull) == 0ull);
+}
+
+CppUnit::Test* RayPacketTest::suite() {
+    auto* suite = new CppUnit::TestSuite("RayPacketTest");
+
+    suite->addTest(new CppUnit::TestCaller("sameResultAsSingleRay", &RayPacketTest::sameResultAsSingleRay));
+    suite->addTest(new CppUnit::TestCaller("ignoreUnmaskedRays", &RayPacketTest::ignoreUnmaskedRays));
+
+    return suite;
+}
@@ -0,0 +1,51 @@
+#include <cppunit/extensions/HelperMacros.h>
+#include <UrchinCommon.h>
+
+#include "common/math/geometry/3d/SimplexTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void SimplexTest::originInTriangleFaceRegion() {
+    Simplex<float> simplex;
+    simplex.addPoint(Point3(-1.0f, -1.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f));
+    simplex.addPoint(Point3(1.0f, -1.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f));
+    simplex.addPoint(Point3(0.0f, 1.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f));
+
+    AssertHelper::assertUnsignedIntEquals(simplex.getSize(), 3);
+    AssertHelper::assertPoint3FloatEquals(simplex.getClosestPointToOrigin(), Point3(0.0f, 0.0f, 1.0f));
+}
+
+void SimplexTest::degenerateSegment() {
+    Simplex<float> simplex;
+    simplex.addPoint(Point3(2.0f, 0.0f, 0.0f), Point3(0.0f, 0.0f, 0.0f));
+    simplex.addPoint(Point3(2.0f, 0.0f, 0.0f), Point3(0.0f, 0.0f, 0.0f)); //same point added twice
+
+    AssertHelper::assertUnsignedIntEquals(simplex.getSize(), 1);
+    AssertHelper::assertPoint3FloatEquals(simplex.getClosestPointToOrigin(), Point3(2.0f, 0.0f, 0.0f));
+    AssertHelper::assertFloatEquals(simplex.getBarycentric(0), 1.0f);
+}
+
+void SimplexTest::degenerateTriangle() {
+    Simplex<float> simplex;
+    simplex.addPoint(Point3(1.0f, -1.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f));
+    simplex.addPoint(Point3(1.0f, 1.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f));
+    simplex.addPoint(Point3(1.0f, 3.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f)); //point aligned with the two first points
+
+    AssertHelper::assertPoint3FloatEquals(simplex.getClosestPointToOrigin(), Point3(1.0f, 0.0f, 1.0f));
+    float barycentricsSum = 0.0f;
+    for (std::size_t i = 0; i < simplex.getSize(); ++i) {
+        AssertHelper::assertTrue(simplex.getBarycentric(i) >= 0.0f && simplex.getBarycentric(i) <= 1.0f);
+        barycentricsSum += simplex.getBarycentric(i);
+    }
+    AssertHelper::assertFloatEquals(barycentricsSum, 1.0f);
+}
+
+CppUnit::Test* SimplexTest::suite() {
+    auto* suite = new CppUnit::TestSuite("SimplexTest");
+
+    suite->addTest(new CppUnit::TestCaller("originInTriangleFaceRegion", &SimplexTest::originInTriangleFaceRegion));
+    suite->addTest(new CppUnit::TestCaller("degenerateSegment", &SimplexTest::degenerateSegment));
+    suite->addTest(new CppUnit::TestCaller("degenerateTriangle", &SimplexTest::degenerateTriangle));
+
+    return suite;
+}
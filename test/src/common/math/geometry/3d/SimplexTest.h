@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class SimplexTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void originInTriangleFaceRegion();
+        void degenerateSegment();
+        void degenerateTriangle();
+};
@@ -0,0 +1,126 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "common/partitioning/aabbtree/AABBTreeTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+MyAABBItem::MyAABBItem(std::string id, const Point3<float>& position) :
+        id(std::move(id)),
+        position(position) {
+}
+
+const std::string& MyAABBItem::getId() const {
+    return id;
+}
+
+const Point3<float>& MyAABBItem::getPosition() const {
+    return position;
+}
+
+MyAABBNodeData::MyAABBNodeData(const std::shared_ptr<MyAABBItem>& item) :
+        AABBNodeData(item) {
+}
+
+std::unique_ptr<AABBNodeData<std::shared_ptr<MyAABBItem>>> MyAABBNodeData::clone() const {
+    return std::make_unique<MyAABBNodeData>(getNodeObject());
+}
+
+const std::string& MyAABBNodeData::getObjectId() const {
+    return getNodeObject()->getId();
+}
+
+AABBox<float> MyAABBNodeData::retrieveObjectAABBox() const {
+    const Point3<float>& position = getNodeObject()->getPosition();
+    return AABBox(position - Point3(0.5f, 0.5f, 0.5f), position + Point3(0.5f, 0.5f, 0.5f));
+}
+
+bool MyAABBNodeData::isObjectMoving() const {
+    return false;
+}
+
+void AABBTreeTest::balancedAfterSortedInsertion() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(1024);
+    AABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+
+    AssertHelper::assertTrue(tree.getHeight() <= 2 * 10 /* 2 * log2(1024) */, "Tree height too big: " + std::to_string(tree.getHeight()));
+    AssertHelper::assertUnsignedIntEquals(aabboxQueryIds(tree, AABBox(Point3(-1.0f, -1.0f, -1.0f), Point3(0.3f, 1.0f, 1.0f))).size(), 1);
+}
+
+void AABBTreeTest::balancedAfterRemoval() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(1024);
+    AABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        if (i % 4 != 0) {
+            tree.removeObject(items[i]);
+        }
+    }
+
+    AssertHelper::assertTrue(tree.getHeight() <= 2 * 8 /* 2 * log2(256) */, "Tree height too big: " + std::to_string(tree.getHeight()));
+    AssertHelper::assertTrue(tree.getRootNode()->getAABBox().getMax().X < (float)items.size() - 2.0f); //refitted after removal
+    std::vector<std::string> queryIds = aabboxQueryIds(tree, AABBox(Point3(-1.0f, -1.0f, -1.0f), Point3(10.0f, 1.0f, 1.0f)));
+    AssertHelper::assertUnsignedIntEquals(queryIds.size(), 3);
+    AssertHelper::assertStringEquals(queryIds[0], "item0");
+    AssertHelper::assertStringEquals(queryIds[1], "item4");
+    AssertHelper::assertStringEquals(queryIds[2], "item8");
+}
+
+void AABBTreeTest::rebuildWithSah() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(1024);
+    AABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    AABBox<float> queryBox(Point3(99.5f, -1.0f, -1.0f), Point3(110.5f, 1.0f, 1.0f));
+    std::vector<std::string> queryIdsBeforeRebuild = aabboxQueryIds(tree, queryBox);
+    float surfaceAreaBeforeRebuild = tree.computeTotalSurfaceArea();
+
+    tree.rebuild();
+
+    AssertHelper::assertTrue(tree.computeTotalSurfaceArea() <= surfaceAreaBeforeRebuild);
+    AssertHelper::assertUnsignedIntEquals(tree.getHeight(), 10 /* log2(1024) */);
+    std::vector<std::string> queryIdsAfterRebuild = aabboxQueryIds(tree, queryBox);
+    AssertHelper::assertUnsignedIntEquals(queryIdsAfterRebuild.size(), 13);
+    AssertHelper::assertTrue(queryIdsBeforeRebuild == queryIdsAfterRebuild);
+}
+
+std::vector<std::shared_ptr<MyAABBItem>> AABBTreeTest::buildItems(unsigned int itemsCount) const {
+    std::vector<std::shared_ptr<MyAABBItem>> items;
+    items.reserve(itemsCount);
+    for (unsigned int i = 0; i < itemsCount; ++i) {
+        items.push_back(std::make_shared<MyAABBItem>("item" + std::to_string(i), Point3((float)i, 0.0f, 0.0f)));
+    }
+    return items;
+}
+
+std::vector<std::string> AABBTreeTest::aabboxQueryIds(const AABBTree<std::shared_ptr<MyAABBItem>>& tree, const AABBox<float>& queryBox) const {
+    std::vector<std::shared_ptr<MyAABBItem>> queryItems;
+    tree.aabboxQuery(queryBox, queryItems);
+
+    std::vector<std::string> queryIds;
+    queryIds.reserve(queryItems.size());
+    for (const auto& queryItem : queryItems) {
+        queryIds.push_back(queryItem->getId());
+    }
+    std::ranges::sort(queryIds, [](const std::string& id1, const std::string& id2) {
+        return id1.size() == id2.size() ? id1 < id2 : id1.size() < id2.size();
+    });
+    return queryIds;
+}
+
+CppUnit::Test* AABBTreeTest::suite() {
+    auto* suite = new CppUnit::TestSuite("AABBTreeTest");
+
+    suite->addTest(new CppUnit::TestCaller("balancedAfterSortedInsertion", &AABBTreeTest::balancedAfterSortedInsertion));
+    suite->addTest(new CppUnit::TestCaller("balancedAfterRemoval", &AABBTreeTest::balancedAfterRemoval));
+    suite->addTest(new CppUnit::TestCaller("rebuildWithSah", &AABBTreeTest::rebuildWithSah));
+
+    return suite;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class MyAABBItem {
+    public:
+        MyAABBItem(std::string, const urchin::Point3<float>&);
+
+        const std::string& getId() const;
+        const urchin::Point3<float>& getPosition() const;
+
+    private:
+        std::string id;
+        urchin::Point3<float> position;
+};
+
+class MyAABBNodeData final : public urchin::AABBNodeData<std::shared_ptr<MyAABBItem>> {
+    public:
+        explicit MyAABBNodeData(const std::shared_ptr<MyAABBItem>&);
+
+        std::unique_ptr<urchin::AABBNodeData<std::shared_ptr<MyAABBItem>>> clone() const override;
+
+        const std::string& getObjectId() const override;
+        urchin::AABBox<float> retrieveObjectAABBox() const override;
+        bool isObjectMoving() const override;
+};
+
+class AABBTreeTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void balancedAfterSortedInsertion();
+        void balancedAfterRemoval();
+        void rebuildWithSah();
+
+    private:
+        std::vector<std::shared_ptr<MyAABBItem>> buildItems(unsigned int) const;
+        std::vector<std::string> aabboxQueryIds(const urchin::AABBTree<std::shared_ptr<MyAABBItem>>&, const urchin::AABBox<float>&) const;
+};
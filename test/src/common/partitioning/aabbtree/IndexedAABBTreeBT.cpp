@@ -0,0 +1,90 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "common/partitioning/aabbtree/IndexedAABBTreeBT.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void IndexedAABBTreeBT::rayQueriesIncoherentRays() {
+    std::vector<std::shared_ptr<MyAABBItem>> items;
+    std::unique_ptr<IndexedAABBTree<std::shared_ptr<MyAABBItem>>> tree = buildTree(items);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution positionDistribution(-100.0f, 100.0f);
+    std::uniform_real_distribution directionDistribution(-1.0f, 1.0f);
+
+    std::vector<Ray<float>> rays;
+    for (unsigned int i = 0; i < RAYS_COUNT; ++i) {
+        Point3 origin(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+        Vector3 direction(directionDistribution(generator), directionDistribution(generator), directionDistribution(generator));
+        rays.emplace_back(origin, direction.normalize(), 20.0f);
+    }
+
+    compareRayQueries("incoherent rays", *tree, rays);
+}
+
+void IndexedAABBTreeBT::rayQueriesCoherentRays() {
+    std::vector<std::shared_ptr<MyAABBItem>> items;
+    std::unique_ptr<IndexedAABBTree<std::shared_ptr<MyAABBItem>>> tree = buildTree(items);
+
+    std::vector<Ray<float>> rays;
+    for (unsigned int i = 0; i < RAYS_COUNT; ++i) { //downward rays on a grid (e.g. ground detection of characters)
+        Point3 origin(-20.0f + (float)(i % 32) * 1.25f, 100.0f, -10.0f + (float)(i / 32) * 1.25f);
+        rays.emplace_back(origin, Vector3(0.0f, -1.0f, 0.0f), 200.0f);
+    }
+
+    compareRayQueries("coherent rays", *tree, rays);
+}
+
+std::unique_ptr<IndexedAABBTree<std::shared_ptr<MyAABBItem>>> IndexedAABBTreeBT::buildTree(std::vector<std::shared_ptr<MyAABBItem>>& items) const {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution positionDistribution(-100.0f, 100.0f);
+
+    auto tree = std::make_unique<IndexedAABBTree<std::shared_ptr<MyAABBItem>>>(0.1f);
+    for (unsigned int i = 0; i < ITEMS_COUNT; ++i) {
+        Point3 position(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+        items.push_back(std::make_shared<MyAABBItem>("item" + std::to_string(i), position));
+        tree->addObject(std::make_unique<MyAABBNodeData>(items.back()));
+    }
+    tree->rebuild();
+    return tree;
+}
+
+void IndexedAABBTreeBT::compareRayQueries(const std::string& benchmarkName, const IndexedAABBTree<std::shared_ptr<MyAABBItem>>& tree, const std::vector<Ray<float>>& rays) const {
+    std::vector<std::vector<std::shared_ptr<MyAABBItem>>> rayQueryResults(rays.size());
+    auto rayQueryStart = std::chrono::steady_clock::now();
+    for (unsigned int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        for (std::size_t i = 0; i < rays.size(); ++i) {
+            rayQueryResults[i].clear();
+            tree.rayQuery(rays[i], rayQueryResults[i]);
+        }
+    }
+    auto rayQueryDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - rayQueryStart).count();
+
+    std::vector<std::vector<std::shared_ptr<MyAABBItem>>> rayQueriesResults;
+    auto rayQueriesStart = std::chrono::steady_clock::now();
+    for (unsigned int iteration = 0; iteration < ITERATIONS; ++iteration) {
+        for (std::vector<std::shared_ptr<MyAABBItem>>& rayQueriesResult : rayQueriesResults) {
+            rayQueriesResult.clear();
+        }
+        tree.rayQueries(rays, rayQueriesResults);
+    }
+    auto rayQueriesDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - rayQueriesStart).count();
+
+    std::cout << "IndexedAABBTree " << benchmarkName << " (" << rays.size() << " rays, " << ITEMS_COUNT << " items, " << ITERATIONS << " iterations): "
+              << "per ray: " << rayQueryDuration << "us, batched: " << rayQueriesDuration << "us" << std::endl;
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        AssertHelper::assertTrue(std::ranges::is_permutation(rayQueriesResults[i], rayQueryResults[i]));
+    }
+}
+
+CppUnit::Test* IndexedAABBTreeBT::suite() {
+    auto* suite = new CppUnit::TestSuite("IndexedAABBTreeBT");
+
+    suite->addTest(new CppUnit::TestCaller("rayQueriesIncoherentRays", &IndexedAABBTreeBT::rayQueriesIncoherentRays));
+    suite->addTest(new CppUnit::TestCaller("rayQueriesCoherentRays", &IndexedAABBTreeBT::rayQueriesCoherentRays));
+
+    return suite;
+}
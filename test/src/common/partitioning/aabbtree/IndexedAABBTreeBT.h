@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinCommon.h>
+
+#include "common/partitioning/aabbtree/AABBTreeTest.h"
+
+class IndexedAABBTreeBT final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void rayQueriesIncoherentRays();
+        void rayQueriesCoherentRays();
+
+    private:
+        std::unique_ptr<urchin::IndexedAABBTree<std::shared_ptr<MyAABBItem>>> buildTree(std::vector<std::shared_ptr<MyAABBItem>>&) const;
+        void compareRayQueries(const std::string&, const urchin::IndexedAABBTree<std::shared_ptr<MyAABBItem>>&, const std::vector<urchin::Ray<float>>&) const;
+
+        static constexpr unsigned int ITEMS_COUNT = 10000;
+        static constexpr unsigned int RAYS_COUNT = 512;
+        static constexpr unsigned int ITERATIONS = 20;
+};
@@ -0,0 +1,171 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "common/partitioning/aabbtree/IndexedAABBTreeTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void IndexedAABBTreeTest::balancedAfterSortedInsertion() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(1024);
+    IndexedAABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+
+    AssertHelper::assertTrue(tree.getHeight() <= 2 * 10 /* 2 * log2(1024) */, "Tree height too big: " + std::to_string(tree.getHeight()));
+    AssertHelper::assertUnsignedIntEquals(aabboxQueryIds(tree, AABBox(Point3(-1.0f, -1.0f, -1.0f), Point3(0.3f, 1.0f, 1.0f))).size(), 1);
+}
+
+void IndexedAABBTreeTest::balancedAfterRemoval() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(1024);
+    IndexedAABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        if (i % 4 != 0) {
+            tree.removeObject(items[i]);
+        }
+    }
+
+    AssertHelper::assertTrue(tree.getHeight() <= 2 * 8 /* 2 * log2(256) */, "Tree height too big: " + std::to_string(tree.getHeight()));
+    std::vector<std::string> queryIds = aabboxQueryIds(tree, AABBox(Point3(-1.0f, -1.0f, -1.0f), Point3(10.0f, 1.0f, 1.0f)));
+    AssertHelper::assertUnsignedIntEquals(queryIds.size(), 3);
+    AssertHelper::assertStringEquals(queryIds[0], "item0");
+    AssertHelper::assertStringEquals(queryIds[1], "item4");
+    AssertHelper::assertStringEquals(queryIds[2], "item8");
+}
+
+void IndexedAABBTreeTest::reuseRemovedNodes() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(64);
+    IndexedAABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    for (unsigned int i = 0; i < 10; ++i) {
+        for (const auto& item : items) {
+            tree.removeObject(item);
+            tree.addObject(std::make_unique<MyAABBNodeData>(item));
+        }
+    }
+
+    AssertHelper::assertTrue(tree.containsObject(items[10].get()));
+    AssertHelper::assertStringEquals(tree.getNodeData(items[10].get()).getObjectId(), "item10");
+    AssertHelper::assertFloatEquals(tree.getFatAABBox(items[10].get()).getMin().X, 9.4f);
+    std::vector<std::shared_ptr<MyAABBItem>> allItems;
+    tree.getAllNodeObjects(allItems);
+    AssertHelper::assertUnsignedIntEquals(allItems.size(), 64);
+    AssertHelper::assertUnsignedIntEquals(aabboxQueryIds(tree, AABBox(Point3(9.5f, -1.0f, -1.0f), Point3(10.5f, 1.0f, 1.0f))).size(), 3);
+}
+
+void IndexedAABBTreeTest::rebuildWithSah() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(1024);
+    IndexedAABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    AABBox<float> queryBox(Point3(99.5f, -1.0f, -1.0f), Point3(110.5f, 1.0f, 1.0f));
+    std::vector<std::string> queryIdsBeforeRebuild = aabboxQueryIds(tree, queryBox);
+    float surfaceAreaBeforeRebuild = tree.computeTotalSurfaceArea();
+
+    tree.rebuild();
+
+    AssertHelper::assertTrue(tree.computeTotalSurfaceArea() <= surfaceAreaBeforeRebuild);
+    AssertHelper::assertUnsignedIntEquals(tree.getHeight(), 10 /* log2(1024) */);
+    std::vector<std::string> queryIdsAfterRebuild = aabboxQueryIds(tree, queryBox);
+    AssertHelper::assertUnsignedIntEquals(queryIdsAfterRebuild.size(), 13);
+    AssertHelper::assertTrue(queryIdsBeforeRebuild == queryIdsAfterRebuild);
+}
+
+void IndexedAABBTreeTest::rayQueries() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(256);
+    IndexedAABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    std::vector<Ray<float>> rays;
+    for (unsigned int i = 0; i < 100; ++i) { //more rays than a ray packet
+        rays.emplace_back(Point3((float)i * 2.5f, 5.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), 5.0f);
+    }
+
+    std::vector<std::vector<std::shared_ptr<MyAABBItem>>> itemsHitRays;
+    tree.rayQueries(rays, itemsHitRays);
+
+    AssertHelper::assertUnsignedIntEquals(itemsHitRays.size(), rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        std::vector<std::shared_ptr<MyAABBItem>> itemsHitRay;
+        tree.rayQuery(rays[i], itemsHitRay);
+        AssertHelper::assertUnsignedIntEquals(itemsHitRays[i].size(), itemsHitRay.size());
+        AssertHelper::assertTrue(std::ranges::is_permutation(itemsHitRays[i], itemsHitRay));
+    }
+    AssertHelper::assertUnsignedIntEquals(itemsHitRays[0].size(), 1);
+    AssertHelper::assertStringEquals(itemsHitRays[0][0]->getId(), "item0");
+    AssertHelper::assertUnsignedIntEquals(itemsHitRays[1].size(), 2); //ray between item2 and item3 hits both fat AABBox
+}
+
+void IndexedAABBTreeTest::snapshotQueries() {
+    std::vector<std::shared_ptr<MyAABBItem>> items = buildItems(256);
+    IndexedAABBTree<std::shared_ptr<MyAABBItem>> tree(0.1f);
+    for (const auto& item : items) {
+        tree.addObject(std::make_unique<MyAABBNodeData>(item));
+    }
+    for (std::size_t i = 0; i < items.size(); i += 2) {
+        tree.removeObject(items[i]);
+    }
+
+    AABBTreeSnapshot<std::string> snapshot;
+    tree.copyTo(snapshot, [](const std::shared_ptr<MyAABBItem>& item) { return item->getId(); });
+    items.clear(); //snapshot does not depend on the tree objects
+
+    std::vector<const std::string*> aabboxQueryIds;
+    snapshot.aabboxQuery(AABBox(Point3(9.6f, -1.0f, -1.0f), Point3(14.4f, 1.0f, 1.0f)), aabboxQueryIds);
+    AssertHelper::assertUnsignedIntEquals(aabboxQueryIds.size(), 2);
+    AssertHelper::assertTrue(std::ranges::any_of(aabboxQueryIds, [](const std::string* id) { return *id == "item11"; }));
+    AssertHelper::assertTrue(std::ranges::any_of(aabboxQueryIds, [](const std::string* id) { return *id == "item13"; }));
+
+    std::vector<const std::string*> rayQueryIds;
+    snapshot.rayQuery(Ray(Point3(3.45f, 5.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), 5.0f), rayQueryIds);
+    AssertHelper::assertUnsignedIntEquals(rayQueryIds.size(), 1);
+    AssertHelper::assertStringEquals(*rayQueryIds[0], "item3");
+    rayQueryIds.clear();
+    snapshot.rayQuery(Ray(Point3(3.55f, 5.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), 5.0f), rayQueryIds);
+    AssertHelper::assertUnsignedIntEquals(rayQueryIds.size(), 0); //snapshot uses exact AABBox instead of fat AABBox
+}
+
+std::vector<std::shared_ptr<MyAABBItem>> IndexedAABBTreeTest::buildItems(unsigned int itemsCount) const {
+    std::vector<std::shared_ptr<MyAABBItem>> items;
+    items.reserve(itemsCount);
+    for (unsigned int i = 0; i < itemsCount; ++i) {
+        items.push_back(std::make_shared<MyAABBItem>("item" + std::to_string(i), Point3((float)i, 0.0f, 0.0f)));
+    }
+    return items;
+}
+
+std::vector<std::string> IndexedAABBTreeTest::aabboxQueryIds(const IndexedAABBTree<std::shared_ptr<MyAABBItem>>& tree, const AABBox<float>& queryBox) const {
+    std::vector<std::shared_ptr<MyAABBItem>> queryItems;
+    tree.aabboxQuery(queryBox, queryItems);
+
+    std::vector<std::string> queryIds;
+    queryIds.reserve(queryItems.size());
+    for (const auto& queryItem : queryItems) {
+        queryIds.push_back(queryItem->getId());
+    }
+    std::ranges::sort(queryIds, [](const std::string& id1, const std::string& id2) {
+        return id1.size() == id2.size() ? id1 < id2 : id1.size() < id2.size();
+    });
+    return queryIds;
+}
+
+CppUnit::Test* IndexedAABBTreeTest::suite() {
+    auto* suite = new CppUnit::TestSuite("IndexedAABBTreeTest");
+
+    suite->addTest(new CppUnit::TestCaller("balancedAfterSortedInsertion", &IndexedAABBTreeTest::balancedAfterSortedInsertion));
+    suite->addTest(new CppUnit::TestCaller("balancedAfterRemoval", &IndexedAABBTreeTest::balancedAfterRemoval));
+    suite->addTest(new CppUnit::TestCaller("reuseRemovedNodes", &IndexedAABBTreeTest::reuseRemovedNodes));
+    suite->addTest(new CppUnit::TestCaller("rebuildWithSah", &IndexedAABBTreeTest::rebuildWithSah));
+    suite->addTest(new CppUnit::TestCaller("rayQueries", &IndexedAABBTreeTest::rayQueries));
+    suite->addTest(new CppUnit::TestCaller("snapshotQueries", &IndexedAABBTreeTest::snapshotQueries));
+
+    return suite;
+}
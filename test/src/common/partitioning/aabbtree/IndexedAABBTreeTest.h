@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "common/partitioning/aabbtree/AABBTreeTest.h"
+
+class IndexedAABBTreeTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void balancedAfterSortedInsertion();
+        void balancedAfterRemoval();
+        void reuseRemovedNodes();
+        void rebuildWithSah();
+        void rayQueries();
+        void snapshotQueries();
+
+    private:
+        std::vector<std::shared_ptr<MyAABBItem>> buildItems(unsigned int) const;
+        std::vector<std::string> aabboxQueryIds(const urchin::IndexedAABBTree<std::shared_ptr<MyAABBItem>>&, const urchin::AABBox<float>&) const;
+};
@@ -0,0 +1,56 @@
+#include <cppunit/extensions/HelperMacros.h>
+#include <UrchinCommon.h>
+
+#include "common/profiler/LatencyHistogramTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void LatencyHistogramTest::bucketCounts() {
+    LatencyHistogram histogram(10);
+
+    histogram.registerLatency(0.00005f); //0.05ms
+    histogram.registerLatency(0.0003f); //0.3ms
+    histogram.registerLatency(0.0004f); //0.4ms
+    histogram.registerLatency(0.5f); //500ms
+
+    AssertHelper::assertUnsignedIntEquals(histogram.getLatenciesCount(), 4);
+    AssertHelper::assertUnsignedIntEquals(histogram.getBucketCount(0), 1); //[0-0.1ms]
+    AssertHelper::assertUnsignedIntEquals(histogram.getBucketCount(2), 2); //[0.25-0.5ms]
+    AssertHelper::assertUnsignedIntEquals(histogram.getBucketCount(histogram.getBucketsCount() - 1), 1); //[100ms-∞]
+    AssertHelper::assertFloatEquals(histogram.getMaxMs(), 500.0f);
+}
+
+void LatencyHistogramTest::rollingWindow() {
+    LatencyHistogram histogram(2);
+
+    histogram.registerLatency(0.05f); //50ms
+    histogram.registerLatency(0.0008f); //0.8ms
+    histogram.registerLatency(0.0008f); //0.8ms: evict the 50ms latency
+
+    AssertHelper::assertUnsignedIntEquals(histogram.getLatenciesCount(), 2);
+    AssertHelper::assertUnsignedIntEquals(histogram.getBucketCount(3), 2); //[0.5-1ms]
+    AssertHelper::assertUnsignedIntEquals(histogram.getBucketCount(9), 0); //[33-100ms]
+    AssertHelper::assertFloatEquals(histogram.getMaxMs(), 0.8f);
+}
+
+void LatencyHistogramTest::percentiles() {
+    LatencyHistogram histogram(100);
+    for (unsigned int i = 1; i <= 100; ++i) {
+        histogram.registerLatency((float)i / 1000.0f);
+    }
+
+    AssertHelper::assertFloatEquals(histogram.computePercentileMs(0.5f), 50.0f, 0.01f);
+    AssertHelper::assertFloatEquals(histogram.computePercentileMs(0.95f), 95.0f, 0.01f);
+    AssertHelper::assertFloatEquals(histogram.computePercentileMs(1.0f), 100.0f, 0.01f);
+    AssertHelper::assertFloatEquals(LatencyHistogram(10).computePercentileMs(0.5f), 0.0f);
+}
+
+CppUnit::Test* LatencyHistogramTest::suite() {
+    auto* suite = new CppUnit::TestSuite("LatencyHistogramTest");
+
+    suite->addTest(new CppUnit::TestCaller("bucketCounts", &LatencyHistogramTest::bucketCounts));
+    suite->addTest(new CppUnit::TestCaller("rollingWindow", &LatencyHistogramTest::rollingWindow));
+    suite->addTest(new CppUnit::TestCaller("percentiles", &LatencyHistogramTest::percentiles));
+
+    return suite;
+}
@@ -0,0 +1,51 @@
+#include <thread>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "common/system/thread/TripleBufferTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void TripleBufferTest::readLastPublishedBuffer() {
+    TripleBuffer<int> tripleBuffer;
+    tripleBuffer.getWriteBuffer() = 1;
+    tripleBuffer.publishWriteBuffer();
+    tripleBuffer.getWriteBuffer() = 2;
+    tripleBuffer.publishWriteBuffer();
+    tripleBuffer.getWriteBuffer() = 3; //not published
+
+    AssertHelper::assertIntEquals(tripleBuffer.getLatestReadBuffer(), 2);
+    AssertHelper::assertIntEquals(tripleBuffer.getLatestReadBuffer(), 2);
+}
+
+void TripleBufferTest::readConsistentBufferWhileWriting() {
+    constexpr int PUBLICATIONS_COUNT = 20000;
+    TripleBuffer<std::vector<int>> tripleBuffer;
+
+    std::jthread writerThread([&tripleBuffer]() {
+        for (int i = 1; i <= PUBLICATIONS_COUNT; ++i) {
+            tripleBuffer.getWriteBuffer().assign(64, i);
+            tripleBuffer.publishWriteBuffer();
+        }
+    });
+
+    int lastReadValue = 0;
+    while (lastReadValue != PUBLICATIONS_COUNT) {
+        const std::vector<int>& readBuffer = tripleBuffer.getLatestReadBuffer();
+        if (!readBuffer.empty()) {
+            AssertHelper::assertTrue(std::ranges::all_of(readBuffer, [&readBuffer](int value) { return value == readBuffer[0]; }), "Buffer modified while read");
+            AssertHelper::assertTrue(readBuffer[0] >= lastReadValue, "Older buffer read");
+            lastReadValue = readBuffer[0];
+        }
+    }
+}
+
+CppUnit::Test* TripleBufferTest::suite() {
+    auto* suite = new CppUnit::TestSuite("TripleBufferTest");
+
+    suite->addTest(new CppUnit::TestCaller("readLastPublishedBuffer", &TripleBufferTest::readLastPublishedBuffer));
+    suite->addTest(new CppUnit::TestCaller("readConsistentBufferWhileWriting", &TripleBufferTest::readConsistentBufferWhileWriting));
+
+    return suite;
+}
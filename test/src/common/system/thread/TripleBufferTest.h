@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class TripleBufferTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void readLastPublishedBuffer();
+        void readConsistentBufferWhileWriting();
+};
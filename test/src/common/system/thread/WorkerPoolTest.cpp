@@ -0,0 +1,68 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+
+#include "common/system/thread/WorkerPoolTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void WorkerPoolTest::processAllItemsOnce() {
+    WorkerPool workerPool(4);
+    std::vector<unsigned int> itemsWorkerIndex(1000, 999);
+
+    for (unsigned int jobIndex = 0; jobIndex < 10; ++jobIndex) { //check the workers are reusable
+        std::ranges::fill(itemsWorkerIndex, 999);
+        workerPool.parallelFor(itemsWorkerIndex.size(), 1, [&](unsigned int workerIndex, std::size_t beginItemIndex, std::size_t endItemIndex) {
+            for (std::size_t i = beginItemIndex; i < endItemIndex; ++i) {
+                itemsWorkerIndex[i] = workerIndex;
+            }
+        });
+
+        AssertHelper::assertUnsignedIntEquals(itemsWorkerIndex[0], 0);
+        AssertHelper::assertUnsignedIntEquals(itemsWorkerIndex[249], 0);
+        AssertHelper::assertUnsignedIntEquals(itemsWorkerIndex[250], 1);
+        AssertHelper::assertUnsignedIntEquals(itemsWorkerIndex[999], 3);
+        AssertHelper::assertTrue(std::ranges::is_sorted(itemsWorkerIndex), "Items must be split in contiguous ranges");
+    }
+}
+
+void WorkerPoolTest::smallJobOnCallingThread() {
+    WorkerPool workerPool(4);
+    std::thread::id callingThreadId = std::this_thread::get_id();
+    std::vector<std::thread::id> itemsThreadId(10);
+
+    workerPool.parallelFor(itemsThreadId.size(), 16, [&](unsigned int, std::size_t beginItemIndex, std::size_t endItemIndex) {
+        for (std::size_t i = beginItemIndex; i < endItemIndex; ++i) {
+            itemsThreadId[i] = std::this_thread::get_id();
+        }
+    });
+
+    AssertHelper::assertTrue(std::ranges::all_of(itemsThreadId, [&](std::thread::id threadId) { return threadId == callingThreadId; }));
+}
+
+void WorkerPoolTest::rethrowWorkerException() {
+    WorkerPool workerPool(4);
+
+    bool exceptionCaught = false;
+    try {
+        workerPool.parallelFor(100, 1, [](unsigned int workerIndex, std::size_t, std::size_t) {
+            if (workerIndex == 2) {
+                throw std::runtime_error("worker failure");
+            }
+        });
+    } catch (const std::runtime_error& e) {
+        exceptionCaught = std::string(e.what()) == "worker failure";
+    }
+
+    AssertHelper::assertTrue(exceptionCaught, "Exception of the worker must be rethrown in the calling thread");
+}
+
+CppUnit::Test* WorkerPoolTest::suite() {
+    auto* suite = new CppUnit::TestSuite("WorkerPoolTest");
+
+    suite->addTest(new CppUnit::TestCaller("processAllItemsOnce", &WorkerPoolTest::processAllItemsOnce));
+    suite->addTest(new CppUnit::TestCaller("smallJobOnCallingThread", &WorkerPoolTest::smallJobOnCallingThread));
+    suite->addTest(new CppUnit::TestCaller("rethrowWorkerException", &WorkerPoolTest::rethrowWorkerException));
+
+    return suite;
+}
@@ -1,3 +1,4 @@
+#include <thread>
 #include <cppunit/TestSuite.h>
 #include <cppunit/TestCaller.h>
 #include <UrchinCommon.h>
@@ -20,10 +21,109 @@ void BodyContainerTest::addAndRemoveBody() {
     AssertHelper::assertUnsignedIntEquals(bodyContainer->getBodies().size(), 0);
 }
 
+void BodyContainerTest::publishSnapshot() {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+    auto cubeBody = std::make_shared<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    cubeBody->setMass(1.0f);
+    bodyContainer->addBody(cubeBody);
+    bodyContainer->refreshBodies();
+    cubeBody->setIsActive(true);
+
+    cubeBody->setTransform(PhysicsTransform(Point3(1.0f, 0.0f, 0.0f), Quaternion<float>::rotationY(MathValue::PI_FLOAT / 2.0f))); //physics step
+    cubeBody->setVelocity(Vector3(2.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+    bodyContainer->publishSnapshot();
+
+    const BodySnapshot* bodySnapshot = bodyContainer->getLatestSnapshot().findBody(*cubeBody);
+    AssertHelper::assertNotNull(bodySnapshot);
+    AssertHelper::assertTrue(bodySnapshot->isActive);
+    AssertHelper::assertVector3FloatEquals(bodySnapshot->linearVelocity, Vector3(2.0f, 0.0f, 0.0f));
+    AssertHelper::assertVector3FloatEquals(bodySnapshot->angularVelocity, Vector3(0.0f, 1.0f, 0.0f));
+    PhysicsTransform interpolatedTransform = bodySnapshot->interpolateTransform(0.25f);
+    AssertHelper::assertPoint3FloatEquals(interpolatedTransform.getPosition(), Point3(0.25f, 0.0f, 0.0f));
+    AssertHelper::assertQuaternionFloatEquals(interpolatedTransform.getOrientation(), Quaternion<float>::rotationY(MathValue::PI_FLOAT / 8.0f));
+    AssertHelper::assertPoint3FloatEquals(bodySnapshot->interpolateTransform(1.0f).getPosition(), Point3(1.0f, 0.0f, 0.0f));
+}
+
+void BodyContainerTest::snapshotAfterManualMove() {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+    auto cubeBody = std::make_shared<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    cubeBody->setMass(1.0f);
+    bodyContainer->addBody(cubeBody);
+    bodyContainer->refreshBodies();
+    cubeBody->setIsActive(false); //sleeping body
+    bodyContainer->publishSnapshot();
+
+    std::jthread([&cubeBody]() { cubeBody->setTransform(PhysicsTransform(Point3(5.0f, 0.0f, 0.0f), Quaternion<float>())); }); //manual move: no interpolation
+    bodyContainer->refreshBodies();
+    bodyContainer->publishSnapshot();
+
+    const BodySnapshot* bodySnapshot = bodyContainer->getLatestSnapshot().findBody(*cubeBody);
+    AssertHelper::assertNotNull(bodySnapshot);
+    AssertHelper::assertTrue(bodySnapshot->isActive);
+    AssertHelper::assertPoint3FloatEquals(bodySnapshot->interpolateTransform(0.25f).getPosition(), Point3(5.0f, 0.0f, 0.0f));
+}
+
+void BodyContainerTest::snapshotOfRemovedBody() {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+    auto cubeBody = std::make_shared<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    bodyContainer->addBody(cubeBody);
+    bodyContainer->refreshBodies();
+    bodyContainer->publishSnapshot();
+    AssertHelper::assertNotNull(bodyContainer->getLatestSnapshot().findBody(*cubeBody));
+
+    bodyContainer->removeBody(*cubeBody);
+    bodyContainer->refreshBodies();
+    auto sphereBody = std::make_shared<RigidBody>("sphere", PhysicsTransform(Point3(5.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionSphereShape>(0.5f));
+    bodyContainer->addBody(sphereBody);
+    bodyContainer->refreshBodies();
+    bodyContainer->publishSnapshot();
+
+    const BodiesSnapshot& bodiesSnapshot = bodyContainer->getLatestSnapshot();
+    AssertHelper::assertUnsignedIntEquals(bodiesSnapshot.getBodies().size(), 1); //snapshot index of removed body reused
+    AssertHelper::assertNull(bodiesSnapshot.findBody(*cubeBody));
+    AssertHelper::assertNotNull(bodiesSnapshot.findBody(*sphereBody));
+    AssertHelper::assertPoint3FloatEquals(bodiesSnapshot.findBody(*sphereBody)->transform.getPosition(), Point3(5.0f, 0.0f, 0.0f));
+}
+
+void BodyContainerTest::snapshotOfSleepingBody() {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+    auto cubeBody = std::make_shared<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    cubeBody->setMass(1.0f);
+    auto groundBody = std::make_shared<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -1.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(5.0f, 0.5f, 5.0f)));
+    bodyContainer->addBody(cubeBody);
+    bodyContainer->addBody(groundBody);
+    bodyContainer->refreshBodies();
+    cubeBody->setIsActive(true);
+
+    for (int step = 1; step <= 5; ++step) { //each buffer of the triple buffer is written
+        cubeBody->setTransform(PhysicsTransform(Point3((float)step, 0.0f, 0.0f), Quaternion<float>())); //physics step
+        bodyContainer->refreshBodies();
+        bodyContainer->publishSnapshot();
+
+        const BodiesSnapshot& bodiesSnapshot = bodyContainer->getLatestSnapshot();
+        AssertHelper::assertPoint3FloatEquals(bodiesSnapshot.findBody(*cubeBody)->transform.getPosition(), Point3((float)step, 0.0f, 0.0f));
+        AssertHelper::assertNotNull(bodiesSnapshot.findBody(*groundBody));
+        AssertHelper::assertPoint3FloatEquals(bodiesSnapshot.findBody(*groundBody)->transform.getPosition(), Point3(0.0f, -1.0f, 0.0f));
+    }
+
+    cubeBody->setIsActive(false); //deactivated by the physics step
+    bodyContainer->publishSnapshot();
+    bodyContainer->refreshBodies();
+    bodyContainer->publishSnapshot();
+    bodyContainer->publishSnapshot();
+    const BodySnapshot* bodySnapshot = bodyContainer->getLatestSnapshot().findBody(*cubeBody);
+    AssertHelper::assertFalse(bodySnapshot->isActive);
+    AssertHelper::assertPoint3FloatEquals(bodySnapshot->interpolateTransform(0.25f).getPosition(), Point3(5.0f, 0.0f, 0.0f));
+}
+
 CppUnit::Test* BodyContainerTest::suite() {
     auto* suite = new CppUnit::TestSuite("BodyContainerTest");
 
     suite->addTest(new CppUnit::TestCaller("addSameBodyThrice", &BodyContainerTest::addAndRemoveBody));
+    suite->addTest(new CppUnit::TestCaller("publishSnapshot", &BodyContainerTest::publishSnapshot));
+    suite->addTest(new CppUnit::TestCaller("snapshotAfterManualMove", &BodyContainerTest::snapshotAfterManualMove));
+    suite->addTest(new CppUnit::TestCaller("snapshotOfRemovedBody", &BodyContainerTest::snapshotOfRemovedBody));
+    suite->addTest(new CppUnit::TestCaller("snapshotOfSleepingBody", &BodyContainerTest::snapshotOfSleepingBody));
 
     return suite;
 }
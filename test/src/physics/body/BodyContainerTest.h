@@ -8,4 +8,8 @@ class BodyContainerTest final : public CppUnit::TestFixture {
         static CppUnit::Test* suite();
 
         void addAndRemoveBody();
+        void publishSnapshot();
+        void snapshotAfterManualMove();
+        void snapshotOfRemovedBody();
+        void snapshotOfSleepingBody();
 };
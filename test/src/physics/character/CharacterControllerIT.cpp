@@ -141,6 +141,38 @@ void CharacterControllerIT::ccdMovingCharacter() {
     AssertHelper::assertFloatEquals(characterController.getPhysicsCharacter().getTransform().getPosition().Z, -9.75f, 0.15f);
 }
 
+void CharacterControllerIT::batchUpdateCharacters() {
+    auto physicsWorld = std::make_unique<PhysicsWorld>();
+    constructGround(*physicsWorld);
+    constructWall(*physicsWorld);
+    std::vector<std::shared_ptr<CharacterController>> characterControllers = constructWalkingCharacters(*physicsWorld);
+    auto batchPhysicsWorld = std::make_unique<PhysicsWorld>();
+    constructGround(*batchPhysicsWorld);
+    constructWall(*batchPhysicsWorld);
+    CharacterControllerSystem characterControllerSystem(*batchPhysicsWorld);
+    for (const auto& characterController : constructWalkingCharacters(*batchPhysicsWorld)) {
+        characterControllerSystem.addCharacterController(characterController);
+    }
+
+    for (std::size_t i = 0; i < 120; ++i) {
+        physicsWorld->getCollisionWorld().process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        for (const auto& characterController : characterControllers) {
+            characterController->update(1.0f / 60.0f);
+        }
+
+        batchPhysicsWorld->getCollisionWorld().process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        characterControllerSystem.update(1.0f / 60.0f);
+    }
+
+    AssertHelper::assertUnsignedIntEquals(characterControllerSystem.getCharacterControllers().size(), characterControllers.size());
+    for (std::size_t i = 0; i < characterControllers.size(); ++i) {
+        Point3<float> position = characterControllers[i]->getPhysicsCharacter().getTransform().getPosition();
+        Point3<float> batchPosition = characterControllerSystem.getCharacterControllers()[i]->getPhysicsCharacter().getTransform().getPosition();
+        AssertHelper::assertPoint3FloatEquals(batchPosition, position, 0.0001f);
+        AssertHelper::assertTrue(position.Z > -10.0f, "Character " + std::to_string(i) + " must be stopped by the wall");
+    }
+}
+
 void CharacterControllerIT::constructGround(PhysicsWorld& physicsWorld) const {
     std::vector groundPoints = {
             Point3(-100.0f, 0.0f, -100.0f), Point3(100.0f, 0.0f, -100.0f),
@@ -175,6 +207,26 @@ std::vector<std::shared_ptr<RigidBody>> CharacterControllerIT::constructCubes(Ph
     return cubes;
 }
 
+std::vector<std::shared_ptr<CharacterController>> CharacterControllerIT::constructWalkingCharacters(PhysicsWorld& physicsWorld) const {
+    std::vector<std::shared_ptr<CharacterController>> characterControllers;
+    for (unsigned int x = 0; x < 8; x++) {
+        for (unsigned int z = 0; z < 5; z++) {
+            auto characterShape = std::make_unique<CollisionCapsuleShape>(0.25f, 1.5f, CapsuleShape<float>::CapsuleOrientation::CAPSULE_Y);
+            PhysicsTransform characterTransform(Point3((float)x * 2.0f - 7.0f, 1.5f + (float)z * 0.5f, (float)z * 2.0f - 6.0f), Quaternion<float>());
+            auto character = std::make_unique<PhysicsCharacter>("character_" + std::to_string(x) + "_" + std::to_string(z), 80.0f, std::move(characterShape), characterTransform);
+            CharacterControllerConfig characterControllerConfig;
+            characterControllerConfig.setWalkSpeed(5.0f);
+            auto characterController = std::make_shared<CharacterController>(std::move(character), characterControllerConfig, physicsWorld);
+            characterController->walk(Vector3((float)x - 3.5f, 0.0f, -5.0f));
+            if (x % 3 == 0) {
+                characterController->jump();
+            }
+            characterControllers.push_back(std::move(characterController));
+        }
+    }
+    return characterControllers;
+}
+
 CppUnit::Test* CharacterControllerIT::suite() {
     auto* suite = new CppUnit::TestSuite("CharacterControllerIT");
 
@@ -184,5 +236,7 @@ CppUnit::Test* CharacterControllerIT::suite() {
     suite->addTest(new CppUnit::TestCaller("ccdFallingCharacter", &CharacterControllerIT::ccdFallingCharacter));
     suite->addTest(new CppUnit::TestCaller("ccdMovingCharacter", &CharacterControllerIT::ccdMovingCharacter));
 
+    suite->addTest(new CppUnit::TestCaller("batchUpdateCharacters", &CharacterControllerIT::batchUpdateCharacters));
+
     return suite;
 }
\ No newline at end of file
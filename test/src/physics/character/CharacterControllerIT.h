@@ -15,8 +15,11 @@ class CharacterControllerIT final : public CppUnit::TestFixture {
         void ccdFallingCharacter();
         void ccdMovingCharacter();
 
+        void batchUpdateCharacters();
+
     private:
         void constructGround(urchin::PhysicsWorld&) const;
         void constructWall(urchin::PhysicsWorld&) const;
         std::vector<std::shared_ptr<urchin::RigidBody>> constructCubes(urchin::PhysicsWorld&, float) const;
+        std::vector<std::shared_ptr<urchin::CharacterController>> constructWalkingCharacters(urchin::PhysicsWorld&) const;
 };
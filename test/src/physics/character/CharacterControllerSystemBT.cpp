@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "physics/character/CharacterControllerSystemBT.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+/**
+ * Crowd of characters walking on one terrain body while the physics thread is running: all the ghost bodies of the characters are paired with the same static body.
+ */
+void CharacterControllerSystemBT::crowdOnTerrain() {
+    auto physicsWorld = std::make_unique<PhysicsWorld>();
+    constructTerrain(*physicsWorld);
+    CharacterControllerSystem characterControllerSystem(*physicsWorld);
+    for (const auto& characterController : constructCrowd(*physicsWorld)) {
+        characterControllerSystem.addCharacterController(characterController);
+    }
+    physicsWorld->getCollisionWorld().process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f)); //pair the ghost bodies with the terrain
+
+    std::atomic_bool stopPhysics = false;
+    auto physicsEngineThread = std::jthread([&physicsWorld, &stopPhysics] {
+        while (!stopPhysics.load(std::memory_order_relaxed)) {
+            physicsWorld->getCollisionWorld().process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        }
+    });
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < FRAMES_COUNT; ++i) {
+        characterControllerSystem.update(1.0f / 60.0f);
+    }
+    auto updateDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    stopPhysics.store(true, std::memory_order_relaxed);
+    physicsEngineThread.join();
+
+    for (const auto& characterController : characterControllerSystem.getCharacterControllers()) {
+        AssertHelper::assertTrue(characterController->getPhysicsCharacter().getTransform().getPosition().Y > -1.0f, "Character must stay on the terrain");
+    }
+    auto charactersCount = (double)characterControllerSystem.getCharacterControllers().size();
+    std::cout << "Crowd of " << charactersCount << " characters on terrain: " << (double)updateDuration / FRAMES_COUNT << "ns/update, "
+              << (double)updateDuration / (FRAMES_COUNT * charactersCount) << "ns/character" << std::endl;
+}
+
+void CharacterControllerSystemBT::constructTerrain(PhysicsWorld& physicsWorld) const {
+    std::vector<Point3<float>> terrainPoints;
+    float halfSize = (float)TERRAIN_CELLS_COUNT / 2.0f;
+    for (unsigned int z = 0; z <= TERRAIN_CELLS_COUNT; ++z) {
+        for (unsigned int x = 0; x <= TERRAIN_CELLS_COUNT; ++x) {
+            float xValue = (float)x - halfSize;
+            float zValue = (float)z - halfSize;
+            terrainPoints.emplace_back(xValue, 0.2f * std::sin(xValue) * std::cos(zValue), zValue);
+        }
+    }
+    auto terrainShape = std::make_unique<CollisionHeightfieldShape>(terrainPoints, TERRAIN_CELLS_COUNT + 1, TERRAIN_CELLS_COUNT + 1);
+    auto terrainBody = std::make_unique<RigidBody>("terrain", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(terrainShape));
+    physicsWorld.getBodyContainer().addBody(std::move(terrainBody));
+}
+
+std::vector<std::shared_ptr<CharacterController>> CharacterControllerSystemBT::constructCrowd(PhysicsWorld& physicsWorld) const {
+    std::vector<std::shared_ptr<CharacterController>> characterControllers;
+    for (unsigned int x = 0; x < CROWD_SIZE; x++) {
+        for (unsigned int z = 0; z < CROWD_SIZE; z++) {
+            auto characterShape = std::make_unique<CollisionCapsuleShape>(0.25f, 1.5f, CapsuleShape<float>::CapsuleOrientation::CAPSULE_Y);
+            PhysicsTransform characterTransform(Point3((float)x * 2.0f - (float)CROWD_SIZE, 1.5f, (float)z * 2.0f - (float)CROWD_SIZE), Quaternion<float>());
+            auto character = std::make_unique<PhysicsCharacter>("character_" + std::to_string(x) + "_" + std::to_string(z), 80.0f, std::move(characterShape), characterTransform);
+            auto characterController = std::make_shared<CharacterController>(std::move(character), CharacterControllerConfig(), physicsWorld);
+            characterController->walk(Vector3(x % 2 == 0 ? 1.0f : -1.0f, 0.0f, z % 2 == 0 ? 1.0f : -1.0f));
+            characterControllers.push_back(std::move(characterController));
+        }
+    }
+    return characterControllers;
+}
+
+CppUnit::Test* CharacterControllerSystemBT::suite() {
+    auto* suite = new CppUnit::TestSuite("CharacterControllerSystemBT");
+
+    suite->addTest(new CppUnit::TestCaller("crowdOnTerrain", &CharacterControllerSystemBT::crowdOnTerrain));
+
+    return suite;
+}
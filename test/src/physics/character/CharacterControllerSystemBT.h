@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class CharacterControllerSystemBT final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void crowdOnTerrain();
+
+    private:
+        void constructTerrain(urchin::PhysicsWorld&) const;
+        std::vector<std::shared_ptr<urchin::CharacterController>> constructCrowd(urchin::PhysicsWorld&) const;
+
+        static constexpr unsigned int TERRAIN_CELLS_COUNT = 64;
+        static constexpr unsigned int CROWD_SIZE = 16; //number of characters on each axis
+        static constexpr unsigned int FRAMES_COUNT = 60;
+};
@@ -2,6 +2,7 @@
 #include <cppunit/TestCaller.h>
 #include <memory>
 #include <cstdio>
+#include <algorithm>
 
 #include "physics/collision/CollisionWorldIT.h"
 #include "AssertHelper.h"
@@ -56,6 +57,56 @@ void CollisionWorldIT::ccdBounceOnGroundAndRoof() {
     AssertHelper::assertTrue(cubeBody->getTransform().getPosition().Y < 10.0f);
 }
 
+void CollisionWorldIT::speculativeContactsPushOnGround() {
+    auto bodyContainer = buildWorld(Point3(0.0f, 5.0f, 0.0f));
+    auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
+    collisionWorld->getNarrowPhase().setSpeculativeContacts(true);
+    collisionWorld->process(1.0f / 1000.0f, Vector3(0.0f, 0.0f, 0.0f));
+    auto* cubeBody = static_cast<RigidBody*>(bodyContainer->getBodies()[1].get());
+    cubeBody->applyCentralMomentum(Vector3(0.0f, -1000.0f, 0.0f)); //apply extreme down force
+    cubeBody->setLinearFactor(Vector3(0.0f, 1.0f, 0.0f)); //avoid cube to go on outside world border
+    cubeBody->setAngularFactor(Vector3(0.0f, 0.0f, 0.0f)); //avoid cube to go on outside world border
+    cubeBody->setRestitution(0.0f); //no bounce: speculative contact must move the cube until the ground
+    bodyContainer->getBodies()[0]->setRestitution(0.0f);
+
+    for (std::size_t i = 0; i < 500; ++i) {
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        AssertHelper::assertTrue(cubeBody->getTransform().getPosition().Y > 0.4f); //ensure speculative contact point avoids penetration
+    }
+
+    AssertHelper::assertFloatEquals(cubeBody->getTransform().getPosition().Y, 0.5f, 0.1f);
+    AssertHelper::assertFalse(cubeBody->isActive(), "Body must become inactive when it doesn't move");
+}
+
+void CollisionWorldIT::speculativeContactsManyProjectiles() {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+    auto wallShape = std::make_unique<CollisionBoxShape>(Vector3(50.0f, 50.0f, 0.1f));
+    bodyContainer->addBody(std::make_unique<RigidBody>("wall", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(wallShape)));
+    std::vector<RigidBody*> projectiles;
+    for (unsigned int i = 0; i < 400; ++i) {
+        auto projectileShape = std::make_unique<CollisionSphereShape>(0.1f);
+        Point3 position(-20.0f + (float)(i % 20) * 2.0f, -20.0f + (float)(i / 20) * 2.0f, -5.0f);
+        auto projectileBody = std::make_unique<RigidBody>("projectile" + std::to_string(i), PhysicsTransform(position, Quaternion<float>()), std::move(projectileShape));
+        projectileBody->setMass(0.1f);
+        projectiles.push_back(projectileBody.get());
+        bodyContainer->addBody(std::move(projectileBody));
+    }
+    auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
+    collisionWorld->getNarrowPhase().setSpeculativeContacts(true);
+    collisionWorld->process(1.0f / 1000.0f, Vector3(0.0f, 0.0f, 0.0f));
+    for (RigidBody* projectile : projectiles) {
+        projectile->applyCentralMomentum(Vector3(0.0f, 0.0f, 50.0f)); //500 m/s: 8.3 meters by step
+    }
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, 0.0f, 0.0f));
+    }
+
+    for (const RigidBody* projectile : projectiles) {
+        AssertHelper::assertTrue(projectile->getTransform().getPosition().Z < -0.1f, "Projectile " + projectile->getId() + " must not go through the wall");
+    }
+}
+
 void CollisionWorldIT::fallForever() {
     Logger::instance().purge(); //Log file must be emptied before start this test
     auto bodyContainer = buildWorld(Point3(60.0f, 5.0f, 0.0f));
@@ -120,6 +171,29 @@ void CollisionWorldIT::changeMomentumOnInactiveBody() {
     AssertHelper::assertFalse(cubeBody->isActive(), "Body must become inactive when it doesn't move (2)");
 }
 
+void CollisionWorldIT::removeSupportOfInactiveBody() {
+    auto bodyContainer = buildWorld(Point3(0.0f, 0.5f, 0.0f));
+    auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
+
+    //1. make sure body is inactive on the ground
+    for (std::size_t i = 0; i < 25; ++i) {
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+    auto groundBody = bodyContainer->getBodies()[0];
+    auto cubeBody = bodyContainer->getBodies()[1];
+    AssertHelper::assertFalse(cubeBody->isActive(), "Body must become inactive when it doesn't move");
+    AssertHelper::assertTrue(bodyContainer->getActiveBodies().empty());
+
+    //2. remove the ground
+    bodyContainer->removeBody(*groundBody);
+    for (std::size_t i = 0; i < 25; ++i) {
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+    AssertHelper::assertTrue(cubeBody->isActive(), "Body must be woken up when its support is removed");
+    AssertHelper::assertUnsignedIntEquals(bodyContainer->getActiveBodies().size(), 1);
+    AssertHelper::assertTrue(cubeBody->getTransform().getPosition().Y < 0.0f);
+}
+
 void CollisionWorldIT::changeMass() {
     auto bodyContainer = buildWorld(Point3(0.0f, 10.0f, 0.0f));
     auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
@@ -147,6 +221,40 @@ void CollisionWorldIT::changeMass() {
     AssertHelper::assertFalse(cubeBody->isActive(), "Body must become inactive when it doesn't move");
 }
 
+void CollisionWorldIT::stepMetrics() {
+    auto bodyContainer = buildWorld(Point3(0.0f, 0.5f, 0.0f));
+    auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
+    const PhysicsMetrics& metrics = collisionWorld->getMetrics();
+
+    //1. cube in contact with the ground
+    collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    StepCounters stepCounters = metrics.getLastStepCounters();
+    AssertHelper::assertUnsignedIntEquals(stepCounters.overlappingPairs, 1);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.manifoldResults, 1);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.islands, 1);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.activeBodies, 1);
+    AssertHelper::assertTrue(stepCounters.constraints > 0);
+    AssertHelper::assertTrue(stepCounters.gjkIterations > 0);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.algorithmCalls[CollisionShape3D::BOX_SHAPE][CollisionShape3D::BOX_SHAPE], 1);
+    AssertHelper::assertTrue(metrics.toJson().find("\"box/box\":1") != std::string::npos);
+
+    //2. cube sleeping on the ground
+    for (std::size_t i = 0; i < 24; ++i) {
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+    stepCounters = metrics.getLastStepCounters();
+    AssertHelper::assertUnsignedIntEquals(metrics.getStepsCount(), 25);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.manifoldResults, 0);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.activeBodies, 0);
+    AssertHelper::assertUnsignedIntEquals(stepCounters.inactiveBodies, 2);
+    AssertHelper::assertUnsignedIntEquals(metrics.getPhaseHistogram(PhysicsMetrics::NARROW_PHASE).getLatenciesCount(), 25);
+    AssertHelper::assertUnsignedIntEquals(metrics.getStepHistogram().getLatenciesCount(), 25);
+
+    std::string csv = metrics.toCsv();
+    AssertHelper::assertUnsignedIntEquals((std::size_t)std::ranges::count(csv, '\n'), 26);
+    AssertHelper::assertTrue(metrics.toJson().find("\"narrowPhase\":{\"latenciesCount\":25") != std::string::npos);
+}
+
 void CollisionWorldIT::rayTestWithRemovedBody() {
     auto bodyContainer = buildWorld(Point3(0.0f, 0.5f, 0.0f));
     auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
@@ -171,6 +279,34 @@ void CollisionWorldIT::rayTestWithRemovedBody() {
     AssertHelper::assertPoint3FloatEquals(rayTestResult->getHitPointOnObject2(), Point3(0.0f, 0.5f, -0.5f), 0.01f);
 }
 
+void CollisionWorldIT::rayTestsMetrics() {
+    auto bodyContainer = buildWorld(Point3(0.0f, 0.5f, 0.0f));
+    auto collisionWorld = std::make_unique<CollisionWorld>(*bodyContainer);
+    const PhysicsMetrics& metrics = collisionWorld->getMetrics();
+    Ray<float> ray(Point3(0.0f, 0.5f, -100.0f), Point3(0.0f, 0.5f, 100.0f));
+
+    auto physicsThread = std::jthread([&] {
+        //1. ray tester executed after the step: counted in the step
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        auto rayTester = RayTester::newRayTester();
+        rayTester->updateRay(ray);
+        rayTester->execute(*collisionWorld);
+        AssertHelper::assertUnsignedIntEquals(metrics.getLastStepCounters().rayTests, 1);
+
+        //2. scene queries executed between two steps: counted in the next step
+        AssertHelper::assertTrue(collisionWorld->getSceneQuery().rayCast(ray).has_value());
+        AssertHelper::assertTrue(collisionWorld->getSceneQuery().rayCast(ray).has_value());
+        AssertHelper::assertUnsignedIntEquals(metrics.getLastStepCounters().rayTests, 1);
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        AssertHelper::assertUnsignedIntEquals(metrics.getLastStepCounters().rayTests, 2);
+
+        //3. no ray
+        collisionWorld->process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        AssertHelper::assertUnsignedIntEquals(metrics.getLastStepCounters().rayTests, 0);
+    });
+    physicsThread.join();
+}
+
 std::unique_ptr<BodyContainer> CollisionWorldIT::buildWorld(const Point3<float>& cubePosition) const {
     auto bodyContainer = std::make_unique<BodyContainer>();
 
@@ -192,14 +328,20 @@ CppUnit::Test* CollisionWorldIT::suite() {
     suite->addTest(new CppUnit::TestCaller("fallOnGround", &CollisionWorldIT::fallOnGround));
     suite->addTest(new CppUnit::TestCaller("ccdPushOnGround", &CollisionWorldIT::ccdPushOnGround));
     suite->addTest(new CppUnit::TestCaller("ccdBounceOnGroundAndRoof", &CollisionWorldIT::ccdBounceOnGroundAndRoof));
+    suite->addTest(new CppUnit::TestCaller("speculativeContactsPushOnGround", &CollisionWorldIT::speculativeContactsPushOnGround));
+    suite->addTest(new CppUnit::TestCaller("speculativeContactsManyProjectiles", &CollisionWorldIT::speculativeContactsManyProjectiles));
     suite->addTest(new CppUnit::TestCaller("fallForever", &CollisionWorldIT::fallForever));
 
     suite->addTest(new CppUnit::TestCaller("changePositionOnInactiveBody", &CollisionWorldIT::changePositionOnInactiveBody));
     suite->addTest(new CppUnit::TestCaller("changeMomentumOnInactiveBody", &CollisionWorldIT::changeMomentumOnInactiveBody));
+    suite->addTest(new CppUnit::TestCaller("removeSupportOfInactiveBody", &CollisionWorldIT::removeSupportOfInactiveBody));
 
     suite->addTest(new CppUnit::TestCaller("changeMass", &CollisionWorldIT::changeMass));
 
     suite->addTest(new CppUnit::TestCaller("rayTestWithRemovedBody", &CollisionWorldIT::rayTestWithRemovedBody));
 
+    suite->addTest(new CppUnit::TestCaller("stepMetrics", &CollisionWorldIT::stepMetrics));
+    suite->addTest(new CppUnit::TestCaller("rayTestsMetrics", &CollisionWorldIT::rayTestsMetrics));
+
     return suite;
 }
@@ -11,15 +11,21 @@ class CollisionWorldIT final : public CppUnit::TestFixture {
         void fallOnGround();
         void ccdPushOnGround();
         void ccdBounceOnGroundAndRoof();
+        void speculativeContactsPushOnGround();
+        void speculativeContactsManyProjectiles();
         void fallForever();
 
         void changePositionOnInactiveBody();
         void changeMomentumOnInactiveBody();
+        void removeSupportOfInactiveBody();
 
         void changeMass();
 
         void rayTestWithRemovedBody();
 
+        void stepMetrics();
+        void rayTestsMetrics();
+
     private:
         std::unique_ptr<urchin::BodyContainer> buildWorld(const urchin::Point3<float>&) const;
 };
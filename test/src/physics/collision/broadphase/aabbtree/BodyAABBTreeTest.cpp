@@ -12,6 +12,8 @@ void BodyAABBTreeTest::twoBodiesPairedAndRemove() {
     auto bodyA = std::make_shared<RigidBody>("bodyA", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(cubeShapeA));
     auto cubeShapeB = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
     auto bodyB = std::make_shared<RigidBody>("bodyB", PhysicsTransform(Point3(1.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(cubeShapeB));
+    bodyA->setMass(1.0f);
+    bodyB->setMass(1.0f);
     BodyAABBTree bodyAabbTree;
     bodyAabbTree.addBody(bodyA);
     bodyAabbTree.addBody(bodyB);
@@ -39,6 +41,100 @@ void BodyAABBTreeTest::twoBodiesNotPaired() {
     AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 0);
 }
 
+void BodyAABBTreeTest::twoStaticBodiesNotPaired() {
+    auto cubeShapeA = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_shared<RigidBody>("bodyA", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(cubeShapeA));
+    auto cubeShapeB = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+    auto bodyB = std::make_shared<RigidBody>("bodyB", PhysicsTransform(Point3(1.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(cubeShapeB));
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(bodyA);
+    bodyAabbTree.addBody(bodyB);
+
+    AssertHelper::assertFalse(bodyAabbTree.isInDynamicTree(*bodyA));
+    AssertHelper::assertFalse(bodyAabbTree.isInDynamicTree(*bodyB));
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
+void BodyAABBTreeTest::bodyActivatedAndDeactivated() {
+    auto cubeShapeA = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_shared<RigidBody>("bodyA", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(cubeShapeA));
+    auto cubeShapeB = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+    auto bodyB = std::make_shared<RigidBody>("bodyB", PhysicsTransform(Point3(1.0f, 0.0f, 0.0f), Quaternion<float>()), std::move(cubeShapeB));
+    bodyB->setMass(1.0f);
+    bodyB->setIsActive(false);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(bodyA);
+    bodyAabbTree.addBody(bodyB);
+    AssertHelper::assertFalse(bodyAabbTree.isInDynamicTree(*bodyB));
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 0);
+
+    //activate body test:
+    bodyB->setIsActive(true);
+    bodyAabbTree.updateBodyState(*bodyB);
+    AssertHelper::assertTrue(bodyAabbTree.isInDynamicTree(*bodyB));
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 1);
+    AssertHelper::assertStringEquals(bodyAabbTree.getOverlappingPairs()[0]->getBody1().getId(), "bodyB");
+
+    //deactivate body test:
+    bodyB->setIsActive(false);
+    bodyAabbTree.updateBodyState(*bodyB);
+    AssertHelper::assertFalse(bodyAabbTree.isInDynamicTree(*bodyB));
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 1); //pairs kept while the body sleeps
+
+    //remove a body test:
+    bodyAabbTree.removeBody(*bodyB);
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
+void BodyAABBTreeTest::removeBodyWakesUpPairedBodies() {
+    auto bodyA = std::make_shared<RigidBody>("bodyA", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    auto bodyB = std::make_shared<RigidBody>("bodyB", PhysicsTransform(Point3(0.0f, 1.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    auto bodyC = std::make_shared<RigidBody>("bodyC", PhysicsTransform(Point3(10.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    auto bodyD = std::make_shared<RigidBody>("bodyD", PhysicsTransform(Point3(10.0f, 1.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    BodyAABBTree bodyAabbTree;
+    for (const auto& body : {bodyA, bodyB, bodyC, bodyD}) {
+        body->setMass(1.0f);
+        bodyAabbTree.addBody(body);
+    }
+    for (const auto& body : {bodyA, bodyB, bodyC, bodyD}) {
+        body->setIsActive(false);
+        bodyAabbTree.updateBodyState(*body);
+    }
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 2); //pairs kept while the bodies sleep
+
+    bodyAabbTree.removeBody(*bodyA);
+    AssertHelper::assertTrue(bodyB->isActive());
+    AssertHelper::assertFalse(bodyC->isActive());
+    AssertHelper::assertFalse(bodyD->isActive());
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 1);
+    AssertHelper::assertObjectEquals(&bodyAabbTree.getOverlappingPairs()[0]->getBody1(), bodyD.get());
+
+    bodyAabbTree.removeBody(*bodyC);
+    AssertHelper::assertTrue(bodyD->isActive());
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
+void BodyAABBTreeTest::moveStaticBodyWakesUpPairedBodies() {
+    auto groundBody = std::make_shared<RigidBody>("ground", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(5.0f, 0.5f, 5.0f)));
+    auto bodyA = std::make_shared<RigidBody>("bodyA", PhysicsTransform(Point3(0.0f, 1.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    auto bodyB = std::make_shared<RigidBody>("bodyB", PhysicsTransform(Point3(20.0f, 1.0f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(groundBody);
+    for (const auto& body : {bodyA, bodyB}) {
+        body->setMass(1.0f);
+        bodyAabbTree.addBody(body);
+        body->setIsActive(false);
+        bodyAabbTree.updateBodyState(*body);
+    }
+    AssertHelper::assertUnsignedIntEquals(bodyAabbTree.getOverlappingPairs().size(), 1); //pair kept while the body sleeps
+
+    groundBody->setTransform(PhysicsTransform(Point3(0.0f, -10.0f, 0.0f), Quaternion<float>())); //manual move out of the fat AABBox
+    bodyAabbTree.updateBodyState(*groundBody);
+
+    AssertHelper::assertTrue(bodyA->isActive());
+    AssertHelper::assertFalse(bodyB->isActive());
+}
+
 void BodyAABBTreeTest::oneGhostBodyAndRemoveIt() {
     oneGhostBodyAndRemove(true);
 }
@@ -155,6 +251,10 @@ CppUnit::Test* BodyAABBTreeTest::suite() {
 
     suite->addTest(new CppUnit::TestCaller("twoBodiesPairedAndRemove", &BodyAABBTreeTest::twoBodiesPairedAndRemove));
     suite->addTest(new CppUnit::TestCaller("twoBodiesNotPaired", &BodyAABBTreeTest::twoBodiesNotPaired));
+    suite->addTest(new CppUnit::TestCaller("twoStaticBodiesNotPaired", &BodyAABBTreeTest::twoStaticBodiesNotPaired));
+    suite->addTest(new CppUnit::TestCaller("bodyActivatedAndDeactivated", &BodyAABBTreeTest::bodyActivatedAndDeactivated));
+    suite->addTest(new CppUnit::TestCaller("removeBodyWakesUpPairedBodies", &BodyAABBTreeTest::removeBodyWakesUpPairedBodies));
+    suite->addTest(new CppUnit::TestCaller("moveStaticBodyWakesUpPairedBodies", &BodyAABBTreeTest::moveStaticBodyWakesUpPairedBodies));
 
     suite->addTest(new CppUnit::TestCaller("oneGhostBodyAndRemoveIt", &BodyAABBTreeTest::oneGhostBodyAndRemoveIt));
     suite->addTest(new CppUnit::TestCaller("oneGhostBodyAndRemoveOther", &BodyAABBTreeTest::oneGhostBodyAndRemoveOther));
@@ -9,6 +9,10 @@ class BodyAABBTreeTest final : public CppUnit::TestFixture {
 
          void twoBodiesPairedAndRemove();
          void twoBodiesNotPaired();
+         void twoStaticBodiesNotPaired();
+         void bodyActivatedAndDeactivated();
+         void removeBodyWakesUpPairedBodies();
+         void moveStaticBodyWakesUpPairedBodies();
 
          void oneGhostBodyAndRemoveIt();
          void oneGhostBodyAndRemoveOther();
@@ -0,0 +1,105 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "physics/collision/constraintsolver/ConstraintSolverTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void ConstraintSolverTest::sameResultWhateverWorkersCount() {
+    std::vector<std::string> singleWorkerVelocities = solveCubePiles(1);
+    std::vector<std::string> multipleWorkersVelocities = solveCubePiles(4);
+
+    AssertHelper::assertUnsignedIntEquals(singleWorkerVelocities.size(), 40 * 3);
+    AssertHelper::assertTrue(singleWorkerVelocities == multipleWorkersVelocities, "Bodies velocities must be identical whatever the number of workers");
+}
+
+void ConstraintSolverTest::fullDistanceBiasOnlyForSpeculativeContacts() {
+    float speculativeVelocityY = solvePredictiveContact(true);
+    float predictiveVelocityY = solvePredictiveContact(false);
+
+    AssertHelper::assertFloatEquals(speculativeVelocityY, -30.0f, 0.01f); //move of the full distance (0.5) in the step
+    AssertHelper::assertFloatEquals(predictiveVelocityY, 0.0f, 0.01f); //stop at the current distance
+}
+
+/**
+ * Solve a predictive contact between a sphere falling at 60m/s and the ground located at 0.5 below the sphere
+ * @return Sphere vertical velocity after constraints solving
+ */
+float ConstraintSolverTest::solvePredictiveContact(bool speculativeContact) const {
+    BodyContainer bodyContainer;
+    auto groundShape = std::make_unique<CollisionBoxShape>(Vector3(5.0f, 0.5f, 5.0f));
+    auto groundBody = std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f), Quaternion<float>()), std::move(groundShape));
+    groundBody->setRestitution(0.0f);
+    RigidBody& ground = *groundBody;
+    bodyContainer.addBody(std::move(groundBody));
+    auto sphereShape = std::make_unique<CollisionSphereShape>(0.5f);
+    auto sphereBody = std::make_unique<RigidBody>("sphere", PhysicsTransform(Point3(0.0f, 1.0f, 0.0f), Quaternion<float>()), std::move(sphereShape));
+    sphereBody->setMass(1.0f);
+    sphereBody->setRestitution(0.0f); //no bounce
+    sphereBody->setVelocity(Vector3(0.0f, -60.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f));
+    RigidBody& sphere = *sphereBody;
+    bodyContainer.addBody(std::move(sphereBody));
+    bodyContainer.refreshBodies();
+
+    ManifoldResult manifoldResult(sphere, ground);
+    if (speculativeContact) {
+        manifoldResult.markAsSpeculative();
+    }
+    manifoldResult.addContactPoint(Vector3(0.0f, 1.0f, 0.0f), Point3(0.0f, 0.0f, 0.0f), 0.5f, true);
+    std::vector<ManifoldResult> manifoldResults = {manifoldResult};
+
+    WorkerPool workerPool(1);
+    ConstraintSolver constraintSolver(workerPool);
+    constraintSolver.process(1.0f / 60.0f, manifoldResults, {});
+
+    return sphere.getLinearVelocity().Y;
+}
+
+/**
+ * Solve the constraints of 40 separate piles of 3 cubes falling on the ground
+ * @return Description of the cubes velocities after constraints solving
+ */
+std::vector<std::string> ConstraintSolverTest::solveCubePiles(unsigned int workersCount) const {
+    BodyContainer bodyContainer;
+    auto groundShape = std::make_unique<CollisionBoxShape>(Vector3(200.0f, 0.5f, 5.0f));
+    bodyContainer.addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f), Quaternion<float>()), std::move(groundShape)));
+    std::vector<RigidBody*> cubeBodies;
+    for (unsigned int pileIndex = 0; pileIndex < 40; ++pileIndex) {
+        for (unsigned int cubeIndex = 0; cubeIndex < 3; ++cubeIndex) {
+            auto cubeShape = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+            Point3 cubePosition(-100.0f + (float)pileIndex * 5.0f, 0.49f + (float)cubeIndex * 0.99f, 0.0f);
+            auto cubeBody = std::make_unique<RigidBody>("cube" + std::to_string(pileIndex) + "_" + std::to_string(cubeIndex), PhysicsTransform(cubePosition, Quaternion<float>()), std::move(cubeShape));
+            cubeBody->setMass(1.0f);
+            cubeBody->setVelocity(Vector3(0.1f * (float)cubeIndex, -1.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f));
+            cubeBodies.push_back(cubeBody.get());
+            bodyContainer.addBody(std::move(cubeBody));
+        }
+    }
+    BroadPhase broadPhase(bodyContainer);
+    bodyContainer.refreshBodies();
+
+    WorkerPool workerPool(workersCount);
+    NarrowPhase narrowPhase(bodyContainer, broadPhase, workerPool);
+    ConstraintSolver constraintSolver(workerPool);
+    std::vector<ManifoldResult> manifoldResults;
+    narrowPhase.process(1.0f / 60.0f, broadPhase.computeOverlappingPairs(), manifoldResults);
+    constraintSolver.process(1.0f / 60.0f, manifoldResults, {});
+
+    std::vector<std::string> velocitiesDescription;
+    for (const RigidBody* cubeBody : cubeBodies) {
+        std::stringstream velocityStream;
+        velocityStream.precision(std::numeric_limits<float>::max_digits10);
+        velocityStream << cubeBody->getId() << ":" << cubeBody->getLinearVelocity() << "/" << cubeBody->getAngularVelocity();
+        velocitiesDescription.push_back(velocityStream.str());
+    }
+    return velocitiesDescription;
+}
+
+CppUnit::Test* ConstraintSolverTest::suite() {
+    auto* suite = new CppUnit::TestSuite("ConstraintSolverTest");
+
+    suite->addTest(new CppUnit::TestCaller("sameResultWhateverWorkersCount", &ConstraintSolverTest::sameResultWhateverWorkersCount));
+    suite->addTest(new CppUnit::TestCaller("fullDistanceBiasOnlyForSpeculativeContacts", &ConstraintSolverTest::fullDistanceBiasOnlyForSpeculativeContacts));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class ConstraintSolverTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void sameResultWhateverWorkersCount();
+        void fullDistanceBiasOnlyForSpeculativeContacts();
+
+    private:
+        std::vector<std::string> solveCubePiles(unsigned int) const;
+        float solvePredictiveContact(bool) const;
+};
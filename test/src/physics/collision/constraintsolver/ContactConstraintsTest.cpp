@@ -0,0 +1,83 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "physics/collision/constraintsolver/ContactConstraintsTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void ContactConstraintsTest::laneSolvingSameAsSequentialSolving() {
+    std::vector<std::pair<Vector3<float>, Vector3<float>>> laneVelocities = solveFallingCubes(true);
+    std::vector<std::pair<Vector3<float>, Vector3<float>>> sequentialVelocities = solveFallingCubes(false);
+
+    AssertHelper::assertUnsignedIntEquals(laneVelocities.size(), 11);
+    for (std::size_t i = 0; i < laneVelocities.size(); ++i) {
+        AssertHelper::assertVector3FloatEquals(laneVelocities[i].first, sequentialVelocities[i].first);
+        AssertHelper::assertVector3FloatEquals(laneVelocities[i].second, sequentialVelocities[i].second);
+
+        Vector3 contactPointVelocity = laneVelocities[i].first + laneVelocities[i].second.crossProduct(Vector3(0.5f, -0.5f, 0.5f));
+        AssertHelper::assertFloatEquals(contactPointVelocity.Y, 0.0f); //cube stop to fall at contact point
+    }
+}
+
+/**
+ * Solve the contacts of 11 cubes falling on the ground with one contact point by cube (more cubes than a lane)
+ * @return Linear and angular velocities of the cubes after constraints solving
+ */
+std::vector<std::pair<Vector3<float>, Vector3<float>>> ContactConstraintsTest::solveFallingCubes(bool independentContacts) const {
+    auto ground = std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(50.0f, 0.5f, 5.0f)));
+    std::vector<std::unique_ptr<RigidBody>> cubes;
+    std::vector<ManifoldContactPoint> contactPoints;
+    for (unsigned int i = 0; i < 11; ++i) {
+        Point3 cubePosition(-25.0f + (float)i * 4.0f, 0.5f, 0.0f);
+        cubes.push_back(std::make_unique<RigidBody>("cube" + std::to_string(i), PhysicsTransform(cubePosition, Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f))));
+        cubes.back()->setMass(1.0f);
+        cubes.back()->setVelocity(Vector3(0.1f * (float)i, -1.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f));
+
+        Point3 contactPoint = cubePosition.translate(Vector3(0.5f, -0.5f, 0.5f));
+        contactPoints.emplace_back(Vector3(0.0f, 1.0f, 0.0f), contactPoint, contactPoint, Point3(0.5f, -0.5f, 0.5f), Point3(0.0f, 0.5f, 0.0f), 0.0f, false);
+    }
+
+    SolvingBodies solvingBodies;
+    ContactConstraints contactConstraints(solvingBodies);
+    for (std::size_t i = 0; i < cubes.size(); ++i) {
+        CommonSolvingData commonData(*cubes[i], *ground);
+        commonData.invInertia1 = cubes[i]->getInvWorldInertia();
+        commonData.invInertia2 = ground->getInvWorldInertia();
+        commonData.r1 = Vector3(0.5f, -0.5f, 0.5f);
+        commonData.r2 = ground->getTransform().getPosition().vector(contactPoints[i].getPointOnObject2());
+        commonData.depth = 0.0f;
+        commonData.contactNormal = Vector3(0.0f, 1.0f, 0.0f);
+        commonData.contactTangent = Vector3(-1.0f, 0.0f, 0.0f);
+
+        ImpulseSolvingData impulseData;
+        impulseData.friction = 0.5f;
+        impulseData.bias = 0.0f;
+        impulseData.normalImpulseDenominator = cubes[i]->getInvMass() + (commonData.invInertia1 * commonData.r1.crossProduct(commonData.contactNormal).crossProduct(commonData.r1)).dotProduct(commonData.contactNormal);
+        impulseData.tangentImpulseDenominator = cubes[i]->getInvMass() + (commonData.invInertia1 * commonData.r1.crossProduct(commonData.contactTangent).crossProduct(commonData.r1)).dotProduct(commonData.contactTangent);
+
+        uint32_t cubeIndex = solvingBodies.addMovingBody(*cubes[i]);
+        uint32_t groundIndex = solvingBodies.addStaticBody(*ground);
+        contactConstraints.addContact(cubeIndex, groundIndex, contactPoints[i], commonData, impulseData);
+    }
+
+    for (unsigned int iteration = 0; iteration < 10; ++iteration) {
+        contactConstraints.solveTangentConstraints(0, contactConstraints.getContactsCount(), independentContacts);
+        contactConstraints.solveNormalConstraints(0, contactConstraints.getContactsCount(), independentContacts);
+    }
+    contactConstraints.storeResults();
+    solvingBodies.storeResults();
+
+    std::vector<std::pair<Vector3<float>, Vector3<float>>> velocities;
+    for (const auto& cube : cubes) {
+        velocities.emplace_back(cube->getLinearVelocity(), cube->getAngularVelocity());
+    }
+    return velocities;
+}
+
+CppUnit::Test* ContactConstraintsTest::suite() {
+    auto* suite = new CppUnit::TestSuite("ContactConstraintsTest");
+
+    suite->addTest(new CppUnit::TestCaller("laneSolvingSameAsSequentialSolving", &ContactConstraintsTest::laneSolvingSameAsSequentialSolving));
+
+    return suite;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class ContactConstraintsTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void laneSolvingSameAsSequentialSolving();
+
+    private:
+        std::vector<std::pair<urchin::Vector3<float>, urchin::Vector3<float>>> solveFallingCubes(bool) const;
+};
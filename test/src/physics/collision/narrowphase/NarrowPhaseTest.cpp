@@ -0,0 +1,150 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "physics/collision/narrowphase/NarrowPhaseTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void NarrowPhaseTest::sameResultWhateverWorkersCount() {
+    std::vector<std::string> singleWorkerResults = processNarrowPhase(1);
+    std::vector<std::string> multipleWorkersResults = processNarrowPhase(4);
+
+    AssertHelper::assertUnsignedIntEquals(singleWorkerResults.size(), 100 /* cubes on ground */ + 2 * 9 * 10 /* cubes side by side */ + 2 * 9 * 9 /* cubes in diagonal */);
+    AssertHelper::assertTrue(singleWorkerResults == multipleWorkersResults, "Manifold results must be identical whatever the number of workers");
+}
+
+void NarrowPhaseTest::reuseCollisionResultOfRestingBodies() {
+    BodyContainer bodyContainer;
+    bodyContainer.addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(50.0f, 0.5f, 50.0f))));
+    auto cubeBody = std::make_unique<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.49f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    cubeBody->setMass(1.0f);
+    RigidBody& cube = *cubeBody;
+    bodyContainer.addBody(std::move(cubeBody));
+    BroadPhase broadPhase(bodyContainer);
+    bodyContainer.refreshBodies();
+    WorkerPool workerPool(1);
+    NarrowPhase narrowPhase(bodyContainer, broadPhase, workerPool);
+    std::vector<ManifoldResult> manifoldResults;
+    const std::vector<std::unique_ptr<OverlappingPair>>& overlappingPairs = broadPhase.computeOverlappingPairs();
+
+    narrowPhase.process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+    AssertHelper::assertUnsignedIntEquals(overlappingPairs.size(), 1);
+    Point3<float> collisionRelativePosition = overlappingPairs[0]->getCollisionRelativeTransform()->getPosition();
+
+    cube.setTransform(PhysicsTransform(Point3(0.0f, 0.4895f, 0.0f), Quaternion<float>())); //small move: collision result is reused
+    manifoldResults.clear();
+    narrowPhase.process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+    AssertHelper::assertPoint3FloatEquals(overlappingPairs[0]->getCollisionRelativeTransform()->getPosition(), collisionRelativePosition);
+    AssertHelper::assertUnsignedIntEquals(manifoldResults.size(), 1);
+    AssertHelper::assertFloatEquals(manifoldResults[0].getManifoldContactPoint(0).getDepth(), -0.0105f, 0.0001f);
+
+    cube.setTransform(PhysicsTransform(Point3(0.0f, 0.48f, 0.0f), Quaternion<float>())); //big move: collision algorithm is executed
+    manifoldResults.clear();
+    narrowPhase.process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+    AssertHelper::assertFloatEquals(std::abs(overlappingPairs[0]->getCollisionRelativeTransform()->getPosition().Y), 0.98f);
+    AssertHelper::assertUnsignedIntEquals(manifoldResults.size(), 1);
+    AssertHelper::assertFloatEquals(manifoldResults[0].getManifoldContactPoint(0).getDepth(), -0.02f, 0.0001f);
+}
+
+void NarrowPhaseTest::keepAccumulatedSolvingData() {
+    BodyContainer bodyContainer;
+    bodyContainer.addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(50.0f, 0.5f, 50.0f))));
+    auto cubeBody = std::make_unique<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.49f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    cubeBody->setMass(1.0f);
+    RigidBody& cube = *cubeBody;
+    bodyContainer.addBody(std::move(cubeBody));
+    BroadPhase broadPhase(bodyContainer);
+    bodyContainer.refreshBodies();
+    WorkerPool workerPool(1);
+    NarrowPhase narrowPhase(bodyContainer, broadPhase, workerPool);
+    std::vector<ManifoldResult> manifoldResults;
+    const std::vector<std::unique_ptr<OverlappingPair>>& overlappingPairs = broadPhase.computeOverlappingPairs();
+
+    narrowPhase.process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+    AssertHelper::assertUnsignedIntEquals(manifoldResults.size(), 1);
+    for (unsigned int i = 0; i < manifoldResults[0].getNumContactPoints(); ++i) { //simulate constraint solver
+        manifoldResults[0].getManifoldContactPoint(i).getAccumulatedSolvingData().accNormalImpulse = -1.5f;
+    }
+    narrowPhase.storeAccumulatedSolvingData(manifoldResults);
+
+    cube.setTransform(PhysicsTransform(Point3(0.0f, 0.485f, 0.0f), Quaternion<float>())); //collision algorithm is executed and replaces the contact points
+    manifoldResults.clear();
+    narrowPhase.process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+    AssertHelper::assertUnsignedIntEquals(manifoldResults.size(), 1);
+    AssertHelper::assertUnsignedIntEquals(manifoldResults[0].getNumContactPoints(), 1);
+    AssertHelper::assertFloatEquals(manifoldResults[0].getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse, -1.5f);
+}
+
+void NarrowPhaseTest::concaveAgainstConcaveShapes() {
+    std::vector<Point3<float>> groundVertices;
+    for (unsigned int z = 0; z <= 8; ++z) {
+        for (unsigned int x = 0; x <= 8; ++x) {
+            groundVertices.emplace_back((float)x - 4.0f, 0.0f, (float)z - 4.0f);
+        }
+    }
+    RigidBody groundBody("ground", PhysicsTransform(), std::make_unique<CollisionHeightfieldShape>(groundVertices, 9, 9));
+    std::vector<Point3<float>> pyramidVertices = {Point3(-0.5f, 0.0f, -0.5f), Point3(0.5f, 0.0f, -0.5f), Point3(0.5f, 0.0f, 0.5f), Point3(-0.5f, 0.0f, 0.5f), Point3(0.0f, 1.0f, 0.0f)};
+    std::vector<IndexedTriangle3D<float>> pyramidTriangles = {{0, 2, 1}, {0, 3, 2}, {0, 1, 4}, {1, 2, 4}, {2, 3, 4}, {3, 0, 4}};
+    RigidBody pyramidBody("pyramid", PhysicsTransform(Point3(0.3f, -0.01f, 0.3f), Quaternion<float>()),
+            std::make_unique<CollisionTriangleMeshShape>(std::move(pyramidVertices), std::move(pyramidTriangles)));
+
+    AlgorithmCounters algorithmCounters;
+    CollisionAlgorithmSelector collisionAlgorithmSelector(algorithmCounters);
+    auto collisionAlgorithm = collisionAlgorithmSelector.createCollisionAlgorithm(groundBody, groundBody.getShape(), pyramidBody, pyramidBody.getShape());
+    collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(groundBody.getShape(), groundBody.getTransform()),
+            CollisionObjectWrapper(pyramidBody.getShape(), pyramidBody.getTransform()), false);
+
+    const ManifoldResult& manifoldResult = collisionAlgorithm->getConstManifoldResult();
+    AssertHelper::assertTrue(manifoldResult.getNumContactPoints() > 0, "Pyramid base must collide with the ground");
+    for (unsigned int i = 0; i < manifoldResult.getNumContactPoints(); ++i) {
+        const ManifoldContactPoint& contactPoint = manifoldResult.getManifoldContactPoint(i);
+        AssertHelper::assertFloatEquals(contactPoint.getDepth(), -0.01f, 0.001f);
+        AssertHelper::assertFloatEquals(contactPoint.getPointOnObject1().Y, 0.0f, 0.011f);
+        AssertHelper::assertTrue(std::abs(contactPoint.getPointOnObject1().X - 0.3f) <= 0.51f && std::abs(contactPoint.getPointOnObject1().Z - 0.3f) <= 0.51f, "Contact point must be below the pyramid base");
+    }
+}
+
+/**
+ * @return Description of the manifold results in their order
+ */
+std::vector<std::string> NarrowPhaseTest::processNarrowPhase(unsigned int workersCount) const {
+    BodyContainer bodyContainer;
+    auto groundShape = std::make_unique<CollisionBoxShape>(Vector3(50.0f, 0.5f, 50.0f));
+    bodyContainer.addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f), Quaternion<float>()), std::move(groundShape)));
+    for (unsigned int x = 0; x < 10; ++x) {
+        for (unsigned int z = 0; z < 10; ++z) {
+            auto cubeShape = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+            Point3 cubePosition((float)x * 0.99f, 0.49f, (float)z * 0.99f);
+            auto cubeBody = std::make_unique<RigidBody>("cube" + std::to_string(x) + "_" + std::to_string(z), PhysicsTransform(cubePosition, Quaternion<float>()), std::move(cubeShape));
+            cubeBody->setMass(1.0f);
+            bodyContainer.addBody(std::move(cubeBody));
+        }
+    }
+    BroadPhase broadPhase(bodyContainer);
+    bodyContainer.refreshBodies();
+    WorkerPool workerPool(workersCount);
+    NarrowPhase narrowPhase(bodyContainer, broadPhase, workerPool);
+    std::vector<ManifoldResult> manifoldResults;
+    narrowPhase.process(1.0f / 60.0f, broadPhase.computeOverlappingPairs(), manifoldResults);
+
+    std::vector<std::string> manifoldResultsDescription;
+    for (const ManifoldResult& manifoldResult : manifoldResults) {
+        std::string description = manifoldResult.getBody1().getId() + "-" + manifoldResult.getBody2().getId() + ":" + std::to_string(manifoldResult.getNumContactPoints());
+        for (unsigned int i = 0; i < manifoldResult.getNumContactPoints(); ++i) {
+            description += ";" + std::to_string(manifoldResult.getManifoldContactPoint(i).getDepth());
+        }
+        manifoldResultsDescription.push_back(description);
+    }
+    return manifoldResultsDescription;
+}
+
+CppUnit::Test* NarrowPhaseTest::suite() {
+    auto* suite = new CppUnit::TestSuite("NarrowPhaseTest");
+
+    suite->addTest(new CppUnit::TestCaller("sameResultWhateverWorkersCount", &NarrowPhaseTest::sameResultWhateverWorkersCount));
+    suite->addTest(new CppUnit::TestCaller("reuseCollisionResultOfRestingBodies", &NarrowPhaseTest::reuseCollisionResultOfRestingBodies));
+    suite->addTest(new CppUnit::TestCaller("keepAccumulatedSolvingData", &NarrowPhaseTest::keepAccumulatedSolvingData));
+    suite->addTest(new CppUnit::TestCaller("concaveAgainstConcaveShapes", &NarrowPhaseTest::concaveAgainstConcaveShapes));
+
+    return suite;
+}
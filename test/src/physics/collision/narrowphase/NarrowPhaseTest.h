@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class NarrowPhaseTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void sameResultWhateverWorkersCount();
+        void reuseCollisionResultOfRestingBodies();
+        void keepAccumulatedSolvingData();
+        void concaveAgainstConcaveShapes();
+
+    private:
+        std::vector<std::string> processNarrowPhase(unsigned int) const;
+};
@@ -0,0 +1,139 @@
+#include <chrono>
+#include <iostream>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "physics/collision/narrowphase/algorithm/GJKEPAAlgorithmBT.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+/**
+ * Compare GJK executed from scratch with GJK using the separating axis of the previous frame on objects closer than the contact breaking threshold:
+ * the early-out cannot apply and the full algorithm is executed as in the narrow phase for resting contacts.
+ */
+void GJKEPAAlgorithmBT::gjkNearContactObjects() {
+    GJKAlgorithm<double> gjkAlgorithm;
+
+    for (const ObjectsPair& objectsPair : buildObjectsPairs(NEAR_CONTACT_SEPARATION)) {
+        GJKConvexObjectWrapper object1(*objectsPair.object1, false);
+        GJKConvexObjectWrapper object2(*objectsPair.object2, false);
+        GJKResult<double> previousFrameResult = gjkAlgorithm.processGJK(object1, object2);
+        AssertHelper::assertFalse(previousFrameResult.isCollide());
+        AssertHelper::assertFloatEquals((float)previousFrameResult.getSeparatingDistance(), NEAR_CONTACT_SEPARATION, 0.002f); //GJK termination tolerance on the rounded capsule
+        Vector3<double> separatingAxis = previousFrameResult.getClosestPointB().vector(previousFrameResult.getClosestPointA()).normalize();
+
+        unsigned long defaultIterations = 0;
+        auto defaultStart = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < ITERATIONS; ++i) {
+            GJKResult<double> gjkResult = gjkAlgorithm.processGJK(object1, object2);
+            defaultIterations += gjkResult.getIterationsCount();
+        }
+        auto defaultDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - defaultStart).count();
+
+        unsigned long cachedAxisIterations = 0;
+        auto cachedAxisStart = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < ITERATIONS; ++i) {
+            GJKResult<double> gjkResult = gjkAlgorithm.processGJK(object1, object2, separatingAxis, CONTACT_BREAKING_THRESHOLD);
+            cachedAxisIterations += gjkResult.getIterationsCount();
+        }
+        auto cachedAxisDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - cachedAxisStart).count();
+        AssertHelper::assertFalse(gjkAlgorithm.processGJK(object1, object2, separatingAxis, CONTACT_BREAKING_THRESHOLD).isCollide());
+
+        std::cout << "GJK near contact " << objectsPair.name << " (separation: " << NEAR_CONTACT_SEPARATION << "): "
+                  << "default: " << (double)defaultDuration / ITERATIONS << "ns/query, " << (double)defaultIterations / ITERATIONS << " iterations/query, "
+                  << "cached axis: " << (double)cachedAxisDuration / ITERATIONS << "ns/query, " << (double)cachedAxisIterations / ITERATIONS << " iterations/query" << std::endl;
+    }
+}
+
+/**
+ * Measure GJK and EPA separately on penetrating objects as executed by the narrow phase (GJK with margin followed by EPA).
+ */
+void GJKEPAAlgorithmBT::gjkEpaPenetratingObjects() {
+    GJKAlgorithm<double> gjkAlgorithm;
+    EPAAlgorithm<double> epaAlgorithm;
+
+    for (const ObjectsPair& objectsPair : buildObjectsPairs(0.0f)) {
+        GJKConvexObjectWrapper object1(*objectsPair.object1, true);
+        GJKConvexObjectWrapper object2(*objectsPair.object2, true);
+
+        unsigned long gjkIterations = 0;
+        auto gjkStart = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < ITERATIONS; ++i) {
+            GJKResult<double> gjkResult = gjkAlgorithm.processGJK(object1, object2);
+            gjkIterations += gjkResult.getIterationsCount();
+        }
+        auto gjkDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - gjkStart).count();
+
+        GJKResult<double> gjkResult = gjkAlgorithm.processGJK(object1, object2);
+        AssertHelper::assertTrue(gjkResult.isValidResult() && gjkResult.isCollide());
+        unsigned long epaIterations = 0;
+        auto epaStart = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < ITERATIONS; ++i) {
+            EPAResult<double> epaResult = epaAlgorithm.processEPA(*objectsPair.object1, *objectsPair.object2, gjkResult);
+            epaIterations += epaResult.getIterationsCount();
+        }
+        auto epaDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epaStart).count();
+
+        EPAResult<double> epaResult = epaAlgorithm.processEPA(*objectsPair.object1, *objectsPair.object2, gjkResult);
+        AssertHelper::assertTrue(epaResult.isValidResult() && epaResult.isCollide());
+        AssertHelper::assertFloatEquals((float)epaResult.getPenetrationDepth(), objectsPair.penetrationDepth, 0.001f);
+
+        std::cout << "GJK/EPA penetrating " << objectsPair.name << " (depth: " << objectsPair.penetrationDepth << "): "
+                  << "GJK: " << (double)gjkDuration / ITERATIONS << "ns/query, " << (double)gjkIterations / ITERATIONS << " iterations/query, "
+                  << "EPA: " << (double)epaDuration / ITERATIONS << "ns/query, " << (double)epaIterations / ITERATIONS << " iterations/query" << std::endl;
+    }
+}
+
+/**
+ * @param separation Distance between the objects of each pair: zero to keep the penetrating configuration of the narrow phase tests (see EPAAlgorithmTest)
+ * @return Box/box, convex hull/convex hull and triangle/capsule pairs. The second object is moved along the contact normal by the penetration depth plus the separation.
+ */
+std::vector<GJKEPAAlgorithmBT::ObjectsPair> GJKEPAAlgorithmBT::buildObjectsPairs(float separation) const {
+    std::vector<ObjectsPair> objectsPairs;
+
+    //box/box: corner of a rotated box inside a box (see EPAAlgorithmTest::overlapOnCornerOBBox)
+    float boxDepth = 0.23205080757f;
+    float boxShift = separation > 0.0f ? boxDepth + separation : 0.0f;
+    objectsPairs.push_back(ObjectsPair{.name = "box/box",
+            .object1 = std::make_unique<CollisionBoxObject>(0.0f, Vector3(1.0f, 1.0f, 1.0f), Point3(0.0f, 0.0f, 0.0f), Quaternion<float>::fromAxisAngle(Vector3(0.245f, 0.769f, -0.59f), 0.987859f)),
+            .object2 = std::make_unique<CollisionBoxObject>(0.0f, Vector3(1.0f, 1.0f, 1.0f), Point3(2.5f + boxShift, 0.0f, 0.0f), Quaternion<float>()),
+            .penetrationDepth = boxDepth});
+
+    //hull/hull: corner of a convex hull inside a box hull (see EPAAlgorithmTest::cornerInsideBox)
+    float hullDepth = 0.2f;
+    float hullShift = separation > 0.0f ? hullDepth + separation : 0.0f;
+    std::vector aabbPoints = {
+            Point3(0.0f, 1.0f, 0.0f), Point3(1.0f, 1.0f, 0.0f), Point3(1.0f, -1.0f, 0.0f), Point3(0.0f, -1.0f, 0.0f),
+            Point3(0.0f, 1.0f, -1.0f), Point3(1.0f, 1.0f, -1.0f), Point3(1.0f, -1.0f, -1.0f), Point3(0.0f, -1.0f, -1.0f)
+    };
+    std::vector obbPoints = {
+            Point3(-0.3f, 1.0f, 0.0f), Point3(0.2f, 0.0f, 0.0f), Point3(-0.3f, -1.0f, 0.0f), Point3(-0.8f, 0.0f, 0.0f),
+            Point3(-0.3f, 1.0f, -1.0f), Point3(0.2f, 0.0f, -1.0f), Point3(-0.3f, -1.0f, -1.0f), Point3(-0.8f, 0.0f, -1.0f)
+    };
+    for (Point3<float>& obbPoint : obbPoints) {
+        obbPoint.X -= hullShift;
+    }
+    objectsPairs.push_back(ObjectsPair{.name = "hull/hull",
+            .object1 = std::make_unique<CollisionConvexHullObject>(0.0f, aabbPoints, aabbPoints),
+            .object2 = std::make_unique<CollisionConvexHullObject>(0.0f, obbPoints, obbPoints),
+            .penetrationDepth = hullDepth});
+
+    //triangle/capsule: capsule standing on a triangle (see EPAAlgorithmTest::overlapTriangleAndCapsule)
+    float capsuleDepth = 0.55f;
+    float capsuleShift = separation > 0.0f ? capsuleDepth + separation : 0.0f;
+    objectsPairs.push_back(ObjectsPair{.name = "triangle/capsule",
+            .object1 = std::make_unique<CollisionTriangleObject>(0.0f, Point3(0.0f, 0.0f, 0.0f), Point3(-2.0f, 0.0f, -2.0f), Point3(-2.0f, 0.0f, 0.0f)),
+            .object2 = std::make_unique<CollisionCapsuleObject>(0.0f, 0.25f, 1.0f, CapsuleShape<float>::CAPSULE_Y, Point3(0.0f, 0.2f + capsuleShift, 0.0f), Quaternion<float>()),
+            .penetrationDepth = capsuleDepth});
+
+    return objectsPairs;
+}
+
+CppUnit::Test* GJKEPAAlgorithmBT::suite() {
+    auto* suite = new CppUnit::TestSuite("GJKEPAAlgorithmBT");
+
+    suite->addTest(new CppUnit::TestCaller("gjkNearContactObjects", &GJKEPAAlgorithmBT::gjkNearContactObjects));
+    suite->addTest(new CppUnit::TestCaller("gjkEpaPenetratingObjects", &GJKEPAAlgorithmBT::gjkEpaPenetratingObjects));
+
+    return suite;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinCommon.h>
+#include <UrchinPhysicsEngine.h>
+
+class GJKEPAAlgorithmBT final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void gjkNearContactObjects();
+        void gjkEpaPenetratingObjects();
+
+    private:
+        struct ObjectsPair {
+            std::string name;
+            std::unique_ptr<urchin::CollisionConvexObject3D> object1;
+            std::unique_ptr<urchin::CollisionConvexObject3D> object2;
+            float penetrationDepth; //penetration depth of the objects when the separation is zero
+        };
+
+        std::vector<ObjectsPair> buildObjectsPairs(float) const;
+
+        static constexpr unsigned int ITERATIONS = 20000;
+        static constexpr float NEAR_CONTACT_SEPARATION = 0.01f;
+        static constexpr double CONTACT_BREAKING_THRESHOLD = 0.02; //see ManifoldResult: early-out distance of the narrow phase for objects without margin
+};
@@ -0,0 +1,190 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+
+#include "physics/joint/JointIT.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void JointIT::distanceJointPendulum() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto anchorBody = buildBody("anchor", Point3(0.0f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.1f, 0.1f, 0.1f)), 0.0f);
+    auto ballBody = buildBody("ball", Point3(2.0f, 10.0f, 0.0f), std::make_unique<CollisionSphereShape>(0.25f), 1.0f);
+    bodyContainer->addBody(anchorBody);
+    bodyContainer->addBody(ballBody);
+    CollisionWorld collisionWorld(*bodyContainer);
+    collisionWorld.getJointContainer().addJoint(std::make_shared<DistanceJoint>(anchorBody, ballBody, Point3(0.0f, 10.0f, 0.0f), Point3(2.0f, 10.0f, 0.0f), 2.0f, 2.0f));
+
+    float minBallHeight = 10.0f;
+    for (std::size_t i = 0; i < 120; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        AssertHelper::assertFloatEquals(Point3(0.0f, 10.0f, 0.0f).distance(ballBody->getTransform().getPosition()), 2.0f, 0.05f);
+        minBallHeight = std::min(minBallHeight, ballBody->getTransform().getPosition().Y);
+    }
+    AssertHelper::assertFloatEquals(minBallHeight, 8.0f, 0.1f); //ball swings until the bottom of the circle
+    AssertHelper::assertFloatEquals(ballBody->getTransform().getPosition().Z, 0.0f);
+}
+
+void JointIT::ballSocketJointChain() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto anchorBody = buildBody("anchor", Point3(0.0f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.1f, 0.1f, 0.1f)), 0.0f);
+    bodyContainer->addBody(anchorBody);
+    CollisionWorld collisionWorld(*bodyContainer);
+
+    std::vector<std::shared_ptr<RigidBody>> linkBodies;
+    std::shared_ptr<RigidBody> previousBody = anchorBody;
+    for (unsigned int i = 0; i < 10; ++i) {
+        auto linkBody = buildBody("link" + std::to_string(i), Point3(0.5f + (float)i * 0.5f, 10.0f, 0.0f), std::make_unique<CollisionSphereShape>(0.15f), 1.0f);
+        bodyContainer->addBody(linkBody);
+        collisionWorld.getJointContainer().addJoint(std::make_shared<BallSocketJoint>(previousBody, linkBody, Point3(0.25f + (float)i * 0.5f, 10.0f, 0.0f)));
+        linkBodies.push_back(linkBody);
+        previousBody = linkBody;
+    }
+
+    float minLastLinkHeight = 10.0f;
+    for (std::size_t i = 0; i < 180; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+        minLastLinkHeight = std::min(minLastLinkHeight, linkBodies.back()->getTransform().getPosition().Y);
+    }
+
+    AssertHelper::assertPoint3FloatEquals(linkBodies[0]->getTransform().transform(Point3(-0.25f, 0.0f, 0.0f)), Point3(0.25f, 10.0f, 0.0f), 0.05f);
+    for (std::size_t i = 1; i < linkBodies.size(); ++i) { //links share their anchor point
+        Point3<float> previousLinkAnchor = linkBodies[i - 1]->getTransform().transform(Point3(0.25f, 0.0f, 0.0f));
+        AssertHelper::assertPoint3FloatEquals(linkBodies[i]->getTransform().transform(Point3(-0.25f, 0.0f, 0.0f)), previousLinkAnchor, 0.05f);
+    }
+    AssertHelper::assertTrue(minLastLinkHeight < 6.0f, "Chain must swing under its anchor");
+}
+
+void JointIT::hingeJointRotation() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto frameBody = buildBody("frame", Point3(0.0f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.05f, 0.05f, 0.05f)), 0.0f);
+    auto doorBody = buildBody("door", Point3(0.6f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.05f, 0.5f)), 5.0f);
+    bodyContainer->addBody(frameBody);
+    bodyContainer->addBody(doorBody);
+    CollisionWorld collisionWorld(*bodyContainer);
+    collisionWorld.getJointContainer().addJoint(std::make_shared<HingeJoint>(frameBody, doorBody, Point3(0.0f, 10.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)));
+
+    float minDoorHeight = 10.0f;
+    for (std::size_t i = 0; i < 60; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+
+        Point3<float> doorPosition = doorBody->getTransform().getPosition();
+        AssertHelper::assertFloatEquals(Point3(0.0f, 10.0f, 0.0f).distance(doorPosition), 0.6f, 0.05f);
+        AssertHelper::assertFloatEquals(doorPosition.Z, 0.0f, 0.01f);
+        AssertHelper::assertVector3FloatEquals(doorBody->getTransform().getOrientation().rotateVector(Vector3(0.0f, 0.0f, 1.0f)), Vector3(0.0f, 0.0f, 1.0f), 0.01f);
+        minDoorHeight = std::min(minDoorHeight, doorPosition.Y);
+    }
+    AssertHelper::assertFloatEquals(minDoorHeight, 9.4f, 0.05f); //door swings until the bottom of the circle
+}
+
+void JointIT::sliderJointTranslation() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto railBody = buildBody("rail", Point3(0.0f, 0.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.1f, 0.1f, 0.1f)), 0.0f);
+    auto sliderBody = buildBody("slider", Point3(0.0f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)), 1.0f);
+    bodyContainer->addBody(railBody);
+    bodyContainer->addBody(sliderBody);
+    CollisionWorld collisionWorld(*bodyContainer);
+    collisionWorld.getJointContainer().addJoint(std::make_shared<SliderJoint>(railBody, sliderBody, Vector3(1.0f, 1.0f, 0.0f)));
+    sliderBody->setVelocity(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 3.0f)); //rotation must be cancelled by the joint
+
+    for (std::size_t i = 0; i < 60; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+
+    Point3<float> sliderPosition = sliderBody->getTransform().getPosition();
+    AssertHelper::assertTrue(sliderPosition.Y < 8.0f, "Slider must slide down along its axis");
+    AssertHelper::assertFloatEquals(sliderPosition.X, sliderPosition.Y - 10.0f, 0.05f);
+    AssertHelper::assertFloatEquals(sliderPosition.Z, 0.0f, 0.01f);
+    AssertHelper::assertVector3FloatEquals(sliderBody->getTransform().getOrientation().rotateVector(Vector3(1.0f, 0.0f, 0.0f)), Vector3(1.0f, 0.0f, 0.0f), 0.01f);
+}
+
+void JointIT::fixedJointFallOnGround() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto cube1Body = buildBody("cube1", Point3(0.0f, 3.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)), 1.0f);
+    auto cube2Body = buildBody("cube2", Point3(1.2f, 3.5f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)), 1.0f);
+    bodyContainer->addBody(cube1Body);
+    bodyContainer->addBody(cube2Body);
+    CollisionWorld collisionWorld(*bodyContainer);
+    collisionWorld.getJointContainer().addJoint(std::make_shared<FixedJoint>(cube1Body, cube2Body));
+
+    for (std::size_t i = 0; i < 400; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+
+    PhysicsTransform relativeTransform = cube1Body->getTransform().inverse() * cube2Body->getTransform();
+    AssertHelper::assertPoint3FloatEquals(relativeTransform.getPosition(), Point3(1.2f, 0.5f, 0.0f), 0.05f);
+    AssertHelper::assertVector3FloatEquals(relativeTransform.getOrientation().rotateVector(Vector3(1.0f, 0.0f, 0.0f)), Vector3(1.0f, 0.0f, 0.0f), 0.02f);
+    AssertHelper::assertTrue(cube1Body->getTransform().getPosition().Y < 1.5f, "Assembly must fall on the ground");
+    AssertHelper::assertFalse(cube1Body->isActive(), "Bodies linked by a joint must sleep together when they don't move");
+    AssertHelper::assertFalse(cube2Body->isActive(), "Bodies linked by a joint must sleep together when they don't move");
+}
+
+void JointIT::removeJointBody() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto anchorBody = buildBody("anchor", Point3(0.0f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.1f, 0.1f, 0.1f)), 0.0f);
+    auto ballBody = buildBody("ball", Point3(0.0f, 9.0f, 0.0f), std::make_unique<CollisionSphereShape>(0.25f), 1.0f);
+    bodyContainer->addBody(anchorBody);
+    bodyContainer->addBody(ballBody);
+    CollisionWorld collisionWorld(*bodyContainer);
+    collisionWorld.getJointContainer().addJoint(std::make_shared<BallSocketJoint>(anchorBody, ballBody, Point3(0.0f, 10.0f, 0.0f)));
+    for (std::size_t i = 0; i < 30; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+    AssertHelper::assertFloatEquals(ballBody->getTransform().getPosition().Y, 9.0f, 0.05f);
+
+    bodyContainer->removeBody(*anchorBody);
+    for (std::size_t i = 0; i < 30; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+    AssertHelper::assertTrue(collisionWorld.getJointContainer().getJoints().empty());
+    AssertHelper::assertTrue(ballBody->getTransform().getPosition().Y < 8.0f, "Ball must fall when the joint is removed");
+}
+
+void JointIT::addJointOfRemovedBody() {
+    std::unique_ptr<BodyContainer> bodyContainer = buildWorld();
+    auto anchorBody = buildBody("anchor", Point3(0.0f, 10.0f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(0.1f, 0.1f, 0.1f)), 0.0f);
+    auto ballBody = buildBody("ball", Point3(0.0f, 9.0f, 0.0f), std::make_unique<CollisionSphereShape>(0.25f), 1.0f);
+    bodyContainer->addBody(anchorBody);
+    bodyContainer->addBody(ballBody);
+    CollisionWorld collisionWorld(*bodyContainer);
+    collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+
+    bodyContainer->removeBody(*anchorBody);
+    collisionWorld.getJointContainer().addJoint(std::make_shared<BallSocketJoint>(anchorBody, ballBody, Point3(0.0f, 10.0f, 0.0f)));
+    for (std::size_t i = 0; i < 30; ++i) {
+        collisionWorld.process(1.0f / 60.0f, Vector3(0.0f, -9.81f, 0.0f));
+    }
+
+    AssertHelper::assertTrue(collisionWorld.getJointContainer().getJoints().empty());
+    AssertHelper::assertTrue(ballBody->getTransform().getPosition().Y < 8.0f, "Ball must fall: joint of a removed body is ignored");
+}
+
+/**
+ * @return World with a ground: the ground defines the world boundaries under which the bodies are deactivated
+ */
+std::unique_ptr<BodyContainer> JointIT::buildWorld() const {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+    bodyContainer->addBody(buildBody("ground", Point3(0.0f, -0.5f, 0.0f), std::make_unique<CollisionBoxShape>(Vector3(50.0f, 0.5f, 50.0f)), 0.0f));
+    return bodyContainer;
+}
+
+std::shared_ptr<RigidBody> JointIT::buildBody(const std::string& id, const Point3<float>& position, std::unique_ptr<const CollisionShape3D> shape, float mass) const {
+    auto body = std::make_shared<RigidBody>(id, PhysicsTransform(position, Quaternion<float>()), std::move(shape));
+    body->setMass(mass);
+    return body;
+}
+
+CppUnit::Test* JointIT::suite() {
+    auto* suite = new CppUnit::TestSuite("JointIT");
+
+    suite->addTest(new CppUnit::TestCaller("distanceJointPendulum", &JointIT::distanceJointPendulum));
+    suite->addTest(new CppUnit::TestCaller("ballSocketJointChain", &JointIT::ballSocketJointChain));
+    suite->addTest(new CppUnit::TestCaller("hingeJointRotation", &JointIT::hingeJointRotation));
+    suite->addTest(new CppUnit::TestCaller("sliderJointTranslation", &JointIT::sliderJointTranslation));
+    suite->addTest(new CppUnit::TestCaller("fixedJointFallOnGround", &JointIT::fixedJointFallOnGround));
+
+    suite->addTest(new CppUnit::TestCaller("removeJointBody", &JointIT::removeJointBody));
+    suite->addTest(new CppUnit::TestCaller("addJointOfRemovedBody", &JointIT::addJointOfRemovedBody));
+
+    return suite;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class JointIT final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void distanceJointPendulum();
+        void ballSocketJointChain();
+        void hingeJointRotation();
+        void sliderJointTranslation();
+        void fixedJointFallOnGround();
+
+        void removeJointBody();
+        void addJointOfRemovedBody();
+
+    private:
+        std::unique_ptr<urchin::BodyContainer> buildWorld() const;
+        std::shared_ptr<urchin::RigidBody> buildBody(const std::string&, const urchin::Point3<float>&, std::unique_ptr<const urchin::CollisionShape3D>, float) const;
+};
@@ -0,0 +1,180 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <filesystem>
+#include <memory>
+#include <thread>
+
+#include "physics/journal/PhysicsJournalIT.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void PhysicsJournalIT::replaySession() {
+    auto bodyContainer = buildWorld();
+    std::unique_ptr<PhysicsJournal> journal = recordSession(*bodyContainer);
+
+    PhysicsReplayer replayer(journal->getStream());
+    ReplayResult replayResult = replayer.replay();
+
+    AssertHelper::assertUnsignedIntEquals(replayResult.stepsCount, SESSION_STEPS);
+    AssertHelper::assertTrue(!replayResult.firstDivergentStep.has_value(), "Replayed steps must produce the recorded bodies state");
+    AssertHelper::assertUnsignedIntEquals((unsigned int)replayer.getBodyContainer().getBodies().size(), (unsigned int)bodyContainer->getBodies().size());
+    for (std::size_t i = 0; i < bodyContainer->getBodies().size(); ++i) {
+        AssertHelper::assertStringEquals(replayer.getBodyContainer().getBodies()[i]->getId(), bodyContainer->getBodies()[i]->getId());
+        AssertHelper::assertPoint3FloatEquals(replayer.getBodyContainer().getBodies()[i]->getTransform().getPosition(), bodyContainer->getBodies()[i]->getTransform().getPosition(), 0.0f);
+    }
+}
+
+void PhysicsJournalIT::replaySessionFromFile() {
+    auto bodyContainer = buildWorld();
+    std::unique_ptr<PhysicsJournal> journal = recordSession(*bodyContainer);
+    std::string journalFilename = (std::filesystem::temp_directory_path() / "urchinPhysicsJournalIT.bin").string();
+    journal->saveToFile(journalFilename);
+
+    PhysicsReplayer replayer(journalFilename);
+    ReplayResult replayResult = replayer.replay();
+    std::filesystem::remove(journalFilename);
+
+    AssertHelper::assertUnsignedIntEquals(replayResult.stepsCount, SESSION_STEPS);
+    AssertHelper::assertTrue(!replayResult.firstDivergentStep.has_value(), "Replayed steps must produce the recorded bodies state");
+}
+
+void PhysicsJournalIT::replayDetectDivergence() {
+    auto bodyContainer = buildWorld();
+    std::unique_ptr<PhysicsJournal> journal = recordSession(*bodyContainer);
+    std::vector<char> journalData = journal->getStream().getData();
+    journalData.back() = (char)~journalData.back(); //alter the state hash of the last step
+
+    PhysicsReplayer replayer((JournalStream(journalData)));
+    ReplayResult replayResult = replayer.replay();
+
+    AssertHelper::assertTrue(replayResult.firstDivergentStep.has_value());
+    AssertHelper::assertUnsignedIntEquals(*replayResult.firstDivergentStep, SESSION_STEPS - 1);
+}
+
+void PhysicsJournalIT::replayExternalModifications() {
+    auto bodyContainer = buildWorld();
+    std::shared_ptr<RigidBody> movedBody = std::make_shared<RigidBody>("moved", PhysicsTransform(Point3(10.0f, 0.5f, 0.0f)), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    movedBody->setMass(1.0f);
+    std::shared_ptr<GhostBody> ghostBody = std::make_shared<GhostBody>("ghost", PhysicsTransform(Point3(-10.0f, 1.0f, 0.0f)), std::make_unique<CollisionSphereShape>(0.5f));
+    bodyContainer->addBody(movedBody);
+    bodyContainer->addBody(ghostBody);
+
+    std::unique_ptr<PhysicsJournal> journal = recordSession(*bodyContainer, [&](unsigned int step, CollisionWorld&) {
+        if (step == 30) {
+            std::jthread([&]() { movedBody->setTransform(PhysicsTransform(Point3(10.0f, 3.0f, 0.0f))); }); //manual move of a sleeping body from another thread
+        } else if (step == 50) {
+            std::jthread([&]() { movedBody->setVelocity(Vector3(4.0f, 2.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)); });
+        } else if (step > 60 && step < 100) {
+            ghostBody->setTransform(PhysicsTransform(Point3(-10.0f + 0.1f * (float)(step - 60), 1.0f, 0.0f))); //ghost moved as a character controller does
+        }
+    });
+
+    PhysicsReplayer replayer(journal->getStream());
+    ReplayResult replayResult = replayer.replay();
+
+    AssertHelper::assertTrue(!replayResult.firstDivergentStep.has_value(), "Replayed steps must produce the recorded bodies state");
+    for (std::size_t i = 0; i < bodyContainer->getBodies().size(); ++i) {
+        AssertHelper::assertPoint3FloatEquals(replayer.getBodyContainer().getBodies()[i]->getTransform().getPosition(), bodyContainer->getBodies()[i]->getTransform().getPosition(), 0.0f);
+    }
+}
+
+void PhysicsJournalIT::replayRejectJoints() {
+    auto bodyContainer = buildWorld();
+    std::unique_ptr<PhysicsJournal> journal = recordSession(*bodyContainer, [&](unsigned int step, CollisionWorld& collisionWorld) {
+        if (step == 10) {
+            auto body1 = std::static_pointer_cast<RigidBody>(bodyContainer->getBodies()[1]);
+            auto body2 = std::static_pointer_cast<RigidBody>(bodyContainer->getBodies()[2]);
+            collisionWorld.getJointContainer().addJoint(std::make_shared<BallSocketJoint>(body1, body2, Point3(0.1f, 1.05f, 0.0f)));
+        }
+    });
+
+    PhysicsReplayer replayer(journal->getStream());
+    bool exceptionCaught = false;
+    try {
+        replayer.replay();
+    } catch (const std::runtime_error&) {
+        exceptionCaught = true;
+    }
+
+    AssertHelper::assertTrue(exceptionCaught, "Journal recorded with joints must not be replayed");
+}
+
+/**
+ * Record a session with the usual inputs: momentum on bodies, gravity change, bodies added and removed during the session
+ */
+std::unique_ptr<PhysicsJournal> PhysicsJournalIT::recordSession(BodyContainer& bodyContainer, const std::function<void(unsigned int, CollisionWorld&)>& additionalInputs) const {
+    auto collisionWorld = std::make_unique<CollisionWorld>(bodyContainer);
+    collisionWorld->setDeterministic(true);
+    collisionWorld->startJournal();
+
+    Vector3 gravity(0.0f, -9.81f, 0.0f);
+    std::weak_ptr<AbstractBody> addedBody;
+    for (unsigned int step = 0; step < SESSION_STEPS; ++step) {
+        if (step == 20) {
+            static_cast<RigidBody&>(*bodyContainer.getBodies()[1]).applyCentralMomentum(Vector3(40.0f, 0.0f, 10.0f));
+            static_cast<RigidBody&>(*bodyContainer.getBodies()[2]).applyTorqueMomentum(Vector3(0.0f, 5.0f, 0.0f));
+        } else if (step == 40) {
+            auto hullShape = std::make_unique<CollisionConvexHullShape>(std::vector<Point3<float>>{
+                    Point3(-0.5f, 0.0f, -0.5f), Point3(0.5f, 0.0f, -0.5f), Point3(0.5f, 0.0f, 0.5f), Point3(-0.5f, 0.0f, 0.5f), Point3(0.0f, 1.0f, 0.0f)});
+            auto hullBody = std::make_shared<RigidBody>("hull", PhysicsTransform(Point3(0.2f, 4.0f, 0.1f)), std::move(hullShape));
+            hullBody->setMass(2.0f);
+            addedBody = hullBody;
+            bodyContainer.addBody(std::move(hullBody));
+        } else if (step == 90) {
+            gravity = Vector3(0.0f, -4.0f, 1.0f);
+        } else if (step == 120) {
+            bodyContainer.removeBody(*addedBody.lock());
+        }
+        if (additionalInputs) {
+            additionalInputs(step, *collisionWorld);
+        }
+        collisionWorld->process(1.0f / 60.0f, gravity);
+    }
+
+    return collisionWorld->stopJournal();
+}
+
+std::unique_ptr<BodyContainer> PhysicsJournalIT::buildWorld() const {
+    auto bodyContainer = std::make_unique<BodyContainer>();
+
+    auto groundShape = std::make_unique<CollisionBoxShape>(Vector3(50.0f, 0.5f, 50.0f));
+    bodyContainer->addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, -0.5f, 0.0f)), std::move(groundShape)));
+
+    for (unsigned int i = 0; i < 3; ++i) {
+        auto cubeShape = std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f));
+        auto cubeBody = std::make_unique<RigidBody>("cube" + std::to_string(i), PhysicsTransform(Point3(0.1f * (float)i, 0.5f + 1.1f * (float)i, 0.0f)), std::move(cubeShape));
+        cubeBody->setMass(10.0f);
+        bodyContainer->addBody(std::move(cubeBody));
+    }
+
+    std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+    for (std::size_t i = 0; i < 2; ++i) {
+        auto localizedShape = std::make_shared<LocalizedCollisionShape>();
+        localizedShape->shapeIndex = i;
+        localizedShape->shape = std::make_unique<CollisionSphereShape>(0.4f);
+        localizedShape->transform = PhysicsTransform(Point3(i == 0 ? -0.4f : 0.4f, 0.0f, 0.0f));
+        localizedShapes.push_back(std::move(localizedShape));
+    }
+    auto compoundBody = std::make_unique<RigidBody>("compound", PhysicsTransform(Point3(3.0f, 2.0f, 0.0f)), std::make_unique<CollisionCompoundShape>(std::move(localizedShapes)));
+    compoundBody->setMass(5.0f);
+    bodyContainer->addBody(std::move(compoundBody));
+
+    auto capsuleBody = std::make_unique<RigidBody>("capsule", PhysicsTransform(Point3(-3.0f, 1.0f, 0.0f)), std::make_unique<CollisionCapsuleShape>(0.3f, 1.0f, CapsuleShape<float>::CAPSULE_X));
+    capsuleBody->setMass(3.0f);
+    capsuleBody->applyCentralMomentum(Vector3(5.0f, 0.0f, 0.0f));
+    bodyContainer->addBody(std::move(capsuleBody));
+
+    return bodyContainer;
+}
+
+CppUnit::Test* PhysicsJournalIT::suite() {
+    auto* suite = new CppUnit::TestSuite("PhysicsJournalIT");
+
+    suite->addTest(new CppUnit::TestCaller("replaySession", &PhysicsJournalIT::replaySession));
+    suite->addTest(new CppUnit::TestCaller("replaySessionFromFile", &PhysicsJournalIT::replaySessionFromFile));
+    suite->addTest(new CppUnit::TestCaller("replayDetectDivergence", &PhysicsJournalIT::replayDetectDivergence));
+    suite->addTest(new CppUnit::TestCaller("replayExternalModifications", &PhysicsJournalIT::replayExternalModifications));
+    suite->addTest(new CppUnit::TestCaller("replayRejectJoints", &PhysicsJournalIT::replayRejectJoints));
+
+    return suite;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <functional>
+#include <UrchinPhysicsEngine.h>
+
+class PhysicsJournalIT final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void replaySession();
+        void replaySessionFromFile();
+        void replayDetectDivergence();
+        void replayExternalModifications();
+        void replayRejectJoints();
+
+    private:
+        std::unique_ptr<urchin::PhysicsJournal> recordSession(urchin::BodyContainer&, const std::function<void(unsigned int, urchin::CollisionWorld&)>& = {}) const;
+        std::unique_ptr<urchin::BodyContainer> buildWorld() const;
+
+        static constexpr unsigned int SESSION_STEPS = 180;
+};
@@ -0,0 +1,148 @@
+#include <thread>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+#include <UrchinPhysicsEngine.h>
+
+#include "physics/scenequery/SceneQueryTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void SceneQueryTest::rayCast() {
+    SceneQueryWorld world({Point3(0.0f, 0.5f, 0.0f), Point3(5.0f, 0.5f, 0.0f)});
+
+    std::optional<ContinuousCollisionResult<float>> cubeHit = world.sceneQuery.rayCast(Ray(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, -5.0f, 0.0f)));
+    AssertHelper::assertTrue(cubeHit.has_value());
+    AssertHelper::assertStringEquals(cubeHit->getBody2().getId(), "cube0");
+    AssertHelper::assertPoint3FloatEquals(cubeHit->getHitPointOnObject2(), Point3(0.0f, 1.0f, 0.0f), 0.01f);
+
+    std::optional<ContinuousCollisionResult<float>> groundHit = world.sceneQuery.rayCast(Ray(Point3(2.5f, 5.0f, 0.0f), Point3(2.5f, -5.0f, 0.0f)));
+    AssertHelper::assertTrue(groundHit.has_value());
+    AssertHelper::assertStringEquals(groundHit->getBody2().getId(), "ground");
+    AssertHelper::assertPoint3FloatEquals(groundHit->getHitPointOnObject2(), Point3(2.5f, 0.0f, 0.0f), 0.01f);
+
+    std::optional<ContinuousCollisionResult<float>> noHit = world.sceneQuery.rayCast(Ray(Point3(2.5f, 5.0f, 0.0f), Point3(2.5f, 10.0f, 0.0f)));
+    AssertHelper::assertTrue(!noHit.has_value());
+}
+
+void SceneQueryTest::sphereSweepTest() {
+    SceneQueryWorld world({Point3(0.0f, 0.5f, 0.0f), Point3(5.0f, 0.5f, 0.0f)});
+    CollisionSphereShape sphereShape(0.25f);
+
+    std::optional<ContinuousCollisionResult<float>> cubeHit = world.sceneQuery.sweepTest(sphereShape, PhysicsTransform(Point3(-3.0f, 0.5f, 0.0f)), PhysicsTransform(Point3(3.0f, 0.5f, 0.0f)));
+
+    AssertHelper::assertTrue(cubeHit.has_value());
+    AssertHelper::assertStringEquals(cubeHit->getBody2().getId(), "cube0");
+    AssertHelper::assertFloatEquals(cubeHit->getTimeToHit(), 2.25f / 6.0f, 0.01f);
+}
+
+void SceneQueryTest::aabboxOverlapTest() {
+    SceneQueryWorld world({Point3(0.0f, 0.5f, 0.0f), Point3(5.0f, 0.5f, 0.0f), Point3(10.0f, 0.5f, 0.0f)});
+
+    std::vector<std::shared_ptr<AbstractBody>> bodies;
+    world.sceneQuery.aabboxOverlapTest(AABBox(Point3(-1.0f, 0.1f, -1.0f), Point3(6.0f, 2.0f, 1.0f)), bodies);
+
+    AssertHelper::assertUnsignedIntEquals(bodies.size(), 2);
+    AssertHelper::assertTrue(std::ranges::any_of(bodies, [](const auto& body) { return body->getId() == "cube0"; }));
+    AssertHelper::assertTrue(std::ranges::any_of(bodies, [](const auto& body) { return body->getId() == "cube1"; }));
+}
+
+void SceneQueryTest::shapeOverlapTest() {
+    SceneQueryWorld world({Point3(0.0f, 0.5f, 0.0f)});
+    CollisionSphereShape sphereShape(0.3f);
+
+    std::vector<std::shared_ptr<AbstractBody>> sideBodies;
+    world.sceneQuery.shapeOverlapTest(sphereShape, PhysicsTransform(Point3(0.7f, 0.5f, 0.0f)), sideBodies);
+    AssertHelper::assertUnsignedIntEquals(sideBodies.size(), 1);
+    AssertHelper::assertStringEquals(sideBodies[0]->getId(), "cube0");
+
+    std::vector<std::shared_ptr<AbstractBody>> groundBodies;
+    world.sceneQuery.shapeOverlapTest(sphereShape, PhysicsTransform(Point3(3.0f, 0.2f, 0.0f)), groundBodies);
+    AssertHelper::assertUnsignedIntEquals(groundBodies.size(), 1);
+    AssertHelper::assertStringEquals(groundBodies[0]->getId(), "ground");
+
+    std::vector<std::shared_ptr<AbstractBody>> cornerBodies;
+    world.sceneQuery.shapeOverlapTest(sphereShape, PhysicsTransform(Point3(0.75f, 1.25f, 0.0f)), cornerBodies);
+    AssertHelper::assertUnsignedIntEquals(cornerBodies.size(), 0); //AABBoxes overlap but not the shapes
+}
+
+void SceneQueryTest::queryFromOtherThread() {
+    SceneQueryWorld world({Point3(0.0f, 0.5f, 0.0f)});
+
+    std::optional<ContinuousCollisionResult<float>> cubeHit;
+    std::jthread queryThread([&]() {
+        cubeHit = world.sceneQuery.rayCast(Ray(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, -5.0f, 0.0f)));
+    });
+    queryThread.join();
+
+    AssertHelper::assertTrue(cubeHit.has_value());
+    AssertHelper::assertStringEquals(cubeHit->getBody2().getId(), "cube0");
+}
+
+void SceneQueryTest::queryWithoutSnapshot() {
+    BodyContainer bodyContainer;
+    WorkerPool workerPool(1);
+    BroadPhase broadPhase(bodyContainer);
+    NarrowPhase narrowPhase(bodyContainer, broadPhase, workerPool);
+    PhysicsMetrics metrics;
+    SceneQuery sceneQuery(narrowPhase, metrics);
+
+    std::vector<std::shared_ptr<AbstractBody>> bodies;
+    sceneQuery.aabboxOverlapTest(AABBox(Point3(-1.0f, -1.0f, -1.0f), Point3(1.0f, 1.0f, 1.0f)), bodies);
+
+    AssertHelper::assertTrue(!sceneQuery.rayCast(Ray(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, -5.0f, 0.0f))).has_value());
+    AssertHelper::assertUnsignedIntEquals(bodies.size(), 0);
+}
+
+void SceneQueryTest::queryAfterStaticBodyMove() {
+    SceneQueryWorld world({Point3(0.0f, 0.5f, 0.0f)});
+    world.sceneQuery.publishSnapshot(world.broadPhase); //static tree unchanged: shared with the previous snapshot
+    std::optional<ContinuousCollisionResult<float>> groundHit = world.sceneQuery.rayCast(Ray(Point3(2.5f, 5.0f, 0.0f), Point3(2.5f, -10.0f, 0.0f)));
+    AssertHelper::assertTrue(groundHit.has_value());
+    AssertHelper::assertPoint3FloatEquals(groundHit->getHitPointOnObject2(), Point3(2.5f, 0.0f, 0.0f), 0.01f);
+
+    std::shared_ptr<AbstractBody> groundBody = world.bodyContainer.getBodies()[0];
+    std::jthread([&groundBody]() { groundBody->setTransform(PhysicsTransform(Point3(0.0f, -5.0f, 0.0f))); }); //manual move
+    world.bodyContainer.refreshBodies();
+    world.broadPhase.computeOverlappingPairs();
+    world.sceneQuery.publishSnapshot(world.broadPhase);
+
+    groundHit = world.sceneQuery.rayCast(Ray(Point3(2.5f, 5.0f, 0.0f), Point3(2.5f, -10.0f, 0.0f)));
+    AssertHelper::assertTrue(groundHit.has_value());
+    AssertHelper::assertStringEquals(groundHit->getBody2().getId(), "ground");
+    AssertHelper::assertPoint3FloatEquals(groundHit->getHitPointOnObject2(), Point3(2.5f, -5.0f, 0.0f), 0.01f);
+}
+
+SceneQueryTest::SceneQueryWorld::SceneQueryWorld(const std::vector<Point3<float>>& cubePositions) :
+        broadPhase(bodyContainer),
+        workerPool(1),
+        narrowPhase(bodyContainer, broadPhase, workerPool),
+        sceneQuery(narrowPhase, metrics) {
+    std::vector<Point3<float>> groundVertices = {Point3(-20.0f, 0.0f, -20.0f), Point3(20.0f, 0.0f, -20.0f), Point3(-20.0f, 0.0f, 20.0f), Point3(20.0f, 0.0f, 20.0f)};
+    std::vector<IndexedTriangle3D<float>> groundTriangles = {IndexedTriangle3D<float>(0, 2, 1), IndexedTriangle3D<float>(1, 2, 3)};
+    auto groundShape = std::make_unique<CollisionTriangleMeshShape>(std::move(groundVertices), std::move(groundTriangles));
+    bodyContainer.addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(), std::move(groundShape)));
+    for (std::size_t i = 0; i < cubePositions.size(); ++i) {
+        auto cubeBody = std::make_unique<RigidBody>("cube" + std::to_string(i), PhysicsTransform(cubePositions[i]), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+        cubeBody->setMass(1.0f);
+        bodyContainer.addBody(std::move(cubeBody));
+    }
+
+    bodyContainer.refreshBodies();
+    broadPhase.computeOverlappingPairs();
+    sceneQuery.publishSnapshot(broadPhase);
+}
+
+CppUnit::Test* SceneQueryTest::suite() {
+    auto* suite = new CppUnit::TestSuite("SceneQueryTest");
+
+    suite->addTest(new CppUnit::TestCaller("rayCast", &SceneQueryTest::rayCast));
+    suite->addTest(new CppUnit::TestCaller("sphereSweepTest", &SceneQueryTest::sphereSweepTest));
+    suite->addTest(new CppUnit::TestCaller("aabboxOverlapTest", &SceneQueryTest::aabboxOverlapTest));
+    suite->addTest(new CppUnit::TestCaller("shapeOverlapTest", &SceneQueryTest::shapeOverlapTest));
+    suite->addTest(new CppUnit::TestCaller("queryFromOtherThread", &SceneQueryTest::queryFromOtherThread));
+    suite->addTest(new CppUnit::TestCaller("queryWithoutSnapshot", &SceneQueryTest::queryWithoutSnapshot));
+    suite->addTest(new CppUnit::TestCaller("queryAfterStaticBodyMove", &SceneQueryTest::queryAfterStaticBodyMove));
+
+    return suite;
+}
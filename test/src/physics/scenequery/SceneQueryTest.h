@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class SceneQueryTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void rayCast();
+        void sphereSweepTest();
+        void aabboxOverlapTest();
+        void shapeOverlapTest();
+        void queryFromOtherThread();
+        void queryWithoutSnapshot();
+        void queryAfterStaticBodyMove();
+
+    private:
+        struct SceneQueryWorld {
+            explicit SceneQueryWorld(const std::vector<urchin::Point3<float>>&);
+
+            urchin::BodyContainer bodyContainer;
+            urchin::BroadPhase broadPhase;
+            urchin::WorkerPool workerPool;
+            urchin::NarrowPhase narrowPhase;
+            urchin::PhysicsMetrics metrics;
+            urchin::SceneQuery sceneQuery;
+        };
+};
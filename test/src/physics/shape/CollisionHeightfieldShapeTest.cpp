@@ -0,0 +1,150 @@
+#include <cmath>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+#include <UrchinPhysicsEngine.h>
+
+#include "AssertHelper.h"
+#include "physics/shape/CollisionHeightfieldShapeTest.h"
+using namespace urchin;
+
+void CollisionHeightfieldShapeTest::quantizedHeights() {
+    auto groundShape = buildWavyGround(16);
+
+    for (unsigned int z = 0; z < groundShape->getZLength(); ++z) {
+        for (unsigned int x = 0; x < groundShape->getXLength(); ++x) {
+            Point3<float> vertex = groundShape->getVertex(x, z);
+            AssertHelper::assertFloatEquals(vertex.X, (float)x - 8.0f);
+            AssertHelper::assertFloatEquals(vertex.Z, (float)z - 8.0f);
+            AssertHelper::assertFloatEquals(vertex.Y, computeHeight(vertex.X, vertex.Z), 0.0001f);
+        }
+    }
+}
+
+void CollisionHeightfieldShapeTest::quadtreeDepth() {
+    auto groundShape = buildWavyGround(64); //8x8 leaf tiles
+
+    AssertHelper::assertUnsignedIntEquals(groundShape->getQuadtreeDepth(), 4);
+}
+
+void CollisionHeightfieldShapeTest::findTrianglesInAABBox() {
+    auto groundShape = buildWavyGround(64);
+    AABBox<float> checkAABBox(Point3(-2.3f, -5.0f, 1.1f), Point3(0.6f, 5.0f, 2.9f));
+
+    std::vector<CollisionTriangleShape> triangles;
+    groundShape->findTrianglesInAABBox(checkAABBox, triangles);
+
+    AssertHelper::assertUnsignedIntEquals(triangles.size(), 4 /* x cells */ * 2 /* z cells */ * 2);
+    for (unsigned int z = 0; z < 2; ++z) {
+        for (unsigned int x = 0; x < 4; ++x) {
+            Point3<float> farLeft = groundShape->getVertex(x + 29, z + 33);
+            Point3<float> farRight = groundShape->getVertex(x + 30, z + 33);
+            Point3<float> nearLeft = groundShape->getVertex(x + 29, z + 34);
+            Point3<float> nearRight = groundShape->getVertex(x + 30, z + 34);
+            AssertHelper::assertTrue(containsTriangle(triangles, farLeft, nearLeft, farRight));
+            AssertHelper::assertTrue(containsTriangle(triangles, farRight, nearLeft, nearRight));
+        }
+    }
+}
+
+void CollisionHeightfieldShapeTest::findTrianglesHitByRay() {
+    auto groundShape = buildWavyGround(64);
+    Point3<float> groundPoint(7.3f, computeHeight(7.3f, -6.6f), -6.6f);
+    LineSegment3D<float> ray(groundPoint + Point3(-30.0f, 20.0f, 20.0f), groundPoint + Point3(3.0f, -2.0f, -2.0f));
+
+    std::vector<CollisionTriangleShape> triangles;
+    groundShape->findTrianglesHitByRay(ray, triangles);
+
+    //the ray stays above the ground in all the crossed cells except the cell of the ground point
+    AssertHelper::assertUnsignedIntEquals(triangles.size(), 2);
+    Point3<float> farLeft = groundShape->getVertex(39, 25);
+    Point3<float> farRight = groundShape->getVertex(40, 25);
+    Point3<float> nearLeft = groundShape->getVertex(39, 26);
+    Point3<float> nearRight = groundShape->getVertex(40, 26);
+    AssertHelper::assertTrue(containsTriangle(triangles, farLeft, nearLeft, farRight));
+    AssertHelper::assertTrue(containsTriangle(triangles, farRight, nearLeft, nearRight));
+}
+
+void CollisionHeightfieldShapeTest::findTrianglesHitByVerticalRay() {
+    auto groundShape = buildWavyGround(64);
+    LineSegment3D<float> ray(Point3(10.5f, 10.0f, 0.5f), Point3(10.5f, -10.0f, 0.5f));
+
+    std::vector<CollisionTriangleShape> triangles;
+    groundShape->findTrianglesHitByRay(ray, triangles);
+
+    AssertHelper::assertUnsignedIntEquals(triangles.size(), 2);
+    AssertHelper::assertTrue(containsTriangle(triangles, groundShape->getVertex(42, 32), groundShape->getVertex(42, 33), groundShape->getVertex(43, 32)));
+}
+
+void CollisionHeightfieldShapeTest::cloneHeights() {
+    auto groundShape = buildWavyGround(16);
+
+    std::unique_ptr<CollisionShape3D> clonedShape = groundShape->clone();
+
+    const auto& clonedGroundShape = static_cast<const CollisionHeightfieldShape&>(*clonedShape);
+    AssertHelper::assertUnsignedIntEquals(clonedGroundShape.getQuadtreeDepth(), groundShape->getQuadtreeDepth());
+    for (unsigned int z = 0; z < groundShape->getZLength(); ++z) {
+        for (unsigned int x = 0; x < groundShape->getXLength(); ++x) {
+            AssertHelper::assertTrue(clonedGroundShape.getVertex(x, z) == groundShape->getVertex(x, z)); //no re-quantization
+        }
+    }
+}
+
+void CollisionHeightfieldShapeTest::scaleHeights() {
+    auto groundShape = buildWavyGround(16);
+
+    std::unique_ptr<CollisionShape3D> scaledShape = groundShape->scale(Vector3(2.0f, 3.0f, 0.5f));
+
+    const auto& scaledGroundShape = static_cast<const CollisionHeightfieldShape&>(*scaledShape);
+    for (unsigned int z = 0; z < groundShape->getZLength(); ++z) {
+        for (unsigned int x = 0; x < groundShape->getXLength(); ++x) {
+            Point3<float> vertex = groundShape->getVertex(x, z);
+            AssertHelper::assertPoint3FloatEquals(scaledGroundShape.getVertex(x, z), Point3(vertex.X * 2.0f, vertex.Y * 3.0f, vertex.Z * 0.5f), 0.00001f);
+        }
+    }
+    AABBox<float> scaledAABBox = scaledGroundShape.toAABBox(PhysicsTransform());
+    AssertHelper::assertFloatEquals(scaledAABBox.getHalfSize(0), 16.0f);
+    AssertHelper::assertFloatEquals(scaledAABBox.getHalfSize(2), 4.0f);
+}
+
+float CollisionHeightfieldShapeTest::computeHeight(float x, float z) {
+    return 0.2f * std::sin(x) * std::cos(z) + 0.05f * x;
+}
+
+/**
+ * @return Ground composed of cells of 1x1 units centered on the origin
+ */
+std::unique_ptr<CollisionHeightfieldShape> CollisionHeightfieldShapeTest::buildWavyGround(unsigned int cellsCount) const {
+    std::vector<Point3<float>> vertices;
+    float halfSize = (float)cellsCount / 2.0f;
+    for (unsigned int z = 0; z <= cellsCount; ++z) {
+        for (unsigned int x = 0; x <= cellsCount; ++x) {
+            float xValue = (float)x - halfSize;
+            float zValue = (float)z - halfSize;
+            vertices.emplace_back(xValue, computeHeight(xValue, zValue), zValue);
+        }
+    }
+
+    return std::make_unique<CollisionHeightfieldShape>(vertices, cellsCount + 1, cellsCount + 1);
+}
+
+bool CollisionHeightfieldShapeTest::containsTriangle(const std::vector<CollisionTriangleShape>& triangles, const Point3<float>& point1, const Point3<float>& point2, const Point3<float>& point3) {
+    return std::ranges::any_of(triangles, [&](const CollisionTriangleShape& triangle) {
+        const auto& points = static_cast<const TriangleShape3D<float>&>(triangle.getSingleShape()).getPoints();
+        return points[0] == point1 && points[1] == point2 && points[2] == point3;
+    });
+}
+
+CppUnit::Test* CollisionHeightfieldShapeTest::suite() {
+    auto* suite = new CppUnit::TestSuite("CollisionHeightfieldShapeTest");
+
+    suite->addTest(new CppUnit::TestCaller("quantizedHeights", &CollisionHeightfieldShapeTest::quantizedHeights));
+    suite->addTest(new CppUnit::TestCaller("quadtreeDepth", &CollisionHeightfieldShapeTest::quadtreeDepth));
+    suite->addTest(new CppUnit::TestCaller("findTrianglesInAABBox", &CollisionHeightfieldShapeTest::findTrianglesInAABBox));
+    suite->addTest(new CppUnit::TestCaller("findTrianglesHitByRay", &CollisionHeightfieldShapeTest::findTrianglesHitByRay));
+    suite->addTest(new CppUnit::TestCaller("findTrianglesHitByVerticalRay", &CollisionHeightfieldShapeTest::findTrianglesHitByVerticalRay));
+    suite->addTest(new CppUnit::TestCaller("cloneHeights", &CollisionHeightfieldShapeTest::cloneHeights));
+    suite->addTest(new CppUnit::TestCaller("scaleHeights", &CollisionHeightfieldShapeTest::scaleHeights));
+
+    return suite;
+}
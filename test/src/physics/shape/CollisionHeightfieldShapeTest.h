@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class CollisionHeightfieldShapeTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void quantizedHeights();
+        void quadtreeDepth();
+        void findTrianglesInAABBox();
+        void findTrianglesHitByRay();
+        void findTrianglesHitByVerticalRay();
+        void cloneHeights();
+        void scaleHeights();
+
+    private:
+        static float computeHeight(float, float);
+        std::unique_ptr<urchin::CollisionHeightfieldShape> buildWavyGround(unsigned int) const;
+        static bool containsTriangle(const std::vector<urchin::CollisionTriangleShape>&, const urchin::Point3<float>&, const urchin::Point3<float>&, const urchin::Point3<float>&);
+};
@@ -0,0 +1,109 @@
+#include <cmath>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <UrchinCommon.h>
+#include <UrchinPhysicsEngine.h>
+
+#include "AssertHelper.h"
+#include "physics/shape/CollisionTriangleMeshShapeTest.h"
+using namespace urchin;
+
+void CollisionTriangleMeshShapeTest::balancedBvh() {
+    auto groundShape = buildWavyGround(64); //8192 triangles
+
+    AssertHelper::assertTrue(groundShape->getBvhHeight() <= 2 * 11 /* 2 * log2(8192 / 4) */, "BVH height too big: " + std::to_string(groundShape->getBvhHeight()));
+}
+
+void CollisionTriangleMeshShapeTest::findTrianglesInAABBox() {
+    auto groundShape = buildWavyGround(16);
+    AABBox<float> checkAABBox(Point3(-2.3f, -5.0f, 1.1f), Point3(0.6f, 5.0f, 2.9f));
+
+    std::vector<CollisionTriangleShape> triangles;
+    groundShape->findTrianglesInAABBox(checkAABBox, triangles);
+
+    std::size_t expectedTrianglesCount = 0;
+    for (const IndexedTriangle3D<float>& triangle : groundShape->getTriangles()) {
+        AABBox<float> triangleAABBox(std::vector{groundShape->getVertices()[triangle.getIndex(0)], groundShape->getVertices()[triangle.getIndex(1)], groundShape->getVertices()[triangle.getIndex(2)]});
+        if (triangleAABBox.collideWithAABBox(checkAABBox)) {
+            expectedTrianglesCount++;
+        }
+    }
+    AssertHelper::assertUnsignedIntEquals(expectedTrianglesCount, 4 /* x cells */ * 2 /* z cells */ * 2);
+    AssertHelper::assertUnsignedIntEquals(triangles.size(), expectedTrianglesCount);
+}
+
+void CollisionTriangleMeshShapeTest::findTrianglesHitByRay() {
+    auto groundShape = buildWavyGround(16);
+    LineSegment3D<float> ray(Point3(0.5f, 10.0f, 0.5f), Point3(0.5f, -10.0f, 0.5f));
+
+    std::vector<CollisionTriangleShape> triangles;
+    groundShape->findTrianglesHitByRay(ray, triangles);
+
+    AssertHelper::assertTrue(!triangles.empty());
+    AssertHelper::assertTrue(triangles.size() <= 4 /* max triangles by leaf */ * 2 /* ray on leaf border */);
+    bool triangleBelowRay = std::ranges::any_of(triangles, [](const CollisionTriangleShape& triangle) {
+        const auto& points = static_cast<const TriangleShape3D<float>&>(triangle.getSingleShape()).getPoints();
+        return std::ranges::all_of(points, [](const Point3<float>& point) { return point.X >= 0.0f && point.X <= 1.0f && point.Z >= 0.0f && point.Z <= 1.0f; });
+    });
+    AssertHelper::assertTrue(triangleBelowRay);
+}
+
+void CollisionTriangleMeshShapeTest::cubeOnTriangleMesh() {
+    BodyContainer bodyContainer;
+    bodyContainer.addBody(std::make_unique<RigidBody>("ground", PhysicsTransform(Point3(0.0f, 0.0f, 0.0f), Quaternion<float>()), buildWavyGround(16)));
+    auto cubeBody = std::make_unique<RigidBody>("cube", PhysicsTransform(Point3(0.0f, 0.49f, 0.0f), Quaternion<float>()), std::make_unique<CollisionBoxShape>(Vector3(0.5f, 0.5f, 0.5f)));
+    cubeBody->setMass(1.0f);
+    bodyContainer.addBody(std::move(cubeBody));
+    BroadPhase broadPhase(bodyContainer);
+    bodyContainer.refreshBodies();
+    WorkerPool workerPool(1);
+    NarrowPhase narrowPhase(bodyContainer, broadPhase, workerPool);
+    std::vector<ManifoldResult> manifoldResults;
+
+    narrowPhase.process(1.0f / 60.0f, broadPhase.computeOverlappingPairs(), manifoldResults);
+
+    AssertHelper::assertUnsignedIntEquals(manifoldResults.size(), 1);
+    AssertHelper::assertTrue(manifoldResults[0].getNumContactPoints() > 0);
+    const ManifoldContactPoint& contactPoint = manifoldResults[0].getManifoldContactPoint(0);
+    AssertHelper::assertFloatEquals(std::abs(contactPoint.getNormalFromObject2().Y), 1.0f, 0.01f);
+    AssertHelper::assertFloatEquals(contactPoint.getDepth(), -0.01f, 0.001f);
+}
+
+/**
+ * @return Ground composed of cells of 1x1 units centered on the origin. Height of the vertices is null in the center area [-3, 3] and wavy elsewhere.
+ */
+std::unique_ptr<CollisionTriangleMeshShape> CollisionTriangleMeshShapeTest::buildWavyGround(unsigned int cellsCount) const {
+    std::vector<Point3<float>> vertices;
+    float halfSize = (float)cellsCount / 2.0f;
+    for (unsigned int z = 0; z <= cellsCount; ++z) {
+        for (unsigned int x = 0; x <= cellsCount; ++x) {
+            float xValue = (float)x - halfSize;
+            float zValue = (float)z - halfSize;
+            bool centerArea = std::abs(xValue) <= 3.0f && std::abs(zValue) <= 3.0f;
+            vertices.emplace_back(xValue, centerArea ? 0.0f : 0.2f * std::sin(xValue) * std::cos(zValue), zValue);
+        }
+    }
+
+    std::vector<IndexedTriangle3D<float>> triangles;
+    for (std::size_t z = 0; z < cellsCount; ++z) {
+        for (std::size_t x = 0; x < cellsCount; ++x) {
+            std::size_t farLeft = x + (cellsCount + 1) * z;
+            std::size_t nearLeft = farLeft + cellsCount + 1;
+            triangles.emplace_back(farLeft, nearLeft, farLeft + 1);
+            triangles.emplace_back(farLeft + 1, nearLeft, nearLeft + 1);
+        }
+    }
+
+    return std::make_unique<CollisionTriangleMeshShape>(std::move(vertices), std::move(triangles));
+}
+
+CppUnit::Test* CollisionTriangleMeshShapeTest::suite() {
+    auto* suite = new CppUnit::TestSuite("CollisionTriangleMeshShapeTest");
+
+    suite->addTest(new CppUnit::TestCaller("balancedBvh", &CollisionTriangleMeshShapeTest::balancedBvh));
+    suite->addTest(new CppUnit::TestCaller("findTrianglesInAABBox", &CollisionTriangleMeshShapeTest::findTrianglesInAABBox));
+    suite->addTest(new CppUnit::TestCaller("findTrianglesHitByRay", &CollisionTriangleMeshShapeTest::findTrianglesHitByRay));
+    suite->addTest(new CppUnit::TestCaller("cubeOnTriangleMesh", &CollisionTriangleMeshShapeTest::cubeOnTriangleMesh));
+
+    return suite;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <UrchinPhysicsEngine.h>
+
+class CollisionTriangleMeshShapeTest final : public CppUnit::TestFixture {
+    public:
+        static CppUnit::Test* suite();
+
+        void balancedBvh();
+        void findTrianglesInAABBox();
+        void findTrianglesHitByRay();
+        void cubeOnTriangleMesh();
+
+    private:
+        std::unique_ptr<urchin::CollisionTriangleMeshShape> buildWavyGround(unsigned int) const;
+};
@@ -54,12 +54,26 @@ void ShapeToAABBoxTest::convexHullConversion() {
     AssertHelper::assertPoint3FloatEquals(box.getMax(), Point3(2.12132034356f, 2.12132034356f, 1.0f));
 }
 
+void ShapeToAABBoxTest::triangleMeshConversion() {
+    std::vector vertices = {Point3(1.0f, 0.0f, 0.0f), Point3(3.0f, 0.0f, 0.0f), Point3(1.0f, 1.0f, 0.0f), Point3(1.0f, 0.0f, 2.0f)};
+    std::vector trianglesIndices = {IndexedTriangle3D<float>(0, 1, 2), IndexedTriangle3D<float>(0, 2, 3)};
+    CollisionTriangleMeshShape collisionTriangleMesh(vertices, trianglesIndices);
+    PhysicsTransform transform(Point3(0.0f, 5.0f, 0.0f), //move 5 units on Y axis
+            Quaternion<float>::rotationY(MathValue::PI_FLOAT / 2.0f)); //rotate 90° on Y axis
+
+    AABBox<float> box = collisionTriangleMesh.toAABBox(transform);
+
+    AssertHelper::assertPoint3FloatEquals(box.getMin(), Point3(0.0f, 5.0f, -3.0f));
+    AssertHelper::assertPoint3FloatEquals(box.getMax(), Point3(2.0f, 6.0f, -1.0f));
+}
+
 CppUnit::Test* ShapeToAABBoxTest::suite() {
     auto* suite = new CppUnit::TestSuite("ShapeToAABBoxTest");
 
     suite->addTest(new CppUnit::TestCaller("boxConversion", &ShapeToAABBoxTest::boxConversion));
     suite->addTest(new CppUnit::TestCaller("coneConversion", &ShapeToAABBoxTest::coneConversion));
     suite->addTest(new CppUnit::TestCaller("convexHullConversion", &ShapeToAABBoxTest::convexHullConversion));
+    suite->addTest(new CppUnit::TestCaller("triangleMeshConversion", &ShapeToAABBoxTest::triangleMeshConversion));
 
     return suite;
 }
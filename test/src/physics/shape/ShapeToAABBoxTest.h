@@ -10,4 +10,5 @@ class ShapeToAABBoxTest final : public CppUnit::TestFixture {
         void boxConversion();
         void coneConversion();
         void convexHullConversion();
+        void triangleMeshConversion();
 };